@@ -185,6 +185,10 @@ co="-DHYPRE_BIGINT=ON"
 ./test.sh cmake.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh cmake $output_dir/cmake-bigint
 
+co="-DHYPRE_ENABLE_NEIGHBOR_COLL=ON"
+./test.sh cmake.sh $src_dir -co: $co -mo: $mo -ro: $ro
+./renametest.sh cmake $output_dir/cmake-neighbor-coll
+
 # cmake build doesn't currently support maxdim
 # cmake build doesn't currently support complex
 
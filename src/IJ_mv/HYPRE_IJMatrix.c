@@ -587,6 +587,96 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_IJMatrixSetValuesCSR( HYPRE_IJMatrix       matrix,
+                            HYPRE_Int            nrows,
+                            const HYPRE_BigInt  *rows,
+                            const HYPRE_Int     *row_ptr,
+                            const HYPRE_BigInt  *cols,
+                            const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (nrows == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nrows < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (!rows)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (!row_ptr)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (!cols)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if (!values)
+   {
+      hypre_error_in_arg(6);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_CUDA)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_IJMatrixMemoryLocation(matrix) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      HYPRE_MemoryLocation memory_location = hypre_IJMatrixMemoryLocation(matrix);
+      HYPRE_Int *row_ptr_h = hypre_TAlloc(HYPRE_Int, nrows+1, HYPRE_MEMORY_HOST);
+      HYPRE_Int *ncols     = hypre_TAlloc(HYPRE_Int, nrows,   memory_location);
+      HYPRE_Int  i;
+
+      hypre_TMemcpy(row_ptr_h, row_ptr, HYPRE_Int, nrows+1, HYPRE_MEMORY_HOST, memory_location);
+      for (i = 0; i < nrows; i++)
+      {
+         row_ptr_h[i] = row_ptr_h[i+1] - row_ptr_h[i];
+      }
+      hypre_TMemcpy(ncols, row_ptr_h, HYPRE_Int, nrows, memory_location, HYPRE_MEMORY_HOST);
+
+      hypre_IJMatrixSetAddValuesParCSRDevice(ijmatrix, nrows, ncols, rows, row_ptr, cols, values, "set");
+
+      hypre_TFree(row_ptr_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(ncols, memory_location);
+   }
+   else
+#endif
+   {
+      hypre_IJMatrixSetValuesCSRParCSR(ijmatrix, nrows, rows, row_ptr, cols, values);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 HYPRE_Int
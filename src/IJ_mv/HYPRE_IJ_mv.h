@@ -178,6 +178,30 @@ HYPRE_Int HYPRE_IJMatrixSetValues2(HYPRE_IJMatrix       matrix,
                                    const HYPRE_BigInt  *cols,
                                    const HYPRE_Complex *values);
 
+/**
+ * Sets values for \e nrows rows of the matrix given as a CSR block: the
+ * entries of row \e rows[i] are \e cols[k] and \e values[k] for
+ * \e row_ptr[i] <= k < \e row_ptr[i+1].  The row numbers must be in
+ * increasing order.
+ *
+ * If no values have been set since HYPRE_IJMatrixInitialize, the locally
+ * owned rows of the block are stored directly, without the searches and
+ * auxiliary row storage used by HYPRE_IJMatrixSetValues.  In that case the
+ * block defines the complete sparsity pattern of the local rows: rows not
+ * in the block are empty, and later calls to SetValues or AddToValues can
+ * only change entries that are present in the block.  Duplicate entries in
+ * a row are not combined.  Otherwise, and for rows owned by other
+ * processors, this is equivalent to HYPRE_IJMatrixSetValues2.
+ *
+ * Not collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetValuesCSR(HYPRE_IJMatrix       matrix,
+                                     HYPRE_Int            nrows,
+                                     const HYPRE_BigInt  *rows,
+                                     const HYPRE_Int     *row_ptr,
+                                     const HYPRE_BigInt  *cols,
+                                     const HYPRE_Complex *values);
+
 /**
  * Adds to values for \e nrows rows or partial rows of the matrix.  
  *
@@ -1113,6 +1113,284 @@ hypre_IJMatrixSetValuesParCSR( hypre_IJMatrix       *matrix,
    return hypre_error_flag;
 }
 
+/******************************************************************************
+ *
+ * hypre_IJMatrixSetValuesCSRRowsParCSR
+ *
+ * passes rows of a CSR block to the entry-wise SetValues routines
+ *
+ *****************************************************************************/
+
+static HYPRE_Int
+hypre_IJMatrixSetValuesCSRRowsParCSR( hypre_IJMatrix       *matrix,
+                                      HYPRE_Int             nrows,
+                                      const HYPRE_BigInt   *rows,
+                                      const HYPRE_Int      *row_ptr,
+                                      const HYPRE_BigInt   *cols,
+                                      const HYPRE_Complex  *values )
+{
+   HYPRE_Int *ncols;
+   HYPRE_Int  i;
+
+   if (nrows < 1)
+   {
+      return hypre_error_flag;
+   }
+
+   ncols = hypre_TAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < nrows; i++)
+   {
+      ncols[i] = row_ptr[i+1] - row_ptr[i];
+   }
+
+   if (hypre_IJMatrixOMPFlag(matrix))
+   {
+      hypre_IJMatrixSetValuesOMPParCSR(matrix, nrows, ncols, rows, row_ptr, cols, values);
+   }
+   else
+   {
+      hypre_IJMatrixSetValuesParCSR(matrix, nrows, ncols, rows, row_ptr, cols, values);
+   }
+
+   hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixSetValuesCSRParCSR
+ *
+ * sets the values of a CSR block of rows, given in increasing order, before
+ * assembly.  If no values have been set yet, the locally owned rows of the
+ * block are split into diag and offd directly (two passes over the block,
+ * no searches) and all other local rows are left empty.  Otherwise, and for
+ * rows owned by other processors, the block is passed to SetValues.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixSetValuesCSRParCSR( hypre_IJMatrix       *matrix,
+                                  HYPRE_Int             nrows,
+                                  const HYPRE_BigInt   *rows,
+                                  const HYPRE_Int      *row_ptr,
+                                  const HYPRE_BigInt   *cols,
+                                  const HYPRE_Complex  *values )
+{
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *)    hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt          *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   hypre_CSRMatrix       *diag, *offd;
+   HYPRE_Int             *diag_i, *offd_i;
+   HYPRE_Int             *diag_j;
+   HYPRE_Complex         *diag_data;
+   HYPRE_BigInt          *big_offd_j;
+   HYPRE_Complex         *offd_data;
+   HYPRE_Int             *row_length;
+   HYPRE_Int             *indx_diag, *indx_offd;
+   HYPRE_BigInt           row_0, row_n, col_0, col_n;
+   HYPRE_Int              num_rows, row_local;
+   HYPRE_Int              i, j, r0, r1;
+   HYPRE_Int              pos_diag, pos_offd, cnt_diag, cnt_offd;
+   HYPRE_Int              fresh;
+   HYPRE_Complex          temp;
+#ifndef HYPRE_NO_GLOBAL_PARTITION
+   HYPRE_Int              my_id;
+
+   hypre_MPI_Comm_rank(hypre_IJMatrixComm(matrix), &my_id);
+   row_0 = row_partitioning[my_id];
+   row_n = row_partitioning[my_id+1]-1;
+   col_0 = col_partitioning[my_id];
+   col_n = col_partitioning[my_id+1]-1;
+#else
+   row_0 = row_partitioning[0];
+   row_n = row_partitioning[1]-1;
+   col_0 = col_partitioning[0];
+   col_n = col_partitioning[1]-1;
+#endif
+
+   /* the direct path requires a freshly initialized matrix on the host and
+      rows in increasing order */
+   fresh = (!hypre_IJMatrixAssembleFlag(matrix) && aux_matrix &&
+            hypre_AuxParCSRMatrixMemoryLocation(aux_matrix) == HYPRE_MEMORY_HOST &&
+            hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(par_matrix)) == hypre_MEMORY_HOST);
+   for (i = 1; i < nrows && fresh; i++)
+   {
+      if (rows[i] <= rows[i-1])
+      {
+         fresh = 0;
+      }
+   }
+
+   num_rows = (HYPRE_Int)(row_n - row_0 + 1);
+   diag   = hypre_ParCSRMatrixDiag(par_matrix);
+   offd   = hypre_ParCSRMatrixOffd(par_matrix);
+   diag_i = hypre_CSRMatrixI(diag);
+   offd_i = hypre_CSRMatrixI(offd);
+   if (fresh)
+   {
+      if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
+      {
+         row_length = hypre_AuxParCSRMatrixRowLength(aux_matrix);
+         for (i = 0; i < num_rows && row_length; i++)
+         {
+            if (row_length[i])
+            {
+               fresh = 0;
+               break;
+            }
+         }
+      }
+      else
+      {
+         indx_diag = hypre_AuxParCSRMatrixIndxDiag(aux_matrix);
+         indx_offd = hypre_AuxParCSRMatrixIndxOffd(aux_matrix);
+         for (i = 0; i < num_rows; i++)
+         {
+            if (indx_diag[i] != diag_i[i] || indx_offd[i] != offd_i[i])
+            {
+               fresh = 0;
+               break;
+            }
+         }
+      }
+   }
+
+   if (!fresh)
+   {
+      return hypre_IJMatrixSetValuesCSRRowsParCSR(matrix, nrows, rows, row_ptr, cols, values);
+   }
+
+   /* since rows are sorted, the locally owned ones are rows[r0..r1-1] */
+   for (r0 = 0; r0 < nrows && rows[r0] < row_0; r0++);
+   for (r1 = r0; r1 < nrows && rows[r1] <= row_n; r1++);
+
+   /* first pass: row counts */
+   for (i = 0; i <= num_rows; i++)
+   {
+      diag_i[i] = 0;
+      offd_i[i] = 0;
+   }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, row_local, cnt_diag, cnt_offd) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = r0; i < r1; i++)
+   {
+      row_local = (HYPRE_Int)(rows[i] - row_0);
+      cnt_diag = 0;
+      cnt_offd = 0;
+      for (j = row_ptr[i]; j < row_ptr[i+1]; j++)
+      {
+         if (cols[j] < col_0 || cols[j] > col_n)
+         {
+            cnt_offd++;
+         }
+         else
+         {
+            cnt_diag++;
+         }
+      }
+      diag_i[row_local+1] = cnt_diag;
+      offd_i[row_local+1] = cnt_offd;
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      diag_i[i+1] += diag_i[i];
+      offd_i[i+1] += offd_i[i];
+   }
+
+   hypre_TFree(hypre_CSRMatrixJ(diag),    hypre_CSRMatrixMemoryLocation(diag));
+   hypre_TFree(hypre_CSRMatrixData(diag), hypre_CSRMatrixMemoryLocation(diag));
+   hypre_TFree(hypre_CSRMatrixJ(offd),    hypre_CSRMatrixMemoryLocation(offd));
+   hypre_TFree(hypre_CSRMatrixData(offd), hypre_CSRMatrixMemoryLocation(offd));
+   hypre_TFree(hypre_CSRMatrixBigJ(offd), hypre_CSRMatrixMemoryLocation(offd));
+
+   diag_j     = hypre_CTAlloc(HYPRE_Int,     diag_i[num_rows], hypre_CSRMatrixMemoryLocation(diag));
+   diag_data  = hypre_CTAlloc(HYPRE_Complex, diag_i[num_rows], hypre_CSRMatrixMemoryLocation(diag));
+   big_offd_j = hypre_CTAlloc(HYPRE_BigInt,  offd_i[num_rows], hypre_CSRMatrixMemoryLocation(offd));
+   offd_data  = hypre_CTAlloc(HYPRE_Complex, offd_i[num_rows], hypre_CSRMatrixMemoryLocation(offd));
+
+   /* second pass: split into diag and offd, diagonal element first */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, row_local, pos_diag, pos_offd, temp) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = r0; i < r1; i++)
+   {
+      row_local = (HYPRE_Int)(rows[i] - row_0);
+      pos_diag = diag_i[row_local];
+      pos_offd = offd_i[row_local];
+      for (j = row_ptr[i]; j < row_ptr[i+1]; j++)
+      {
+         if (cols[j] < col_0 || cols[j] > col_n)
+         {
+            big_offd_j[pos_offd] = cols[j];
+            offd_data[pos_offd++] = values[j];
+         }
+         else
+         {
+            diag_j[pos_diag] = (HYPRE_Int)(cols[j] - col_0);
+            diag_data[pos_diag] = values[j];
+            if (diag_j[pos_diag] == row_local && pos_diag > diag_i[row_local])
+            {
+               temp = diag_data[diag_i[row_local]];
+               diag_data[diag_i[row_local]] = diag_data[pos_diag];
+               diag_data[pos_diag] = temp;
+               diag_j[pos_diag] = diag_j[diag_i[row_local]];
+               diag_j[diag_i[row_local]] = row_local;
+            }
+            pos_diag++;
+         }
+      }
+   }
+
+   hypre_CSRMatrixJ(diag) = diag_j;
+   hypre_CSRMatrixData(diag) = diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = diag_i[num_rows];
+   hypre_CSRMatrixJ(offd) = NULL;
+   hypre_CSRMatrixBigJ(offd) = big_offd_j;
+   hypre_CSRMatrixData(offd) = offd_data;
+   hypre_CSRMatrixNumNonzeros(offd) = offd_i[num_rows];
+
+   /* the auxiliary row storage is not needed anymore; later SetValues and
+      AddToValues calls can only change the entries set here */
+   if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
+   {
+      if (hypre_AuxParCSRMatrixAuxJ(aux_matrix))
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            hypre_TFree(hypre_AuxParCSRMatrixAuxJ(aux_matrix)[i], HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_AuxParCSRMatrixAuxData(aux_matrix)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_AuxParCSRMatrixAuxJ(aux_matrix), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AuxParCSRMatrixAuxData(aux_matrix), HYPRE_MEMORY_HOST);
+      }
+      hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 0;
+   }
+   if (!hypre_AuxParCSRMatrixIndxDiag(aux_matrix))
+   {
+      hypre_AuxParCSRMatrixIndxDiag(aux_matrix) = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   }
+   if (!hypre_AuxParCSRMatrixIndxOffd(aux_matrix))
+   {
+      hypre_AuxParCSRMatrixIndxOffd(aux_matrix) = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   }
+   indx_diag = hypre_AuxParCSRMatrixIndxDiag(aux_matrix);
+   indx_offd = hypre_AuxParCSRMatrixIndxOffd(aux_matrix);
+   for (i = 0; i < num_rows; i++)
+   {
+      indx_diag[i] = diag_i[i+1];
+      indx_offd[i] = offd_i[i+1];
+   }
+
+   /* rows owned by other processors go to the off-processor stash */
+   hypre_IJMatrixSetValuesCSRRowsParCSR(matrix, r0, rows, row_ptr, cols, values);
+   hypre_IJMatrixSetValuesCSRRowsParCSR(matrix, nrows-r1, rows+r1, row_ptr+r1, cols, values);
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  *
  * hypre_IJMatrixSetConstantValuesParCSR
@@ -1725,6 +2003,140 @@ hypre_IJMatrixDestroyParCSR(hypre_IJMatrix *matrix)
    return hypre_error_flag;
 }
 
+/******************************************************************************
+ *
+ * hypre_IJMatrixAddOffProcTriplesParCSR
+ *
+ * adds (row, col, value) triples received from other processors to the
+ * local rows. The triples are bucketed by row with a counting sort, sorted
+ * by column within each row, duplicate entries are summed, and the merged
+ * rows are added with a single AddToValues call.
+ *
+ *****************************************************************************/
+
+static HYPRE_Int
+hypre_IJMatrixAddOffProcTriplesParCSR( hypre_IJMatrix *matrix,
+                                       HYPRE_Int       num_elmts,
+                                       HYPRE_BigInt   *rows,
+                                       HYPRE_BigInt   *cols,
+                                       HYPRE_Complex  *values )
+{
+   HYPRE_BigInt  *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt   first_row;
+   HYPRE_Int      local_num_rows;
+   HYPRE_Int     *row_starts, *perm;
+   HYPRE_Int     *add_ncols, *add_row_indexes;
+   HYPRE_BigInt  *add_rows, *add_cols;
+   HYPRE_Complex *add_values;
+   HYPRE_Int      i, j, k, lrow, num_add_rows, nnz;
+
+   if (num_elmts < 1)
+   {
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   first_row = row_partitioning[0];
+   local_num_rows = (HYPRE_Int)(row_partitioning[1]-row_partitioning[0]);
+#else
+   HYPRE_Int my_id;
+   hypre_MPI_Comm_rank(hypre_IJMatrixComm(matrix), &my_id);
+   first_row = row_partitioning[my_id];
+   local_num_rows = (HYPRE_Int)(row_partitioning[my_id+1]-row_partitioning[my_id]);
+#endif
+
+   /* count the entries per local row */
+   row_starts = hypre_CTAlloc(HYPRE_Int, local_num_rows+1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_elmts; i++)
+   {
+      lrow = (HYPRE_Int)(rows[i] - first_row);
+      if (lrow < 0 || lrow >= local_num_rows)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Received off-proc. row not owned by this processor\n");
+         hypre_TFree(row_starts, HYPRE_MEMORY_HOST);
+         return hypre_error_flag;
+      }
+      row_starts[lrow+1]++;
+   }
+   num_add_rows = 0;
+   for (j = 0; j < local_num_rows; j++)
+   {
+      if (row_starts[j+1])
+      {
+         num_add_rows++;
+      }
+      row_starts[j+1] += row_starts[j];
+   }
+
+   /* stable bucket sort of the triples by row */
+   perm = hypre_TAlloc(HYPRE_Int, num_elmts, HYPRE_MEMORY_HOST);
+   add_cols = hypre_TAlloc(HYPRE_BigInt, num_elmts, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_elmts; i++)
+   {
+      lrow = (HYPRE_Int)(rows[i] - first_row);
+      k = row_starts[lrow]++;
+      perm[k] = i;
+      add_cols[k] = cols[i];
+   }
+   for (j = local_num_rows; j > 0; j--)
+   {
+      row_starts[j] = row_starts[j-1];
+   }
+   row_starts[0] = 0;
+
+   /* sort each row by column and sum duplicates (segmented reduction);
+      the merged columns are compacted in place in add_cols */
+   add_rows = hypre_TAlloc(HYPRE_BigInt, num_add_rows, HYPRE_MEMORY_HOST);
+   add_ncols = hypre_TAlloc(HYPRE_Int, num_add_rows, HYPRE_MEMORY_HOST);
+   add_row_indexes = hypre_TAlloc(HYPRE_Int, num_add_rows, HYPRE_MEMORY_HOST);
+   add_values = hypre_TAlloc(HYPRE_Complex, num_elmts, HYPRE_MEMORY_HOST);
+
+   nnz = 0;
+   num_add_rows = 0;
+   for (j = 0; j < local_num_rows; j++)
+   {
+      if (row_starts[j+1] == row_starts[j])
+      {
+         continue;
+      }
+      hypre_BigQsortbi(add_cols, perm, row_starts[j], row_starts[j+1]-1);
+
+      add_rows[num_add_rows] = first_row + (HYPRE_BigInt) j;
+      add_row_indexes[num_add_rows] = nnz;
+      add_cols[nnz] = add_cols[row_starts[j]];
+      add_values[nnz] = values[perm[row_starts[j]]];
+      for (k = row_starts[j]+1; k < row_starts[j+1]; k++)
+      {
+         if (add_cols[k] == add_cols[nnz])
+         {
+            add_values[nnz] += values[perm[k]];
+         }
+         else
+         {
+            nnz++;
+            add_cols[nnz] = add_cols[k];
+            add_values[nnz] = values[perm[k]];
+         }
+      }
+      nnz++;
+      add_ncols[num_add_rows] = nnz - add_row_indexes[num_add_rows];
+      num_add_rows++;
+   }
+
+   hypre_IJMatrixAddToValuesParCSR(matrix, num_add_rows, add_ncols, add_rows, add_row_indexes,
+                                   add_cols, add_values);
+
+   hypre_TFree(row_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_ncols, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_row_indexes, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_values, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  *
  * hypre_IJMatrixAssembleOffProcValsParCSR
@@ -1750,8 +2162,9 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    MPI_Comm comm = hypre_IJMatrixComm(matrix);
    hypre_MPI_Request *requests = NULL;
    hypre_MPI_Status *status = NULL;
-   HYPRE_Int i, ii, j, j2, jj, n, row_index = 0;
+   HYPRE_Int i, ii, j, j2, jj, n;
    HYPRE_BigInt row;
+   HYPRE_Int num_recv_elmts;
    HYPRE_Int iii, iid, indx, ip;
    HYPRE_Int proc_id, num_procs, my_id;
    HYPRE_Int num_sends, num_sends3;
@@ -1766,6 +2179,8 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int *recv_procs;
    HYPRE_Int *recv_chunks;
    HYPRE_BigInt *recv_i;
+   HYPRE_BigInt *recv_rows;
+   HYPRE_BigInt *recv_cols;
    HYPRE_Int *recv_vec_starts;
    HYPRE_Int *dbl_recv_vec_starts;
    HYPRE_Int *info;
@@ -1892,6 +2307,7 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    send_data = hypre_CTAlloc(HYPRE_Complex, dbl_send_map_starts[num_sends], HYPRE_MEMORY_HOST);
    recv_i = hypre_CTAlloc(HYPRE_BigInt, recv_vec_starts[num_recvs], HYPRE_MEMORY_HOST);
    recv_data = hypre_CTAlloc(HYPRE_Complex, dbl_recv_vec_starts[num_recvs], HYPRE_MEMORY_HOST);
+   num_recv_elmts = dbl_recv_vec_starts[num_recvs];
 
    j=0;
    jj=0;
@@ -1991,6 +2407,10 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_TFree(recv_vec_starts, HYPRE_MEMORY_HOST);
    hypre_TFree(dbl_recv_vec_starts, HYPRE_MEMORY_HOST);
 
+   /* expand the received rows into (row, col) pairs matching recv_data and
+      merge them into the local rows */
+   recv_rows = hypre_TAlloc(HYPRE_BigInt, num_recv_elmts, HYPRE_MEMORY_HOST);
+   recv_cols = hypre_TAlloc(HYPRE_BigInt, num_recv_elmts, HYPRE_MEMORY_HOST);
    j = 0;
    j2 = 0;
    for (i=0; i < num_recvs; i++)
@@ -1998,15 +2418,22 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
       for (ii=0; ii < recv_chunks[i]; ii++)
       {
          row = recv_i[j];
-         HYPRE_Int rcvi = (HYPRE_Int) recv_i[j+1];
-         hypre_IJMatrixAddToValuesParCSR(matrix,1,&rcvi,&row,&row_index,
-                                         &recv_i[j+2],&recv_data[j2]);
-         j2 += recv_i[j+1];
-         j += recv_i[j+1]+2;
+         n = (HYPRE_Int) recv_i[j+1];
+         for (jj=0; jj < n; jj++)
+         {
+            recv_rows[j2] = row;
+            recv_cols[j2++] = recv_i[j+2+jj];
+         }
+         j += n+2;
       }
    }
    hypre_TFree(recv_chunks, HYPRE_MEMORY_HOST);
    hypre_TFree(recv_i, HYPRE_MEMORY_HOST);
+
+   hypre_IJMatrixAddOffProcTriplesParCSR(matrix, num_recv_elmts, recv_rows, recv_cols, recv_data);
+
+   hypre_TFree(recv_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_cols, HYPRE_MEMORY_HOST);
    hypre_TFree(recv_data, HYPRE_MEMORY_HOST);
 
    return hypre_error_flag;
@@ -2042,7 +2469,7 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int storage;
    HYPRE_Int indx;
    HYPRE_BigInt row;
-   HYPRE_Int num_ranges, row_index = 0;
+   HYPRE_Int num_ranges;
    HYPRE_Int num_recvs;
    HYPRE_BigInt upper_bound;
    HYPRE_Int counter;
@@ -2058,25 +2485,16 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int *recv_starts=NULL;
    HYPRE_BigInt *response_buf = NULL;
    HYPRE_Int *response_buf_starts=NULL;
-   HYPRE_Int *num_rows_per_proc = NULL, *num_elements_total = NULL;
+   HYPRE_Int *num_elements_total = NULL, *elmts_per_proc = NULL;
    HYPRE_Int *argsort_contact_procs = NULL;
 
    HYPRE_Int  obj_size_bytes, complex_size;
    HYPRE_BigInt big_int_size;
-   HYPRE_Int  tmp_int;
-   HYPRE_BigInt  tmp_big_int;
-   HYPRE_BigInt *col_ptr;
-   HYPRE_BigInt *big_int_data = NULL;
-   HYPRE_Int big_int_data_size = 0, complex_data_size = 0;
 
    void *void_contact_buf = NULL;
    void *index_ptr;
    void *recv_data_ptr;
 
-   HYPRE_Complex  tmp_complex;
-   HYPRE_Complex *col_data_ptr;
-   HYPRE_Complex *complex_data = NULL;
-
    hypre_DataExchangeResponse  response_obj1, response_obj2;
    hypre_ProcListElements      send_proc_obj;
 
@@ -2113,10 +2531,8 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
       hypre_TFree(tmp, HYPRE_MEMORY_HOST);
    }
 
-   /* call hypre_IJMatrixAddToValuesParCSR directly inside this function
-    * with one chunk of data */
+   /* the received entries are merged into the matrix with one chunk of data */
    HYPRE_Int      off_proc_nelm_recv_cur = 0;
-   HYPRE_Int      off_proc_nelm_recv_max = 0;
    HYPRE_BigInt  *off_proc_i_recv = NULL;
    HYPRE_BigInt  *off_proc_j_recv = NULL;
    HYPRE_Complex *off_proc_data_recv = NULL;
@@ -2278,14 +2694,13 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
    /* now we have the list of real processor ids (real_proc_id) - and the number
       of distinct ones - so now we can set up data to be sent - we have
-      HYPRE_Int data and HYPRE_Complex data.  that we will need to pack
+      HYPRE_BigInt data and HYPRE_Complex data.  that we will need to pack
       together */
 
-   /* first find out how many rows and elements we need to send per proc - so we
+   /* first find out how many elements we need to send per proc - so we
       can do storage */
 
    ex_contact_procs = hypre_CTAlloc(HYPRE_Int,  num_real_procs, HYPRE_MEMORY_HOST);
-   num_rows_per_proc = hypre_CTAlloc(HYPRE_Int,  num_real_procs, HYPRE_MEMORY_HOST);
    num_elements_total  =  hypre_CTAlloc(HYPRE_Int,  num_real_procs, HYPRE_MEMORY_HOST);
 
    counter = 0;
@@ -2293,7 +2708,6 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    if (num_real_procs > 0 )
    {
       ex_contact_procs[0] = real_proc_id[0];
-      num_rows_per_proc[0] = 1;
       num_elements_total[0] = row_list_num_elements[orig_order[0]];
 
       /* loop through real procs - these are sorted (row_list is sorted also)*/
@@ -2301,21 +2715,19 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
       {
          if (real_proc_id[i] == ex_contact_procs[counter]) /* same processor */
          {
-            num_rows_per_proc[counter] += 1; /*another row */
             num_elements_total[counter] += row_list_num_elements[orig_order[i]];
          }
          else /* new processor */
          {
             counter++;
             ex_contact_procs[counter] = real_proc_id[i];
-            num_rows_per_proc[counter] = 1;
             num_elements_total[counter] = row_list_num_elements[orig_order[i]];
          }
       }
    }
 
    /* to pack together, we need to use the largest obj. size of
-      (HYPRE_Int) and (HYPRE_Complex) - if these are much different, then we are
+      (HYPRE_BigInt) and (HYPRE_Complex) - if these are much different, then we are
       wasting some storage, but I do not think that it will be a
       large amount since this function should not be used on really
       large amounts of data anyway*/
@@ -2325,29 +2737,27 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    obj_size_bytes = hypre_max(big_int_size, complex_size);
 
    /* set up data to be sent to send procs */
-   /* for each proc, ex_contact_buf contains #rows, row #,
-      no. elements, col indicies, col data, row #, no. elements, col
-      indicies, col data, etc. */
+   /* for each proc, ex_contact_buf contains the no. of elements n followed
+      by n row numbers, n col indices and n values, i.e. the (row, col, value)
+      triples bucketed by owner */
 
-   /* first calculate total storage and make vec_starts arrays */
    storage = 0;
    ex_contact_vec_starts = hypre_CTAlloc(HYPRE_Int,  num_real_procs + 1, HYPRE_MEMORY_HOST);
-   ex_contact_vec_starts[0] = -1;
+   ex_contact_vec_starts[0] = 0;
 
    for (i=0; i < num_real_procs; i++)
    {
-      storage += 1 + 2 * num_rows_per_proc[i] + 2* num_elements_total[i];
-      ex_contact_vec_starts[i+1] = -storage-1; /* need negative for next loop */
+      storage += 1 + 3 * num_elements_total[i];
+      ex_contact_vec_starts[i+1] = storage;
    }
 
-   hypre_TFree(num_elements_total, HYPRE_MEMORY_HOST);
-
-   /*void_contact_buf = hypre_MAlloc(storage*obj_size_bytes);*/
-   void_contact_buf = hypre_CTAlloc(char, storage*obj_size_bytes, HYPRE_MEMORY_HOST);
-   index_ptr = void_contact_buf; /* step through with this index */
+   void_contact_buf = hypre_TAlloc(char, storage*obj_size_bytes, HYPRE_MEMORY_HOST);
 
-   /* for each proc: #rows, row #, no. elements,
-      col indicies, col data, row #, no. elements, col indicies, col data, etc. */
+   for (i=0; i < num_real_procs; i++)
+   {
+      index_ptr = (void *) ((char *) void_contact_buf + ex_contact_vec_starts[i]*obj_size_bytes);
+      *((HYPRE_Int *) index_ptr) = num_elements_total[i];
+   }
 
    /* un-sort real_proc_id - we want to access data arrays in order, so
       cheaper to do this*/
@@ -2358,67 +2768,30 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    }
    hypre_TFree(real_proc_id, HYPRE_MEMORY_HOST);
 
+   /* counting sort of the elements by owner: elmts_per_proc is the running
+      position within the bucket of each proc */
+   elmts_per_proc = hypre_CTAlloc(HYPRE_Int,  num_real_procs, HYPRE_MEMORY_HOST);
+
    counter = 0; /* index into data arrays */
-   prev_id = -1;
    for (i=0; i < num_rows; i++)
    {
-      proc_id = us_real_proc_id[i];
       /* can't use row list[i] - you loose the negative signs that differentiate
          add/set values */
       row = off_proc_i[i*2];
       num_elements = row_list_num_elements[i];
       /* find position of this processor */
-      indx = hypre_BinarySearch(ex_contact_procs, proc_id, num_real_procs);
-      in_i = ex_contact_vec_starts[indx];
-
-      index_ptr = (void *) ((char *) void_contact_buf + in_i*obj_size_bytes);
-
-      /* first time for this processor - add the number of rows to the buffer */
-      if (in_i < 0)
-      {
-         in_i = -in_i - 1;
-         /* re-calc. index_ptr since in_i was negative */
-         index_ptr = (void *) ((char *) void_contact_buf + in_i*obj_size_bytes);
+      indx = hypre_BinarySearch(ex_contact_procs, us_real_proc_id[i], num_real_procs);
+      in_i = ex_contact_vec_starts[indx] + 1 + elmts_per_proc[indx];
+      k = num_elements_total[indx]*obj_size_bytes;
 
-         tmp_int =  num_rows_per_proc[indx];
-         hypre_TMemcpy( index_ptr,  &tmp_int, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-
-         in_i++;
-      }
-      /* add row # */
-      hypre_TMemcpy( index_ptr,  &row, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-      index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-      in_i++;
-
-      /* add number of elements */
-      hypre_TMemcpy( index_ptr,  &num_elements, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-      index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-      in_i++;
-
-      /* now add col indices  */
       for (j=0; j< num_elements; j++)
       {
-         tmp_big_int = off_proc_j[counter+j]; /* col number */
-
-         hypre_TMemcpy( index_ptr,  &tmp_big_int, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-         in_i ++;
+         index_ptr = (void *) ((char *) void_contact_buf + (in_i+j)*obj_size_bytes);
+         *((HYPRE_BigInt *) index_ptr) = row;
+         *((HYPRE_BigInt *) ((char *) index_ptr + k)) = off_proc_j[counter];
+         *((HYPRE_Complex *) ((char *) index_ptr + 2*k)) = off_proc_data[counter++];
       }
-
-      /* now add data */
-      for (j=0; j< num_elements; j++)
-      {
-         tmp_complex = off_proc_data[counter++]; /* value */
-
-         hypre_TMemcpy( index_ptr,  &tmp_complex, HYPRE_Complex, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-         in_i++;
-      }
-
-      /* increment the indexes to keep track of where we are - we
-       * adjust below to be actual starts*/
-      ex_contact_vec_starts[indx] = in_i;
+      elmts_per_proc[indx] += num_elements;
    }
 
    /* some clean up */
@@ -2430,14 +2803,8 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_TFree(orig_order, HYPRE_MEMORY_HOST);
    hypre_TFree(row_list, HYPRE_MEMORY_HOST);
    hypre_TFree(row_list_num_elements, HYPRE_MEMORY_HOST);
-   hypre_TFree(num_rows_per_proc, HYPRE_MEMORY_HOST);
-
-   for (i=num_real_procs; i > 0; i--)
-   {
-      ex_contact_vec_starts[i] =   ex_contact_vec_starts[i-1];
-   }
-
-   ex_contact_vec_starts[0] = 0;
+   hypre_TFree(num_elements_total, HYPRE_MEMORY_HOST);
+   hypre_TFree(elmts_per_proc, HYPRE_MEMORY_HOST);
 
    /* now send the data */
 
@@ -2482,9 +2849,9 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_TFree(void_contact_buf, HYPRE_MEMORY_HOST);
    hypre_TFree(ex_contact_vec_starts, HYPRE_MEMORY_HOST);
 
-   /* Now we can unpack the send_proc_objects and call set
-      and add to values functions.  We unpack messages in a
-      deterministic order, using processor rank */
+   /* Now we can unpack the send_proc_objects into contiguous (row, col,
+      value) arrays.  We unpack messages in a deterministic order, using
+      processor rank */
 
    num_recvs = send_proc_obj.length;
    argsort_contact_procs = hypre_CTAlloc(HYPRE_Int,  num_recvs, HYPRE_MEMORY_HOST);
@@ -2497,112 +2864,43 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_qsort2i( send_proc_obj.id, argsort_contact_procs, 0, num_recvs-1 );
 
    /* alias */
-   recv_data_ptr = send_proc_obj.v_elements;
    recv_starts = send_proc_obj.vec_starts;
 
+   /* each message holds one header object and three objects per element */
+   off_proc_nelm_recv_cur = (recv_starts[num_recvs] - num_recvs)/3;
+   off_proc_i_recv    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_HOST);
+   off_proc_j_recv    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_HOST);
+   off_proc_data_recv = hypre_TAlloc(HYPRE_Complex, off_proc_nelm_recv_cur, HYPRE_MEMORY_HOST);
+
+   counter = 0;
    for (i=0; i < num_recvs; i++)
    {
-
       /* Find the current processor in order, and reset recv_data_ptr to that processor's message */
       original_proc_indx = argsort_contact_procs[i];
-      /*current_proc = send_proc_obj.id[i];*/
       indx = recv_starts[original_proc_indx];
       recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements + indx*obj_size_bytes);
 
-      /* get the number of rows for this recv */
-      hypre_TMemcpy( &num_rows, recv_data_ptr, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      /* get the number of elements for this recv */
+      num_elements = *((HYPRE_Int *) recv_data_ptr);
       recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-      indx++;
-
+      k = num_elements*obj_size_bytes;
 
-      for (j=0; j < num_rows; j++) /* for each row: unpack info */
+      for (j=0; j < num_elements; j++)
       {
-         /* row # */
-         hypre_TMemcpy( &row,  recv_data_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-         indx++;
-
-         /* num elements for this row */
-         hypre_TMemcpy( &num_elements,  recv_data_ptr, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-         indx++;
-
-         /* col indices */ /* Need to check this again !!!! */
-         if (big_int_size == obj_size_bytes)
-         {
-            col_ptr = (HYPRE_BigInt *) recv_data_ptr;
-            recv_data_ptr = (void *) ((char *)recv_data_ptr + num_elements*obj_size_bytes);
-         }
-         else /* copy data */
-         {
-            if (big_int_data_size < num_elements)
-            {
-               big_int_data = hypre_TReAlloc(big_int_data,  HYPRE_BigInt,  num_elements + 10, HYPRE_MEMORY_HOST);
-            }
-            for (k=0; k< num_elements; k++)
-            {
-               hypre_TMemcpy( &big_int_data[k],  recv_data_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-               recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-            }
-            col_ptr = big_int_data;
-         }
-
-         /* col data */
-         if (complex_size == obj_size_bytes)
-         {
-            col_data_ptr = (HYPRE_Complex *) recv_data_ptr;
-            recv_data_ptr = (void *) ((char *)recv_data_ptr + num_elements*obj_size_bytes);
-         }
-         else /* copy data */
-         {
-            if (complex_data_size < num_elements)
-            {
-               complex_data =
-                  hypre_TReAlloc(complex_data,  HYPRE_Complex,  num_elements + 10, HYPRE_MEMORY_HOST);
-            }
-            for (k=0; k< num_elements; k++)
-            {
-               hypre_TMemcpy( &complex_data[k],  recv_data_ptr, HYPRE_Complex, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-               recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-            }
-            col_data_ptr = complex_data;
-
-         }
-
-         if (memory_location == HYPRE_MEMORY_HOST)
-         {
-            hypre_IJMatrixAddToValuesParCSR(matrix, 1, &num_elements, &row, &row_index, col_ptr, col_data_ptr);
-         }
-         else
-         {
-            HYPRE_Int nelm_new = off_proc_nelm_recv_cur + num_elements;
-
-            if (nelm_new > off_proc_nelm_recv_max)
-            {
-               off_proc_nelm_recv_max = nelm_new * 2;
-               off_proc_i_recv    = hypre_TReAlloc(off_proc_i_recv,    HYPRE_BigInt,  off_proc_nelm_recv_max, HYPRE_MEMORY_HOST);
-               off_proc_j_recv    = hypre_TReAlloc(off_proc_j_recv,    HYPRE_BigInt,  off_proc_nelm_recv_max, HYPRE_MEMORY_HOST);
-               off_proc_data_recv = hypre_TReAlloc(off_proc_data_recv, HYPRE_Complex, off_proc_nelm_recv_max, HYPRE_MEMORY_HOST);
-            }
-
-            HYPRE_Int i;
-            for (i = 0; i < num_elements; i++)
-            {
-               off_proc_i_recv[off_proc_nelm_recv_cur + i] = row;
-            }
-            hypre_TMemcpy(off_proc_j_recv + off_proc_nelm_recv_cur, col_ptr, HYPRE_BigInt, num_elements,
-                           HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-            hypre_TMemcpy(off_proc_data_recv + off_proc_nelm_recv_cur, col_data_ptr, HYPRE_Complex, num_elements,
-                           HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-
-            off_proc_nelm_recv_cur = nelm_new;
-         }
-
-         indx += (num_elements*2);
+         index_ptr = (void *) ((char *) recv_data_ptr + j*obj_size_bytes);
+         off_proc_i_recv[counter]    = *((HYPRE_BigInt *) index_ptr);
+         off_proc_j_recv[counter]    = *((HYPRE_BigInt *) ((char *) index_ptr + k));
+         off_proc_data_recv[counter] = *((HYPRE_Complex *) ((char *) index_ptr + 2*k));
+         counter++;
       }
    }
 
-   if (memory_location == HYPRE_MEMORY_DEVICE)
+   if (memory_location == HYPRE_MEMORY_HOST)
+   {
+      hypre_IJMatrixAddOffProcTriplesParCSR(matrix, off_proc_nelm_recv_cur, off_proc_i_recv,
+                                            off_proc_j_recv, off_proc_data_recv);
+   }
+   else
    {
       off_proc_i_recv_d    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_DEVICE);
       off_proc_j_recv_d    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_DEVICE);
@@ -2626,16 +2924,6 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_TFree(send_proc_obj.id, HYPRE_MEMORY_HOST);
    hypre_TFree(argsort_contact_procs, HYPRE_MEMORY_HOST);
 
-   if (big_int_data)
-   {
-      hypre_TFree(big_int_data, HYPRE_MEMORY_HOST);
-   }
-
-   if (complex_data)
-   {
-      hypre_TFree(complex_data, HYPRE_MEMORY_HOST);
-   }
-
    if (memory_location == HYPRE_MEMORY_DEVICE)
    {
       hypre_TFree(off_proc_i,    HYPRE_MEMORY_HOST);
@@ -3150,6 +3438,10 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       hypre_IJMatrixAssembleFlag(matrix) = 1;
    }
 
+   /* values may have changed: drop any stale SELL copies */
+   hypre_CSRMatrixResetSell(diag);
+   hypre_CSRMatrixResetSell(offd);
+
    hypre_AuxParCSRMatrixDestroy(aux_matrix);
    hypre_IJMatrixTranslator(matrix) = NULL;
 
@@ -178,6 +178,31 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                          HYPRE_Int    recompute_residual_p);
 
+/**
+ * (Optional) Use the pipelined variant of Ghysels and Vanroose, which
+ * combines the inner products of an iteration into one global reduction
+ * and overlaps it with the preconditioner and matvec.  It needs six more
+ * vectors and is less stable; use it with RecomputeResidualP when many
+ * iterations are expected.  The options RelChange and the residual-based
+ * and convergence-factor tolerances are ignored.  Available when the
+ * solver has the split reduction functions (the ParCSR, Struct and
+ * SStruct interfaces); otherwise the standard algorithm is used.
+ **/
+HYPRE_Int HYPRE_PCGSetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int    pipelined);
+
+/**
+ * (Optional) Use the s-step variant of Chronopoulos and Gear, which
+ * performs s iterations with one global reduction.  It needs 4s more
+ * vectors and tests convergence every s iterations.  Since its basis loses
+ * independence quickly, s must be between 1 and 5, and s is reduced during
+ * the solve if the basis breaks down.  The default, s = 1, is the standard
+ * algorithm.  Ignored if pipelining is on, and subject to the same
+ * restrictions.
+ **/
+HYPRE_Int HYPRE_PCGSetSStep(HYPRE_Solver solver,
+                            HYPRE_Int    s_step);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -359,6 +384,17 @@ HYPRE_Int HYPRE_GMRESSetMaxIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_GMRESSetKDim(HYPRE_Solver solver,
                              HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Use classical Gram-Schmidt applied twice (CGS2) instead of
+ * modified Gram-Schmidt to orthogonalize the Krylov basis.  CGS2 needs two
+ * global reductions per iteration instead of one per basis vector, but is
+ * used only if the interface provides batched inner products and axpys
+ * (ParCSR on the host, Struct and SStruct).  Default is 0 (modified
+ * Gram-Schmidt).
+ **/
+HYPRE_Int HYPRE_GMRESSetCGS(HYPRE_Solver solver,
+                            HYPRE_Int    cgs);
+
 /**
  * (Optional) Additionally require that the relative difference in
  * successive iterates be small.
@@ -452,6 +488,11 @@ HYPRE_Int HYPRE_GMRESGetMaxIter(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_GMRESGetKDim(HYPRE_Solver  solver,
                              HYPRE_Int    *k_dim);
 
+/**
+ **/
+HYPRE_Int HYPRE_GMRESGetCGS(HYPRE_Solver  solver,
+                            HYPRE_Int    *cgs);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetRelChange(HYPRE_Solver  solver,
@@ -544,6 +585,13 @@ HYPRE_Int HYPRE_FlexGMRESSetMaxIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_FlexGMRESSetKDim(HYPRE_Solver solver,
                                  HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Use CGS2 instead of modified Gram-Schmidt, as described for
+ * \ref HYPRE_GMRESSetCGS.  Default is 0.
+ **/
+HYPRE_Int HYPRE_FlexGMRESSetCGS(HYPRE_Solver solver,
+                                HYPRE_Int    cgs);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -615,6 +663,11 @@ HYPRE_Int HYPRE_FlexGMRESGetMaxIter(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_FlexGMRESGetKDim(HYPRE_Solver  solver,
                                  HYPRE_Int    *k_dim);
 
+/**
+ **/
+HYPRE_Int HYPRE_FlexGMRESGetCGS(HYPRE_Solver  solver,
+                                HYPRE_Int    *cgs);
+
 /**
  **/
 HYPRE_Int HYPRE_FlexGMRESGetPrecond(HYPRE_Solver  solver,
@@ -716,6 +769,13 @@ HYPRE_LGMRESSetMaxIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_LGMRESSetKDim(HYPRE_Solver solver,
                               HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Use CGS2 instead of modified Gram-Schmidt, as described for
+ * \ref HYPRE_GMRESSetCGS.  Default is 0.
+ **/
+HYPRE_Int HYPRE_LGMRESSetCGS(HYPRE_Solver solver,
+                             HYPRE_Int    cgs);
+
 /**
  * (Optional) Set the number of augmentation vectors  (default: 2).
  **/
@@ -793,6 +853,11 @@ HYPRE_Int HYPRE_LGMRESGetMaxIter(HYPRE_Solver  solver,
  **/
 HYPRE_Int HYPRE_LGMRESGetKDim(HYPRE_Solver  solver,
                               HYPRE_Int    *k_dim);
+
+/**
+ **/
+HYPRE_Int HYPRE_LGMRESGetCGS(HYPRE_Solver  solver,
+                             HYPRE_Int    *cgs);
 /**
  **/
 HYPRE_Int HYPRE_LGMRESGetAugDim(HYPRE_Solver  solver,
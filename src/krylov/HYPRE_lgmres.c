@@ -73,6 +73,24 @@ HYPRE_LGMRESGetKDim( HYPRE_Solver solver,
 {
    return( hypre_LGMRESGetKDim( (void *) solver, k_dim ) );
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_LGMRESSetCGS, HYPRE_LGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_LGMRESSetCGS( HYPRE_Solver solver,
+                    HYPRE_Int    cgs )
+{
+   return( hypre_LGMRESSetCGS( (void *) solver, cgs ) );
+}
+
+HYPRE_Int
+HYPRE_LGMRESGetCGS( HYPRE_Solver solver,
+                    HYPRE_Int   *cgs )
+{
+   return( hypre_LGMRESGetCGS( (void *) solver, cgs ) );
+}
 /*--------------------------------------------------------------------------
  * HYPRE_LGMRESSetAugDim, HYPRE_LGMRESGetAugDim
  *--------------------------------------------------------------------------*/
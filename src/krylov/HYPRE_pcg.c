@@ -252,6 +252,42 @@ HYPRE_PCGGetRecomputeResidualP( HYPRE_Solver  solver,
    return( hypre_PCGGetRecomputeResidualP( (void *) solver, recompute_residual_p ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetPipelined, HYPRE_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetPipelined( HYPRE_Solver solver,
+                       HYPRE_Int    pipelined )
+{
+   return( hypre_PCGSetPipelined( (void *) solver, pipelined ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetPipelined( HYPRE_Solver  solver,
+                       HYPRE_Int    *pipelined )
+{
+   return( hypre_PCGGetPipelined( (void *) solver, pipelined ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetSStep, HYPRE_PCGGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetSStep( HYPRE_Solver solver,
+                   HYPRE_Int    s_step )
+{
+   return( hypre_PCGSetSStep( (void *) solver, s_step ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetSStep( HYPRE_Solver  solver,
+                   HYPRE_Int    *s_step )
+{
+   return( hypre_PCGGetSStep( (void *) solver, s_step ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_PCGSetPrecond
  *--------------------------------------------------------------------------*/
@@ -51,6 +51,7 @@ hypre_BiCGSTABFunctionsCreate(
    bicgstab_functions->ClearVector = ClearVector;
    bicgstab_functions->ScaleVector = ScaleVector;
    bicgstab_functions->Axpy = Axpy;
+   bicgstab_functions->MassDotpTwo = NULL;
    bicgstab_functions->CommInfo = CommInfo;
    bicgstab_functions->precond_setup = PrecondSetup;
    bicgstab_functions->precond = Precond;
@@ -242,6 +243,7 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
    HYPRE_Real den_norm;
    HYPRE_Real gamma_numer;
    HYPRE_Real gamma_denom;
+   HYPRE_Real res_next = 0.0;
 
    (bicgstab_data -> converged) = 0;
 
@@ -418,8 +420,16 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
         precond(precond_data, A, r, v);
         (*(bicgstab_functions->Matvec))(matvec_data,1.0,A,v,0.0,s);
       	/* Handle case when gamma = 0.0/0.0 as 0.0 and not NAN */
-        gamma_numer = (*(bicgstab_functions->InnerProd))(r,s);
-        gamma_denom = (*(bicgstab_functions->InnerProd))(s,s);
+        if (bicgstab_functions->MassDotpTwo)
+        {
+           (*(bicgstab_functions->MassDotpTwo))(r, s, &s, 1, 1,
+                                                &gamma_numer, &gamma_denom);
+        }
+        else
+        {
+           gamma_numer = (*(bicgstab_functions->InnerProd))(r,s);
+           gamma_denom = (*(bicgstab_functions->InnerProd))(s,s);
+        }
         if ((gamma_numer == 0.0) && (gamma_denom == 0.0))
             gamma = 0.0;
         else
@@ -427,7 +437,17 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
 	(*(bicgstab_functions->Axpy))(gamma,v,x);
 	(*(bicgstab_functions->Axpy))(-gamma,s,r);
     /* residual is now updated, must immediately check for convergence */
-	r_norm = sqrt((*(bicgstab_functions->InnerProd))(r,r));
+        if (bicgstab_functions->MassDotpTwo)
+        {
+           /* also get <r0,r> for the next direction in the same reduction */
+           (*(bicgstab_functions->MassDotpTwo))(r, r0, &r, 1, 1,
+                                                &r_norm, &res_next);
+           r_norm = sqrt(r_norm);
+        }
+        else
+        {
+           r_norm = sqrt((*(bicgstab_functions->InnerProd))(r,r));
+        }
 	if (logging > 0 || print_level > 0)
 	{
 	   norms[iter] = r_norm;
@@ -447,6 +467,8 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
 	   (*(bicgstab_functions->CopyVector))(b,r);
            (*(bicgstab_functions->Matvec))(matvec_data,-1.0,A,x,1.0,r);
 	   r_norm = sqrt((*(bicgstab_functions->InnerProd))(r,r));
+	   if (bicgstab_functions->MassDotpTwo)
+	      res_next = (*(bicgstab_functions->InnerProd))(r0,r);
 	   if (r_norm <= epsilon)
            {
               if (print_level > 0 && my_id == 0)
@@ -483,7 +505,10 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
 	  hypre_error_w_msg(HYPRE_ERROR_GENERIC,"BiCGSTAB broke down!! res=0 \n");
 	  return hypre_error_flag;
        }
-       res = (*(bicgstab_functions->InnerProd))(r0,r);
+       if (bicgstab_functions->MassDotpTwo)
+          res = res_next;
+       else
+          res = (*(bicgstab_functions->InnerProd))(r0,r);
        beta *= res;    
        (*(bicgstab_functions->Axpy))(-gamma,q,p);
        if (fabs(gamma) >= epsmac)
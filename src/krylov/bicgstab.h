@@ -81,6 +81,8 @@ typedef struct
   HYPRE_Int  (*ClearVector)   ( void *x );
   HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha , void *x );
   HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha , void *x , void *y );
+  /* optional (NULL if not available): <x,z[0]> and <y,z[0]> in one reduction */
+  HYPRE_Int  (*MassDotpTwo)   ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
   HYPRE_Int  (*CommInfo)      ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
 	HYPRE_Int  (*precond_setup) (void *vdata , void *A , void *b , void *x);
 	HYPRE_Int  (*precond)       (void *vdata , void *A , void *b , void *x);
@@ -58,6 +58,9 @@ hypre_FlexGMRESFunctionsCreate(
    fgmres_functions->ClearVector = ClearVector;
    fgmres_functions->ScaleVector = ScaleVector;
    fgmres_functions->Axpy = Axpy;
+   fgmres_functions->MassInnerProd = NULL;
+   fgmres_functions->MassDotpTwo = NULL;
+   fgmres_functions->MassAxpy = NULL;
 /* default preconditioner must be set here but can be changed later... */
    fgmres_functions->precond_setup = PrecondSetup;
    fgmres_functions->precond       = Precond;
@@ -83,6 +86,7 @@ hypre_FlexGMRESCreate( hypre_FlexGMRESFunctions *fgmres_functions )
  
    /* set defaults */
    (fgmres_data -> k_dim)          = 20;
+   (fgmres_data -> cgs)            = 0; /* modified Gram-Schmidt */
    (fgmres_data -> tol)            = 1.0e-06;
    (fgmres_data -> cf_tol)         = 0.0;
    (fgmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -263,6 +267,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    hypre_FlexGMRESData  *fgmres_data   = (hypre_FlexGMRESData *)fgmres_vdata;
    hypre_FlexGMRESFunctions *fgmres_functions = fgmres_data->functions;
    HYPRE_Int 		     k_dim        = (fgmres_data -> k_dim);
+   HYPRE_Int            cgs          = (fgmres_data -> cgs);
    HYPRE_Int               min_iter     = (fgmres_data -> min_iter);
    HYPRE_Int 		     max_iter     = (fgmres_data -> max_iter);
    HYPRE_Real 	     r_tol        = (fgmres_data -> tol);
@@ -290,6 +295,8 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    HYPRE_Int        break_value = 0;
    HYPRE_Int	      i, j, k;
    HYPRE_Real *rs, **hh, *c, *s; 
+   HYPRE_Real *hv;
+   HYPRE_Int   unroll = 8;
    HYPRE_Int        iter; 
    HYPRE_Int        my_id, num_procs;
    HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm;
@@ -326,6 +333,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
 
    /* initialize work arrays  */
    rs = hypre_CTAllocF(HYPRE_Real,k_dim+1,fgmres_functions, HYPRE_MEMORY_HOST);
+   hv = hypre_CTAllocF(HYPRE_Real,k_dim+1,fgmres_functions, HYPRE_MEMORY_HOST);
    c = hypre_CTAllocF(HYPRE_Real,k_dim,fgmres_functions, HYPRE_MEMORY_HOST);
    s = hypre_CTAllocF(HYPRE_Real,k_dim,fgmres_functions, HYPRE_MEMORY_HOST);
 
@@ -457,6 +465,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
            hypre_TFreeF(c,fgmres_functions); 
            hypre_TFreeF(s,fgmres_functions); 
            hypre_TFreeF(rs,fgmres_functions);
+           hypre_TFreeF(hv,fgmres_functions);
 
            for (i=0; i < k_dim+1; i++) {
               hypre_TFreeF(hh[i],fgmres_functions);
@@ -515,13 +524,43 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
            (*(fgmres_functions->Matvec))(matvec_data, 1.0, A, pre_vecs[i-1], 0.0, p[i]);
            
 
-           /* modified Gram_Schmidt */
-           for (j=0; j < i; j++)
+           if ( cgs && fgmres_functions->MassInnerProd && fgmres_functions->MassAxpy )
            {
-              hh[j][i-1] = (*(fgmres_functions->InnerProd))(p[j],p[i]);
-              (*(fgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              /* classical Gram-Schmidt applied twice, with one batched reduction
+                 per pass; the second pass also returns <p[i],p[i]> */
+              (*(fgmres_functions->MassInnerProd))(p[i], p, i, unroll, hv);
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = hv[j];
+                 hv[j] = -hv[j];
+              }
+              (*(fgmres_functions->MassAxpy))(hv, p, p[i], i, unroll);
+              (*(fgmres_functions->MassInnerProd))(p[i], p, i+1, unroll, hv);
+              t = 0.0;
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] += hv[j];
+                 t += hv[j]*hv[j];
+                 hv[j] = -hv[j];
+              }
+              (*(fgmres_functions->MassAxpy))(hv, p, p[i], i, unroll);
+              /* ||p[i]||^2 = <p[i],p[i]> - sum_j hv[j]^2 before the update, unless
+                 this cancels badly */
+              if (t < 0.5*hv[i])
+                 t = sqrt(hv[i] - t);
+              else
+                 t = sqrt((*(fgmres_functions->InnerProd))(p[i],p[i]));
+           }
+           else
+           {
+              /* modified Gram_Schmidt */
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = (*(fgmres_functions->InnerProd))(p[j],p[i]);
+                 (*(fgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              }
+              t = sqrt((*(fgmres_functions->InnerProd))(p[i],p[i]));
            }
-           t = sqrt((*(fgmres_functions->InnerProd))(p[i],p[i]));
            hh[i][i-1] = t;	
            if (t != 0.0)
            {
@@ -614,10 +653,18 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
 	}
         /* form linear combination of pre_vecs's to get solution */
       
-        (*(fgmres_functions->CopyVector))(pre_vecs[i-1],w);
-        (*(fgmres_functions->ScaleVector))(rs[i-1],w);
-        for (j = i-2; j >=0; j--)
-           (*(fgmres_functions->Axpy))(rs[j], pre_vecs[j], w);
+        if (fgmres_functions->MassAxpy)
+        {
+           (*(fgmres_functions->ClearVector))(w);
+           (*(fgmres_functions->MassAxpy))(rs, pre_vecs, w, i, unroll);
+        }
+        else
+        {
+           (*(fgmres_functions->CopyVector))(pre_vecs[i-1],w);
+           (*(fgmres_functions->ScaleVector))(rs[i-1],w);
+           for (j = i-2; j >=0; j--)
+              (*(fgmres_functions->Axpy))(rs[j], pre_vecs[j], w);
+        }
         
 
         /* don't need to un-wind precond... - so now the correction is
@@ -664,8 +711,15 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
 	}
         
         if (i) (*(fgmres_functions->Axpy))(rs[i]-1.0,p[i],p[i]);
-        for (j=i-1 ; j > 0; j--)
-           (*(fgmres_functions->Axpy))(rs[j],p[j],p[i]);
+        if (fgmres_functions->MassAxpy)
+        {
+           if (i > 1) (*(fgmres_functions->MassAxpy))(&rs[1], &p[1], p[i], i-1, unroll);
+        }
+        else
+        {
+           for (j=i-1 ; j > 0; j--)
+              (*(fgmres_functions->Axpy))(rs[j],p[j],p[i]);
+        }
         
         if (i)
         {
@@ -691,6 +745,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    hypre_TFreeF(c,fgmres_functions); 
    hypre_TFreeF(s,fgmres_functions); 
    hypre_TFreeF(rs,fgmres_functions);
+   hypre_TFreeF(hv,fgmres_functions);
 
    for (i=0; i < k_dim+1; i++)
    {	
@@ -730,6 +785,32 @@ hypre_FlexGMRESGetKDim( void   *fgmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FlexGMRESSetCGS, hypre_FlexGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FlexGMRESSetCGS( void      *fgmres_vdata,
+                       HYPRE_Int  cgs )
+{
+   hypre_FlexGMRESData *fgmres_data = (hypre_FlexGMRESData *)fgmres_vdata;
+
+   (fgmres_data -> cgs) = cgs;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_FlexGMRESGetCGS( void      *fgmres_vdata,
+                       HYPRE_Int *cgs )
+{
+   hypre_FlexGMRESData *fgmres_data = (hypre_FlexGMRESData *)fgmres_vdata;
+
+   *cgs = (fgmres_data -> cgs);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  * hypre_FlexGMRESSetTol, hypre_FlexGMRESGetTol
@@ -969,7 +1050,7 @@ hypre_FlexGMRESGetPrintLevel( void *fgmres_vdata,
 
 HYPRE_Int
 hypre_FlexGMRESSetLogging( void *fgmres_vdata,
-                      HYPRE_Int   level)
+                       HYPRE_Int   level)
 {
    hypre_FlexGMRESData *fgmres_data = (hypre_FlexGMRESData *)fgmres_vdata;
 
@@ -981,7 +1062,7 @@ hypre_FlexGMRESSetLogging( void *fgmres_vdata,
 
 HYPRE_Int
 hypre_FlexGMRESGetLogging( void *fgmres_vdata,
-                      HYPRE_Int * level)
+                       HYPRE_Int * level)
 {
    hypre_FlexGMRESData *fgmres_data = (hypre_FlexGMRESData *)fgmres_vdata;
 
@@ -61,6 +61,11 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional batched functions (NULL if not available); the vectors of
+      an array argument must come from one call to CreateVectorArray */
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
+   HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll );
 
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x );
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x );
@@ -76,6 +81,7 @@ typedef struct
 typedef struct
 {
    HYPRE_Int      k_dim;
+   HYPRE_Int      cgs;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
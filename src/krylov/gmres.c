@@ -58,6 +58,9 @@ hypre_GMRESFunctionsCreate(
    gmres_functions->ClearVector = ClearVector;
    gmres_functions->ScaleVector = ScaleVector;
    gmres_functions->Axpy = Axpy;
+   gmres_functions->MassInnerProd = NULL;
+   gmres_functions->MassDotpTwo = NULL;
+   gmres_functions->MassAxpy = NULL;
 /* default preconditioner must be set here but can be changed later... */
    gmres_functions->precond_setup = PrecondSetup;
    gmres_functions->precond       = Precond;
@@ -80,6 +83,7 @@ hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions )
  
    /* set defaults */
    (gmres_data -> k_dim)          = 5;
+   (gmres_data -> cgs)            = 0; /* modified Gram-Schmidt */
    (gmres_data -> tol)            = 1.0e-06; /* relative residual tol */
    (gmres_data -> cf_tol)         = 0.0;
    (gmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -249,6 +253,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    hypre_GMRESData      *gmres_data         = (hypre_GMRESData *)gmres_vdata;
    hypre_GMRESFunctions *gmres_functions    = gmres_data->functions;
    HYPRE_Int             k_dim              = (gmres_data -> k_dim);
+   HYPRE_Int             cgs                = (gmres_data -> cgs);
    HYPRE_Int             min_iter           = (gmres_data -> min_iter);
    HYPRE_Int             max_iter           = (gmres_data -> max_iter);
    HYPRE_Int             rel_change         = (gmres_data -> rel_change);
@@ -279,6 +284,8 @@ hypre_GMRESSolve(void  *gmres_vdata,
    HYPRE_Int        break_value = 0;
    HYPRE_Int        i, j, k;
    HYPRE_Real *rs, **hh, *c, *s, *rs_2; 
+   HYPRE_Real *hv;
+   HYPRE_Int   unroll = 8;
    HYPRE_Int        iter; 
    HYPRE_Int        my_id, num_procs;
    HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm, x_norm;
@@ -315,6 +322,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
    /* initialize work arrays */
    rs = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   hv = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
    c = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
    s = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
    if (rel_change)
@@ -455,6 +463,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
          hypre_TFreeF(c,gmres_functions); 
          hypre_TFreeF(s,gmres_functions); 
          hypre_TFreeF(rs,gmres_functions);
+         hypre_TFreeF(hv,gmres_functions);
          if (rel_change)  hypre_TFreeF(rs_2,gmres_functions);
          for (i=0; i < k_dim+1; i++) hypre_TFreeF(hh[i],gmres_functions);
          hypre_TFreeF(hh,gmres_functions); 
@@ -502,13 +511,43 @@ hypre_GMRESSolve(void  *gmres_vdata,
          (*(gmres_functions->ClearVector))(r);
          precond(precond_data, A, p[i-1], r);
          (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
-         /* modified Gram_Schmidt */
-         for (j=0; j < i; j++)
+         if ( cgs && gmres_functions->MassInnerProd && gmres_functions->MassAxpy )
          {
-            hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
-            (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+            /* classical Gram-Schmidt applied twice, with one batched reduction
+               per pass; the second pass also returns <p[i],p[i]> */
+            (*(gmres_functions->MassInnerProd))(p[i], p, i, unroll, hv);
+            for (j=0; j < i; j++)
+            {
+               hh[j][i-1] = hv[j];
+               hv[j] = -hv[j];
+            }
+            (*(gmres_functions->MassAxpy))(hv, p, p[i], i, unroll);
+            (*(gmres_functions->MassInnerProd))(p[i], p, i+1, unroll, hv);
+            t = 0.0;
+            for (j=0; j < i; j++)
+            {
+               hh[j][i-1] += hv[j];
+               t += hv[j]*hv[j];
+               hv[j] = -hv[j];
+            }
+            (*(gmres_functions->MassAxpy))(hv, p, p[i], i, unroll);
+            /* ||p[i]||^2 = <p[i],p[i]> - sum_j hv[j]^2 before the update, unless
+               this cancels badly */
+            if (t < 0.5*hv[i])
+               t = sqrt(hv[i] - t);
+            else
+               t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
+         }
+         else
+         {
+            /* modified Gram_Schmidt */
+            for (j=0; j < i; j++)
+            {
+               hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
+               (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+            }
+            t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
          }
-         t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
          hh[i][i-1] = t;
          if (t != 0.0)
          {
@@ -712,10 +751,18 @@ hypre_GMRESSolve(void  *gmres_vdata,
          rs[k] = t/hh[k][k];
       }
 
-      (*(gmres_functions->CopyVector))(p[i-1],w);
-      (*(gmres_functions->ScaleVector))(rs[i-1],w);
-      for (j = i-2; j >=0; j--)
-         (*(gmres_functions->Axpy))(rs[j], p[j], w);
+      if (gmres_functions->MassAxpy)
+      {
+         (*(gmres_functions->ClearVector))(w);
+         (*(gmres_functions->MassAxpy))(rs, p, w, i, unroll);
+      }
+      else
+      {
+         (*(gmres_functions->CopyVector))(p[i-1],w);
+         (*(gmres_functions->ScaleVector))(rs[i-1],w);
+         for (j = i-2; j >=0; j--)
+            (*(gmres_functions->Axpy))(rs[j], p[j], w);
+      }
 
       (*(gmres_functions->ClearVector))(r);
       /* find correction (in r) */
@@ -829,8 +876,15 @@ hypre_GMRESSolve(void  *gmres_vdata,
       }
 
       if (i) (*(gmres_functions->Axpy))(rs[i]-1.0,p[i],p[i]);
-      for (j=i-1 ; j > 0; j--)
-         (*(gmres_functions->Axpy))(rs[j],p[j],p[i]);
+      if (gmres_functions->MassAxpy)
+      {
+         if (i > 1) (*(gmres_functions->MassAxpy))(&rs[1], &p[1], p[i], i-1, unroll);
+      }
+      else
+      {
+         for (j=i-1 ; j > 0; j--)
+            (*(gmres_functions->Axpy))(rs[j],p[j],p[i]);
+      }
 
       if (i)
       {
@@ -865,6 +919,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    hypre_TFreeF(c, gmres_functions); 
    hypre_TFreeF(s, gmres_functions); 
    hypre_TFreeF(rs, gmres_functions);
+   hypre_TFreeF(hv, gmres_functions);
    
    if (rel_change)
    {
@@ -910,6 +965,32 @@ hypre_GMRESGetKDim( void      *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSetCGS, hypre_GMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSetCGS( void      *gmres_vdata,
+                   HYPRE_Int  cgs )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   (gmres_data -> cgs) = cgs;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GMRESGetCGS( void      *gmres_vdata,
+                   HYPRE_Int *cgs )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   *cgs = (gmres_data -> cgs);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetTol, hypre_GMRESGetTol
  *--------------------------------------------------------------------------*/
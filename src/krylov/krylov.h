@@ -101,6 +101,8 @@ extern "C" {
     HYPRE_Int  (*ClearVector)   ( void *x );
     HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha , void *x );
     HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha , void *x , void *y );
+    /* optional (NULL if not available): <x,z[0]> and <y,z[0]> in one reduction */
+    HYPRE_Int  (*MassDotpTwo)   ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
     HYPRE_Int  (*CommInfo)      ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
     HYPRE_Int  (*precond_setup) (void *vdata , void *A , void *b , void *x);
     HYPRE_Int  (*precond)       (void *vdata , void *A , void *b , void *x);
@@ -411,6 +413,11 @@ extern "C" {
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+    /* optional batched functions (NULL if not available); the vectors of
+       an array argument must come from one call to CreateVectorArray */
+    HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
+    HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
+    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll );
 
     HYPRE_Int    (*precond)       (void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup) (void *vdata , void *A , void *b , void *x);
@@ -424,6 +431,7 @@ extern "C" {
   typedef struct
   {
     HYPRE_Int      k_dim;
+    HYPRE_Int      cgs;
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -741,6 +749,11 @@ extern "C" {
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+    /* optional batched functions (NULL if not available); the vectors of
+       an array argument must come from one call to CreateVectorArray */
+    HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
+    HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
+    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll );
 
     HYPRE_Int    (*precond)       (void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup) (void *vdata , void *A , void *b , void *x);
@@ -754,6 +767,7 @@ extern "C" {
   typedef struct
   {
     HYPRE_Int      k_dim;
+    HYPRE_Int      cgs;
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -902,6 +916,11 @@ extern "C" {
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+    /* optional batched functions (NULL if not available); the vectors of
+       an array argument must come from one call to CreateVectorArray */
+    HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
+    HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
+    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll );
 
     HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x );
     HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x );
@@ -917,6 +936,7 @@ extern "C" {
   typedef struct
   {
     HYPRE_Int      k_dim;
+    HYPRE_Int      cgs;
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -1062,6 +1082,20 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional multivector operations for block solves (NULL if not available) */
+    HYPRE_Int    (*NumVectors)    ( void *x );
+    HYPRE_Int    (*MultiInnerProd)( void *x, void *y, HYPRE_Real *result );
+    HYPRE_Int    (*MultiAxpy)     ( HYPRE_Complex *alpha, void *x, void *y );
+    HYPRE_Int    (*MultiScaleVector)( HYPRE_Complex *alpha, void *x );
+
+    /* optional split reductions for pipelined and s-step solves (NULL if not
+       available): InnerProdLocal computes this process' part of <x,y>, and
+       IAllreduce starts a sum over the processes of x that Wait completes */
+    HYPRE_Int    (*InnerProdLocal)( void *x, void *y, HYPRE_Real *result );
+    HYPRE_Int    (*IAllreduce)    ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+        HYPRE_Int count, void **request );
+    HYPRE_Int    (*Wait)          ( void *request );
+
     HYPRE_Int    (*precond)(void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup)(void *vdata , void *A , void *b , void *x);
 
@@ -1117,12 +1151,16 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      pipelined;
+    HYPRE_Int      s_step;
 
     void    *A;
     void    *p;
     void    *s;
     void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
+    void   **work; /* extra work vectors of the pipelined and s-step solves */
+    HYPRE_Int num_work;
 
     HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
     void    *matvec_data;
@@ -1241,6 +1279,8 @@ extern "C" {
   HYPRE_Int hypre_GMRESSolve ( void *gmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_GMRESSetKDim ( void *gmres_vdata , HYPRE_Int k_dim );
   HYPRE_Int hypre_GMRESGetKDim ( void *gmres_vdata , HYPRE_Int *k_dim );
+  HYPRE_Int hypre_GMRESSetCGS ( void *gmres_vdata , HYPRE_Int cgs );
+  HYPRE_Int hypre_GMRESGetCGS ( void *gmres_vdata , HYPRE_Int *cgs );
   HYPRE_Int hypre_GMRESSetTol ( void *gmres_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_GMRESGetTol ( void *gmres_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_GMRESSetAbsoluteTol ( void *gmres_vdata , HYPRE_Real a_tol );
@@ -1315,6 +1355,8 @@ extern "C" {
   HYPRE_Int hypre_FlexGMRESSolve ( void *fgmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_FlexGMRESSetKDim ( void *fgmres_vdata , HYPRE_Int k_dim );
   HYPRE_Int hypre_FlexGMRESGetKDim ( void *fgmres_vdata , HYPRE_Int *k_dim );
+  HYPRE_Int hypre_FlexGMRESSetCGS ( void *fgmres_vdata , HYPRE_Int cgs );
+  HYPRE_Int hypre_FlexGMRESGetCGS ( void *fgmres_vdata , HYPRE_Int *cgs );
   HYPRE_Int hypre_FlexGMRESSetTol ( void *fgmres_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_FlexGMRESGetTol ( void *fgmres_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_FlexGMRESSetAbsoluteTol ( void *fgmres_vdata , HYPRE_Real a_tol );
@@ -1347,6 +1389,8 @@ extern "C" {
   HYPRE_Int hypre_LGMRESSolve ( void *lgmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_LGMRESSetKDim ( void *lgmres_vdata , HYPRE_Int k_dim );
   HYPRE_Int hypre_LGMRESGetKDim ( void *lgmres_vdata , HYPRE_Int *k_dim );
+  HYPRE_Int hypre_LGMRESSetCGS ( void *lgmres_vdata , HYPRE_Int cgs );
+  HYPRE_Int hypre_LGMRESGetCGS ( void *lgmres_vdata , HYPRE_Int *cgs );
   HYPRE_Int hypre_LGMRESSetAugDim ( void *lgmres_vdata , HYPRE_Int aug_dim );
   HYPRE_Int hypre_LGMRESGetAugDim ( void *lgmres_vdata , HYPRE_Int *aug_dim );
   HYPRE_Int hypre_LGMRESSetTol ( void *lgmres_vdata , HYPRE_Real tol );
@@ -1408,6 +1452,8 @@ extern "C" {
   HYPRE_Int HYPRE_GMRESSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
   HYPRE_Int HYPRE_GMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
   HYPRE_Int HYPRE_GMRESGetKDim ( HYPRE_Solver solver , HYPRE_Int *k_dim );
+  HYPRE_Int HYPRE_GMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
+  HYPRE_Int HYPRE_GMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
   HYPRE_Int HYPRE_GMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
   HYPRE_Int HYPRE_GMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
   HYPRE_Int HYPRE_GMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -1474,6 +1520,8 @@ extern "C" {
   HYPRE_Int HYPRE_FlexGMRESSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
   HYPRE_Int HYPRE_FlexGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
   HYPRE_Int HYPRE_FlexGMRESGetKDim ( HYPRE_Solver solver , HYPRE_Int *k_dim );
+  HYPRE_Int HYPRE_FlexGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
+  HYPRE_Int HYPRE_FlexGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
   HYPRE_Int HYPRE_FlexGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
   HYPRE_Int HYPRE_FlexGMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
   HYPRE_Int HYPRE_FlexGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -1501,6 +1549,8 @@ extern "C" {
   HYPRE_Int HYPRE_LGMRESSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
   HYPRE_Int HYPRE_LGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
   HYPRE_Int HYPRE_LGMRESGetKDim ( HYPRE_Solver solver , HYPRE_Int *k_dim );
+  HYPRE_Int HYPRE_LGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
+  HYPRE_Int HYPRE_LGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
   HYPRE_Int HYPRE_LGMRESSetAugDim ( HYPRE_Solver solver , HYPRE_Int aug_dim );
   HYPRE_Int HYPRE_LGMRESGetAugDim ( HYPRE_Solver solver , HYPRE_Int *aug_dim );
   HYPRE_Int HYPRE_LGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
@@ -1549,6 +1599,10 @@ extern "C" {
   HYPRE_Int HYPRE_PCGGetRecomputeResidual ( HYPRE_Solver solver , HYPRE_Int *recompute_residual );
   HYPRE_Int HYPRE_PCGSetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int recompute_residual_p );
   HYPRE_Int HYPRE_PCGGetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int HYPRE_PCGSetPipelined ( HYPRE_Solver solver , HYPRE_Int pipelined );
+  HYPRE_Int HYPRE_PCGGetPipelined ( HYPRE_Solver solver , HYPRE_Int *pipelined );
+  HYPRE_Int HYPRE_PCGSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
+  HYPRE_Int HYPRE_PCGGetSStep ( HYPRE_Solver solver , HYPRE_Int *s_step );
   HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_PCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1566,6 +1620,9 @@ extern "C" {
   HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata , void **residual );
   HYPRE_Int hypre_PCGSetup ( void *pcg_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_PCGSolve ( void *pcg_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_PCGSolveMulti ( void *pcg_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_PCGSolvePipelined ( void *pcg_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_PCGSolveSStep ( void *pcg_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata , HYPRE_Real a_tol );
@@ -1586,6 +1643,10 @@ extern "C" {
   HYPRE_Int hypre_PCGGetRecomputeResidual ( void *pcg_vdata , HYPRE_Int *recompute_residual );
   HYPRE_Int hypre_PCGSetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int recompute_residual_p );
   HYPRE_Int hypre_PCGGetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata , HYPRE_Int pipelined );
+  HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata , HYPRE_Int *pipelined );
+  HYPRE_Int hypre_PCGSetSStep ( void *pcg_vdata , HYPRE_Int s_step );
+  HYPRE_Int hypre_PCGGetSStep ( void *pcg_vdata , HYPRE_Int *s_step );
   HYPRE_Int hypre_PCGSetStopCrit ( void *pcg_vdata , HYPRE_Int stop_crit );
   HYPRE_Int hypre_PCGGetStopCrit ( void *pcg_vdata , HYPRE_Int *stop_crit );
   HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata , HYPRE_Solver *precond_data_ptr );
@@ -58,6 +58,9 @@ hypre_LGMRESFunctionsCreate(
    lgmres_functions->ClearVector = ClearVector;
    lgmres_functions->ScaleVector = ScaleVector;
    lgmres_functions->Axpy = Axpy;
+   lgmres_functions->MassInnerProd = NULL;
+   lgmres_functions->MassDotpTwo = NULL;
+   lgmres_functions->MassAxpy = NULL;
 /* default preconditioner must be set here but can be changed later... */
    lgmres_functions->precond_setup = PrecondSetup;
    lgmres_functions->precond       = Precond;
@@ -80,6 +83,7 @@ hypre_LGMRESCreate( hypre_LGMRESFunctions *lgmres_functions )
  
    /* set defaults */
    (lgmres_data -> k_dim)          = 20;
+   (lgmres_data -> cgs)            = 0; /* modified Gram-Schmidt */
    (lgmres_data -> tol)            = 1.0e-06;
    (lgmres_data -> cf_tol)         = 0.0;
    (lgmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -287,6 +291,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    hypre_LGMRESData  *lgmres_data   = (hypre_LGMRESData *)lgmres_vdata;
    hypre_LGMRESFunctions *lgmres_functions = lgmres_data->functions;
    HYPRE_Int 		     k_dim        = (lgmres_data -> k_dim);
+   HYPRE_Int            cgs          = (lgmres_data -> cgs);
    HYPRE_Int               min_iter     = (lgmres_data -> min_iter);
    HYPRE_Int 		     max_iter     = (lgmres_data -> max_iter);
    HYPRE_Real 	     r_tol        = (lgmres_data -> tol);
@@ -322,6 +327,8 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    HYPRE_Int        break_value = 0;
    HYPRE_Int	      i, j, k;
    HYPRE_Real *rs, **hh, *c, *s; 
+   HYPRE_Real *hv;
+   HYPRE_Int   unroll = 8;
    HYPRE_Int        iter; 
    HYPRE_Int        my_id, num_procs;
    HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm;
@@ -356,6 +363,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
 
    /* initialize work arrays  - lgmres includes aug_dim*/
    rs = hypre_CTAllocF(HYPRE_Real,k_dim+1+aug_dim,lgmres_functions, HYPRE_MEMORY_HOST);
+   hv = hypre_CTAllocF(HYPRE_Real,k_dim+1+aug_dim,lgmres_functions, HYPRE_MEMORY_HOST);
    c = hypre_CTAllocF(HYPRE_Real,k_dim+aug_dim,lgmres_functions, HYPRE_MEMORY_HOST);
    s = hypre_CTAllocF(HYPRE_Real,k_dim+aug_dim,lgmres_functions, HYPRE_MEMORY_HOST);
 
@@ -496,6 +504,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
            hypre_TFreeF(c,lgmres_functions); 
            hypre_TFreeF(s,lgmres_functions); 
            hypre_TFreeF(rs,lgmres_functions);
+           hypre_TFreeF(hv,lgmres_functions);
            for (i=0; i < k_dim+aug_dim+1; i++) {
               hypre_TFreeF(hh[i],lgmres_functions);
            }
@@ -578,13 +587,43 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
            }
            /*---*/
 
-           /* modified Gram_Schmidt */
-           for (j=0; j < i; j++)
+           if ( cgs && lgmres_functions->MassInnerProd && lgmres_functions->MassAxpy )
            {
-              hh[j][i-1] = (*(lgmres_functions->InnerProd))(p[j],p[i]);
-              (*(lgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              /* classical Gram-Schmidt applied twice, with one batched reduction
+                 per pass; the second pass also returns <p[i],p[i]> */
+              (*(lgmres_functions->MassInnerProd))(p[i], p, i, unroll, hv);
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = hv[j];
+                 hv[j] = -hv[j];
+              }
+              (*(lgmres_functions->MassAxpy))(hv, p, p[i], i, unroll);
+              (*(lgmres_functions->MassInnerProd))(p[i], p, i+1, unroll, hv);
+              t = 0.0;
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] += hv[j];
+                 t += hv[j]*hv[j];
+                 hv[j] = -hv[j];
+              }
+              (*(lgmres_functions->MassAxpy))(hv, p, p[i], i, unroll);
+              /* ||p[i]||^2 = <p[i],p[i]> - sum_j hv[j]^2 before the update, unless
+                 this cancels badly */
+              if (t < 0.5*hv[i])
+                 t = sqrt(hv[i] - t);
+              else
+                 t = sqrt((*(lgmres_functions->InnerProd))(p[i],p[i]));
+           }
+           else
+           {
+              /* modified Gram_Schmidt */
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = (*(lgmres_functions->InnerProd))(p[j],p[i]);
+                 (*(lgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              }
+              t = sqrt((*(lgmres_functions->InnerProd))(p[i],p[i]));
            }
-           t = sqrt((*(lgmres_functions->InnerProd))(p[i],p[i]));
            hh[i][i-1] = t;	
            if (t != 0.0)
            {
@@ -685,20 +724,37 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
 
         if (!it_aug)
         {
-           (*(lgmres_functions->CopyVector))(p[i-1],w);
-           (*(lgmres_functions->ScaleVector))(rs[i-1],w);
-           for (j = i-2; j >=0; j--)
-              (*(lgmres_functions->Axpy))(rs[j], p[j], w);
+           if (lgmres_functions->MassAxpy)
+           {
+              (*(lgmres_functions->ClearVector))(w);
+              (*(lgmres_functions->MassAxpy))(rs, p, w, i, unroll);
+           }
+           else
+           {
+              (*(lgmres_functions->CopyVector))(p[i-1],w);
+              (*(lgmres_functions->ScaleVector))(rs[i-1],w);
+              for (j = i-2; j >=0; j--)
+                 (*(lgmres_functions->Axpy))(rs[j], p[j], w);
+           }
         }
         else /* need some of the augvecs */
         {
-           (*(lgmres_functions->CopyVector))(p[0],w);
-           (*(lgmres_functions->ScaleVector))(rs[0],w);
-
-           /* reg. arnoldi directions */  
-           for (j = 1; j < it_arnoldi; j++) /*first one already done */
+           if (lgmres_functions->MassAxpy)
            {
-              (*(lgmres_functions->Axpy))(rs[j], p[j], w);
+              /* reg. arnoldi directions */
+              (*(lgmres_functions->ClearVector))(w);
+              (*(lgmres_functions->MassAxpy))(rs, p, w, it_arnoldi, unroll);
+           }
+           else
+           {
+              (*(lgmres_functions->CopyVector))(p[0],w);
+              (*(lgmres_functions->ScaleVector))(rs[0],w);
+
+              /* reg. arnoldi directions */  
+              for (j = 1; j < it_arnoldi; j++) /*first one already done */
+              {
+                 (*(lgmres_functions->Axpy))(rs[j], p[j], w);
+              }
            }
             
            /* augment directions */
@@ -770,8 +826,15 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
 	}
         
         if (i) (*(lgmres_functions->Axpy))(rs[i]-1.0,p[i],p[i]);
-        for (j=i-1 ; j > 0; j--)
-           (*(lgmres_functions->Axpy))(rs[j],p[j],p[i]);
+        if (lgmres_functions->MassAxpy)
+        {
+           if (i > 1) (*(lgmres_functions->MassAxpy))(&rs[1], &p[1], p[i], i-1, unroll);
+        }
+        else
+        {
+           for (j=i-1 ; j > 0; j--)
+              (*(lgmres_functions->Axpy))(rs[j],p[j],p[i]);
+        }
         
         if (i)
         {
@@ -848,6 +911,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    hypre_TFreeF(c,lgmres_functions); 
    hypre_TFreeF(s,lgmres_functions); 
    hypre_TFreeF(rs,lgmres_functions);
+   hypre_TFreeF(hv,lgmres_functions);
 
    for (i=0; i < k_dim+1+aug_dim; i++)
    {	
@@ -886,6 +950,32 @@ hypre_LGMRESGetKDim( void   *lgmres_vdata,
  
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_LGMRESSetCGS, hypre_LGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LGMRESSetCGS( void      *lgmres_vdata,
+                    HYPRE_Int  cgs )
+{
+   hypre_LGMRESData *lgmres_data = (hypre_LGMRESData *)lgmres_vdata;
+
+   (lgmres_data -> cgs) = cgs;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_LGMRESGetCGS( void      *lgmres_vdata,
+                    HYPRE_Int *cgs )
+{
+   hypre_LGMRESData *lgmres_data = (hypre_LGMRESData *)lgmres_vdata;
+
+   *cgs = (lgmres_data -> cgs);
+
+   return hypre_error_flag;
+}
 /*--------------------------------------------------------------------------
  * hypre_LGMRESSetAugDim
  *--------------------------------------------------------------------------*/
@@ -65,6 +65,13 @@ hypre_PCGFunctionsCreate(
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
    pcg_functions->Axpy = Axpy;
+   pcg_functions->NumVectors = NULL;
+   pcg_functions->MultiInnerProd = NULL;
+   pcg_functions->MultiAxpy = NULL;
+   pcg_functions->MultiScaleVector = NULL;
+   pcg_functions->InnerProdLocal = NULL;
+   pcg_functions->IAllreduce = NULL;
+   pcg_functions->Wait = NULL;
 /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
@@ -99,6 +106,8 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> pipelined)    = 0;
+   (pcg_data -> s_step)       = 1;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -109,10 +118,58 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> work)         = NULL;
+   (pcg_data -> num_work)     = 0;
 
    return (void *) pcg_data;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGDestroyWorkVectors, hypre_PCGCreateWorkVectors
+ *
+ * Manage the extra work vectors of the pipelined and s-step solves.  They
+ * are created on first use, like x, and destroyed by the setup.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGDestroyWorkVectors( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int           i;
+
+   for (i = 0; i < (pcg_data -> num_work); i++)
+   {
+      (*(pcg_functions->DestroyVector))(pcg_data -> work[i]);
+   }
+   if ( (pcg_data -> work) != NULL )
+   {
+      hypre_TFreeF( pcg_data -> work, pcg_functions );
+   }
+   (pcg_data -> num_work) = 0;
+}
+
+static void
+hypre_PCGCreateWorkVectors( hypre_PCGData *pcg_data,
+                            void          *x,
+                            HYPRE_Int      num_work )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int           i;
+
+   if ( (pcg_data -> num_work) == num_work )
+   {
+      return;
+   }
+
+   hypre_PCGDestroyWorkVectors(pcg_data);
+   (pcg_data -> work) = hypre_CTAllocF(void *, num_work, pcg_functions, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_work; i++)
+   {
+      (pcg_data -> work[i]) = (*(pcg_functions->CreateVector))(x);
+   }
+   (pcg_data -> num_work) = num_work;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGDestroy
  *--------------------------------------------------------------------------*/
@@ -155,6 +212,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGDestroyWorkVectors(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -212,6 +270,8 @@ hypre_PCGSetup( void *pcg_vdata,
       (*(pcg_functions->DestroyVector))(pcg_data -> r);
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   hypre_PCGDestroyWorkVectors(pcg_data);
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
    (pcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
@@ -238,6 +298,39 @@ hypre_PCGSetup( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGResizeWorkVectors
+ *
+ * (Re)create the work vectors if the setup was done with vectors having a
+ * different number of columns than x.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGResizeWorkVectors( hypre_PCGData *pcg_data,
+                            void          *b,
+                            void          *x )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   if ( (pcg_data -> p) != NULL &&
+        (*(pcg_functions->NumVectors))(pcg_data -> p) == (*(pcg_functions->NumVectors))(x) )
+   {
+      return;
+   }
+
+   if ( (pcg_data -> p) != NULL )
+      (*(pcg_functions->DestroyVector))(pcg_data -> p);
+   (pcg_data -> p) = (*(pcg_functions->CreateVector))(x);
+
+   if ( (pcg_data -> s) != NULL )
+      (*(pcg_functions->DestroyVector))(pcg_data -> s);
+   (pcg_data -> s) = (*(pcg_functions->CreateVector))(x);
+
+   if ( (pcg_data -> r) != NULL )
+      (*(pcg_functions->DestroyVector))(pcg_data -> r);
+   (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSolve
  *--------------------------------------------------------------------------
@@ -311,6 +404,33 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   if ( pcg_functions->NumVectors )
+   {
+      /* block solve for multiple right-hand sides */
+      if ( (*(pcg_functions->NumVectors))(b) > 1 )
+      {
+         return hypre_PCGSolveMulti(pcg_vdata, A, b, x);
+      }
+      hypre_PCGResizeWorkVectors(pcg_data, b, x);
+      p = (pcg_data -> p);
+      s = (pcg_data -> s);
+      r = (pcg_data -> r);
+   }
+
+   /* variants with fused global reductions */
+   if ( pcg_functions->InnerProdLocal && pcg_functions->IAllreduce &&
+        pcg_functions->Wait )
+   {
+      if ( pcg_data -> pipelined )
+      {
+         return hypre_PCGSolvePipelined(pcg_vdata, A, b, x);
+      }
+      if ( (pcg_data -> s_step) > 1 )
+      {
+         return hypre_PCGSolveSStep(pcg_vdata, A, b, x);
+      }
+   }
+
    (pcg_data -> converged) = 0;
 
    (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
@@ -743,119 +863,1247 @@ hypre_PCGSolve( void *pcg_vdata,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_PCGSetTol, hypre_PCGGetTol
+ * hypre_PCGSolveMulti
+ *--------------------------------------------------------------------------
+ *
+ * Block version of hypre_PCGSolve for b and x holding several right-hand
+ * sides (multivectors).  Each column j runs its own CG recurrence, with
+ * alpha_j and beta_j computed from a batched inner product (one global
+ * reduction for all columns), while the matvec and the preconditioner act
+ * on all columns at once so that the operator data is streamed only once
+ * per iteration.  A column that meets the default convergence test
+ *
+ *       <C*r_j,r_j> <= max( tol^2 * <C*b_j,b_j>, a_tol^2 )
+ *
+ * (or its two-norm equivalent) is frozen; the solve stops when all columns
+ * have converged.  The options rel_change, stop_crit, atolf, rtol, cf_tol
+ * and recompute_residual(_p) are not used in block mode.  On return,
+ * num_iterations is the iteration count and rel_residual_norm the largest
+ * relative residual norm over all columns.
+ *
+ * Requires the NumVectors, MultiInnerProd, MultiAxpy and MultiScaleVector
+ * functions.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
-hypre_PCGSetTol( void   *pcg_vdata,
-                 HYPRE_Real  tol       )
+hypre_PCGSolveMulti( void *pcg_vdata,
+                     void *A,
+                     void *b,
+                     void *x         )
 {
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
-
-   (pcg_data -> tol) = tol;
-
-   return hypre_error_flag;
-}
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
 
-HYPRE_Int
-hypre_PCGGetTol( void   *pcg_vdata,
-                 HYPRE_Real * tol       )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+   void           *p, *s, *r;
 
-   *tol = (pcg_data -> tol);
+   HYPRE_Int       num_vectors;
+   HYPRE_Real     *bi_prod, *eps, *gamma, *gamma_old, *sdotp, *i_prod;
+   HYPRE_Complex  *alpha, *beta;
+   HYPRE_Int      *converged;
+   HYPRE_Real      ieee_check = 0.;
+   HYPRE_Real      sum_prod, max_rel = 0.0, max_rel_old;
+   HYPRE_Int       num_converged;
 
-   return hypre_error_flag;
-}
-/*--------------------------------------------------------------------------
- * hypre_PCGSetAbsoluteTol, hypre_PCGGetAbsoluteTol
- *--------------------------------------------------------------------------*/
+   HYPRE_Int       i = 0, j;
+   HYPRE_Int       my_id, num_procs;
 
-HYPRE_Int
-hypre_PCGSetAbsoluteTol( void   *pcg_vdata,
-                 HYPRE_Real  a_tol       )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   (pcg_data -> converged) = 0;
 
-   (pcg_data -> a_tol) = a_tol;
+   if ( !(pcg_functions->MultiInnerProd) || !(pcg_functions->MultiAxpy) ||
+        !(pcg_functions->MultiScaleVector) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Multivector functions not available in PCG");
+      return hypre_error_flag;
+   }
 
-   return hypre_error_flag;
-}
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
 
-HYPRE_Int
-hypre_PCGGetAbsoluteTol( void   *pcg_vdata,
-                 HYPRE_Real * a_tol       )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   num_vectors = (*(pcg_functions->NumVectors))(b);
 
-   *a_tol = (pcg_data -> a_tol);
+   hypre_PCGResizeWorkVectors(pcg_data, b, x);
+   p = (pcg_data -> p);
+   s = (pcg_data -> s);
+   r = (pcg_data -> r);
 
-   return hypre_error_flag;
-}
+   bi_prod   = hypre_CTAllocF(HYPRE_Real,    num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   eps       = hypre_CTAllocF(HYPRE_Real,    num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   gamma     = hypre_CTAllocF(HYPRE_Real,    num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   gamma_old = hypre_CTAllocF(HYPRE_Real,    num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   sdotp     = hypre_CTAllocF(HYPRE_Real,    num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   i_prod    = hypre_CTAllocF(HYPRE_Real,    num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   alpha     = hypre_CTAllocF(HYPRE_Complex, num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   beta      = hypre_CTAllocF(HYPRE_Complex, num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   converged = hypre_CTAllocF(HYPRE_Int,     num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
 
-/*--------------------------------------------------------------------------
- * hypre_PCGSetAbsoluteTolFactor, hypre_PCGGetAbsoluteTolFactor
- *--------------------------------------------------------------------------*/
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      (*(pcg_functions->MultiInnerProd))(b, b, bi_prod);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      (*(pcg_functions->MultiInnerProd))(p, b, bi_prod);
+   }
 
-HYPRE_Int
-hypre_PCGSetAbsoluteTolFactor( void   *pcg_vdata,
-                               HYPRE_Real  atolf   )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   sum_prod = 0.0;
+   for (j = 0; j < num_vectors; j++)
+   {
+      sum_prod += bi_prod[j];
+   }
+   if (sum_prod != 0.) ieee_check = sum_prod/sum_prod; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+        hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+        hypre_printf("ERROR -- hypre_PCGSolveMulti: INFs and/or NaNs detected in input.\n");
+        hypre_printf("User probably placed non-numerics in supplied b.\n");
+        hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+        hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      goto finish;
+   }
 
-   (pcg_data -> atolf) = atolf;
+   /* columns with a zero right-hand side have the solution x_j = 0 */
+   num_converged = 0;
+   for (j = 0; j < num_vectors; j++)
+   {
+      if (bi_prod[j] > 0.0)
+      {
+         eps[j]   = hypre_max(r_tol*r_tol, a_tol*a_tol/bi_prod[j]);
+         beta[j]  = 1.0;
+      }
+      else
+      {
+         converged[j] = 1;
+         num_converged++;
+         beta[j]  = 0.0;
+      }
+   }
+   if (num_converged)
+   {
+      (*(pcg_functions->MultiScaleVector))(beta, x);
+   }
 
-   return hypre_error_flag;
-}
+   /* r = b - Ax */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
 
-HYPRE_Int
-hypre_PCGGetAbsoluteTolFactor( void   *pcg_vdata,
-                               HYPRE_Real  * atolf   )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   /* p = C*r */
+   (*(pcg_functions->ClearVector))(p);
+   precond(precond_data, A, r, p);
 
-   *atolf = (pcg_data -> atolf);
+   /* gamma = <r,p> */
+   (*(pcg_functions->MultiInnerProd))(r, p, gamma);
 
-   return hypre_error_flag;
-}
+   if (two_norm)
+      (*(pcg_functions->MultiInnerProd))(r, r, i_prod);
+   else
+      for (j = 0; j < num_vectors; j++)
+         i_prod[j] = gamma[j];
 
-/*--------------------------------------------------------------------------
- * hypre_PCGSetResidualTol, hypre_PCGGetResidualTol
- *--------------------------------------------------------------------------*/
+   for (j = 0; j < num_vectors; j++)
+   {
+      if (!converged[j])
+         max_rel = hypre_max(max_rel, sqrt(i_prod[j]/bi_prod[j]));
+   }
+   if ( logging>0 || print_level>0 )
+   {
+      norms[0]     = max_rel;
+      rel_norms[0] = max_rel;
+   }
+   if ( print_level > 1 && my_id==0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters  max ||r||_2/||b||_2  conv.rate  converged\n");
+         hypre_printf("-----  -----------------   ---------  ---------\n");
+      }
+      else
+      {
+         hypre_printf("Iters  max ||r||_C/||b||_C  conv.rate  converged\n");
+         hypre_printf("-----  -----------------   ---------  ---------\n");
+      }
+   }
 
-HYPRE_Int
-hypre_PCGSetResidualTol( void   *pcg_vdata,
-                         HYPRE_Real  rtol   )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   while ( num_converged < num_vectors && (i+1) <= max_iter )
+   {
+      i++;
 
-   (pcg_data -> rtol) = rtol;
+      /* s = A*p */
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
 
-   return hypre_error_flag;
-}
+      /* alpha = gamma / <s,p> */
+      (*(pcg_functions->MultiInnerProd))(s, p, sdotp);
+      for (j = 0; j < num_vectors; j++)
+      {
+         alpha[j] = 0.0;
+         if (!converged[j])
+         {
+            if ( sdotp[j] != 0.0 && (gamma[j] / sdotp[j]) > HYPRE_REAL_MIN )
+            {
+               alpha[j] = gamma[j] / sdotp[j];
+            }
+            else
+            {
+               /* breakdown: stop updating this column */
+               hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero sdotp or subnormal alpha value in PCG");
+               converged[j] = -1;
+               num_converged++;
+            }
+         }
+      }
 
-HYPRE_Int
-hypre_PCGGetResidualTol( void   *pcg_vdata,
-                         HYPRE_Real  * rtol   )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+      /* x = x + alpha*p */
+      (*(pcg_functions->MultiAxpy))(alpha, p, x);
 
-   *rtol = (pcg_data -> rtol);
+      /* r = r - alpha*s */
+      for (j = 0; j < num_vectors; j++)
+      {
+         alpha[j] = -alpha[j];
+      }
+      (*(pcg_functions->MultiAxpy))(alpha, s, r);
 
-   return hypre_error_flag;
-}
+      /* s = C*r */
+      (*(pcg_functions->ClearVector))(s);
+      precond(precond_data, A, r, s);
 
-/*--------------------------------------------------------------------------
- * hypre_PCGSetConvergenceFactorTol, hypre_PCGGetConvergenceFactorTol
- *--------------------------------------------------------------------------*/
+      /* gamma = <r,s> */
+      for (j = 0; j < num_vectors; j++)
+      {
+         gamma_old[j] = gamma[j];
+      }
+      (*(pcg_functions->MultiInnerProd))(r, s, gamma);
 
-HYPRE_Int
-hypre_PCGSetConvergenceFactorTol( void   *pcg_vdata,
-                                  HYPRE_Real  cf_tol   )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+      /* set i_prod for convergence test */
+      if (two_norm)
+         (*(pcg_functions->MultiInnerProd))(r, r, i_prod);
+      else
+         for (j = 0; j < num_vectors; j++)
+            i_prod[j] = gamma[j];
 
-   (pcg_data -> cf_tol) = cf_tol;
+      /* check for convergence of each column */
+      max_rel_old = max_rel;
+      max_rel = 0.0;
+      for (j = 0; j < num_vectors; j++)
+      {
+         if (!converged[j])
+         {
+            max_rel = hypre_max(max_rel, sqrt(i_prod[j]/bi_prod[j]));
+            if (i_prod[j] / bi_prod[j] < eps[j])
+            {
+               converged[j] = 1;
+               num_converged++;
+            }
+            else if (! (gamma[j] > HYPRE_REAL_MIN) )
+            {
+               hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+               converged[j] = -1;
+               num_converged++;
+            }
+         }
+      }
+
+      if ( logging>0 || print_level>0 )
+      {
+         norms[i]     = max_rel;
+         rel_norms[i] = max_rel;
+      }
+      if ( print_level > 1 && my_id==0 )
+      {
+         hypre_printf("% 5d    %e     %f    %d/%d\n", i, max_rel,
+                      max_rel_old ? max_rel/max_rel_old : 0.0,
+                      num_converged, num_vectors);
+      }
+
+      /* p = s + beta p, for the columns still iterating */
+      for (j = 0; j < num_vectors; j++)
+      {
+         beta[j] = converged[j] ? 0.0 : gamma[j] / gamma_old[j];
+      }
+      (*(pcg_functions->MultiScaleVector))(beta, p);
+      (*(pcg_functions->Axpy))(1.0, s, p);
+   }
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   /* the largest relative residual norm over all columns */
+   max_rel = 0.0;
+   for (j = 0; j < num_vectors; j++)
+   {
+      if (bi_prod[j] > 0.0)
+         max_rel = hypre_max(max_rel, sqrt(i_prod[j]/bi_prod[j]));
+   }
+
+   if (num_converged < num_vectors && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+   else
+   {
+      (pcg_data -> converged) = 1;
+      for (j = 0; j < num_vectors; j++)
+      {
+         if (converged[j] < 0)
+         {
+            (pcg_data -> converged) = 0;
+         }
+      }
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = max_rel;
+
+finish:
+   hypre_TFreeF(bi_prod, pcg_functions);
+   hypre_TFreeF(eps, pcg_functions);
+   hypre_TFreeF(gamma, pcg_functions);
+   hypre_TFreeF(gamma_old, pcg_functions);
+   hypre_TFreeF(sdotp, pcg_functions);
+   hypre_TFreeF(i_prod, pcg_functions);
+   hypre_TFreeF(alpha, pcg_functions);
+   hypre_TFreeF(beta, pcg_functions);
+   hypre_TFreeF(converged, pcg_functions);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGPipelinedResidual
+ *
+ * Replace the recursively updated vectors of the pipelined solve by their
+ * true values: r = b - A*x, u = C*r, w = A*u, s = A*p, q = C*s, z = A*q.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGPipelinedResidual( hypre_PCGData *pcg_data,
+                            void          *A,
+                            void          *b,
+                            void          *x )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *u            = (pcg_data -> work[0]);
+   void           *w            = (pcg_data -> work[1]);
+   void           *z            = (pcg_data -> work[4]);
+   void           *q            = (pcg_data -> work[5]);
+
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
+   (*(pcg_functions->ClearVector))(q);
+   precond(precond_data, A, s, q);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, q, 0.0, z);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolvePipelined
+ *--------------------------------------------------------------------------
+ *
+ * Pipelined PCG of Ghysels and Vanroose (Parallel Computing 40, 2014).
+ * Recurrences for u = C*r and w = A*u let the two inner products of an
+ * iteration, <r,u> and <w,u> (and <r,r> for the two-norm test), be combined
+ * into a single global reduction, which is started before and completed
+ * after the preconditioner and matvec of the same iteration, m = C*w and
+ * n = A*m.  This costs six extra vectors and four extra vector updates per
+ * iteration, and pays off when the latency of the reduction dominates.
+ *
+ * The recurrences are less stable than those of hypre_PCGSolve.  With
+ * recompute_residual_p, all recursively updated vectors are replaced by
+ * their true values periodically; with recompute_residual, this is done
+ * before convergence is accepted.  The options rel_change, stop_crit,
+ * atolf, rtol and cf_tol are not used.
+ *
+ * Requires the InnerProdLocal, IAllreduce and Wait functions.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolvePipelined( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x         )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       recompute_residual   = (pcg_data -> recompute_residual);
+   HYPRE_Int       recompute_residual_p = (pcg_data -> recompute_residual_p);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+   void           *u, *w, *m, *n, *z, *q;
+
+   HYPRE_Real      local_prods[3], prods[3];
+   HYPRE_Int       num_prods    = two_norm ? 3 : 2;
+   void           *request;
+   HYPRE_Real      alpha = 0.0, alpha_old = 0.0, beta;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta;
+   HYPRE_Real      bi_prod, eps, i_prod = 0.0;
+   HYPRE_Real      ieee_check = 0.;
+   HYPRE_Int       residual_recomputed = 0;
+
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+
+   hypre_PCGCreateWorkVectors(pcg_data, x, 6);
+   u = (pcg_data -> work[0]);
+   w = (pcg_data -> work[1]);
+   m = (pcg_data -> work[2]);
+   n = (pcg_data -> work[3]);
+   z = (pcg_data -> work[4]);
+   q = (pcg_data -> work[5]);
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+   }
+
+   if (bi_prod != 0.) ieee_check = bi_prod/bi_prod; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in input to PCG");
+      return hypre_error_flag;
+   }
+
+   if ( !(bi_prod > 0.0) )
+   {
+      /* the rhs vector b is zero: set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging>0 || print_level>0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+      return hypre_error_flag;
+   }
+   eps = hypre_max(r_tol*r_tol, a_tol*a_tol/bi_prod);
+
+   /* p = s = q = z = 0, r = b - Ax, u = C*r, w = A*u */
+   (*(pcg_functions->ClearVector))(p);
+   (*(pcg_functions->ClearVector))(s);
+   (*(pcg_functions->ClearVector))(q);
+   (*(pcg_functions->ClearVector))(z);
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   if ( print_level > 1 && my_id==0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   while (1)
+   {
+      /* start the reduction for <r,u>, <w,u> (and <r,r>) */
+      (*(pcg_functions->InnerProdLocal))(r, u, &local_prods[0]);
+      (*(pcg_functions->InnerProdLocal))(w, u, &local_prods[1]);
+      if (two_norm)
+      {
+         (*(pcg_functions->InnerProdLocal))(r, r, &local_prods[2]);
+      }
+      (*(pcg_functions->IAllreduce))(r, local_prods, prods, num_prods, &request);
+
+      /* m = C*w, n = A*m, overlapped with the reduction */
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+
+      (*(pcg_functions->Wait))(request);
+      gamma  = prods[0];
+      delta  = prods[1];
+      i_prod = two_norm ? prods[2] : gamma;
+
+      if (gamma != 0.) ieee_check = gamma/gamma; /* INF -> NaN conversion */
+      if (ieee_check != ieee_check)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in PCG");
+         break;
+      }
+
+      /* print norm info */
+      if ( logging>0 || print_level>0 )
+      {
+         norms[i]     = sqrt(i_prod);
+         rel_norms[i] = sqrt(i_prod/bi_prod);
+      }
+      if ( print_level > 1 && my_id==0 && i > 0 )
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                      norms[i]/norms[i-1], rel_norms[i] );
+      }
+
+      /* check for convergence */
+      if (i_prod / bi_prod < eps)
+      {
+         if ( !recompute_residual || residual_recomputed )
+         {
+            (pcg_data -> converged) = 1;
+            break;
+         }
+         /* don't trust the convergence test until the residual has been
+            recomputed from scratch */
+         hypre_PCGPipelinedResidual(pcg_data, A, b, x);
+         residual_recomputed = 1;
+         continue;
+      }
+      residual_recomputed = 0;
+
+      if (! (gamma > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+         break;
+      }
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      /* alpha = gamma / <A*p,p>, computed from the recurrences */
+      if (i > 0)
+      {
+         beta  = gamma / gamma_old;
+         alpha = delta - beta*gamma/alpha_old;
+      }
+      else
+      {
+         beta  = 0.0;
+         alpha = delta;
+      }
+      if ( alpha == 0.0 || !(gamma / alpha > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero or subnormal alpha value in PCG");
+         break;
+      }
+      alpha = gamma / alpha;
+
+      i++;
+
+      /* z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p */
+      (*(pcg_functions->ScaleVector))(beta, z);
+      (*(pcg_functions->Axpy))(1.0, n, z);
+      (*(pcg_functions->ScaleVector))(beta, q);
+      (*(pcg_functions->Axpy))(1.0, m, q);
+      (*(pcg_functions->ScaleVector))(beta, s);
+      (*(pcg_functions->Axpy))(1.0, w, s);
+      (*(pcg_functions->ScaleVector))(beta, p);
+      (*(pcg_functions->Axpy))(1.0, u, p);
+
+      /* x = x + alpha*p, r = r - alpha*s, u = u - alpha*q, w = w - alpha*z */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      (*(pcg_functions->Axpy))(-alpha, q, u);
+      (*(pcg_functions->Axpy))(-alpha, z, w);
+
+      /* At user request, periodically replace the recursively updated vectors
+         by their true values */
+      if ( recompute_residual_p && !(i%recompute_residual_p) )
+      {
+         if (print_level > 1 && my_id == 0)
+         {
+            hypre_printf("Recomputing the residual...\n");
+         }
+         hypre_PCGPipelinedResidual(pcg_data, A, b, x);
+      }
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+   }
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   if (i >= max_iter && (i_prod/bi_prod) >= eps && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGDenseFactor, hypre_PCGDenseSolve
+ *
+ * LU factorization with partial pivoting of a small dense n x n matrix
+ * (row-major), and the solution of a system with it for nrhs right-hand
+ * sides stored as the columns of an n x nrhs (row-major) array.  The factor
+ * returns 1 if the matrix is numerically singular.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGDenseFactor( HYPRE_Int   n,
+                      HYPRE_Real *lu,
+                      HYPRE_Int  *piv )
+{
+   HYPRE_Int   i, j, k, kp;
+   HYPRE_Real  val, max_val = 0.0;
+
+   for (i = 0; i < n*n; i++)
+   {
+      max_val = hypre_max(max_val, fabs(lu[i]));
+   }
+
+   for (k = 0; k < n; k++)
+   {
+      kp = k;
+      for (i = k+1; i < n; i++)
+      {
+         if (fabs(lu[i*n+k]) > fabs(lu[kp*n+k]))
+         {
+            kp = i;
+         }
+      }
+      piv[k] = kp;
+      if ( !(fabs(lu[kp*n+k]) > n*HYPRE_REAL_EPSILON*max_val) )
+      {
+         return 1;
+      }
+      if (kp != k)
+      {
+         for (j = 0; j < n; j++)
+         {
+            val = lu[k*n+j]; lu[k*n+j] = lu[kp*n+j]; lu[kp*n+j] = val;
+         }
+      }
+      for (i = k+1; i < n; i++)
+      {
+         lu[i*n+k] /= lu[k*n+k];
+         for (j = k+1; j < n; j++)
+         {
+            lu[i*n+j] -= lu[i*n+k]*lu[k*n+j];
+         }
+      }
+   }
+
+   return 0;
+}
+
+static void
+hypre_PCGDenseSolve( HYPRE_Int   n,
+                     HYPRE_Real *lu,
+                     HYPRE_Int  *piv,
+                     HYPRE_Int   nrhs,
+                     HYPRE_Real *rhs )
+{
+   HYPRE_Int   i, k, c;
+   HYPRE_Real  val;
+
+   for (k = 0; k < n; k++)
+   {
+      if (piv[k] != k)
+      {
+         for (c = 0; c < nrhs; c++)
+         {
+            val = rhs[k*nrhs+c]; rhs[k*nrhs+c] = rhs[piv[k]*nrhs+c]; rhs[piv[k]*nrhs+c] = val;
+         }
+      }
+   }
+   for (i = 1; i < n; i++)
+   {
+      for (k = 0; k < i; k++)
+      {
+         for (c = 0; c < nrhs; c++)
+         {
+            rhs[i*nrhs+c] -= lu[i*n+k]*rhs[k*nrhs+c];
+         }
+      }
+   }
+   for (i = n-1; i >= 0; i--)
+   {
+      for (k = i+1; k < n; k++)
+      {
+         for (c = 0; c < nrhs; c++)
+         {
+            rhs[i*nrhs+c] -= lu[i*n+k]*rhs[k*nrhs+c];
+         }
+      }
+      for (c = 0; c < nrhs; c++)
+      {
+         rhs[i*nrhs+c] /= lu[i*n+i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolveSStep
+ *--------------------------------------------------------------------------
+ *
+ * s-step PCG of Chronopoulos and Gear (J. Comput. Appl. Math. 25, 1989).
+ * Each outer step builds the monomial basis V = [C*r, (C*A)*C*r, ...,
+ * (C*A)^(s-1)*C*r] together with A*V, and computes all inner products it
+ * needs, V^T*A*V, V^T*A*P_old and V^T*r (and <r,r> for the two-norm test),
+ * in a single global reduction.  The block of search directions P = V +
+ * P_old*B is made A-conjugate to the previous block by solving small s x s
+ * systems, and x and r are updated by s iterations at once.  This replaces
+ * the 2s reductions of s standard PCG iterations by one, at the cost of 4s
+ * extra vectors and O(s^2) vector updates per outer step.
+ *
+ * The monomial basis becomes ill-conditioned quickly, so s is at most 5.
+ * When the s x s system of a step is (numerically) singular or does not
+ * reduce the error, that step is dropped and the iteration restarts from
+ * the current residual with s-1 (s = 1 is standard PCG).  Convergence is
+ * tested once per outer step, and the basis built for the final test is not
+ * used.  The iteration count advances by s per outer step and does not
+ * exceed max_iter.  With recompute_residual, the residual is recomputed
+ * before convergence is accepted; the options recompute_residual_p,
+ * rel_change, stop_crit, atolf, rtol and cf_tol are not used.
+ *
+ * Requires the InnerProdLocal, IAllreduce and Wait functions.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolveSStep( void *pcg_vdata,
+                     void *A,
+                     void *b,
+                     void *x         )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       recompute_residual = (pcg_data -> recompute_residual);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   HYPRE_Int       s_step       = (pcg_data -> s_step);
+   void           *r            = (pcg_data -> r);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   void          **V, **AV, **P, **AP, **tmp;
+   HYPRE_Real     *G1, *G2, *g, *W, *W_new, *B, *coef;
+   HYPRE_Real     *local_prods, *prods;
+   HYPRE_Int      *piv;
+   HYPRE_Int       num_prods;
+   void           *request;
+   HYPRE_Real      gamma, bi_prod, eps, i_prod = 0.0, i_prod_old = 0.0;
+   HYPRE_Real      energy, piv_min, piv_max;
+   HYPRE_Real      ieee_check = 0.;
+   HYPRE_Int       residual_recomputed = 0;
+   HYPRE_Int       breakdown, restarted = 0;
+   HYPRE_Int       s = s_step;
+
+   HYPRE_Int       i = 0, k = 0, j, l, ii, np;
+   HYPRE_Int       my_id, num_procs;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+
+   hypre_PCGCreateWorkVectors(pcg_data, x, 4*s_step);
+   V  = hypre_CTAllocF(void *, s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   AV = hypre_CTAllocF(void *, s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   P  = hypre_CTAllocF(void *, s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   AP = hypre_CTAllocF(void *, s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   for (j = 0; j < s_step; j++)
+   {
+      V[j]  = (pcg_data -> work[j]);
+      AV[j] = (pcg_data -> work[s_step+j]);
+      P[j]  = (pcg_data -> work[2*s_step+j]);
+      AP[j] = (pcg_data -> work[3*s_step+j]);
+   }
+
+   G1    = hypre_CTAllocF(HYPRE_Real, s_step*s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   G2    = hypre_CTAllocF(HYPRE_Real, s_step*s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   W     = hypre_CTAllocF(HYPRE_Real, s_step*s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   W_new = hypre_CTAllocF(HYPRE_Real, s_step*s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   B     = hypre_CTAllocF(HYPRE_Real, s_step*s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   g     = hypre_CTAllocF(HYPRE_Real, s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   coef  = hypre_CTAllocF(HYPRE_Real, s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   piv   = hypre_CTAllocF(HYPRE_Int,  s_step, pcg_functions, HYPRE_MEMORY_HOST);
+   /* upper triangle of V^T*A*V, V^T*A*P_old, V^T*r and <r,r> */
+   num_prods   = s_step*(s_step+1)/2 + s_step*s_step + s_step + 1;
+   local_prods = hypre_CTAllocF(HYPRE_Real, num_prods, pcg_functions, HYPRE_MEMORY_HOST);
+   prods       = hypre_CTAllocF(HYPRE_Real, num_prods, pcg_functions, HYPRE_MEMORY_HOST);
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(V[0]);
+      precond(precond_data, A, b, V[0]);
+      bi_prod = (*(pcg_functions->InnerProd))(V[0], b);
+   }
+
+   if (bi_prod != 0.) ieee_check = bi_prod/bi_prod; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in input to PCG");
+      goto finish;
+   }
+
+   if ( !(bi_prod > 0.0) )
+   {
+      /* the rhs vector b is zero: set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging>0 || print_level>0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+      goto finish;
+   }
+   eps = hypre_max(r_tol*r_tol, a_tol*a_tol/bi_prod);
+
+   /* r = b - Ax */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+
+   if ( print_level > 1 && my_id==0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   while (1)
+   {
+      /* V_0 = C*r, AV_j = A*V_j, V_{j+1} = C*AV_j */
+      (*(pcg_functions->ClearVector))(V[0]);
+      precond(precond_data, A, r, V[0]);
+      for (j = 0; j < s; j++)
+      {
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, V[j], 0.0, AV[j]);
+         if (j < s-1)
+         {
+            (*(pcg_functions->ClearVector))(V[j+1]);
+            precond(precond_data, A, AV[j], V[j+1]);
+         }
+      }
+
+      /* one reduction for all inner products of this outer step */
+      np = 0;
+      for (j = 0; j < s; j++)
+      {
+         for (l = j; l < s; l++)
+         {
+            (*(pcg_functions->InnerProdLocal))(V[j], AV[l], &local_prods[np++]);
+         }
+      }
+      if (k > 0)
+      {
+         for (j = 0; j < s; j++)
+         {
+            for (l = 0; l < s; l++)
+            {
+               (*(pcg_functions->InnerProdLocal))(V[j], AP[l], &local_prods[np++]);
+            }
+         }
+      }
+      for (j = 0; j < s; j++)
+      {
+         (*(pcg_functions->InnerProdLocal))(V[j], r, &local_prods[np++]);
+      }
+      if (two_norm)
+      {
+         (*(pcg_functions->InnerProdLocal))(r, r, &local_prods[np++]);
+      }
+      (*(pcg_functions->IAllreduce))(r, local_prods, prods, np, &request);
+      (*(pcg_functions->Wait))(request);
+
+      np = 0;
+      for (j = 0; j < s; j++)
+      {
+         for (l = j; l < s; l++)
+         {
+            G1[j*s+l] = G1[l*s+j] = prods[np++];
+         }
+      }
+      if (k > 0)
+      {
+         for (j = 0; j < s*s; j++)
+         {
+            G2[j] = prods[np++];
+         }
+      }
+      for (j = 0; j < s; j++)
+      {
+         g[j] = prods[np++];
+      }
+      gamma  = g[0];
+      i_prod = two_norm ? prods[np] : gamma;
+
+      if (gamma != 0.) ieee_check = gamma/gamma; /* INF -> NaN conversion */
+      if (ieee_check != ieee_check)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in PCG");
+         break;
+      }
+
+      /* print norm info */
+      if ( logging>0 || print_level>0 )
+      {
+         norms[i]     = sqrt(i_prod);
+         rel_norms[i] = sqrt(i_prod/bi_prod);
+      }
+      if ( print_level > 1 && my_id==0 && i > 0 && !restarted )
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", i, sqrt(i_prod),
+                      sqrt(i_prod/i_prod_old), sqrt(i_prod/bi_prod) );
+      }
+      i_prod_old = i_prod;
+      restarted  = 0;
+
+      /* check for convergence */
+      if (i_prod / bi_prod < eps)
+      {
+         if ( !recompute_residual || residual_recomputed )
+         {
+            (pcg_data -> converged) = 1;
+            break;
+         }
+         /* don't trust the convergence test until the residual has been
+            recomputed from scratch */
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         residual_recomputed = 1;
+         continue;
+      }
+      residual_recomputed = 0;
+
+      if (! (gamma > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+         break;
+      }
+      if (i + s > max_iter)
+      {
+         break;
+      }
+
+      if (k > 0)
+      {
+         /* B = -W_old^{-1} (V^T*A*P_old)^T, with W_old = P_old^T*A*P_old */
+         for (ii = 0; ii < s; ii++)
+         {
+            for (l = 0; l < s; l++)
+            {
+               B[ii*s+l] = -G2[l*s+ii];
+            }
+         }
+         hypre_PCGDenseSolve(s, W, piv, s, B);
+
+         /* W = P^T*A*P = V^T*A*V + (V^T*A*P_old)*B */
+         for (j = 0; j < s; j++)
+         {
+            for (l = 0; l < s; l++)
+            {
+               W_new[j*s+l] = G1[j*s+l];
+               for (ii = 0; ii < s; ii++)
+               {
+                  W_new[j*s+l] += G2[j*s+ii]*B[ii*s+l];
+               }
+            }
+         }
+
+         /* P = V + P_old*B and A*P = A*V + A*P_old*B, formed in place of V */
+         for (j = 0; j < s; j++)
+         {
+            for (ii = 0; ii < s; ii++)
+            {
+               (*(pcg_functions->Axpy))(B[ii*s+j], P[ii], V[j]);
+               (*(pcg_functions->Axpy))(B[ii*s+j], AP[ii], AV[j]);
+            }
+         }
+      }
+      else
+      {
+         for (j = 0; j < s*s; j++)
+         {
+            W_new[j] = G1[j];
+         }
+      }
+      tmp = P;  P  = V;  V  = tmp;
+      tmp = AP; AP = AV; AV = tmp;
+
+      /* coef = W^{-1} P^T*r, where P^T*r = V^T*r since P_old^T*r = 0 */
+      for (j = 0; j < s*s; j++)
+      {
+         W[j] = W_new[j];
+      }
+      breakdown = hypre_PCGDenseFactor(s, W, piv);
+      if (!breakdown)
+      {
+         /* pivot ratio as a cheap estimate of the conditioning of W */
+         piv_min = piv_max = fabs(W[0]);
+         for (j = 1; j < s; j++)
+         {
+            piv_min = hypre_min(piv_min, fabs(W[j*s+j]));
+            piv_max = hypre_max(piv_max, fabs(W[j*s+j]));
+         }
+         breakdown = (piv_min < sqrt(HYPRE_REAL_EPSILON)*piv_max);
+      }
+      if (!breakdown)
+      {
+         for (j = 0; j < s; j++)
+         {
+            coef[j] = g[j];
+         }
+         hypre_PCGDenseSolve(s, W, piv, 1, coef);
+
+         /* the step must reduce the A-norm of the error by coef^T*g > 0 */
+         energy = 0.0;
+         for (j = 0; j < s; j++)
+         {
+            energy += coef[j]*g[j];
+         }
+         breakdown = !(energy > 0.0);
+      }
+      if (breakdown)
+      {
+         if (s == 1)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_CONV, "Singular s-step matrix in PCG");
+            break;
+         }
+         /* the basis has lost independence: restart from the current
+            residual with a smaller s (s = 1 is standard PCG) */
+         s--;
+         k = 0;
+         restarted = 1;
+         continue;
+      }
+
+      /* x = x + P*coef, r = r - A*P*coef */
+      for (j = 0; j < s; j++)
+      {
+         (*(pcg_functions->Axpy))(coef[j], P[j], x);
+         (*(pcg_functions->Axpy))(-coef[j], AP[j], r);
+      }
+
+      i += s;
+      k++;
+   }
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   if (!(pcg_data -> converged) && i + s > max_iter && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+finish:
+   hypre_TFreeF(V, pcg_functions);
+   hypre_TFreeF(AV, pcg_functions);
+   hypre_TFreeF(P, pcg_functions);
+   hypre_TFreeF(AP, pcg_functions);
+   hypre_TFreeF(G1, pcg_functions);
+   hypre_TFreeF(G2, pcg_functions);
+   hypre_TFreeF(W, pcg_functions);
+   hypre_TFreeF(W_new, pcg_functions);
+   hypre_TFreeF(B, pcg_functions);
+   hypre_TFreeF(g, pcg_functions);
+   hypre_TFreeF(coef, pcg_functions);
+   hypre_TFreeF(piv, pcg_functions);
+   hypre_TFreeF(local_prods, pcg_functions);
+   hypre_TFreeF(prods, pcg_functions);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetTol, hypre_PCGGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetTol( void   *pcg_vdata,
+                 HYPRE_Real  tol       )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetTol( void   *pcg_vdata,
+                 HYPRE_Real * tol       )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *tol = (pcg_data -> tol);
+
+   return hypre_error_flag;
+}
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetAbsoluteTol, hypre_PCGGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetAbsoluteTol( void   *pcg_vdata,
+                 HYPRE_Real  a_tol       )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> a_tol) = a_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetAbsoluteTol( void   *pcg_vdata,
+                 HYPRE_Real * a_tol       )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *a_tol = (pcg_data -> a_tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetAbsoluteTolFactor, hypre_PCGGetAbsoluteTolFactor
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetAbsoluteTolFactor( void   *pcg_vdata,
+                               HYPRE_Real  atolf   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> atolf) = atolf;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetAbsoluteTolFactor( void   *pcg_vdata,
+                               HYPRE_Real  * atolf   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *atolf = (pcg_data -> atolf);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetResidualTol, hypre_PCGGetResidualTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetResidualTol( void   *pcg_vdata,
+                         HYPRE_Real  rtol   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> rtol) = rtol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetResidualTol( void   *pcg_vdata,
+                         HYPRE_Real  * rtol   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *rtol = (pcg_data -> rtol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetConvergenceFactorTol, hypre_PCGGetConvergenceFactorTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetConvergenceFactorTol( void   *pcg_vdata,
+                                  HYPRE_Real  cf_tol   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> cf_tol) = cf_tol;
 
    return hypre_error_flag;
 }
@@ -1008,6 +2256,64 @@ hypre_PCGGetRecomputeResidualP( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int   pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int * pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetSStep, hypre_PCGGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetSStep( void *pcg_vdata,
+                   HYPRE_Int   s_step  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   /* the monomial basis is too ill-conditioned for larger s */
+   if (s_step < 1 || s_step > 5)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (pcg_data -> s_step) = s_step;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetSStep( void *pcg_vdata,
+                   HYPRE_Int * s_step  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *s_step = (pcg_data -> s_step);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetStopCrit, hypre_PCGGetStopCrit
  *--------------------------------------------------------------------------*/
@@ -64,6 +64,20 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional multivector operations for block solves (NULL if not available) */
+   HYPRE_Int    (*NumVectors)    ( void *x );
+   HYPRE_Int    (*MultiInnerProd)( void *x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*MultiAxpy)     ( HYPRE_Complex *alpha, void *x, void *y );
+   HYPRE_Int    (*MultiScaleVector)( HYPRE_Complex *alpha, void *x );
+
+   /* optional split reductions for pipelined and s-step solves (NULL if not
+      available): InnerProdLocal computes this process' part of <x,y>, and
+      IAllreduce starts a sum over the processes of x that Wait completes */
+   HYPRE_Int    (*InnerProdLocal)( void *x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*IAllreduce)    ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                   HYPRE_Int count, void **request );
+   HYPRE_Int    (*Wait)          ( void *request );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -119,12 +133,16 @@ typedef struct
    HYPRE_Int    stop_crit;
    HYPRE_Int    converged;
    HYPRE_Int    hybrid;
+   HYPRE_Int    pipelined;
+   HYPRE_Int    s_step;
 
    void    *A;
    void    *p;
    void    *s;
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                   If that is ever changed, it still must be kept if logging>1 */
+   void   **work; /* extra work vectors of the pipelined and s-step solves */
+   HYPRE_Int num_work;
 
    HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void      *matvec_data;
@@ -50,6 +50,22 @@ HYPRE_BoomerAMGSetup( HYPRE_Solver solver,
                                  (hypre_ParVector *) x ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGResetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGResetup( HYPRE_Solver solver,
+                        HYPRE_ParCSRMatrix A,
+                        HYPRE_ParVector b,
+                        HYPRE_ParVector x      )
+{
+   return( hypre_BoomerAMGResetup( (void *) solver,
+                                   (hypre_ParCSRMatrix *) A,
+                                   (hypre_ParVector *) b,
+                                   (hypre_ParVector *) x ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSolve
  *--------------------------------------------------------------------------*/
@@ -774,6 +790,50 @@ HYPRE_BoomerAMGSetRelaxOrder( HYPRE_Solver  solver,
    return( hypre_BoomerAMGSetRelaxOrder( (void *) solver, relax_order ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRelaxOverlap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRelaxOverlap( HYPRE_Solver  solver,
+                                HYPRE_Int     relax_overlap )
+{
+   return( hypre_BoomerAMGSetRelaxOverlap( (void *) solver, relax_overlap ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRelaxPlan
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRelaxPlan( HYPRE_Solver  solver,
+                             HYPRE_Int     relax_plan )
+{
+   return( hypre_BoomerAMGSetRelaxPlan( (void *) solver, relax_plan ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFloatLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFloatLevel( HYPRE_Solver  solver,
+                              HYPRE_Int     float_level )
+{
+   return( hypre_BoomerAMGSetFloatLevel( (void *) solver, float_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFloatDropDouble
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFloatDropDouble( HYPRE_Solver  solver,
+                                   HYPRE_Int     float_drop_double )
+{
+   return( hypre_BoomerAMGSetFloatDropDouble( (void *) solver, float_drop_double ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetGridRelaxPoints
  * DEPRECATED.  There are memory management problems associated with the
@@ -1851,6 +1911,67 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFusedRAP
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFusedRAP (HYPRE_Solver solver,
+                            HYPRE_Int    fused_rap)
+{
+   return (hypre_BoomerAMGSetFusedRAP ( (void *) solver, fused_rap ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetRAPPeakMemory
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetRAPPeakMemory (HYPRE_Solver  solver,
+                                 HYPRE_Real   *peak_memory)
+{
+   return (hypre_BoomerAMGGetRAPPeakMemory ( (void *) solver, peak_memory ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetPhaseStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetPhaseStats (HYPRE_Solver solver,
+                              HYPRE_Int    phase_stats)
+{
+   return (hypre_BoomerAMGSetPhaseStats ( (void *) solver, phase_stats ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetPhaseStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetPhaseStats (HYPRE_Solver  solver,
+                              HYPRE_Int     level,
+                              HYPRE_Int     phase,
+                              HYPRE_Real   *time,
+                              HYPRE_Real   *bytes,
+                              HYPRE_Real   *messages,
+                              HYPRE_Real   *nnz)
+{
+   return (hypre_BoomerAMGGetPhaseStats ( (void *) solver, level, phase,
+                                          time, bytes, messages, nnz ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGPrintPhaseStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGPrintPhaseStats (HYPRE_Solver  solver,
+                                const char   *filename)
+{
+   return (hypre_BoomerAMGPrintPhaseStats ( (void *) solver, filename ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
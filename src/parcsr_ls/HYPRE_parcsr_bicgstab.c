@@ -31,6 +31,9 @@ HYPRE_ParCSRBiCGSTABCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovCommInfo,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   bicgstab_functions->MassDotpTwo = hypre_ParKrylovMassDotpTwo;
+#endif
    *solver = ( (HYPRE_Solver) hypre_BiCGSTABCreate( bicgstab_functions) );
     
    return hypre_error_flag;
@@ -32,6 +32,11 @@ HYPRE_ParCSRFlexGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   fgmres_functions->MassInnerProd = hypre_ParKrylovMassInnerProd;
+   fgmres_functions->MassDotpTwo   = hypre_ParKrylovMassDotpTwo;
+   fgmres_functions->MassAxpy      = hypre_ParKrylovMassAxpy;
+#endif
    *solver = ( (HYPRE_Solver) hypre_FlexGMRESCreate( fgmres_functions ) );
 
    return hypre_error_flag;
@@ -90,6 +95,17 @@ HYPRE_ParCSRFlexGMRESSetKDim( HYPRE_Solver solver,
    return( HYPRE_FlexGMRESSetKDim( solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRFlexGMRESSetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRFlexGMRESSetCGS( HYPRE_Solver solver,
+                             HYPRE_Int    cgs )
+{
+   return( HYPRE_FlexGMRESSetCGS( solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRFlexGMRESSetTol
  *--------------------------------------------------------------------------*/
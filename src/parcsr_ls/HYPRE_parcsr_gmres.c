@@ -32,6 +32,11 @@ HYPRE_ParCSRGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   gmres_functions->MassInnerProd = hypre_ParKrylovMassInnerProd;
+   gmres_functions->MassDotpTwo   = hypre_ParKrylovMassDotpTwo;
+   gmres_functions->MassAxpy      = hypre_ParKrylovMassAxpy;
+#endif
    *solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
@@ -90,6 +95,17 @@ HYPRE_ParCSRGMRESSetKDim( HYPRE_Solver solver,
    return( HYPRE_GMRESSetKDim( solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGMRESSetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGMRESSetCGS( HYPRE_Solver solver,
+                         HYPRE_Int    cgs )
+{
+   return( HYPRE_GMRESSetCGS( solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRGMRESSetTol
  *--------------------------------------------------------------------------*/
@@ -32,6 +32,11 @@ HYPRE_ParCSRLGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   lgmres_functions->MassInnerProd = hypre_ParKrylovMassInnerProd;
+   lgmres_functions->MassDotpTwo   = hypre_ParKrylovMassDotpTwo;
+   lgmres_functions->MassAxpy      = hypre_ParKrylovMassAxpy;
+#endif
    *solver = ( (HYPRE_Solver) hypre_LGMRESCreate( lgmres_functions ) );
 
    return hypre_error_flag;
@@ -90,6 +95,17 @@ HYPRE_ParCSRLGMRESSetKDim( HYPRE_Solver solver,
    return( HYPRE_LGMRESSetKDim( solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRLGMRESSetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRLGMRESSetCGS( HYPRE_Solver solver,
+                          HYPRE_Int    cgs )
+{
+   return( HYPRE_LGMRESSetCGS( solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRLGMRESSetAugDim
  *--------------------------------------------------------------------------*/
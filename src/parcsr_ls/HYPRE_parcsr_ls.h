@@ -102,6 +102,27 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
                                HYPRE_ParVector    b,
                                HYPRE_ParVector    x);
 
+/**
+ * Update the solver or preconditioner after the values of \e A have changed.
+ * The sparsity pattern of \e A must be the same as in the last call to
+ * HYPRE_BoomerAMGSetup.  The C/F splitting and the sparsity patterns of
+ * the interpolation and coarse-grid operators are kept, and only their
+ * values are recomputed.  Options that are not supported by this
+ * numeric-only setup (e.g. aggressive coarsening, nodal or non-Galerkin
+ * coarse grids, additive cycles, complex smoothers or coarse solvers)
+ * result in a full setup.  Like HYPRE_BoomerAMGSetup, this function may
+ * be passed to the iterative solver \e SetPrecond function.
+ *
+ * @param solver [IN] object to be updated.
+ * @param A [IN] ParCSR matrix with the new values.
+ * @param b Ignored by this function.
+ * @param x Ignored by this function.
+ **/
+HYPRE_Int HYPRE_BoomerAMGResetup(HYPRE_Solver       solver,
+                                 HYPRE_ParCSRMatrix A,
+                                 HYPRE_ParVector    b,
+                                 HYPRE_ParVector    x);
+
 /**
  * Solve the system or apply AMG as a preconditioner.
  * If used as a preconditioner, this function should be passed
@@ -770,6 +791,58 @@ HYPRE_Int HYPRE_BoomerAMGSetCycleRelaxType(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGSetRelaxOrder(HYPRE_Solver  solver,
                                        HYPRE_Int     relax_order);
 
+/**
+ * (Optional) If \e relax_overlap is nonzero, the hybrid Gauss-Seidel and
+ * SOR smoothers (relax types 3, 4, 6, 8, 13 and 14) relax the rows without
+ * off-processor connections while the halo exchange is in progress, and the
+ * remaining rows after it has completed. The rows are classified during
+ * setup. On each processor, the rows without off-processor connections are
+ * visited before the others, so results differ slightly from the default
+ * ordering. Threaded runs use the default smoothers. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRelaxOverlap(HYPRE_Solver  solver,
+                                         HYPRE_Int     relax_overlap);
+
+/**
+ * (Optional) If \e relax_plan is nonzero, setup precomputes for each level
+ * the row ranges of the threads (balanced by the number of nonzeros), the
+ * lists of C- and F-points, and the inverses of the diagonal and l1 norms.
+ * Relax types 0, 3, 4, 6, 8, 13, 14 and 18 then use this data instead of
+ * recomputing it in every sweep. HYPRE_BoomerAMGSetRelaxOverlap takes
+ * precedence on levels where both apply. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRelaxPlan(HYPRE_Solver  solver,
+                                      HYPRE_Int     relax_plan);
+
+/**
+ * (Optional) If \e float_level is positive, setup keeps a single-precision
+ * copy of the coarse-grid operators on levels \e float_level and coarser,
+ * and of the interpolation and restriction operators between these levels.
+ * The matvecs and relax types 0, 3, 4, 6, 8, 13 and 14 on these levels read
+ * the matrix entries in single precision, while all vectors, and thus the
+ * outer Krylov method, stay in double precision. The finest level is never
+ * converted. The double-precision values are kept (see
+ * HYPRE_BoomerAMGSetFloatDropDouble). Host memory only. The default is 0
+ * (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFloatLevel(HYPRE_Solver  solver,
+                                       HYPRE_Int     float_level);
+
+/**
+ * (Optional) If \e float_drop_double is nonzero, the double-precision
+ * values of the operators converted by HYPRE_BoomerAMGSetFloatLevel are
+ * freed when the cycle does not need them: always for the interpolation and
+ * restriction operators, and for the coarse-grid operators on levels whose
+ * smoothers (or coarse solver) all run in single precision. These matrices
+ * can then only be used by the solver itself; they must not be accessed
+ * through HYPRE_BoomerAMGGetGridHierarchy or printed, and matvecs with them
+ * outside the single-precision kernels return an error.
+ * HYPRE_BoomerAMGResetup then performs a full setup, and block solves with
+ * several right-hand sides cycle one vector at a time. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFloatDropDouble(HYPRE_Solver  solver,
+                                            HYPRE_Int     float_drop_double);
+
 /**
  * (Optional) Defines in which order the points are relaxed.
  *
@@ -1167,6 +1240,71 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                       HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, the Galerkin products R^T A P are computed
+ * row by row from R, A and P without forming A P, which lowers the peak
+ * memory of the setup at the cost of some recomputation.
+ * Not used with rap2 and on GPUs. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFusedRAP(HYPRE_Solver solver,
+                                     HYPRE_Int    fused_rap);
+
+/**
+ * Returns the largest storage in bytes (on this processor) used by the
+ * matrices of a Galerkin product during the last setup.
+ * Only available for the triple product kernels of HYPRE_BoomerAMGSetModuleRAP2
+ * and HYPRE_BoomerAMGSetFusedRAP, 0 otherwise.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetRAPPeakMemory(HYPRE_Solver  solver,
+                                          HYPRE_Real   *peak_memory);
+
+/**
+ * (Optional) If set to 1, the setup and the cycle record, for every level,
+ * the wall time, the number of messages and bytes sent by point-to-point
+ * ParCSR communication, and the number of local nonzeros involved in each
+ * of the following phases:
+ *
+ *    - 0 : strength matrix
+ *    - 1 : coarsening
+ *    - 2 : interpolation (and AIR restriction)
+ *    - 3 : truncation done by the setup itself, after multi-stage
+ *          (aggressive coarsening) interpolation or for the additive
+ *          cycles (also counted in 1 or 2); interpolation routines that
+ *          truncate internally count it in 2
+ *    - 4 : coarse-grid operator
+ *    - 5 : smoother and coarse solver setup
+ *    - 6 : relaxation
+ *    - 7 : residual and restriction
+ *    - 8 : interpolation and correction
+ *    - 9 : coarsest grid solve
+ *
+ * Phases 0-5 are reset by each setup, phases 6-9 accumulate over all
+ * solves after it. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetPhaseStats(HYPRE_Solver solver,
+                                       HYPRE_Int    phase_stats);
+
+/**
+ * Returns the values recorded on this processor for the given level and
+ * phase (see HYPRE_BoomerAMGSetPhaseStats). level = -1 sums over all levels.
+ * Any of the output pointers may be NULL.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetPhaseStats(HYPRE_Solver  solver,
+                                       HYPRE_Int     level,
+                                       HYPRE_Int     phase,
+                                       HYPRE_Real   *time,
+                                       HYPRE_Real   *bytes,
+                                       HYPRE_Real   *messages,
+                                       HYPRE_Real   *nnz);
+
+/**
+ * Writes the per-level, per-phase statistics to a JSON file, grouped into
+ * setup and solve phases. Times are the maximum over processors, all other
+ * quantities are summed over processors. Must be called by all processors.
+ **/
+HYPRE_Int HYPRE_BoomerAMGPrintPhaseStats(HYPRE_Solver  solver,
+                                         const char   *filename);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2260,6 +2398,20 @@ HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange(HYPRE_Solver solver,
                                       HYPRE_Int    rel_change);
 
+/**
+ * (Optional) Use pipelined PCG, with one overlapped global reduction per
+ * iteration.  See HYPRE_PCGSetPipelined.
+ **/
+HYPRE_Int HYPRE_ParCSRPCGSetPipelined(HYPRE_Solver solver,
+                                      HYPRE_Int    pipelined);
+
+/**
+ * (Optional) Use s-step PCG, with one global reduction per s iterations.
+ * See HYPRE_PCGSetSStep.
+ **/
+HYPRE_Int HYPRE_ParCSRPCGSetSStep(HYPRE_Solver solver,
+                                  HYPRE_Int    s_step);
+
 HYPRE_Int HYPRE_ParCSRPCGSetPrecond(HYPRE_Solver            solver,
                                     HYPRE_PtrToParSolverFcn precond,
                                     HYPRE_PtrToParSolverFcn precond_setup,
@@ -2351,6 +2503,9 @@ HYPRE_Int HYPRE_ParCSRGMRESSolve(HYPRE_Solver       solver,
 HYPRE_Int HYPRE_ParCSRGMRESSetKDim(HYPRE_Solver solver,
                                    HYPRE_Int    k_dim);
 
+HYPRE_Int HYPRE_ParCSRGMRESSetCGS(HYPRE_Solver solver,
+                                  HYPRE_Int    cgs);
+
 HYPRE_Int HYPRE_ParCSRGMRESSetTol(HYPRE_Solver solver,
                                   HYPRE_Real   tol);
 
@@ -2511,6 +2666,9 @@ HYPRE_Int HYPRE_ParCSRFlexGMRESSolve(HYPRE_Solver       solver,
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetKDim(HYPRE_Solver solver,
                                        HYPRE_Int    k_dim);
 
+HYPRE_Int HYPRE_ParCSRFlexGMRESSetCGS(HYPRE_Solver solver,
+                                      HYPRE_Int    cgs);
+
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetTol(HYPRE_Solver solver,
                                       HYPRE_Real   tol);
 
@@ -2592,6 +2750,9 @@ HYPRE_Int HYPRE_ParCSRLGMRESSolve(HYPRE_Solver       solver,
 HYPRE_Int HYPRE_ParCSRLGMRESSetKDim(HYPRE_Solver solver,
                                     HYPRE_Int    k_dim);
 
+HYPRE_Int HYPRE_ParCSRLGMRESSetCGS(HYPRE_Solver solver,
+                                   HYPRE_Int    cgs);
+
 HYPRE_Int HYPRE_ParCSRLGMRESSetAugDim(HYPRE_Solver solver,
                                       HYPRE_Int    aug_dim);
 
@@ -31,6 +31,13 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   pcg_functions->NumVectors       = hypre_ParKrylovNumVectors;
+   pcg_functions->MultiInnerProd   = hypre_ParKrylovMultiInnerProd;
+   pcg_functions->MultiAxpy        = hypre_ParKrylovMultiAxpy;
+   pcg_functions->MultiScaleVector = hypre_ParKrylovMultiScaleVector;
+   pcg_functions->InnerProdLocal   = hypre_ParKrylovInnerProdLocal;
+   pcg_functions->IAllreduce       = hypre_ParKrylovIAllreduce;
+   pcg_functions->Wait             = hypre_ParKrylovWait;
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -143,6 +150,28 @@ HYPRE_ParCSRPCGSetRelChange( HYPRE_Solver solver,
    return( HYPRE_PCGSetRelChange( solver, rel_change ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPCGSetPipelined( HYPRE_Solver solver,
+                             HYPRE_Int    pipelined )
+{
+   return( HYPRE_PCGSetPipelined( solver, pipelined ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPCGSetSStep( HYPRE_Solver solver,
+                         HYPRE_Int    s_step )
+{
+   return( HYPRE_PCGSetSStep( solver, s_step ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRPCGSetPrecond
  *--------------------------------------------------------------------------*/
@@ -30,6 +30,75 @@ typedef struct { HYPRE_Int prev; HYPRE_Int next; } Link;
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGPhaseStats
+ *
+ * Instrumentation record for one phase on one level.  Setup phases are
+ * filled in by hypre_BoomerAMGSetup, solve phases by hypre_BoomerAMGCycle.
+ * Truncation is nested in interpolation (and in aggressive coarsening), so
+ * its cost is also contained in those phases.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_AMG_PHASE_STRENGTH        0
+#define hypre_AMG_PHASE_COARSEN         1
+#define hypre_AMG_PHASE_INTERP          2
+#define hypre_AMG_PHASE_TRUNC           3
+#define hypre_AMG_PHASE_RAP             4
+#define hypre_AMG_PHASE_SMOOTHER_SETUP  5
+#define hypre_AMG_PHASE_RELAX           6
+#define hypre_AMG_PHASE_RESTRICT        7
+#define hypre_AMG_PHASE_INTERPOLATE     8
+#define hypre_AMG_PHASE_COARSE_SOLVE    9
+#define hypre_AMG_NUM_PHASES           10
+#define hypre_AMG_NUM_SETUP_PHASES      6
+
+typedef struct
+{
+   HYPRE_Int      calls;
+   HYPRE_Real     time;      /* wall time in seconds */
+   HYPRE_Real     bytes;     /* bytes sent */
+   HYPRE_Real     messages;  /* messages sent */
+   HYPRE_Real     nnz;       /* nonzeros produced (setup) or applied (solve) */
+
+   /* counters sampled when the phase was entered */
+   HYPRE_Real     start_time;
+   HYPRE_Real     start_bytes;
+   HYPRE_Real     start_messages;
+
+} hypre_ParAMGPhaseStats;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGRelaxPlan
+ *
+ * Per-level data for the pointwise smoothers, built once in setup: row
+ * ranges of the threads (balanced by the number of nonzeros), the C- and
+ * F-rows of each range, and the inverse diagonal and l1 norms.  Rows with a
+ * zero diagonal (or l1 norm) have a zero inverse and are skipped.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int      num_rows;
+   HYPRE_Int      num_threads;
+   HYPRE_Int     *thread_starts;  /* rows of thread t: [starts[t], starts[t+1]) */
+   HYPRE_Int     *C_rows;         /* rows with cf_marker ==  1 */
+   HYPRE_Int     *C_starts;       /* C_rows of thread t: [C_starts[t], C_starts[t+1]) */
+   HYPRE_Int     *F_rows;         /* rows with cf_marker == -1 */
+   HYPRE_Int     *F_starts;
+   HYPRE_Real    *inv_diag;
+   HYPRE_Real    *inv_l1_norms;   /* NULL if the level has no l1 norms */
+} hypre_ParAMGRelaxPlan;
+
+#define hypre_ParAMGRelaxPlanNumRows(plan)      ((plan) -> num_rows)
+#define hypre_ParAMGRelaxPlanNumThreads(plan)   ((plan) -> num_threads)
+#define hypre_ParAMGRelaxPlanThreadStarts(plan) ((plan) -> thread_starts)
+#define hypre_ParAMGRelaxPlanCRows(plan)        ((plan) -> C_rows)
+#define hypre_ParAMGRelaxPlanCStarts(plan)      ((plan) -> C_starts)
+#define hypre_ParAMGRelaxPlanFRows(plan)        ((plan) -> F_rows)
+#define hypre_ParAMGRelaxPlanFStarts(plan)      ((plan) -> F_starts)
+#define hypre_ParAMGRelaxPlanInvDiag(plan)      ((plan) -> inv_diag)
+#define hypre_ParAMGRelaxPlanInvL1Norms(plan)   ((plan) -> inv_l1_norms)
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -89,6 +158,10 @@ typedef struct
    HYPRE_Int     *grid_relax_type;
    HYPRE_Int    **grid_relax_points;
    HYPRE_Int      relax_order;
+   HYPRE_Int      relax_overlap;
+   HYPRE_Int      relax_plan;
+   HYPRE_Int      float_level;
+   HYPRE_Int      float_drop_double;
    HYPRE_Int      user_coarse_relax_type;
    HYPRE_Int      user_relax_type;
    HYPRE_Int      user_num_sweeps;
@@ -123,6 +196,9 @@ typedef struct
    HYPRE_Int          **point_dof_map_array;
    HYPRE_Int            num_levels;
    hypre_Vector       **l1_norms;
+   HYPRE_Int          **relax_overlap_rows;
+   HYPRE_Int           *relax_overlap_num_interior;
+   hypre_ParAMGRelaxPlan **relax_plan_array;
 
    /* Block data */
    hypre_ParCSRBlockMatrix **A_block_array;
@@ -177,6 +253,18 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* multivector work space for block (multiple right-hand side) solves */
+   HYPRE_Int          multi_num_vectors;
+   HYPRE_Int          multi_num_levels;
+   hypre_ParVector  **F_multi_array;
+   hypre_ParVector  **U_multi_array;
+   hypre_ParVector  **Vtemp_multi_array;
+   hypre_ParVector  **Ztemp_multi_array;
+
+   /* symbolic coarse-grid products reused by hypre_BoomerAMGResetup */
+   HYPRE_Int             num_rap_plans;
+   hypre_ParCSRRAPPlan **rap_plans;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -248,6 +336,14 @@ typedef struct
    HYPRE_Int rap2;
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
+   /* row-wise fused triple product, and high-water mark of its storage */
+   HYPRE_Int fused_rap;
+   HYPRE_Real rap_peak_memory;
+
+   /* per-level, per-phase instrumentation */
+   HYPRE_Int               phase_stats;
+   HYPRE_Int               phase_stats_num_levels;
+   hypre_ParAMGPhaseStats *phase_stats_data;
 
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
@@ -313,6 +409,9 @@ typedef struct
 #define hypre_ParAMGDataISType(amg_data)               ((amg_data) -> IS_type)
 #define hypre_ParAMGDataCRUseCG(amg_data)              ((amg_data) -> CR_use_CG)
 #define hypre_ParAMGDataL1Norms(amg_data)              ((amg_data) -> l1_norms)
+#define hypre_ParAMGDataRelaxOverlapRows(amg_data)     ((amg_data) -> relax_overlap_rows)
+#define hypre_ParAMGDataRelaxOverlapNumInterior(amg_data) ((amg_data) -> relax_overlap_num_interior)
+#define hypre_ParAMGDataRelaxPlanArray(amg_data)       ((amg_data) -> relax_plan_array)
 #define hypre_ParAMGDataCGCIts(amg_data)               ((amg_data) -> cgc_its)
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
@@ -334,6 +433,10 @@ typedef struct
 #define hypre_ParAMGDataGridRelaxType(amg_data) ((amg_data)->grid_relax_type)
 #define hypre_ParAMGDataGridRelaxPoints(amg_data) ((amg_data)->grid_relax_points)
 #define hypre_ParAMGDataRelaxOrder(amg_data) ((amg_data)->relax_order)
+#define hypre_ParAMGDataRelaxOverlap(amg_data) ((amg_data)->relax_overlap)
+#define hypre_ParAMGDataRelaxPlan(amg_data) ((amg_data)->relax_plan)
+#define hypre_ParAMGDataFloatLevel(amg_data) ((amg_data)->float_level)
+#define hypre_ParAMGDataFloatDropDouble(amg_data) ((amg_data)->float_drop_double)
 #define hypre_ParAMGDataRelaxWeight(amg_data) ((amg_data)->relax_weight)
 #define hypre_ParAMGDataOmega(amg_data) ((amg_data)->omega)
 #define hypre_ParAMGDataOuterWt(amg_data) ((amg_data)->outer_wt)
@@ -411,6 +514,14 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataMultiNumVectors(amg_data) ((amg_data)->multi_num_vectors)
+#define hypre_ParAMGDataMultiNumLevels(amg_data) ((amg_data)->multi_num_levels)
+#define hypre_ParAMGDataFMultiArray(amg_data) ((amg_data)->F_multi_array)
+#define hypre_ParAMGDataUMultiArray(amg_data) ((amg_data)->U_multi_array)
+#define hypre_ParAMGDataVtempMultiArray(amg_data) ((amg_data)->Vtemp_multi_array)
+#define hypre_ParAMGDataZtempMultiArray(amg_data) ((amg_data)->Ztemp_multi_array)
+#define hypre_ParAMGDataNumRAPPlans(amg_data) ((amg_data)->num_rap_plans)
+#define hypre_ParAMGDataRAPPlans(amg_data) ((amg_data)->rap_plans)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -489,6 +600,11 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataFusedRAP(amg_data) ((amg_data)->fused_rap)
+#define hypre_ParAMGDataRAPPeakMemory(amg_data) ((amg_data)->rap_peak_memory)
+#define hypre_ParAMGDataPhaseStats(amg_data) ((amg_data)->phase_stats)
+#define hypre_ParAMGDataPhaseStatsNumLevels(amg_data) ((amg_data)->phase_stats_num_levels)
+#define hypre_ParAMGDataPhaseStatsData(amg_data) ((amg_data)->phase_stats_data)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -780,6 +896,7 @@ HYPRE_Int HYPRE_AMSFEIDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGCreate ( HYPRE_Solver *solver );
 HYPRE_Int HYPRE_BoomerAMGDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGResetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSetRestriction ( HYPRE_Solver solver , HYPRE_Int restr_par );
@@ -947,6 +1064,11 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver , HYPRE_Int nonga
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver , HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver , HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver , HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetFusedRAP ( HYPRE_Solver solver , HYPRE_Int fused_rap );
+HYPRE_Int HYPRE_BoomerAMGGetRAPPeakMemory ( HYPRE_Solver solver , HYPRE_Real *peak_memory );
+HYPRE_Int HYPRE_BoomerAMGSetPhaseStats ( HYPRE_Solver solver , HYPRE_Int phase_stats );
+HYPRE_Int HYPRE_BoomerAMGGetPhaseStats ( HYPRE_Solver solver , HYPRE_Int level , HYPRE_Int phase , HYPRE_Real *time , HYPRE_Real *bytes , HYPRE_Real *messages , HYPRE_Real *nnz );
+HYPRE_Int HYPRE_BoomerAMGPrintPhaseStats ( HYPRE_Solver solver , const char *filename );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver , HYPRE_Int slu_threshold );
 #endif
@@ -1020,6 +1142,7 @@ HYPRE_Int HYPRE_ParCSRFlexGMRESDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_ParCSRFlexGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
@@ -1039,6 +1162,7 @@ HYPRE_Int HYPRE_ParCSRGMRESDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_ParCSRGMRESSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRGMRESSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_ParCSRGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_ParCSRGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
@@ -1151,6 +1275,7 @@ HYPRE_Int HYPRE_ParCSRLGMRESDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_ParCSRLGMRESSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRLGMRESSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRLGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_ParCSRLGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_ParCSRLGMRESSetAugDim ( HYPRE_Solver solver , HYPRE_Int aug_dim );
 HYPRE_Int HYPRE_ParCSRLGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRLGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -1209,6 +1334,8 @@ HYPRE_Int HYPRE_ParCSRPCGSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter )
 HYPRE_Int HYPRE_ParCSRPCGSetStopCrit ( HYPRE_Solver solver , HYPRE_Int stop_crit );
 HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm ( HYPRE_Solver solver , HYPRE_Int two_norm );
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange ( HYPRE_Solver solver , HYPRE_Int rel_change );
+HYPRE_Int HYPRE_ParCSRPCGSetPipelined ( HYPRE_Solver solver , HYPRE_Int pipelined );
+HYPRE_Int HYPRE_ParCSRPCGSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
 HYPRE_Int HYPRE_ParCSRPCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_ParCSRPCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
 HYPRE_Int HYPRE_ParCSRPCGSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1316,6 +1443,10 @@ HYPRE_Int hypre_BoomerAMGSetRelaxType ( void *data , HYPRE_Int relax_type );
 HYPRE_Int hypre_BoomerAMGSetCycleRelaxType ( void *data , HYPRE_Int relax_type , HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGGetCycleRelaxType ( void *data , HYPRE_Int *relax_type , HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGSetRelaxOrder ( void *data , HYPRE_Int relax_order );
+HYPRE_Int hypre_BoomerAMGSetRelaxOverlap ( void *data , HYPRE_Int relax_overlap );
+HYPRE_Int hypre_BoomerAMGSetRelaxPlan ( void *data , HYPRE_Int relax_plan );
+HYPRE_Int hypre_BoomerAMGSetFloatLevel ( void *data , HYPRE_Int float_level );
+HYPRE_Int hypre_BoomerAMGSetFloatDropDouble ( void *data , HYPRE_Int float_drop_double );
 HYPRE_Int hypre_BoomerAMGGetRelaxOrder ( void *data , HYPRE_Int *relax_order );
 HYPRE_Int hypre_BoomerAMGSetGridRelaxType ( void *data , HYPRE_Int *grid_relax_type );
 HYPRE_Int hypre_BoomerAMGGetGridRelaxType ( void *data , HYPRE_Int **grid_relax_type );
@@ -1429,6 +1560,9 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data , HYPRE_Int nongalerk_num_
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data , HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data , HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data , HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetFusedRAP ( void *data , HYPRE_Int fused_rap );
+HYPRE_Int hypre_BoomerAMGGetRAPPeakMemory ( void *data , HYPRE_Real *peak_memory );
+HYPRE_Int hypre_BoomerAMGSetPhaseStats ( void *data , HYPRE_Int phase_stats );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data , HYPRE_Int slu_threshold );
 #endif
@@ -1438,8 +1572,21 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
+/* par_amg_phase_stats.c */
+HYPRE_Int hypre_BoomerAMGPhaseStatsInitialize ( void *data , HYPRE_Int num_levels );
+HYPRE_Int hypre_BoomerAMGPhaseStatsDestroy ( void *data );
+HYPRE_Int hypre_BoomerAMGPhaseBegin ( void *data , HYPRE_Int level , HYPRE_Int phase );
+HYPRE_Int hypre_BoomerAMGPhaseEnd ( void *data , HYPRE_Int level , HYPRE_Int phase , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGGetPhaseStats ( void *data , HYPRE_Int level , HYPRE_Int phase , HYPRE_Real *time , HYPRE_Real *bytes , HYPRE_Real *messages , HYPRE_Real *nnz );
+HYPRE_Int hypre_BoomerAMGPrintPhaseStats ( void *data , const char *filename );
+
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGResetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGRAPPlansDestroy ( void *amg_vdata );
+
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGSolveMulti ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
 /* par_amg_solveT.c */
 HYPRE_Int hypre_BoomerAMGSolveT ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
@@ -1502,6 +1649,12 @@ HYPRE_Int hypre_BoomerAMGCoarsenCR ( hypre_ParCSRMatrix *A , HYPRE_Int **CF_mark
 /* par_cycle.c */
 HYPRE_Int hypre_BoomerAMGCycle ( void *amg_vdata , hypre_ParVector **F_array , hypre_ParVector **U_array );
 
+/* par_cycle_multi.c */
+HYPRE_Int hypre_BoomerAMGMultiCycleSupported ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGMultiVectorsCreate ( void *amg_vdata , HYPRE_Int num_vectors );
+HYPRE_Int hypre_BoomerAMGMultiVectorsDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGMultiCycle ( void *amg_vdata , hypre_ParVector **F_array , hypre_ParVector **U_array );
+
 /* par_difconv.c */
 HYPRE_ParCSRMatrix GenerateDifConv ( MPI_Comm comm , HYPRE_BigInt nx , HYPRE_BigInt ny , HYPRE_BigInt nz , HYPRE_Int P , HYPRE_Int Q , HYPRE_Int R , HYPRE_Int p , HYPRE_Int q , HYPRE_Int r , HYPRE_Real *value );
 
@@ -1622,6 +1775,23 @@ HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data , HYPRE_Int level ,
 /* par_relax_interface.c */
 HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
 
+/* par_relax_overlap.c */
+HYPRE_Int hypre_BoomerAMGRelaxOverlapSetup ( hypre_ParCSRMatrix *A , HYPRE_Int **rows_ptr , HYPRE_Int *num_interior_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxOverlap ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , HYPRE_Int *rows , HYPRE_Int num_interior , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxOverlapIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , HYPRE_Int *rows , HYPRE_Int num_interior , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
+/* par_relax_float.c */
+HYPRE_Int hypre_BoomerAMGRelaxFloatSupported ( hypre_ParCSRMatrix *A , HYPRE_Int relax_type , HYPRE_Real *l1_norms );
+HYPRE_Int hypre_BoomerAMGRelaxFloat ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGFloatLevelsSetup ( void *amg_vdata );
+
+/* par_relax_plan.c */
+HYPRE_Int hypre_BoomerAMGRelaxPlanUpdate ( hypre_ParAMGRelaxPlan *plan , hypre_ParCSRMatrix *A , HYPRE_Real *l1_norms );
+HYPRE_Int hypre_BoomerAMGRelaxPlanCreate ( hypre_ParCSRMatrix *A , HYPRE_Int *cf_marker , HYPRE_Real *l1_norms , hypre_ParAMGRelaxPlan **plan_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxPlanDestroy ( hypre_ParAMGRelaxPlan *plan );
+HYPRE_Int hypre_BoomerAMGRelaxWithPlan ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParAMGRelaxPlan *plan , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxWithPlanIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParAMGRelaxPlan *plan , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
 /* par_relax_more.c */
 HYPRE_Int hypre_ParCSRMaxEigEstimate ( hypre_ParCSRMatrix *A , HYPRE_Int scale , HYPRE_Real *max_eig );
 HYPRE_Int hypre_ParCSRMaxEigEstimateCG ( hypre_ParCSRMatrix *A , HYPRE_Int scale , HYPRE_Int max_iter , HYPRE_Real *max_eig , HYPRE_Real *min_eig );
@@ -1632,6 +1802,9 @@ HYPRE_Int hypre_LINPACKcgtql1 ( HYPRE_Int *n , HYPRE_Real *d , HYPRE_Real *e , H
 HYPRE_Real hypre_LINPACKcgpthy ( HYPRE_Real *a , HYPRE_Real *b );
 HYPRE_Int hypre_ParCSRRelax_L1_Jacobi ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp );
 
+/* par_relax_multi.c */
+HYPRE_Int hypre_BoomerAMGMultiRelax ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
 /* par_rotate_7pt.c */
 HYPRE_ParCSRMatrix GenerateRotate7pt ( MPI_Comm comm , HYPRE_BigInt nx , HYPRE_BigInt ny , HYPRE_Int P , HYPRE_Int Q , HYPRE_Int p , HYPRE_Int q , HYPRE_Real alpha , HYPRE_Real eps );
 
@@ -1728,6 +1901,13 @@ HYPRE_Int hypre_ParKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha , void *x );
 HYPRE_Int hypre_ParKrylovAxpy ( HYPRE_Complex alpha , void *x , void *y );
+HYPRE_Int hypre_ParKrylovNumVectors ( void *x );
+HYPRE_Int hypre_ParKrylovMultiInnerProd ( void *x , void *y , HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovMultiAxpy ( HYPRE_Complex *alpha , void *x , void *y );
+HYPRE_Int hypre_ParKrylovMultiScaleVector ( HYPRE_Complex *alpha , void *x );
+HYPRE_Int hypre_ParKrylovInnerProdLocal ( void *x , void *y , HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovIAllreduce ( void *x , HYPRE_Real *sendbuf , HYPRE_Real *recvbuf , HYPRE_Int count , void **request );
+HYPRE_Int hypre_ParKrylovWait ( void *request );
 HYPRE_Int hypre_ParKrylovCommInfo ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
 HYPRE_Int hypre_ParKrylovIdentitySetup ( void *vdata , void *A , void *b , void *x );
 HYPRE_Int hypre_ParKrylovIdentity ( void *vdata , void *A , void *b , void *x );
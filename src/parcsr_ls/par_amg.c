@@ -369,6 +369,14 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRtemp(amg_data)  = NULL;
    hypre_ParAMGDataPtemp(amg_data)  = NULL;
    hypre_ParAMGDataZtemp(amg_data)  = NULL;
+   hypre_ParAMGDataMultiNumVectors(amg_data) = 0;
+   hypre_ParAMGDataMultiNumLevels(amg_data) = 0;
+   hypre_ParAMGDataFMultiArray(amg_data) = NULL;
+   hypre_ParAMGDataUMultiArray(amg_data) = NULL;
+   hypre_ParAMGDataVtempMultiArray(amg_data) = NULL;
+   hypre_ParAMGDataZtempMultiArray(amg_data) = NULL;
+   hypre_ParAMGDataNumRAPPlans(amg_data) = 0;
+   hypre_ParAMGDataRAPPlans(amg_data) = NULL;
    hypre_ParAMGDataFArray(amg_data) = NULL;
    hypre_ParAMGDataUArray(amg_data) = NULL;
    hypre_ParAMGDataDofFunc(amg_data) = NULL;
@@ -378,6 +386,9 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataPointDofMapArray(amg_data) = NULL;
    hypre_ParAMGDataSmoother(amg_data) = NULL;
    hypre_ParAMGDataL1Norms(amg_data) = NULL;
+   hypre_ParAMGDataRelaxOverlapRows(amg_data) = NULL;
+   hypre_ParAMGDataRelaxOverlapNumInterior(amg_data) = NULL;
+   hypre_ParAMGDataRelaxPlanArray(amg_data) = NULL;
 
    hypre_ParAMGDataABlockArray(amg_data) = NULL;
    hypre_ParAMGDataPBlockArray(amg_data) = NULL;
@@ -441,6 +452,15 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataKeepTranspose(amg_data)     = 0;
    hypre_ParAMGDataModularizedMatMat(amg_data) = 0;
 #endif
+   hypre_ParAMGDataFusedRAP(amg_data)          = 0;
+   hypre_ParAMGDataRAPPeakMemory(amg_data)     = 0.0;
+   hypre_ParAMGDataPhaseStats(amg_data)          = 0;
+   hypre_ParAMGDataPhaseStatsNumLevels(amg_data) = 0;
+   hypre_ParAMGDataPhaseStatsData(amg_data)      = NULL;
+   hypre_ParAMGDataRelaxOverlap(amg_data)        = 0;
+   hypre_ParAMGDataRelaxPlan(amg_data)           = 0;
+   hypre_ParAMGDataFloatLevel(amg_data)          = 0;
+   hypre_ParAMGDataFloatDropDouble(amg_data)     = 0;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -613,6 +633,25 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
    }
 
+   if (hypre_ParAMGDataRelaxOverlapRows(amg_data))
+   {
+      for (i = 0; i < num_levels; i++)
+      {
+         hypre_TFree(hypre_ParAMGDataRelaxOverlapRows(amg_data)[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_ParAMGDataRelaxOverlapRows(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataRelaxOverlapNumInterior(amg_data), HYPRE_MEMORY_HOST);
+   }
+
+   if (hypre_ParAMGDataRelaxPlanArray(amg_data))
+   {
+      for (i = 0; i < num_levels; i++)
+      {
+         hypre_BoomerAMGRelaxPlanDestroy(hypre_ParAMGDataRelaxPlanArray(amg_data)[i]);
+      }
+      hypre_TFree(hypre_ParAMGDataRelaxPlanArray(amg_data), HYPRE_MEMORY_HOST);
+   }
+
    if (hypre_ParAMGDataChebyCoefs(amg_data))
    {
       for (i=0; i < num_levels; i++)
@@ -659,6 +698,10 @@ hypre_BoomerAMGDestroy( void *data )
    if (hypre_ParAMGDataZtemp(amg_data))
       hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
 
+   hypre_BoomerAMGMultiVectorsDestroy(amg_data);
+   hypre_BoomerAMGRAPPlansDestroy(amg_data);
+   hypre_BoomerAMGPhaseStatsDestroy(amg_data);
+
    if (hypre_ParAMGDataDofFuncArray(amg_data))
    {
       for (i=1; i < num_levels; i++)
@@ -2175,6 +2218,75 @@ hypre_BoomerAMGSetRelaxOrder( void     *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetRelaxOverlap( void      *data,
+                                HYPRE_Int  relax_overlap)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataRelaxOverlap(amg_data) = relax_overlap;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetRelaxPlan( void      *data,
+                             HYPRE_Int  relax_plan)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataRelaxPlan(amg_data) = relax_plan;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetFloatLevel( void      *data,
+                              HYPRE_Int  float_level)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (float_level < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataFloatLevel(amg_data) = float_level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetFloatDropDouble( void      *data,
+                                   HYPRE_Int  float_drop_double)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataFloatDropDouble(amg_data) = float_drop_double;
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGGetRelaxOrder( void     *data,
                               HYPRE_Int     * relax_order)
@@ -4458,6 +4570,46 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
   return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetFusedRAP( void       *data,
+                            HYPRE_Int   fused_rap)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  hypre_ParAMGDataFusedRAP(amg_data) = fused_rap;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetPhaseStats( void       *data,
+                              HYPRE_Int   phase_stats)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+  hypre_ParAMGDataPhaseStats(amg_data) = phase_stats;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetRAPPeakMemory( void       *data,
+                                 HYPRE_Real *peak_memory)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+  *peak_memory = hypre_ParAMGDataRAPPeakMemory(amg_data);
+  return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
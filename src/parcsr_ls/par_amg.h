@@ -12,6 +12,75 @@
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGPhaseStats
+ *
+ * Instrumentation record for one phase on one level.  Setup phases are
+ * filled in by hypre_BoomerAMGSetup, solve phases by hypre_BoomerAMGCycle.
+ * Truncation is nested in interpolation (and in aggressive coarsening), so
+ * its cost is also contained in those phases.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_AMG_PHASE_STRENGTH        0
+#define hypre_AMG_PHASE_COARSEN         1
+#define hypre_AMG_PHASE_INTERP          2
+#define hypre_AMG_PHASE_TRUNC           3
+#define hypre_AMG_PHASE_RAP             4
+#define hypre_AMG_PHASE_SMOOTHER_SETUP  5
+#define hypre_AMG_PHASE_RELAX           6
+#define hypre_AMG_PHASE_RESTRICT        7
+#define hypre_AMG_PHASE_INTERPOLATE     8
+#define hypre_AMG_PHASE_COARSE_SOLVE    9
+#define hypre_AMG_NUM_PHASES           10
+#define hypre_AMG_NUM_SETUP_PHASES      6
+
+typedef struct
+{
+   HYPRE_Int      calls;
+   HYPRE_Real     time;      /* wall time in seconds */
+   HYPRE_Real     bytes;     /* bytes sent */
+   HYPRE_Real     messages;  /* messages sent */
+   HYPRE_Real     nnz;       /* nonzeros produced (setup) or applied (solve) */
+
+   /* counters sampled when the phase was entered */
+   HYPRE_Real     start_time;
+   HYPRE_Real     start_bytes;
+   HYPRE_Real     start_messages;
+
+} hypre_ParAMGPhaseStats;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGRelaxPlan
+ *
+ * Per-level data for the pointwise smoothers, built once in setup: row
+ * ranges of the threads (balanced by the number of nonzeros), the C- and
+ * F-rows of each range, and the inverse diagonal and l1 norms.  Rows with a
+ * zero diagonal (or l1 norm) have a zero inverse and are skipped.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int      num_rows;
+   HYPRE_Int      num_threads;
+   HYPRE_Int     *thread_starts;  /* rows of thread t: [starts[t], starts[t+1]) */
+   HYPRE_Int     *C_rows;         /* rows with cf_marker ==  1 */
+   HYPRE_Int     *C_starts;       /* C_rows of thread t: [C_starts[t], C_starts[t+1]) */
+   HYPRE_Int     *F_rows;         /* rows with cf_marker == -1 */
+   HYPRE_Int     *F_starts;
+   HYPRE_Real    *inv_diag;
+   HYPRE_Real    *inv_l1_norms;   /* NULL if the level has no l1 norms */
+} hypre_ParAMGRelaxPlan;
+
+#define hypre_ParAMGRelaxPlanNumRows(plan)      ((plan) -> num_rows)
+#define hypre_ParAMGRelaxPlanNumThreads(plan)   ((plan) -> num_threads)
+#define hypre_ParAMGRelaxPlanThreadStarts(plan) ((plan) -> thread_starts)
+#define hypre_ParAMGRelaxPlanCRows(plan)        ((plan) -> C_rows)
+#define hypre_ParAMGRelaxPlanCStarts(plan)      ((plan) -> C_starts)
+#define hypre_ParAMGRelaxPlanFRows(plan)        ((plan) -> F_rows)
+#define hypre_ParAMGRelaxPlanFStarts(plan)      ((plan) -> F_starts)
+#define hypre_ParAMGRelaxPlanInvDiag(plan)      ((plan) -> inv_diag)
+#define hypre_ParAMGRelaxPlanInvL1Norms(plan)   ((plan) -> inv_l1_norms)
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -71,6 +140,10 @@ typedef struct
    HYPRE_Int     *grid_relax_type;
    HYPRE_Int    **grid_relax_points;
    HYPRE_Int      relax_order;
+   HYPRE_Int      relax_overlap;
+   HYPRE_Int      relax_plan;
+   HYPRE_Int      float_level;
+   HYPRE_Int      float_drop_double;
    HYPRE_Int      user_coarse_relax_type;
    HYPRE_Int      user_relax_type;
    HYPRE_Int      user_num_sweeps;
@@ -105,6 +178,9 @@ typedef struct
    HYPRE_Int          **point_dof_map_array;
    HYPRE_Int            num_levels;
    hypre_Vector       **l1_norms;
+   HYPRE_Int          **relax_overlap_rows;
+   HYPRE_Int           *relax_overlap_num_interior;
+   hypre_ParAMGRelaxPlan **relax_plan_array;
 
    /* Block data */
    hypre_ParCSRBlockMatrix **A_block_array;
@@ -159,6 +235,18 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* multivector work space for block (multiple right-hand side) solves */
+   HYPRE_Int          multi_num_vectors;
+   HYPRE_Int          multi_num_levels;
+   hypre_ParVector  **F_multi_array;
+   hypre_ParVector  **U_multi_array;
+   hypre_ParVector  **Vtemp_multi_array;
+   hypre_ParVector  **Ztemp_multi_array;
+
+   /* symbolic coarse-grid products reused by hypre_BoomerAMGResetup */
+   HYPRE_Int             num_rap_plans;
+   hypre_ParCSRRAPPlan **rap_plans;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -230,6 +318,14 @@ typedef struct
    HYPRE_Int rap2;
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
+   /* row-wise fused triple product, and high-water mark of its storage */
+   HYPRE_Int fused_rap;
+   HYPRE_Real rap_peak_memory;
+
+   /* per-level, per-phase instrumentation */
+   HYPRE_Int               phase_stats;
+   HYPRE_Int               phase_stats_num_levels;
+   hypre_ParAMGPhaseStats *phase_stats_data;
 
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
@@ -295,6 +391,9 @@ typedef struct
 #define hypre_ParAMGDataISType(amg_data)               ((amg_data) -> IS_type)
 #define hypre_ParAMGDataCRUseCG(amg_data)              ((amg_data) -> CR_use_CG)
 #define hypre_ParAMGDataL1Norms(amg_data)              ((amg_data) -> l1_norms)
+#define hypre_ParAMGDataRelaxOverlapRows(amg_data)     ((amg_data) -> relax_overlap_rows)
+#define hypre_ParAMGDataRelaxOverlapNumInterior(amg_data) ((amg_data) -> relax_overlap_num_interior)
+#define hypre_ParAMGDataRelaxPlanArray(amg_data)       ((amg_data) -> relax_plan_array)
 #define hypre_ParAMGDataCGCIts(amg_data)               ((amg_data) -> cgc_its)
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
@@ -316,6 +415,10 @@ typedef struct
 #define hypre_ParAMGDataGridRelaxType(amg_data) ((amg_data)->grid_relax_type)
 #define hypre_ParAMGDataGridRelaxPoints(amg_data) ((amg_data)->grid_relax_points)
 #define hypre_ParAMGDataRelaxOrder(amg_data) ((amg_data)->relax_order)
+#define hypre_ParAMGDataRelaxOverlap(amg_data) ((amg_data)->relax_overlap)
+#define hypre_ParAMGDataRelaxPlan(amg_data) ((amg_data)->relax_plan)
+#define hypre_ParAMGDataFloatLevel(amg_data) ((amg_data)->float_level)
+#define hypre_ParAMGDataFloatDropDouble(amg_data) ((amg_data)->float_drop_double)
 #define hypre_ParAMGDataRelaxWeight(amg_data) ((amg_data)->relax_weight)
 #define hypre_ParAMGDataOmega(amg_data) ((amg_data)->omega)
 #define hypre_ParAMGDataOuterWt(amg_data) ((amg_data)->outer_wt)
@@ -393,6 +496,14 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataMultiNumVectors(amg_data) ((amg_data)->multi_num_vectors)
+#define hypre_ParAMGDataMultiNumLevels(amg_data) ((amg_data)->multi_num_levels)
+#define hypre_ParAMGDataFMultiArray(amg_data) ((amg_data)->F_multi_array)
+#define hypre_ParAMGDataUMultiArray(amg_data) ((amg_data)->U_multi_array)
+#define hypre_ParAMGDataVtempMultiArray(amg_data) ((amg_data)->Vtemp_multi_array)
+#define hypre_ParAMGDataZtempMultiArray(amg_data) ((amg_data)->Ztemp_multi_array)
+#define hypre_ParAMGDataNumRAPPlans(amg_data) ((amg_data)->num_rap_plans)
+#define hypre_ParAMGDataRAPPlans(amg_data) ((amg_data)->rap_plans)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -471,6 +582,11 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataFusedRAP(amg_data) ((amg_data)->fused_rap)
+#define hypre_ParAMGDataRAPPeakMemory(amg_data) ((amg_data)->rap_peak_memory)
+#define hypre_ParAMGDataPhaseStats(amg_data) ((amg_data)->phase_stats)
+#define hypre_ParAMGDataPhaseStatsNumLevels(amg_data) ((amg_data)->phase_stats_num_levels)
+#define hypre_ParAMGDataPhaseStatsData(amg_data) ((amg_data)->phase_stats_data)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
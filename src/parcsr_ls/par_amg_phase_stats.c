@@ -0,0 +1,324 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Per-level, per-phase instrumentation of BoomerAMG setup and solve.
+ *
+ * Each phase records wall time, the number of messages and bytes sent
+ * through the ParCSR communication handles (see hypre_HandleCommNumMessages),
+ * and the number of local nonzeros of the operator it produced or applied.
+ * Collection is enabled with hypre_BoomerAMGSetPhaseStats and reset at the
+ * start of every hypre_BoomerAMGSetup; solve phases accumulate over all
+ * solves that follow.  All state lives in hypre_ParAMGData and every phase
+ * is bracketed with its AMG data and level, so AMG instances used inside
+ * other solvers (or inside another AMG) keep separate records.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+static const char *hypre_amg_phase_names[hypre_AMG_NUM_PHASES] =
+{
+   "strength", "coarsening", "interp", "truncation", "rap", "smoother_setup",
+   "relax", "restrict", "interpolate", "coarse_solve"
+};
+
+/*--------------------------------------------------------------------------
+ * Returns the record of (level, phase), or NULL if collection is disabled
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParAMGPhaseStats *
+hypre_BoomerAMGPhaseStatsEntry( hypre_ParAMGData *amg_data,
+                                HYPRE_Int         level,
+                                HYPRE_Int         phase )
+{
+   if (!amg_data || !hypre_ParAMGDataPhaseStats(amg_data) ||
+       !hypre_ParAMGDataPhaseStatsData(amg_data))
+   {
+      return NULL;
+   }
+   if (level < 0 || level >= hypre_ParAMGDataPhaseStatsNumLevels(amg_data) ||
+       phase < 0 || phase >= hypre_AMG_NUM_PHASES)
+   {
+      return NULL;
+   }
+
+   return &hypre_ParAMGDataPhaseStatsData(amg_data)[level * hypre_AMG_NUM_PHASES + phase];
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGPhaseStatsInitialize
+ *
+ * Allocates (or clears) the records for num_levels levels.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGPhaseStatsInitialize( void      *data,
+                                     HYPRE_Int  num_levels )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!hypre_ParAMGDataPhaseStats(amg_data))
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParAMGDataPhaseStatsNumLevels(amg_data) != num_levels)
+   {
+      hypre_TFree(hypre_ParAMGDataPhaseStatsData(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataPhaseStatsData(amg_data) =
+         hypre_CTAlloc(hypre_ParAMGPhaseStats, num_levels * hypre_AMG_NUM_PHASES,
+                       HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataPhaseStatsNumLevels(amg_data) = num_levels;
+   }
+   else
+   {
+      memset(hypre_ParAMGDataPhaseStatsData(amg_data), 0,
+             num_levels * hypre_AMG_NUM_PHASES * sizeof(hypre_ParAMGPhaseStats));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGPhaseStatsDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGPhaseStatsDestroy( void *data )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   hypre_TFree(hypre_ParAMGDataPhaseStatsData(amg_data), HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataPhaseStatsData(amg_data) = NULL;
+   hypre_ParAMGDataPhaseStatsNumLevels(amg_data) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGPhaseBegin, hypre_BoomerAMGPhaseEnd
+ *
+ * Bracket one execution of a phase.  A is the operator the phase produced
+ * or applied; its local number of nonzeros is added to the record.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGPhaseBegin( void      *data,
+                           HYPRE_Int  level,
+                           HYPRE_Int  phase )
+{
+   hypre_ParAMGPhaseStats *stats =
+      hypre_BoomerAMGPhaseStatsEntry((hypre_ParAMGData*) data, level, phase);
+
+   if (stats)
+   {
+      stats -> start_time     = hypre_MPI_Wtime();
+      stats -> start_bytes    = hypre_HandleCommNumBytes(hypre_handle());
+      stats -> start_messages = hypre_HandleCommNumMessages(hypre_handle());
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGPhaseEnd( void               *data,
+                         HYPRE_Int           level,
+                         HYPRE_Int           phase,
+                         hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGPhaseStats *stats =
+      hypre_BoomerAMGPhaseStatsEntry((hypre_ParAMGData*) data, level, phase);
+
+   if (stats)
+   {
+      stats -> time     += hypre_MPI_Wtime() - stats -> start_time;
+      stats -> bytes    += hypre_HandleCommNumBytes(hypre_handle()) - stats -> start_bytes;
+      stats -> messages += hypre_HandleCommNumMessages(hypre_handle()) - stats -> start_messages;
+      stats -> calls    ++;
+      if (A)
+      {
+         stats -> nnz += (HYPRE_Real)
+            ( hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+              hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A)) );
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGGetPhaseStats
+ *
+ * Returns the local values recorded for (level, phase).  level = -1 returns
+ * the sum over all levels.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGGetPhaseStats( void       *data,
+                              HYPRE_Int   level,
+                              HYPRE_Int   phase,
+                              HYPRE_Real *time,
+                              HYPRE_Real *bytes,
+                              HYPRE_Real *messages,
+                              HYPRE_Real *nnz )
+{
+   hypre_ParAMGData       *amg_data = (hypre_ParAMGData*) data;
+   hypre_ParAMGPhaseStats *stats;
+   HYPRE_Int               num_levels, l, l_first, l_last;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   num_levels = hypre_ParAMGDataPhaseStatsNumLevels(amg_data);
+   if (level < -1 || level >= num_levels)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   if (phase < 0 || phase >= hypre_AMG_NUM_PHASES)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   l_first = (level < 0) ? 0 : level;
+   l_last  = (level < 0) ? num_levels - 1 : level;
+
+   if (time)     { *time     = 0.0; }
+   if (bytes)    { *bytes    = 0.0; }
+   if (messages) { *messages = 0.0; }
+   if (nnz)      { *nnz      = 0.0; }
+
+   for (l = l_first; l <= l_last; l++)
+   {
+      stats = hypre_BoomerAMGPhaseStatsEntry(amg_data, l, phase);
+      if (!stats)
+      {
+         continue;
+      }
+      if (time)     { *time     += stats -> time; }
+      if (bytes)    { *bytes    += stats -> bytes; }
+      if (messages) { *messages += stats -> messages; }
+      if (nnz)      { *nnz      += stats -> nnz; }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGPrintPhaseStats
+ *
+ * Writes the statistics of all levels and phases as a JSON document.  Times
+ * are the maximum over processors, all other quantities are summed.  This
+ * is collective; only processor 0 writes the file.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGPrintPhaseStats( void       *data,
+                                const char *filename )
+{
+   hypre_ParAMGData       *amg_data = (hypre_ParAMGData*) data;
+   hypre_ParAMGPhaseStats *stats;
+   MPI_Comm                comm;
+   HYPRE_Int               num_levels, num_entries;
+   HYPRE_Int               my_id, num_procs;
+   HYPRE_Int               level, phase, i;
+   HYPRE_Real             *send_buf, *max_buf, *sum_buf;
+   FILE                   *fp;
+
+   if (!amg_data || !hypre_ParAMGDataAArray(amg_data))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   comm = hypre_ParCSRMatrixComm(hypre_ParAMGDataAArray(amg_data)[0]);
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   num_levels = hypre_min(hypre_ParAMGDataNumLevels(amg_data),
+                          hypre_ParAMGDataPhaseStatsNumLevels(amg_data));
+   num_entries = num_levels * hypre_AMG_NUM_PHASES;
+
+   /* per entry: time, bytes, messages, nnz, calls */
+   send_buf = hypre_CTAlloc(HYPRE_Real, 5 * num_entries + 1, HYPRE_MEMORY_HOST);
+   max_buf  = hypre_CTAlloc(HYPRE_Real, 5 * num_entries + 1, HYPRE_MEMORY_HOST);
+   sum_buf  = hypre_CTAlloc(HYPRE_Real, 5 * num_entries + 1, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_entries; i++)
+   {
+      stats = &hypre_ParAMGDataPhaseStatsData(amg_data)[i];
+      send_buf[5*i]   = stats -> time;
+      send_buf[5*i+1] = stats -> bytes;
+      send_buf[5*i+2] = stats -> messages;
+      send_buf[5*i+3] = stats -> nnz;
+      send_buf[5*i+4] = (HYPRE_Real) stats -> calls;
+   }
+   hypre_MPI_Allreduce(send_buf, max_buf, 5 * num_entries, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+   hypre_MPI_Allreduce(send_buf, sum_buf, 5 * num_entries, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   if (my_id == 0)
+   {
+      if ((fp = fopen(filename, "w")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      }
+      else
+      {
+         hypre_fprintf(fp, "{\n");
+         hypre_fprintf(fp, "  \"num_procs\": %d,\n", num_procs);
+         hypre_fprintf(fp, "  \"num_levels\": %d,\n", num_levels);
+         hypre_fprintf(fp, "  \"levels\": [\n");
+         for (level = 0; level < num_levels; level++)
+         {
+            hypre_fprintf(fp, "    {\n      \"level\": %d,\n", level);
+            for (phase = 0; phase < hypre_AMG_NUM_PHASES; phase++)
+            {
+               i = level * hypre_AMG_NUM_PHASES + phase;
+               if (phase == 0)
+               {
+                  hypre_fprintf(fp, "      \"setup\": {\n");
+               }
+               else if (phase == hypre_AMG_NUM_SETUP_PHASES)
+               {
+                  hypre_fprintf(fp, "      \"solve\": {\n");
+               }
+               hypre_fprintf(fp, "        \"%s\": {\"calls\": %.0f, \"time\": %e, "
+                             "\"bytes\": %.0f, \"messages\": %.0f, \"nnz\": %.0f}",
+                             hypre_amg_phase_names[phase], max_buf[5*i+4], max_buf[5*i],
+                             sum_buf[5*i+1], sum_buf[5*i+2], sum_buf[5*i+3]);
+               if (phase == hypre_AMG_NUM_SETUP_PHASES - 1)
+               {
+                  hypre_fprintf(fp, "\n      },\n");
+               }
+               else if (phase == hypre_AMG_NUM_PHASES - 1)
+               {
+                  hypre_fprintf(fp, "\n      }\n");
+               }
+               else
+               {
+                  hypre_fprintf(fp, ",\n");
+               }
+            }
+            hypre_fprintf(fp, "    }%s\n", (level < num_levels - 1) ? "," : "");
+         }
+         hypre_fprintf(fp, "  ]\n}\n");
+         fclose(fp);
+      }
+   }
+
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(max_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(sum_buf, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,652 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Numeric-only AMG setup for a matrix whose sparsity pattern has not
+ * changed since the last call to hypre_BoomerAMGSetup.
+ *
+ * The C/F splitting, the sparsity patterns of the interpolation operators and
+ * of the coarse-grid operators are kept.  On every level the strength matrix
+ * is recomputed, interpolation is rebuilt with the configured method on the
+ * stored C/F splitting and projected onto the stored pattern, and the values
+ * of the coarse-grid operator are recomputed with a reusable symbolic RAP
+ * (see parcsr_mv/par_csr_rap_plan.c).  Configurations that are not covered
+ * fall back to a full hypre_BoomerAMGSetup.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if hypre_BoomerAMGResetup cannot reuse the current hierarchy
+ * for the given settings.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupNeedsSetup( hypre_ParAMGData *amg_data )
+{
+   HYPRE_Int  *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int   interp_type     = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int   num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int   j;
+
+   if ( hypre_ParAMGDataBlockMode(amg_data) ||
+        hypre_ParAMGDataNumFunctions(amg_data) > 1 ||
+        hypre_ParAMGDataNodal(amg_data) != 0 ||
+        hypre_ParAMGInterpVecVariant(amg_data) > 0 ||
+        hypre_ParAMGInterpRefine(amg_data) > 0 ||
+        hypre_ParAMGDataGSMG(amg_data) ||
+        hypre_ParAMGDataAggNumLevels(amg_data) > 0 ||
+        hypre_ParAMGDataPostInterpType(amg_data) > 0 ||
+        hypre_ParAMGDataRestriction(amg_data) ||
+        hypre_ParAMGDataNonGalerkNumTol(amg_data) > 0 ||
+        hypre_ParAMGDataNonGalTolArray(amg_data) ||
+        hypre_ParAMGDataAdditive(amg_data) > -1 ||
+        hypre_ParAMGDataMultAdditive(amg_data) > -1 ||
+        hypre_ParAMGDataSimple(amg_data) > -1 ||
+        hypre_ParAMGDataADropTol(amg_data) > 0.0 ||
+        hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+        hypre_ParAMGDataCoarseSolver(amg_data) )
+   {
+      return 1;
+   }
+
+#ifdef HYPRE_USING_DSUPERLU
+   if (hypre_ParAMGDataDSLUSolver(amg_data))
+   {
+      return 1;
+   }
+#endif
+
+   /* least-squares interpolation needs the smooth vectors of the setup */
+   if (interp_type == 1)
+   {
+      return 1;
+   }
+
+   /* the CG smoother keeps a PCG setup for every level */
+   for (j = 0; j < 4; j++)
+   {
+      if (grid_relax_type[j] == 15)
+      {
+         return 1;
+      }
+   }
+
+   /* single-precision levels whose double values were freed */
+   for (j = 1; j < num_levels; j++)
+   {
+      hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(hypre_ParAMGDataAArray(amg_data)[j]);
+      hypre_CSRMatrix *P_diag = hypre_ParCSRMatrixDiag(hypre_ParAMGDataPArray(amg_data)[j-1]);
+
+      if ( (!hypre_CSRMatrixData(A_diag) && hypre_CSRMatrixDataFloat(A_diag)) ||
+           (!hypre_CSRMatrixData(P_diag) && hypre_CSRMatrixDataFloat(P_diag)) )
+      {
+         return 1;
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Builds interpolation on the stored C/F splitting, following the
+ * dispatch of hypre_BoomerAMGSetup for scalar problems.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupBuildInterp( hypre_ParAMGData    *amg_data,
+                                   hypre_ParCSRMatrix  *A,
+                                   HYPRE_Int           *CF_marker,
+                                   hypre_ParCSRMatrix  *S,
+                                   HYPRE_BigInt        *coarse_pnts_global,
+                                   HYPRE_Int           *col_offd_S_to_A,
+                                   hypre_ParCSRMatrix **P_ptr )
+{
+   HYPRE_Int   interp_type  = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int   sep_weight   = hypre_ParAMGDataSepWeight(amg_data);
+   HYPRE_Int   debug_flag   = hypre_ParAMGDataDebugFlag(amg_data);
+   HYPRE_Real  trunc_factor = hypre_ParAMGDataTruncFactor(amg_data);
+   HYPRE_Int   P_max_elmts  = hypre_ParAMGDataPMaxElmts(amg_data);
+
+   /* see hypre_BoomerAMGSetup */
+   if (interp_type == 9)
+   {
+      interp_type = 8;
+      sep_weight = 1;
+   }
+   else if (interp_type == 5)
+   {
+      interp_type = 4;
+      sep_weight = 1;
+   }
+
+   switch (interp_type)
+   {
+      case 2:
+         hypre_BoomerAMGBuildInterpHE(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                      debug_flag, trunc_factor, P_max_elmts,
+                                      col_offd_S_to_A, P_ptr);
+         break;
+
+      case 3:
+      case 15:
+         hypre_BoomerAMGBuildDirInterp(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                       debug_flag, trunc_factor, P_max_elmts,
+                                       col_offd_S_to_A, interp_type, P_ptr);
+         break;
+
+      case 4:
+         hypre_BoomerAMGBuildMultipass(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                       debug_flag, trunc_factor, P_max_elmts, sep_weight,
+                                       col_offd_S_to_A, P_ptr);
+         break;
+
+      case 6:
+         hypre_BoomerAMGBuildExtPIInterp(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                         debug_flag, trunc_factor, P_max_elmts,
+                                         col_offd_S_to_A, P_ptr);
+         break;
+
+      case 7:
+         hypre_BoomerAMGBuildExtPICCInterp(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                           debug_flag, trunc_factor, P_max_elmts,
+                                           col_offd_S_to_A, P_ptr);
+         break;
+
+      case 8:
+         hypre_BoomerAMGBuildStdInterp(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                       debug_flag, trunc_factor, P_max_elmts, sep_weight,
+                                       col_offd_S_to_A, P_ptr);
+         break;
+
+      case 12:
+         hypre_BoomerAMGBuildFFInterp(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                      debug_flag, trunc_factor, P_max_elmts,
+                                      col_offd_S_to_A, P_ptr);
+         break;
+
+      case 13:
+         hypre_BoomerAMGBuildFF1Interp(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                       debug_flag, trunc_factor, P_max_elmts,
+                                       col_offd_S_to_A, P_ptr);
+         break;
+
+      case 14:
+         hypre_BoomerAMGBuildExtInterp(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                       debug_flag, trunc_factor, P_max_elmts,
+                                       col_offd_S_to_A, P_ptr);
+         break;
+
+      case 16:
+         hypre_BoomerAMGBuildModExtInterp(A, CF_marker, S, coarse_pnts_global,
+                                          debug_flag, trunc_factor, P_max_elmts,
+                                          col_offd_S_to_A, P_ptr);
+         break;
+
+      case 17:
+         hypre_BoomerAMGBuildModExtPIInterp(A, CF_marker, S, coarse_pnts_global,
+                                            debug_flag, trunc_factor, P_max_elmts,
+                                            col_offd_S_to_A, P_ptr);
+         break;
+
+      case 18:
+         hypre_BoomerAMGBuildModNewExtPIInterp(A, CF_marker, S, coarse_pnts_global,
+                                               debug_flag, trunc_factor, P_max_elmts,
+                                               col_offd_S_to_A, P_ptr);
+         break;
+
+      case 100:
+         hypre_BoomerAMGBuildInterpOnePnt(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                          debug_flag, col_offd_S_to_A, P_ptr);
+         break;
+
+      default:
+         hypre_BoomerAMGBuildInterp(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                    debug_flag, trunc_factor, P_max_elmts,
+                                    col_offd_S_to_A, P_ptr);
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Copies the values of P_new into the sparsity pattern of P.  Entries of
+ * P_new outside of the pattern are dropped and every row of P is rescaled
+ * so that it keeps the row sum of P_new.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupProjectInterp( hypre_ParCSRMatrix *P,
+                                     hypre_ParCSRMatrix *P_new )
+{
+   hypre_CSRMatrix *P_diag          = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrix *P_offd          = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int       *P_diag_i        = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j        = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Real      *P_diag_data     = hypre_CSRMatrixData(P_diag);
+   HYPRE_Int       *P_offd_i        = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int       *P_offd_j        = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Real      *P_offd_data     = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int        num_rows        = hypre_CSRMatrixNumRows(P_diag);
+   HYPRE_Int        num_cols_diag   = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int        num_cols_offd   = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_BigInt    *col_map_offd    = hypre_ParCSRMatrixColMapOffd(P);
+
+   hypre_CSRMatrix *Pn_diag         = hypre_ParCSRMatrixDiag(P_new);
+   hypre_CSRMatrix *Pn_offd         = hypre_ParCSRMatrixOffd(P_new);
+   HYPRE_Int       *Pn_diag_i       = hypre_CSRMatrixI(Pn_diag);
+   HYPRE_Int       *Pn_diag_j       = hypre_CSRMatrixJ(Pn_diag);
+   HYPRE_Real      *Pn_diag_data    = hypre_CSRMatrixData(Pn_diag);
+   HYPRE_Int       *Pn_offd_i       = hypre_CSRMatrixI(Pn_offd);
+   HYPRE_Int       *Pn_offd_j       = hypre_CSRMatrixJ(Pn_offd);
+   HYPRE_Real      *Pn_offd_data    = hypre_CSRMatrixData(Pn_offd);
+   HYPRE_Int        num_cols_offd_n = hypre_CSRMatrixNumCols(Pn_offd);
+   HYPRE_BigInt    *col_map_offd_n  = hypre_ParCSRMatrixColMapOffd(P_new);
+
+   HYPRE_Int       *offd_n_to_offd, *marker;
+   HYPRE_Int        i, jj, c;
+   HYPRE_Real       row_sum, kept_sum, scale;
+
+   offd_n_to_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd_n, HYPRE_MEMORY_HOST);
+   for (c = 0; c < num_cols_offd_n; c++)
+   {
+      offd_n_to_offd[c] = hypre_BigBinarySearch(col_map_offd, col_map_offd_n[c], num_cols_offd);
+   }
+
+   marker = hypre_TAlloc(HYPRE_Int, num_cols_diag + num_cols_offd, HYPRE_MEMORY_HOST);
+   for (c = 0; c < num_cols_diag + num_cols_offd; c++)
+   {
+      marker[c] = -1;
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+      {
+         marker[P_diag_j[jj]] = jj;
+         P_diag_data[jj] = 0.0;
+      }
+      for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+      {
+         marker[num_cols_diag + P_offd_j[jj]] = jj;
+         P_offd_data[jj] = 0.0;
+      }
+
+      row_sum  = 0.0;
+      kept_sum = 0.0;
+      for (jj = Pn_diag_i[i]; jj < Pn_diag_i[i + 1]; jj++)
+      {
+         row_sum += Pn_diag_data[jj];
+         if (marker[Pn_diag_j[jj]] > -1)
+         {
+            P_diag_data[marker[Pn_diag_j[jj]]] = Pn_diag_data[jj];
+            kept_sum += Pn_diag_data[jj];
+         }
+      }
+      for (jj = Pn_offd_i[i]; jj < Pn_offd_i[i + 1]; jj++)
+      {
+         row_sum += Pn_offd_data[jj];
+         c = offd_n_to_offd[Pn_offd_j[jj]];
+         if (c > -1 && marker[num_cols_diag + c] > -1)
+         {
+            P_offd_data[marker[num_cols_diag + c]] = Pn_offd_data[jj];
+            kept_sum += Pn_offd_data[jj];
+         }
+      }
+
+      if (kept_sum != 0.0 && kept_sum != row_sum)
+      {
+         scale = row_sum / kept_sum;
+         for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+         {
+            P_diag_data[jj] *= scale;
+         }
+         for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+         {
+            P_offd_data[jj] *= scale;
+         }
+      }
+
+      for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+      {
+         marker[P_diag_j[jj]] = -1;
+      }
+      for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+      {
+         marker[num_cols_diag + P_offd_j[jj]] = -1;
+      }
+   }
+
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_n_to_offd, HYPRE_MEMORY_HOST);
+
+   hypre_CSRMatrixResetSell(P_diag);
+   hypre_CSRMatrixResetSell(P_offd);
+
+   /* transposes kept by the coarse-grid product (keepTranspose) */
+   if (hypre_ParCSRMatrixDiagT(P))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(P));
+      hypre_CSRMatrixTranspose(P_diag, &hypre_ParCSRMatrixDiagT(P), 1);
+   }
+   if (hypre_ParCSRMatrixOffdT(P))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(P));
+      hypre_CSRMatrixTranspose(P_offd, &hypre_ParCSRMatrixOffdT(P), 1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Recomputes the smoother data of hypre_BoomerAMGSetup that depends on the
+ * values of the level matrices (l1 norms, diagonal inverses of the smoother
+ * plans, Chebyshev coefficients and the coarsest-level Gaussian elimination).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupSmoothers( hypre_ParAMGData *amg_data )
+{
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int          **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            relax_order     = hypre_ParAMGDataRelaxOrder(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   hypre_ParAMGRelaxPlan **relax_plans  = hypre_ParAMGDataRelaxPlanArray(amg_data);
+   HYPRE_Real         **cheby_coefs     = hypre_ParAMGDataChebyCoefs(amg_data);
+   HYPRE_Real         **cheby_ds        = hypre_ParAMGDataChebyDS(amg_data);
+   HYPRE_Real          *max_eig_est     = hypre_ParAMGDataMaxEigEst(amg_data);
+   HYPRE_Real          *min_eig_est     = hypre_ParAMGDataMinEigEst(amg_data);
+   HYPRE_Int            j;
+
+   for (j = 0; j < num_levels; j++)
+   {
+      HYPRE_Real *l1_norm_data = NULL;
+      HYPRE_Int  *cf_marker    = (relax_order && j < num_levels - 1) ? CF_marker_array[j] : NULL;
+
+      if (!l1_norms || !l1_norms[j])
+      {
+         /* nothing to do */
+      }
+      else if (grid_relax_type[1] == 7 || grid_relax_type[2] == 7 ||
+               (grid_relax_type[3] == 7 && j == num_levels - 1))
+      {
+         hypre_ParCSRComputeL1Norms(A_array[j], 5, NULL, &l1_norm_data);
+      }
+      else if ( j < num_levels - 1 && (grid_relax_type[1] == 18 || grid_relax_type[2] == 18) )
+      {
+         hypre_ParCSRComputeL1Norms(A_array[j], 1, cf_marker, &l1_norm_data);
+      }
+      else if (grid_relax_type[3] == 18 && j == num_levels - 1)
+      {
+         hypre_ParCSRComputeL1Norms(A_array[j], 1, NULL, &l1_norm_data);
+      }
+      else
+      {
+         hypre_ParCSRComputeL1Norms(A_array[j], 4, cf_marker, &l1_norm_data);
+      }
+
+      if (l1_norm_data)
+      {
+         hypre_SeqVectorDestroy(l1_norms[j]);
+         l1_norms[j] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[j]));
+         hypre_VectorData(l1_norms[j]) = l1_norm_data;
+         hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
+      }
+
+      if (relax_plans && relax_plans[j])
+      {
+         hypre_BoomerAMGRelaxPlanUpdate(relax_plans[j], A_array[j],
+                                        (l1_norms && l1_norms[j]) ? hypre_VectorData(l1_norms[j]) : NULL);
+      }
+
+      if (cheby_coefs && cheby_coefs[j])
+      {
+         HYPRE_Int   scale          = hypre_ParAMGDataChebyScale(amg_data);
+         HYPRE_Int   variant        = hypre_ParAMGDataChebyVariant(amg_data);
+         HYPRE_Int   cheby_order    = hypre_ParAMGDataChebyOrder(amg_data);
+         HYPRE_Int   cheby_eig_est  = hypre_ParAMGDataChebyEigEst(amg_data);
+         HYPRE_Real  cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);
+         HYPRE_Real  max_eig, min_eig = 0;
+
+         if (cheby_eig_est)
+         {
+            hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est,
+                                         &max_eig, &min_eig);
+         }
+         else
+         {
+            hypre_ParCSRMaxEigEstimate(A_array[j], scale, &max_eig);
+         }
+         max_eig_est[j] = max_eig;
+         min_eig_est[j] = min_eig;
+
+         hypre_TFree(cheby_coefs[j], HYPRE_MEMORY_HOST);
+         hypre_TFree(cheby_ds[j], HYPRE_MEMORY_HOST);
+         hypre_ParCSRRelax_Cheby_Setup(A_array[j], max_eig, min_eig, cheby_fraction,
+                                       cheby_order, scale, variant,
+                                       &cheby_coefs[j], &cheby_ds[j]);
+      }
+   }
+
+   /* coarsest-level Gaussian elimination (relax types 9, 99, 199) */
+   if (hypre_ParAMGDataGSSetup(amg_data))
+   {
+      MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
+
+      hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataAMat(amg_data)     = NULL;
+      hypre_ParAMGDataAInv(amg_data)     = NULL;
+      hypre_ParAMGDataBVec(amg_data)     = NULL;
+      hypre_ParAMGDataCommInfo(amg_data) = NULL;
+      if (new_comm != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&new_comm);
+         hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
+      }
+
+      hypre_GaussElimSetup(amg_data, num_levels - 1, grid_relax_type[3]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetup( void               *amg_vdata,
+                        hypre_ParCSRMatrix *A,
+                        hypre_ParVector    *f,
+                        hypre_ParVector    *u )
+{
+   MPI_Comm              comm     = hypre_ParCSRMatrixComm(A);
+   hypre_ParAMGData     *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   hypre_ParCSRMatrix  **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array         = hypre_ParAMGDataPArray(amg_data);
+   HYPRE_Int           **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   hypre_ParVector     **F_array         = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector     **U_array         = hypre_ParAMGDataUArray(amg_data);
+   HYPRE_Int             num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRRAPPlan **rap_plans       = hypre_ParAMGDataRAPPlans(amg_data);
+
+   HYPRE_Real            strong_threshold = hypre_ParAMGDataStrongThreshold(amg_data);
+   HYPRE_Real            max_row_sum      = hypre_ParAMGDataMaxRowSum(amg_data);
+   HYPRE_Real            S_commpkg_switch = hypre_ParAMGDataSCommPkgSwitch(amg_data);
+   HYPRE_Int             useSabs          = hypre_ParAMGDataSabs(amg_data);
+   HYPRE_Int             amg_print_level  = hypre_ParAMGDataPrintLevel(amg_data);
+
+   hypre_ParCSRMatrix   *S, *P;
+   hypre_ParCSRRAPPlan  *plan;
+   HYPRE_BigInt         *coarse_pnts_global;
+   HYPRE_Int            *col_offd_S_to_A;
+   HYPRE_Int             num_procs, num_starts, level;
+   HYPRE_Int             local_flag, global_flag;
+
+   /* the values of A may have been changed in place by the caller */
+   hypre_CSRMatrixResetSell(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixResetSell(hypre_ParCSRMatrixOffd(A));
+
+   /*-----------------------------------------------------------------------
+    * Decide (collectively) whether the existing hierarchy can be reused
+    *-----------------------------------------------------------------------*/
+
+   local_flag = (A_array == NULL || A_array[0] == NULL ||
+                 hypre_BoomerAMGResetupNeedsSetup(amg_data));
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_DEVICE)
+   {
+      local_flag = 1;
+   }
+#endif
+   if (!local_flag)
+   {
+      local_flag = (hypre_ParCSRMatrixGlobalNumRows(A) != hypre_ParCSRMatrixGlobalNumRows(A_array[0]) ||
+                    hypre_ParCSRMatrixNumRows(A) != hypre_ParCSRMatrixNumRows(A_array[0]));
+   }
+   if (!local_flag && rap_plans && rap_plans[0])
+   {
+      hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+      hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+      HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+      HYPRE_Int        i;
+
+      plan = rap_plans[0];
+      local_flag = (num_cols_offd != plan -> num_cols_offd_A ||
+                    hypre_CSRMatrixI(A_diag)[hypre_CSRMatrixNumRows(A_diag)] +
+                    hypre_CSRMatrixI(A_offd)[hypre_CSRMatrixNumRows(A_offd)] !=
+                    plan -> num_nonzeros_A);
+      for (i = 0; i < num_cols_offd && !local_flag; i++)
+      {
+         local_flag = (hypre_ParCSRMatrixColMapOffd(A)[i] != plan -> col_map_offd_A[i]);
+      }
+   }
+   hypre_MPI_Allreduce(&local_flag, &global_flag, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+
+   if (global_flag)
+   {
+      return hypre_BoomerAMGSetup(amg_vdata, A, f, u);
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   num_starts = 2;
+#else
+   num_starts = num_procs + 1;
+#endif
+
+   hypre_ParCSRMatrixSetNumNonzeros(A);
+   hypre_ParCSRMatrixSetDNumNonzeros(A);
+   A_array[0] = A;
+   F_array[0] = f;
+   U_array[0] = u;
+
+   if (!rap_plans && num_levels > 1)
+   {
+      rap_plans = hypre_CTAlloc(hypre_ParCSRRAPPlan *, num_levels - 1, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlans(amg_data)    = rap_plans;
+      hypre_ParAMGDataNumRAPPlans(amg_data) = num_levels - 1;
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      /* strength of connection */
+      S = NULL;
+      if (!useSabs)
+      {
+         hypre_BoomerAMGCreateS(A_array[level], strong_threshold, max_row_sum,
+                                1, NULL, &S);
+      }
+      else
+      {
+         hypre_BoomerAMGCreateSabs(A_array[level], strong_threshold, 1.0,
+                                   1, NULL, &S);
+      }
+      col_offd_S_to_A = NULL;
+      if (strong_threshold > S_commpkg_switch)
+      {
+         hypre_BoomerAMGCreateSCommPkg(A_array[level], S, &col_offd_S_to_A);
+      }
+
+      /* interpolation on the stored C/F splitting, projected onto the stored pattern */
+      coarse_pnts_global = hypre_TAlloc(HYPRE_BigInt, num_starts, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(coarse_pnts_global, hypre_ParCSRMatrixColStarts(P_array[level]),
+                    HYPRE_BigInt, num_starts, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+      P = NULL;
+      hypre_BoomerAMGResetupBuildInterp(amg_data, A_array[level], CF_marker_array[level], S,
+                                        coarse_pnts_global, col_offd_S_to_A, &P);
+      hypre_BoomerAMGResetupProjectInterp(P_array[level], P);
+
+      hypre_ParCSRMatrixDestroy(P);
+      hypre_ParCSRMatrixDestroy(S);
+      hypre_TFree(col_offd_S_to_A, HYPRE_MEMORY_HOST);
+
+      /* coarse-grid operator: values only */
+      if (!rap_plans[level])
+      {
+         hypre_ParCSRRAPPlanCreate(P_array[level], A_array[level], P_array[level],
+                                   A_array[level + 1], &rap_plans[level]);
+         if (!rap_plans[level])
+         {
+            /* the stored coarse-grid pattern does not contain R^T A P */
+            return hypre_BoomerAMGSetup(amg_vdata, A, f, u);
+         }
+      }
+      hypre_ParCSRMatrixRAPNumeric(rap_plans[level], P_array[level], A_array[level],
+                                   P_array[level], A_array[level + 1]);
+   }
+
+   hypre_BoomerAMGResetupSmoothers(amg_data);
+
+   if (amg_print_level == 1 || amg_print_level == 3)
+   {
+      hypre_BoomerAMGSetupStats(amg_data, A);
+   }
+
+   if (hypre_ParAMGDataFloatLevel(amg_data) > 0)
+   {
+      hypre_BoomerAMGFloatLevelsSetup(amg_data);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRAPPlansDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRAPPlansDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData     *amg_data  = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRRAPPlan **rap_plans = hypre_ParAMGDataRAPPlans(amg_data);
+   HYPRE_Int             level;
+
+   if (rap_plans)
+   {
+      for (level = 0; level < hypre_ParAMGDataNumRAPPlans(amg_data); level++)
+      {
+         hypre_ParCSRRAPPlanDestroy(rap_plans[level]);
+      }
+      hypre_TFree(rap_plans, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParAMGDataRAPPlans(amg_data)    = NULL;
+   hypre_ParAMGDataNumRAPPlans(amg_data) = 0;
+
+   return hypre_error_flag;
+}
@@ -189,6 +189,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       addlvl = hypre_max(mult_addlvl, additive);
    HYPRE_Int       rap2 = hypre_ParAMGDataRAP2(amg_data);
    HYPRE_Int       keepTranspose = hypre_ParAMGDataKeepTranspose(amg_data);
+   HYPRE_Int       fused_rap = hypre_ParAMGDataFusedRAP(amg_data);
+   HYPRE_Real      rap_peak_memory = 0.0;
 
    HYPRE_Int       local_coarse_size;
    HYPRE_Int       num_C_points_coarse      = hypre_ParAMGDataNumCPoints(amg_data);
@@ -240,7 +242,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    /*A_new = hypre_CSRMatrixDeleteZeros(hypre_ParCSRMatrixDiag(A), 1.e-16);
    hypre_CSRMatrixPrint(A_new, "Atestnew"); */
    old_num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParAMGDataRAPPeakMemory(amg_data) = 0.0;
    max_levels = hypre_ParAMGDataMaxLevels(amg_data);
+   hypre_BoomerAMGPhaseStatsInitialize(amg_data, max_levels);
    add_end = hypre_min(add_last_lvl, max_levels-1);
    if (add_end == -1) add_end = max_levels-1;
    amg_logging = hypre_ParAMGDataLogging(amg_data);
@@ -541,6 +545,23 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
+      if (hypre_ParAMGDataRelaxOverlapRows(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_TFree(hypre_ParAMGDataRelaxOverlapRows(amg_data)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_ParAMGDataRelaxOverlapRows(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataRelaxOverlapNumInterior(amg_data), HYPRE_MEMORY_HOST);
+      }
+      if (hypre_ParAMGDataRelaxPlanArray(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_BoomerAMGRelaxPlanDestroy(hypre_ParAMGDataRelaxPlanArray(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataRelaxPlanArray(amg_data), HYPRE_MEMORY_HOST);
+      }
       if (smooth_num_levels && smoother)
       {
          if (smooth_num_levels > old_num_levels-1)
@@ -810,6 +831,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
 
 
+   hypre_BoomerAMGMultiVectorsDestroy(amg_data);
+   hypre_BoomerAMGRAPPlansDestroy(amg_data);
+
    F_array = hypre_ParAMGDataFArray(amg_data);
    U_array = hypre_ParAMGDataUArray(amg_data);
 
@@ -975,6 +999,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Get the Strength Matrix ****/
 
+         hypre_BoomerAMGPhaseBegin(amg_data, level, hypre_AMG_PHASE_STRENGTH);
+
          if (hypre_ParAMGDataGSMG(amg_data) == 0)
          {
             if (nodal) /* if we are solving systems and
@@ -1059,6 +1085,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                             num_functions, dof_func_array[level], &S);
          }
 
+         hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_STRENGTH, S ? S : SN);
+
          /* Allocate CF_marker for the current level */
          CF_marker_array[level] = hypre_CTAlloc(HYPRE_Int, local_num_vars, HYPRE_MEMORY_HOST);
          CF_marker = CF_marker_array[level];
@@ -1087,6 +1115,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Do the appropriate coarsening ****/
 
+         hypre_BoomerAMGPhaseBegin(amg_data, level, hypre_AMG_PHASE_COARSEN);
+
          if (nodal == 0) /* no nodal coarsening */
          {
             if (coarsen_type == 6)
@@ -1108,6 +1138,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
            {
 #ifdef HYPRE_MIXEDINT
               hypre_error_w_msg(HYPRE_ERROR_GENERIC,"CGC coarsening is not available in mixedint mode!");
+              hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_COARSEN, NULL);
               return hypre_error_flag;
 #endif
               hypre_BoomerAMGCoarsenCGCb(S, A_array[level], measure_type, coarsen_type,
@@ -1447,6 +1478,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   num_grid_sweeps[3] = 1;
                   if (grid_relax_points) grid_relax_points[3][0] = 0;
                }
+               hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_COARSEN, S);
                if (S) hypre_ParCSRMatrixDestroy(S);
                if (SN) hypre_ParCSRMatrixDestroy(SN);
                if (AN) hypre_ParCSRMatrixDestroy(AN);
@@ -1474,6 +1506,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
             if (coarse_size < min_coarse_size)
             {
+               hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_COARSEN, S);
                if (S) hypre_ParCSRMatrixDestroy(S);
                if (SN) hypre_ParCSRMatrixDestroy(SN);
                if (AN) hypre_ParCSRMatrixDestroy(AN);
@@ -1501,6 +1534,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
          if (level < agg_num_levels)
          {
+            hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_COARSEN, S);
+            hypre_BoomerAMGPhaseBegin(amg_data, level, hypre_AMG_PHASE_INTERP);
+
             if (nodal == 0)
             {
                if (agg_interp_type == 1)
@@ -1619,7 +1655,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                      P = hypre_ParMatmul(P1, P2);
                   }
 
+                  hypre_BoomerAMGPhaseBegin(amg_data, level, hypre_AMG_PHASE_TRUNC);
                   hypre_BoomerAMGInterpTruncation(P, agg_trunc_factor, agg_P_max_elmts);
+                  hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_TRUNC, P);
 
                   hypre_MatvecCommPkgCreate(P);
                   hypre_ParCSRMatrixDestroy(P1);
@@ -1788,8 +1826,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   {
                      P = hypre_ParMatmul(P1, P2);
                   }
+                  hypre_BoomerAMGPhaseBegin(amg_data, level, hypre_AMG_PHASE_TRUNC);
                   hypre_BoomerAMGInterpTruncation(P, agg_trunc_factor,
                                                   agg_P_max_elmts);
+                  hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_TRUNC, P);
                   hypre_MatvecCommPkgCreate(P);
                   hypre_ParCSRMatrixDestroy(P1);
                   hypre_ParCSRMatrixOwnsColStarts(P2) = 0;
@@ -1837,6 +1877,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             coarse_size = coarse_pnts_global[num_procs];
 #endif
  xxxxxxxxxxxxxxxxxxxxxxxxx change for min_coarse_size */
+            hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_COARSEN, S);
+
             if (debug_flag==1)
             {
                wall_time = time_getWallclockSeconds() - wall_time;
@@ -1845,6 +1887,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                fflush(NULL);
             }
 
+            hypre_BoomerAMGPhaseBegin(amg_data, level, hypre_AMG_PHASE_INTERP);
+
             /* RL: build restriction */
             if (restri_type)
             {
@@ -2244,6 +2288,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             num_grid_sweeps[3] = 1;
             if (grid_relax_points) grid_relax_points[3][0] = 0;
          }
+         if (max_levels > 1)
+            hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_INTERP, P);
          if (S)
             hypre_ParCSRMatrixDestroy(S);
          if (P)
@@ -2261,6 +2307,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
       if (level < agg_num_levels && coarse_size < min_coarse_size)
       {
+         hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_INTERP, P);
          if (S)
             hypre_ParCSRMatrixDestroy(S);
          if (P)
@@ -2571,10 +2618,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                }
                else
                {
-                  if (hypre_ParAMGDataModularizedMatMat(amg_data))
+                  if (hypre_ParAMGDataModularizedMatMat(amg_data) || fused_rap)
                   {
-                     A_H = hypre_ParCSRMatrixRAPKT(P, A_array[level],
-                                                   P, keepTranspose);
+                     A_H = hypre_ParCSRMatrixRAPKT_v2(P, A_array[level], P,
+                                                      keepTranspose, fused_rap, &rap_peak_memory);
+                     hypre_ParAMGDataRAPPeakMemory(amg_data) =
+                        hypre_max(hypre_ParAMGDataRAPPeakMemory(amg_data), rap_peak_memory);
                   }
                   else
                   {
@@ -2613,7 +2662,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
             if (add_P_max_elmts || add_trunc_factor)
             {
+               hypre_BoomerAMGPhaseBegin(amg_data, level, hypre_AMG_PHASE_TRUNC);
                hypre_BoomerAMGTruncandBuild(P_array[level], add_trunc_factor,add_P_max_elmts);
+               hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_TRUNC, P_array[level]);
             }
             /*else
                 hypre_MatvecCommPkgCreate(P_array[level]);  */
@@ -2639,6 +2690,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_TFree(SmoothVecs, HYPRE_MEMORY_HOST);
       SmoothVecs = NULL;
 
+      hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_INTERP,
+                              block_mode ? NULL : P_array[level]);
+
       if (debug_flag==1)
       {
          wall_time = time_getWallclockSeconds() - wall_time;
@@ -2653,6 +2707,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       if (debug_flag==1) wall_time = time_getWallclockSeconds();
 
+      hypre_BoomerAMGPhaseBegin(amg_data, level, hypre_AMG_PHASE_RAP);
+
       if (block_mode)
       {
 
@@ -2771,10 +2827,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          else
          {
             /* Compute standard Galerkin coarse-grid product */
-            if (hypre_ParAMGDataModularizedMatMat(amg_data))
+            if (hypre_ParAMGDataModularizedMatMat(amg_data) || fused_rap)
             {
-               A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
-                                             P_array[level], keepTranspose);
+               A_H = hypre_ParCSRMatrixRAPKT_v2(P_array[level], A_array[level], P_array[level],
+                                                keepTranspose, fused_rap, &rap_peak_memory);
+               hypre_ParAMGDataRAPPeakMemory(amg_data) =
+                  hypre_max(hypre_ParAMGDataRAPPeakMemory(amg_data), rap_peak_memory);
             }
             else
             {
@@ -2790,6 +2848,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
 
+      hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_RAP,
+                              block_mode ? NULL : A_H);
+
       if (debug_flag==1)
       {
          wall_time = time_getWallclockSeconds() - wall_time;
@@ -2839,6 +2900,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
    /* redundant coarse grid solve */
+   hypre_BoomerAMGPhaseBegin(amg_data, level, hypre_AMG_PHASE_SMOOTHER_SETUP);
    if (  (seq_threshold >= coarse_threshold) && (coarse_size > (HYPRE_BigInt)coarse_threshold) && (level != max_levels-1))
    {
       hypre_seqAMGSetup( amg_data, level, coarse_threshold);
@@ -2870,6 +2932,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          grid_relax_type[3] = grid_relax_type[1];
       }
    }
+   hypre_BoomerAMGPhaseEnd(amg_data, level, hypre_AMG_PHASE_SMOOTHER_SETUP,
+                           block_mode ? NULL : A_array[level]);
 
    if (level > 0)
    {
@@ -2965,6 +3029,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    {
       HYPRE_Real *l1_norm_data = NULL;
 
+      hypre_BoomerAMGPhaseBegin(amg_data, j, hypre_AMG_PHASE_SMOOTHER_SETUP);
+
       if (j < num_levels-1 && (grid_relax_type[1] == 8 || grid_relax_type[1] == 13 || grid_relax_type[1] == 14 ||
                                grid_relax_type[2] == 8 || grid_relax_type[2] == 13 || grid_relax_type[2] == 14))
       {
@@ -3004,6 +3070,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_VectorData(l1_norms[j]) = l1_norm_data;
          hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
       }
+
+      hypre_BoomerAMGPhaseEnd(amg_data, j, hypre_AMG_PHASE_SMOOTHER_SETUP, NULL);
    }
 
    for (j = addlvl; j < hypre_min(add_end+1, num_levels) ; j++)
@@ -3024,6 +3092,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    {
       HYPRE_Real *l1_norm_data = NULL;
 
+      hypre_BoomerAMGPhaseBegin(amg_data, j, hypre_AMG_PHASE_SMOOTHER_SETUP);
+
       if (j < num_levels-1 && (grid_relax_type[1] == 8 || grid_relax_type[1] == 13 || grid_relax_type[1] == 14 ||
                                grid_relax_type[2] == 8 || grid_relax_type[2] == 13 || grid_relax_type[2] == 14))
       {
@@ -3062,10 +3132,30 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_VectorData(l1_norms[j]) = l1_norm_data;
          hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
       }
+
+      hypre_BoomerAMGPhaseEnd(amg_data, j, hypre_AMG_PHASE_SMOOTHER_SETUP, NULL);
+   }
+
+   /* interior/boundary row split for the split-phase hybrid smoothers */
+   if (hypre_ParAMGDataRelaxOverlap(amg_data) && !block_mode)
+   {
+      hypre_ParAMGDataRelaxOverlapRows(amg_data) =
+         hypre_CTAlloc(HYPRE_Int *, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRelaxOverlapNumInterior(amg_data) =
+         hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+   }
+
+   /* thread partitions, C/F row lists and diagonal inverses for the smoothers */
+   if (hypre_ParAMGDataRelaxPlan(amg_data) && !block_mode)
+   {
+      hypre_ParAMGDataRelaxPlanArray(amg_data) =
+         hypre_CTAlloc(hypre_ParAMGRelaxPlan *, num_levels, HYPRE_MEMORY_HOST);
    }
 
    for (j = 0; j < num_levels; j++)
    {
+      hypre_BoomerAMGPhaseBegin(amg_data, j, hypre_AMG_PHASE_SMOOTHER_SETUP);
+
       if (grid_relax_type[1] == 7 || grid_relax_type[2] == 7 || (grid_relax_type[3] == 7 && j == (num_levels-1)))
       {
          HYPRE_Real *l1_norm_data = NULL;
@@ -3249,6 +3339,22 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_BoomerAMGCGRelaxWt(amg_data, j, num_cg_sweeps, &omega[j]);
          }
       }
+
+      if (hypre_ParAMGDataRelaxOverlapRows(amg_data))
+      {
+         hypre_BoomerAMGRelaxOverlapSetup(A_array[j],
+                                          &hypre_ParAMGDataRelaxOverlapRows(amg_data)[j],
+                                          &hypre_ParAMGDataRelaxOverlapNumInterior(amg_data)[j]);
+      }
+      if (hypre_ParAMGDataRelaxPlanArray(amg_data))
+      {
+         hypre_BoomerAMGRelaxPlanCreate(A_array[j],
+                                        (relax_order && j < num_levels-1) ? CF_marker_array[j] : NULL,
+                                        (l1_norms && l1_norms[j]) ? hypre_VectorData(l1_norms[j]) : NULL,
+                                        &hypre_ParAMGDataRelaxPlanArray(amg_data)[j]);
+      }
+
+      hypre_BoomerAMGPhaseEnd(amg_data, j, hypre_AMG_PHASE_SMOOTHER_SETUP, A_array[j]);
    } /* end of levels loop */
 
    if ( amg_logging > 1 ) {
@@ -3284,6 +3390,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_BoomerAMGSetupStats(amg_data,A);
    }
 
+   /* single-precision coarse levels; this may free their double values */
+   if (hypre_ParAMGDataFloatLevel(amg_data) > 0 && !block_mode)
+   {
+      hypre_BoomerAMGFloatLevelsSetup(amg_data);
+   }
+
    /* print out CF info to plot grids in matlab (see 'tools/AMGgrids.m') */
 
    if (hypre_ParAMGDataPlotGrids(amg_data))
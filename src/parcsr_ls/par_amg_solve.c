@@ -15,18 +15,55 @@
 #include "par_amg.h"
 
 /*--------------------------------------------------------------------
- * hypre_BoomerAMGSolve
+ * hypre_BoomerAMGSolveResidualNorms
+ *
+ * resid_nrm[j] = ||r_j||_2 for each of the num_vectors columns of r.
  *--------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_BoomerAMGSolve( void               *amg_vdata,
-                   hypre_ParCSRMatrix *A,
-                   hypre_ParVector    *f,
-                   hypre_ParVector    *u         )
+static HYPRE_Int
+hypre_BoomerAMGSolveResidualNorms( hypre_ParVector *r,
+                                   HYPRE_Int        num_vectors,
+                                   HYPRE_Real      *resid_nrm )
 {
-   MPI_Comm            comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int jv;
 
-   hypre_ParAMGData   *amg_data = (hypre_ParAMGData*) amg_vdata;
+   if (num_vectors > 1)
+   {
+      hypre_ParVectorMultiInnerProd(r, r, resid_nrm);
+   }
+   else
+   {
+      resid_nrm[0] = hypre_ParVectorInnerProd(r, r);
+   }
+
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      resid_nrm[jv] = sqrt(resid_nrm[jv]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveCycles
+ *
+ * Cycling loop shared by hypre_BoomerAMGSolve and
+ * hypre_BoomerAMGSolveMulti.  The level 0 arrays must already point to
+ * A, f and u, and r is the work vector for the fine-grid residual.  With
+ * num_vectors > 1 the cycles are done with hypre_BoomerAMGMultiCycle;
+ * the convergence test, the iteration count and the printed residuals
+ * are then those of the column with the largest relative residual.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGSolveCycles( hypre_ParAMGData   *amg_data,
+                            hypre_ParCSRMatrix *A,
+                            hypre_ParVector    *f,
+                            hypre_ParVector    *u,
+                            hypre_ParVector    *r,
+                            HYPRE_Int           num_vectors )
+{
+   MPI_Comm            comm = hypre_ParCSRMatrixComm(A);
 
    /* Data Structure variables */
 
@@ -34,12 +71,10 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Int      amg_logging;
    HYPRE_Int      cycle_count;
    HYPRE_Int      num_levels;
-   /* HYPRE_Int      num_unknowns; */
-   HYPRE_Int    converge_type;
-   HYPRE_Real   tol;
-
-   HYPRE_Int block_mode;
+   HYPRE_Int      converge_type;
+   HYPRE_Real     tol;
 
+   HYPRE_Int      block_mode;
 
    hypre_ParCSRMatrix **A_array;
    hypre_ParVector    **F_array;
@@ -47,10 +82,9 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
    hypre_ParCSRBlockMatrix **A_block_array;
 
-
    /*  Local variables  */
 
-   HYPRE_Int      j;
+   HYPRE_Int      j, jv, jmax;
    HYPRE_Int      Solve_err_flag;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
@@ -70,25 +104,19 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Real   operat_cmplxty;
    HYPRE_Real   grid_cmplxty;
    HYPRE_Real   conv_factor = 0.0;
-   HYPRE_Real   resid_nrm = 1.0;
-   HYPRE_Real   resid_nrm_init = 0.0;
    HYPRE_Real   relative_resid;
-   HYPRE_Real   rhs_norm = 0.0;
    HYPRE_Real   old_resid;
    HYPRE_Real   ieee_check = 0.;
+   HYPRE_Real  *resid_nrm;
+   HYPRE_Real  *resid_nrm_init;
+   HYPRE_Real  *rhs_norm;
+   HYPRE_Real  *rel_resid;
 
-   hypre_ParVector  *Vtemp;
-   hypre_ParVector  *Residual;
-
-   HYPRE_ANNOTATION_BEGIN("BoomerAMG.solve");
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm,&my_id);
 
-   amg_print_level    = hypre_ParAMGDataPrintLevel(amg_data);
+   amg_print_level  = hypre_ParAMGDataPrintLevel(amg_data);
    amg_logging      = hypre_ParAMGDataLogging(amg_data);
-   if ( amg_logging > 1 )
-      Residual = hypre_ParAMGDataResidual(amg_data);
-   /* num_unknowns  = hypre_ParAMGDataNumUnknowns(amg_data); */
    num_levels       = hypre_ParAMGDataNumLevels(amg_data);
    A_array          = hypre_ParAMGDataAArray(amg_data);
    F_array          = hypre_ParAMGDataFArray(amg_data);
@@ -102,23 +130,14 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    simple           = hypre_ParAMGDataSimple(amg_data);
    mult_additive    = hypre_ParAMGDataMultAdditive(amg_data);
 
-   A_array[0] = A;
-   F_array[0] = f;
-   U_array[0] = u;
-
    block_mode = hypre_ParAMGDataBlockMode(amg_data);
 
    A_block_array = hypre_ParAMGDataABlockArray(amg_data);
 
-
-   /*   Vtemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
-        hypre_ParCSRMatrixGlobalNumRows(A_array[0]),
-        hypre_ParCSRMatrixRowStarts(A_array[0]));
-        hypre_ParVectorInitialize(Vtemp);
-        hypre_ParVectorSetPartitioningOwner(Vtemp,0);
-        hypre_ParAMGDataVtemp(amg_data) = Vtemp;
-        */
-   Vtemp = hypre_ParAMGDataVtemp(amg_data);
+   resid_nrm      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   resid_nrm_init = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   rhs_norm       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   rel_resid      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
 
    /*-----------------------------------------------------------------------
     *    Write the solver parameters
@@ -140,14 +159,23 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    cycle_count = 0;
    operat_cmplxty = 0;
    grid_cmplxty = 0;
+   jmax = 0;
 
    /*-----------------------------------------------------------------------
     *     write some initial info
     *-----------------------------------------------------------------------*/
 
    if (my_id == 0 && amg_print_level > 1 && tol > 0.)
-      hypre_printf("\n\nAMG SOLUTION INFO:\n");
-
+   {
+      if (num_vectors > 1)
+      {
+         hypre_printf("\n\nAMG SOLUTION INFO (%d right-hand sides):\n", num_vectors);
+      }
+      else
+      {
+         hypre_printf("\n\nAMG SOLUTION INFO:\n");
+      }
+   }
 
    /*-----------------------------------------------------------------------
     *    Compute initial fine-grid residual and print
@@ -155,30 +183,51 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
    if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
    {
-      if ( amg_logging > 1 )
+      hypre_ParVectorCopy(f, r);
+      if (tol > 0)
       {
-         hypre_ParVectorCopy(F_array[0], Residual );
-         if (tol > 0)
-         {
-            hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Residual );
-         }
-         resid_nrm = sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
+         hypre_ParCSRMatrixMatvec(alpha, A, u, beta, r);
       }
-      else
+      hypre_BoomerAMGSolveResidualNorms(r, num_vectors, resid_nrm);
+      if (0 == converge_type)
       {
-         hypre_ParVectorCopy(F_array[0], Vtemp);
-         if (tol > 0)
-         {
-            hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Vtemp);
-         }
-         resid_nrm = sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
+         hypre_BoomerAMGSolveResidualNorms(f, num_vectors, rhs_norm);
       }
 
-      /* Since it is does not diminish performance, attempt to return an error flag
-         and notify users when they supply bad input. */
-      if (resid_nrm != 0.)
+      relative_resid = 0.0;
+      for (jv = 0; jv < num_vectors; jv++)
       {
-         ieee_check = resid_nrm/resid_nrm; /* INF -> NaN conversion */
+         /* Since it is does not diminish performance, attempt to return an error flag
+            and notify users when they supply bad input. */
+         if (resid_nrm[jv] != 0.)
+         {
+            ieee_check += resid_nrm[jv]/resid_nrm[jv]; /* INF -> NaN conversion */
+         }
+
+         /* r0 */
+         resid_nrm_init[jv] = resid_nrm[jv];
+
+         if (0 == converge_type)
+         {
+            if (rhs_norm[jv])
+            {
+               rel_resid[jv] = resid_nrm_init[jv] / rhs_norm[jv];
+            }
+            else
+            {
+               rel_resid[jv] = resid_nrm_init[jv];
+            }
+         }
+         else
+         {
+            /* converge_type != 0, test convergence with ||r|| / ||r0|| */
+            rel_resid[jv] = 1.0;
+         }
+         if (rel_resid[jv] > relative_resid)
+         {
+            relative_resid = rel_resid[jv];
+            jmax = jv;
+         }
       }
 
       if (ieee_check != ieee_check)
@@ -196,34 +245,19 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
-         HYPRE_ANNOTATION_END("BoomerAMG.solve");
-         return hypre_error_flag;
-      }
 
-      /* r0 */
-      resid_nrm_init = resid_nrm;
+         hypre_TFree(resid_nrm, HYPRE_MEMORY_HOST);
+         hypre_TFree(resid_nrm_init, HYPRE_MEMORY_HOST);
+         hypre_TFree(rhs_norm, HYPRE_MEMORY_HOST);
+         hypre_TFree(rel_resid, HYPRE_MEMORY_HOST);
 
-      if (0 == converge_type)
-      {
-         rhs_norm = sqrt(hypre_ParVectorInnerProd(f, f));
-         if (rhs_norm)
-         {
-            relative_resid = resid_nrm_init / rhs_norm;
-         }
-         else
-         {
-            relative_resid = resid_nrm_init;
-         }
-      }
-      else
-      {
-         /* converge_type != 0, test convergence with ||r|| / ||r0|| */
-         relative_resid = 1.0;
+         return hypre_error_flag;
       }
    }
    else
    {
       relative_resid = 1.;
+      resid_nrm[0] = 1.0;
    }
 
    if (my_id == 0 && amg_print_level > 1)
@@ -231,7 +265,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_printf("                                            relative\n");
       hypre_printf("               residual        factor       residual\n");
       hypre_printf("               --------        ------       --------\n");
-      hypre_printf("    Initial    %e                 %e\n", resid_nrm_init,
+      hypre_printf("    Initial    %e                 %e\n", resid_nrm_init[jmax],
             relative_resid);
    }
 
@@ -243,9 +277,14 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    {
       hypre_ParAMGDataCycleOpCount(amg_data) = 0;
       /* Op count only needed for one cycle */
-      if ( (additive      < 0 || additive      >= num_levels) &&
-           (mult_additive < 0 || mult_additive >= num_levels) &&
-           (simple        < 0 || simple        >= num_levels) )
+      if (num_vectors > 1)
+      {
+         hypre_BoomerAMGMultiCycle(amg_data, hypre_ParAMGDataFMultiArray(amg_data),
+                                   hypre_ParAMGDataUMultiArray(amg_data));
+      }
+      else if ( (additive      < 0 || additive      >= num_levels) &&
+                (mult_additive < 0 || mult_additive >= num_levels) &&
+                (simple        < 0 || simple        >= num_levels) )
       {
          hypre_BoomerAMGCycle(amg_data, F_array, U_array);
       }
@@ -260,42 +299,44 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
       if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
       {
-         old_resid = resid_nrm;
-
-         if ( amg_logging > 1 )
-         {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Residual );
-            resid_nrm = sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
-         }
-         else
-         {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Vtemp);
-            resid_nrm = sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
-         }
+         old_resid = resid_nrm[jmax];
 
-         if (old_resid)
-         {
-            conv_factor = resid_nrm / old_resid;
-         }
-         else
-         {
-            conv_factor = resid_nrm;
-         }
+         hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, r);
+         hypre_BoomerAMGSolveResidualNorms(r, num_vectors, resid_nrm);
 
-         if (0 == converge_type)
+         relative_resid = 0.0;
+         for (jv = 0; jv < num_vectors; jv++)
          {
-            if (rhs_norm)
+            if (0 == converge_type)
             {
-               relative_resid = resid_nrm / rhs_norm;
+               if (rhs_norm[jv])
+               {
+                  rel_resid[jv] = resid_nrm[jv] / rhs_norm[jv];
+               }
+               else
+               {
+                  rel_resid[jv] = resid_nrm[jv];
+               }
             }
             else
             {
-               relative_resid = resid_nrm;
+               rel_resid[jv] = resid_nrm_init[jv] ? resid_nrm[jv] / resid_nrm_init[jv] : 0.0;
             }
+            /* the first column is always taken, so that a NaN is reported */
+            if (rel_resid[jv] > relative_resid || jv == 0)
+            {
+               relative_resid = rel_resid[jv];
+               jmax = jv;
+            }
+         }
+
+         if (old_resid)
+         {
+            conv_factor = resid_nrm[jmax] / old_resid;
          }
          else
          {
-            relative_resid = resid_nrm / resid_nrm_init;
+            conv_factor = resid_nrm[jmax];
          }
 
          hypre_ParAMGDataRelativeResidualNorm(amg_data) = relative_resid;
@@ -311,7 +352,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       if (my_id == 0 && amg_print_level > 1)
       {
          hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
-               resid_nrm, conv_factor, relative_resid);
+               resid_nrm[jmax], conv_factor, relative_resid);
       }
    }
 
@@ -325,8 +366,8 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
     *    Compute closing statistics
     *-----------------------------------------------------------------------*/
 
-   if (cycle_count > 0 && resid_nrm_init)
-      conv_factor = pow((resid_nrm/resid_nrm_init),(1.0/(HYPRE_Real) cycle_count));
+   if (cycle_count > 0 && resid_nrm_init[jmax])
+      conv_factor = pow((resid_nrm[jmax]/resid_nrm_init[jmax]),(1.0/(HYPRE_Real) cycle_count));
    else
       conv_factor = 1.;
 
@@ -392,8 +433,137 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
       hypre_TFree(num_variables, HYPRE_MEMORY_HOST);
    }
+
+   hypre_TFree(resid_nrm, HYPRE_MEMORY_HOST);
+   hypre_TFree(resid_nrm_init, HYPRE_MEMORY_HOST);
+   hypre_TFree(rhs_norm, HYPRE_MEMORY_HOST);
+   hypre_TFree(rel_resid, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolve
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSolve( void               *amg_vdata,
+                   hypre_ParCSRMatrix *A,
+                   hypre_ParVector    *f,
+                   hypre_ParVector    *u         )
+{
+   hypre_ParAMGData   *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   hypre_ParVector    *r;
+
+   /* block solve for multiple right-hand sides */
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      return hypre_BoomerAMGSolveMulti(amg_vdata, A, f, u);
+   }
+
+   HYPRE_ANNOTATION_BEGIN("BoomerAMG.solve");
+
+   hypre_ParAMGDataAArray(amg_data)[0] = A;
+   hypre_ParAMGDataFArray(amg_data)[0] = f;
+   hypre_ParAMGDataUArray(amg_data)[0] = u;
+
+   if (hypre_ParAMGDataLogging(amg_data) > 1)
+   {
+      r = hypre_ParAMGDataResidual(amg_data);
+   }
+   else
+   {
+      r = hypre_ParAMGDataVtemp(amg_data);
+   }
+
+   hypre_BoomerAMGSolveCycles(amg_data, A, f, u, r, 1);
+
    HYPRE_ANNOTATION_END("BoomerAMG.solve");
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveMulti
+ *
+ * Solve for the columns of the multivector f (multiple right-hand sides)
+ * at once.  The cycles are done with hypre_BoomerAMGMultiCycle, so that
+ * the matrices of the hierarchy are streamed once per cycle for all
+ * right-hand sides, and the residual norms of all columns are computed
+ * with a single global reduction.  Cycling continues until the relative
+ * residual of every column is below the tolerance; the number of
+ * iterations and the relative residual norm returned are those of the
+ * worst column.  If the setup uses features that are not available for
+ * multivectors (see hypre_BoomerAMGMultiCycleSupported), each column is
+ * solved in turn with hypre_BoomerAMGSolve.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSolveMulti( void               *amg_vdata,
+                           hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           hypre_ParVector    *u         )
+{
+   hypre_ParAMGData   *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   HYPRE_Int           num_levels    = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           additive      = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int           mult_additive = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int           simple        = hypre_ParAMGDataSimple(amg_data);
+   HYPRE_Int           num_vectors   = hypre_ParVectorNumVectors(f);
+   HYPRE_Int           jv;
+
+   hypre_ParAMGDataAArray(amg_data)[0] = A;
+
+   /*-----------------------------------------------------------------------
+    *    Fall back to one solve per right-hand side if needed
+    *-----------------------------------------------------------------------*/
+
+   if ( !( (additive      < 0 || additive      >= num_levels) &&
+           (mult_additive < 0 || mult_additive >= num_levels) &&
+           (simple        < 0 || simple        >= num_levels) ) ||
+        !hypre_BoomerAMGMultiCycleSupported(amg_data) )
+   {
+      HYPRE_Int   num_iterations = 0;
+      HYPRE_Real  max_rel_resid = 0.0;
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         hypre_ParVector *f_col = hypre_ParMultiVectorColumnView(f, jv);
+         hypre_ParVector *u_col = hypre_ParMultiVectorColumnView(u, jv);
+
+         hypre_BoomerAMGSolve(amg_vdata, A, f_col, u_col);
+
+         num_iterations = hypre_max(num_iterations, hypre_ParAMGDataNumIterations(amg_data));
+         max_rel_resid  = hypre_max(max_rel_resid,
+                                    hypre_ParAMGDataRelativeResidualNorm(amg_data));
+
+         hypre_ParVectorDestroy(f_col);
+         hypre_ParVectorDestroy(u_col);
+      }
+
+      hypre_ParAMGDataFArray(amg_data)[0] = f;
+      hypre_ParAMGDataUArray(amg_data)[0] = u;
+      hypre_ParAMGDataNumIterations(amg_data) = num_iterations;
+      hypre_ParAMGDataRelativeResidualNorm(amg_data) = max_rel_resid;
+
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATION_BEGIN("BoomerAMG.solve");
+
+   hypre_ParAMGDataFArray(amg_data)[0] = f;
+   hypre_ParAMGDataUArray(amg_data)[0] = u;
+
+   hypre_BoomerAMGMultiVectorsCreate(amg_data, num_vectors);
+   hypre_ParAMGDataFMultiArray(amg_data)[0] = f;
+   hypre_ParAMGDataUMultiArray(amg_data)[0] = u;
+
+   hypre_BoomerAMGSolveCycles(amg_data, A, f, u,
+                              hypre_ParAMGDataVtempMultiArray(amg_data)[0], num_vectors);
+
+   HYPRE_ANNOTATION_END("BoomerAMG.solve");
+
+   return hypre_error_flag;
+}
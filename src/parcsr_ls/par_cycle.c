@@ -77,6 +77,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_Int       i, j, jj;
    HYPRE_Int       level;
    HYPRE_Int       cycle_param;
+   HYPRE_Int       relax_phase;
    HYPRE_Int       coarse_grid;
    HYPRE_Int       fine_grid;
    HYPRE_Int       Not_Finished;
@@ -100,6 +101,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_Real      alpha;
    hypre_Vector  **l1_norms = NULL;
    hypre_Vector   *l1_norms_level;
+   HYPRE_Int     **relax_overlap_rows;
+   HYPRE_Int      *relax_overlap_num_interior;
+   hypre_ParAMGRelaxPlan **relax_plans;
    HYPRE_Real    **ds = hypre_ParAMGDataChebyDS(amg_data);
    HYPRE_Real    **coefs = hypre_ParAMGDataChebyCoefs(amg_data);
    HYPRE_Int       seq_cg = 0;
@@ -143,6 +147,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    smooth_type         = hypre_ParAMGDataSmoothType(amg_data);
    smooth_num_levels   = hypre_ParAMGDataSmoothNumLevels(amg_data);
    l1_norms            = hypre_ParAMGDataL1Norms(amg_data);
+   relax_overlap_rows  = hypre_ParAMGDataRelaxOverlapRows(amg_data);
+   relax_overlap_num_interior = hypre_ParAMGDataRelaxOverlapNumInterior(amg_data);
+   relax_plans         = hypre_ParAMGDataRelaxPlanArray(amg_data);
    /* smooth_option       = hypre_ParAMGDataSmoothOption(amg_data); */
    /* RL */
    restri_type = hypre_ParAMGDataRestriction(amg_data);
@@ -325,6 +332,10 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          l1_norms_level = NULL;
       }
 
+      relax_phase = (num_levels > 1 && level == num_levels - 1) ?
+                    hypre_AMG_PHASE_COARSE_SOLVE : hypre_AMG_PHASE_RELAX;
+      hypre_BoomerAMGPhaseBegin(amg_data, level, relax_phase);
+
       if (cycle_param == 3 && seq_cg)
       {
          hypre_seqAMGCycle(amg_data, level, F_array, U_array);
@@ -441,6 +452,26 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                { /* Gaussian elimination */
                   hypre_GaussElimSolve(amg_data, level, relax_type);
                }
+               else if (relax_plans && relax_plans[level] && !old_version &&
+                        !(relax_overlap_rows && relax_overlap_rows[level]) &&
+                        (relax_type ==  0 || relax_type ==  3 || relax_type ==  4 ||
+                         relax_type ==  6 || relax_type ==  8 || relax_type == 13 ||
+                         relax_type == 14 || relax_type == 18))
+               {
+                  Solve_err_flag = hypre_BoomerAMGRelaxWithPlanIF(A_array[level],
+                                                                  Aux_F,
+                                                                  CF_marker_array[level],
+                                                                  relax_type,
+                                                                  relax_local,
+                                                                  cycle_param,
+                                                                  relax_weight[level],
+                                                                  omega[level],
+                                                                  l1_norms_level ? hypre_VectorData(l1_norms_level) : NULL,
+                                                                  relax_plans[level],
+                                                                  Aux_U,
+                                                                  Vtemp,
+                                                                  Ztemp);
+               }
                else if (relax_type == 18)
                {   /* L1 - Jacobi*/
                   if (relax_order == 1 && cycle_param < 3)
@@ -584,6 +615,23 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                                   Aux_U,
                                                                   Vtemp);
                   }
+                  else if (relax_overlap_rows && relax_overlap_rows[level])
+                  {
+                     Solve_err_flag = hypre_BoomerAMGRelaxOverlapIF(A_array[level],
+                                                                    Aux_F,
+                                                                    CF_marker_array[level],
+                                                                    relax_type,
+                                                                    relax_local,
+                                                                    cycle_param,
+                                                                    relax_weight[level],
+                                                                    omega[level],
+                                                                    l1_norms_level ? hypre_VectorData(l1_norms_level) : NULL,
+                                                                    relax_overlap_rows[level],
+                                                                    relax_overlap_num_interior[level],
+                                                                    Aux_U,
+                                                                    Vtemp,
+                                                                    Ztemp);
+                  }
                   else
                   {
                      Solve_err_flag = hypre_BoomerAMGRelaxIF(A_array[level],
@@ -631,6 +679,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          }
       }
 
+      hypre_BoomerAMGPhaseEnd(amg_data, level, relax_phase,
+                              block_mode ? NULL : A_array[level]);
+
       /*------------------------------------------------------------------
        * Decrement the control counter and determine which grid to visit next
        *-----------------------------------------------------------------*/
@@ -650,6 +701,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          fine_grid = level;
          coarse_grid = level + 1;
 
+         hypre_BoomerAMGPhaseBegin(amg_data, fine_grid, hypre_AMG_PHASE_RESTRICT);
+
          hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
 
          alpha = -1.0;
@@ -691,6 +744,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             }
          }
 
+         hypre_BoomerAMGPhaseEnd(amg_data, fine_grid, hypre_AMG_PHASE_RESTRICT,
+                                 block_mode ? NULL : R_array[fine_grid]);
+
          ++level;
          lev_counter[level] = hypre_max(lev_counter[level], cycle_type);
          cycle_param = 1;
@@ -713,6 +769,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          coarse_grid = level;
          alpha = 1.0;
          beta = 1.0;
+
+         hypre_BoomerAMGPhaseBegin(amg_data, fine_grid, hypre_AMG_PHASE_INTERPOLATE);
+
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvec(alpha, P_block_array[fine_grid],
@@ -728,6 +787,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             /* printf("Proc %d: level %d, n %d, Interpolation done\n", my_id, level, local_size); */
          }
 
+         hypre_BoomerAMGPhaseEnd(amg_data, fine_grid, hypre_AMG_PHASE_INTERPOLATE,
+                                 block_mode ? NULL : P_array[fine_grid]);
+
          --level;
 
          if (fcycle && fcycle_lev == level)
@@ -0,0 +1,533 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * ParAMG cycling routine for multivectors (several right-hand sides)
+ *
+ * Residuals, restriction and interpolation are done with multivector
+ * matvecs and relaxation with hypre_BoomerAMGMultiRelax, so that the
+ * matrices of each level are streamed once per cycle for all right-hand
+ * sides.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiRelaxTypeSupported
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiRelaxTypeSupported( hypre_ParAMGData *amg_data,
+                                        HYPRE_Int         level,
+                                        HYPRE_Int         relax_type,
+                                        HYPRE_Int         coarsest )
+{
+   hypre_Vector **l1_norms     = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Real    *relax_weight = hypre_ParAMGDataRelaxWeight(amg_data);
+   HYPRE_Real    *omega        = hypre_ParAMGDataOmega(amg_data);
+   HYPRE_Int      has_l1       = (l1_norms != NULL && l1_norms[level] != NULL);
+
+   switch (relax_type)
+   {
+      case 0:
+         return 1;
+
+      case 3:
+      case 4:
+      case 6:
+         return (relax_weight[level] == 1.0 && omega[level] == 1.0);
+
+      case 8:
+      case 13:
+      case 14:
+         return (has_l1 && relax_weight[level] == 1.0 && omega[level] == 1.0);
+
+      case 18:
+         return has_l1;
+
+      case 9:
+      case 99:
+      case 199:
+         return coarsest;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiCycleSupported
+ *
+ * Returns 1 if the current setup can be cycled with multivectors, that is,
+ * if only the smoothers available in hypre_BoomerAMGMultiRelax (plus the
+ * Gaussian elimination coarse solvers) are used.  Otherwise, a block solve
+ * falls back to solving for each right-hand side in turn.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiCycleSupported( void *amg_vdata )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   HYPRE_Int   num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int  *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int   relax_type;
+   HYPRE_Int   level;
+
+   if ( hypre_ParAMGDataBlockMode(amg_data) ||
+        hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+        hypre_ParAMGDataParticipate(amg_data) ||
+        (hypre_ParAMGDataFloatLevel(amg_data) > 0 &&
+         hypre_ParAMGDataFloatDropDouble(amg_data)) ||
+        hypre_ParAMGDataGridRelaxPoints(amg_data) != NULL )
+   {
+      return 0;
+   }
+
+#ifdef HYPRE_USING_DSUPERLU
+   if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
+   {
+      return 0;
+   }
+#endif
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(hypre_ParAMGDataAArray(amg_data)[0]))
+       != hypre_MEMORY_HOST)
+   {
+      return 0;
+   }
+
+   if (num_levels == 1)
+   {
+      relax_type = hypre_ParAMGDataUserRelaxType(amg_data);
+      if (relax_type == -1)
+      {
+         relax_type = 6;
+      }
+      return hypre_BoomerAMGMultiRelaxTypeSupported(amg_data, 0, relax_type, 0);
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if ( !hypre_BoomerAMGMultiRelaxTypeSupported(amg_data, level, grid_relax_type[1], 0) ||
+           !hypre_BoomerAMGMultiRelaxTypeSupported(amg_data, level, grid_relax_type[2], 0) )
+      {
+         return 0;
+      }
+   }
+
+   return hypre_BoomerAMGMultiRelaxTypeSupported(amg_data, num_levels - 1, grid_relax_type[3], 1);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorsCreate
+ *
+ * Creates the coarse-grid multivectors and the temporary multivectors
+ * (on all levels) needed by hypre_BoomerAMGMultiCycle, unless they already
+ * exist with num_vectors columns.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiVectorsCreate( void      *amg_vdata,
+                                   HYPRE_Int  num_vectors )
+{
+   hypre_ParAMGData     *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix  **A_array    = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int             num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_MemoryLocation  memory_location;
+
+   hypre_ParVector     **F_multi_array;
+   hypre_ParVector     **U_multi_array;
+   hypre_ParVector     **Vtemp_multi_array;
+   hypre_ParVector     **Ztemp_multi_array = NULL;
+   HYPRE_Int             level;
+
+   if ( hypre_ParAMGDataMultiNumVectors(amg_data) == num_vectors &&
+        hypre_ParAMGDataMultiNumLevels(amg_data) == num_levels )
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_BoomerAMGMultiVectorsDestroy(amg_data);
+
+   memory_location   = hypre_ParCSRMatrixMemoryLocation(A_array[0]);
+   F_multi_array     = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   U_multi_array     = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   Vtemp_multi_array = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   if (hypre_NumThreads() > 1)
+   {
+      Ztemp_multi_array = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   }
+
+   for (level = 0; level < num_levels; level++)
+   {
+      MPI_Comm      comm        = hypre_ParCSRMatrixComm(A_array[level]);
+      HYPRE_BigInt  global_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      HYPRE_BigInt *row_starts  = hypre_ParCSRMatrixRowStarts(A_array[level]);
+
+      if (level > 0)
+      {
+         F_multi_array[level] = hypre_ParMultiVectorCreate(comm, global_size, row_starts,
+                                                           num_vectors);
+         hypre_ParVectorInitialize_v2(F_multi_array[level], memory_location);
+         hypre_ParVectorSetPartitioningOwner(F_multi_array[level], 0);
+
+         U_multi_array[level] = hypre_ParMultiVectorCreate(comm, global_size, row_starts,
+                                                           num_vectors);
+         hypre_ParVectorInitialize_v2(U_multi_array[level], memory_location);
+         hypre_ParVectorSetPartitioningOwner(U_multi_array[level], 0);
+      }
+
+      Vtemp_multi_array[level] = hypre_ParMultiVectorCreate(comm, global_size, row_starts,
+                                                            num_vectors);
+      hypre_ParVectorInitialize_v2(Vtemp_multi_array[level], memory_location);
+      hypre_ParVectorSetPartitioningOwner(Vtemp_multi_array[level], 0);
+
+      if (Ztemp_multi_array)
+      {
+         Ztemp_multi_array[level] = hypre_ParMultiVectorCreate(comm, global_size, row_starts,
+                                                               num_vectors);
+         hypre_ParVectorInitialize_v2(Ztemp_multi_array[level], memory_location);
+         hypre_ParVectorSetPartitioningOwner(Ztemp_multi_array[level], 0);
+      }
+   }
+
+   hypre_ParAMGDataMultiNumVectors(amg_data) = num_vectors;
+   hypre_ParAMGDataMultiNumLevels(amg_data)  = num_levels;
+   hypre_ParAMGDataFMultiArray(amg_data)     = F_multi_array;
+   hypre_ParAMGDataUMultiArray(amg_data)     = U_multi_array;
+   hypre_ParAMGDataVtempMultiArray(amg_data) = Vtemp_multi_array;
+   hypre_ParAMGDataZtempMultiArray(amg_data) = Ztemp_multi_array;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorsDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiVectorsDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData  *amg_data          = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int          num_levels        = hypre_ParAMGDataMultiNumLevels(amg_data);
+   hypre_ParVector  **F_multi_array     = hypre_ParAMGDataFMultiArray(amg_data);
+   hypre_ParVector  **U_multi_array     = hypre_ParAMGDataUMultiArray(amg_data);
+   hypre_ParVector  **Vtemp_multi_array = hypre_ParAMGDataVtempMultiArray(amg_data);
+   hypre_ParVector  **Ztemp_multi_array = hypre_ParAMGDataZtempMultiArray(amg_data);
+   HYPRE_Int          level;
+
+   for (level = 0; level < num_levels; level++)
+   {
+      /* level 0 holds the user vectors */
+      if (level > 0)
+      {
+         hypre_ParVectorDestroy(F_multi_array[level]);
+         hypre_ParVectorDestroy(U_multi_array[level]);
+      }
+      hypre_ParVectorDestroy(Vtemp_multi_array[level]);
+      if (Ztemp_multi_array)
+      {
+         hypre_ParVectorDestroy(Ztemp_multi_array[level]);
+      }
+   }
+
+   hypre_TFree(F_multi_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(U_multi_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(Vtemp_multi_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ztemp_multi_array, HYPRE_MEMORY_HOST);
+
+   hypre_ParAMGDataMultiNumVectors(amg_data) = 0;
+   hypre_ParAMGDataMultiNumLevels(amg_data)  = 0;
+   hypre_ParAMGDataFMultiArray(amg_data)     = NULL;
+   hypre_ParAMGDataUMultiArray(amg_data)     = NULL;
+   hypre_ParAMGDataVtempMultiArray(amg_data) = NULL;
+   hypre_ParAMGDataZtempMultiArray(amg_data) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiGaussElimSolve
+ *
+ * The coarse-grid direct solve works on one vector at a time; it is applied
+ * to each column of the level multivectors in turn.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiGaussElimSolve( hypre_ParAMGData *amg_data,
+                                    HYPRE_Int         level,
+                                    HYPRE_Int         relax_type,
+                                    hypre_ParVector  *f,
+                                    hypre_ParVector  *u )
+{
+   hypre_ParVector **F_array = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector **U_array = hypre_ParAMGDataUArray(amg_data);
+   hypre_ParVector  *F_save  = F_array[level];
+   hypre_ParVector  *U_save  = U_array[level];
+   HYPRE_Int         num_vectors = hypre_ParVectorNumVectors(f);
+   HYPRE_Int         jv;
+
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      F_array[level] = hypre_ParMultiVectorColumnView(f, jv);
+      U_array[level] = hypre_ParMultiVectorColumnView(u, jv);
+
+      hypre_GaussElimSolve(amg_data, level, relax_type);
+
+      hypre_ParVectorDestroy(F_array[level]);
+      hypre_ParVectorDestroy(U_array[level]);
+   }
+
+   F_array[level] = F_save;
+   U_array[level] = U_save;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiCycle
+ *
+ * Multivector version of hypre_BoomerAMGCycle (V, W and F cycles).  The
+ * arrays F_array and U_array hold multivectors with the same number of
+ * columns on all levels, see hypre_BoomerAMGMultiVectorsCreate.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiCycle( void              *amg_vdata,
+                           hypre_ParVector  **F_array,
+                           hypre_ParVector  **U_array )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   /* Data Structure variables */
+   hypre_ParCSRMatrix  **A_array           = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array           = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix  **R_array           = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParVector     **Vtemp_array       = hypre_ParAMGDataVtempMultiArray(amg_data);
+   hypre_ParVector     **Ztemp_array       = hypre_ParAMGDataZtempMultiArray(amg_data);
+   HYPRE_Int           **CF_marker_array   = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int             num_levels        = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int             max_levels        = hypre_ParAMGDataMaxLevels(amg_data);
+   HYPRE_Int             cycle_type        = hypre_ParAMGDataCycleType(amg_data);
+   HYPRE_Int             fcycle            = hypre_ParAMGDataFCycle(amg_data);
+   HYPRE_Int            *num_grid_sweeps   = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Int            *grid_relax_type   = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int             relax_order       = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Real           *relax_weight      = hypre_ParAMGDataRelaxWeight(amg_data);
+   hypre_Vector        **l1_norms          = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Int             restri_type       = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Real            cycle_op_count    = hypre_ParAMGDataCycleOpCount(amg_data);
+
+   /* Local variables  */
+   hypre_ParVector      *Ztemp;
+   HYPRE_Real           *num_coeffs;
+   HYPRE_Real           *l1_norms_level;
+   HYPRE_Int            *lev_counter;
+   HYPRE_Int             Solve_err_flag = 0;
+   HYPRE_Int             k, j;
+   HYPRE_Int             level;
+   HYPRE_Int             cycle_param;
+   HYPRE_Int             coarse_grid;
+   HYPRE_Int             fine_grid;
+   HYPRE_Int             fcycle_lev;
+   HYPRE_Int             Not_Finished;
+   HYPRE_Int             num_sweep;
+   HYPRE_Int             relax_type;
+   HYPRE_Int             relax_local;
+   HYPRE_Int             relax_points[2];
+   HYPRE_Int             num_passes, ip;
+
+   num_coeffs = hypre_CTAlloc(HYPRE_Real, num_levels, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_levels; j++)
+   {
+      num_coeffs[j] = hypre_ParCSRMatrixDNumNonzeros(A_array[j]);
+   }
+
+   /*---------------------------------------------------------------------
+    * Initialize cycling control counter (see hypre_BoomerAMGCycle)
+    *---------------------------------------------------------------------*/
+
+   lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+   lev_counter[0] = 1;
+   for (k = 1; k < num_levels; ++k)
+   {
+      lev_counter[k] = fcycle ? 1 : cycle_type;
+   }
+   fcycle_lev = num_levels - 2;
+
+   level = 0;
+   cycle_param = 1;
+   Not_Finished = 1;
+
+   /*---------------------------------------------------------------------
+    * Main loop of cycling
+    *--------------------------------------------------------------------*/
+
+   while (Not_Finished)
+   {
+      if (num_levels > 1)
+      {
+         num_sweep = num_grid_sweeps[cycle_param];
+         relax_type = grid_relax_type[cycle_param];
+      }
+      else
+      {
+         /* If no coarsening occurred, apply a simple smoother once */
+         num_sweep = 1;
+         relax_type = hypre_ParAMGDataUserRelaxType(amg_data);
+         if (relax_type == -1)
+         {
+            relax_type = 6;
+         }
+      }
+
+      l1_norms_level = (l1_norms != NULL && l1_norms[level] != NULL) ?
+                       hypre_VectorData(l1_norms[level]) : NULL;
+      Ztemp = Ztemp_array ? Ztemp_array[level] : NULL;
+
+      /*------------------------------------------------------------------
+       * Do the relaxation num_sweep times
+       *-----------------------------------------------------------------*/
+
+      for (j = 0; j < num_sweep; j++)
+      {
+         relax_local = (num_levels == 1 && max_levels > 1) ? 0 : relax_order;
+
+         cycle_op_count += num_coeffs[level];
+
+         if (relax_type == 9 || relax_type == 99 || relax_type == 199)
+         {
+            /* Gaussian elimination */
+            hypre_BoomerAMGMultiGaussElimSolve(amg_data, level, relax_type,
+                                               F_array[level], U_array[level]);
+            continue;
+         }
+
+         /* C/F ordering as in hypre_BoomerAMGRelaxIF (for relax_type 18, the
+            ordering is chosen by the cycle type as in hypre_BoomerAMGCycle) */
+         num_passes = 1;
+         relax_points[0] = 0;
+         if (relax_local == 1 && cycle_param < 3)
+         {
+            num_passes = 2;
+            if ((relax_type == 18 ? cycle_type : cycle_param) < 2)
+            {
+               relax_points[0] = 1;
+               relax_points[1] = -1;
+            }
+            else
+            {
+               relax_points[0] = -1;
+               relax_points[1] = 1;
+            }
+         }
+
+         for (ip = 0; ip < num_passes && !Solve_err_flag; ip++)
+         {
+            Solve_err_flag = hypre_BoomerAMGMultiRelax(A_array[level],
+                                                       F_array[level],
+                                                       CF_marker_array[level],
+                                                       relax_type,
+                                                       relax_points[ip],
+                                                       relax_weight[level],
+                                                       l1_norms_level,
+                                                       U_array[level],
+                                                       Vtemp_array[level],
+                                                       Ztemp);
+         }
+
+         if (Solve_err_flag)
+         {
+            break;
+         }
+      }
+
+      if (Solve_err_flag)
+      {
+         break;
+      }
+
+      /*------------------------------------------------------------------
+       * Decrement the control counter and determine which grid to visit next
+       *-----------------------------------------------------------------*/
+
+      --lev_counter[level];
+
+      if (lev_counter[level] >= 0 && level != num_levels-1)
+      {
+         /*---------------------------------------------------------------
+          * Visit coarser level next.
+          * Compute residual and restrict it for all columns at once.
+          *--------------------------------------------------------------*/
+
+         fine_grid = level;
+         coarse_grid = level + 1;
+
+         hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
+
+         hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A_array[fine_grid], U_array[fine_grid],
+                                            1.0, F_array[fine_grid], Vtemp_array[fine_grid]);
+
+         if (restri_type)
+         {
+            /* RL: no transpose for R */
+            hypre_ParCSRMatrixMatvec(1.0, R_array[fine_grid], Vtemp_array[fine_grid],
+                                     0.0, F_array[coarse_grid]);
+         }
+         else
+         {
+            hypre_ParCSRMatrixMatvecT(1.0, R_array[fine_grid], Vtemp_array[fine_grid],
+                                      0.0, F_array[coarse_grid]);
+         }
+
+         ++level;
+         lev_counter[level] = hypre_max(lev_counter[level], cycle_type);
+         cycle_param = 1;
+         if (level == num_levels-1)
+         {
+            cycle_param = 3;
+         }
+      }
+      else if (level != 0)
+      {
+         /*---------------------------------------------------------------
+          * Visit finer level next.
+          * Interpolate and add correction for all columns at once.
+          *--------------------------------------------------------------*/
+
+         fine_grid = level - 1;
+         coarse_grid = level;
+
+         hypre_ParCSRMatrixMatvec(1.0, P_array[fine_grid], U_array[coarse_grid],
+                                  1.0, U_array[fine_grid]);
+
+         --level;
+
+         if (fcycle && fcycle_lev == level)
+         {
+            lev_counter[level] = hypre_max(lev_counter[level], 1);
+            fcycle_lev --;
+         }
+
+         cycle_param = 2;
+      }
+      else
+      {
+         Not_Finished = 0;
+      }
+   } /* main loop: while (Not_Finished) */
+
+   hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
+
+   hypre_TFree(lev_counter, HYPRE_MEMORY_HOST);
+   hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
+
+   return Solve_err_flag;
+}
@@ -42,9 +42,10 @@ hypre_ParKrylovCreateVector( void *vvector )
    hypre_ParVector *vector = (hypre_ParVector *) vvector;
    hypre_ParVector *new_vector;
 
-   new_vector = hypre_ParVectorCreate( hypre_ParVectorComm(vector),
-                                       hypre_ParVectorGlobalSize(vector),
-                                       hypre_ParVectorPartitioning(vector) );
+   new_vector = hypre_ParMultiVectorCreate( hypre_ParVectorComm(vector),
+                                            hypre_ParVectorGlobalSize(vector),
+                                            hypre_ParVectorPartitioning(vector),
+                                            hypre_ParVectorNumVectors(vector) );
    hypre_ParVectorSetPartitioningOwner(new_vector,0);
 
    hypre_ParVectorInitialize_v2(new_vector, hypre_ParVectorMemoryLocation(vector));
@@ -119,6 +120,9 @@ hypre_ParKrylovMatvecCreate( void   *A,
 
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMatvec
+ *
+ * Applies the user operator attached with hypre_ParCSRMatrixSetShellMatvec,
+ * if any, and the stored matrix otherwise.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -129,6 +133,15 @@ hypre_ParKrylovMatvec( void   *matvec_data,
                        HYPRE_Complex  beta,
                        void   *y           )
 {
+   hypre_ParCSRMatrix *matrix = (hypre_ParCSRMatrix *) A;
+
+   if (hypre_ParCSRMatrixShellMatvec(matrix))
+   {
+      return ( (hypre_ParCSRMatrixShellMatvec(matrix))
+               ( hypre_ParCSRMatrixShellData(matrix), alpha,
+                 (HYPRE_ParVector) x, beta, (HYPRE_ParVector) y ) );
+   }
+
    return ( hypre_ParCSRMatrixMatvec ( alpha,
                                        (hypre_ParCSRMatrix *) A,
                                        (hypre_ParVector *) x,
@@ -148,6 +161,20 @@ hypre_ParKrylovMatvecT(void   *matvec_data,
                        HYPRE_Complex  beta,
                        void   *y           )
 {
+   hypre_ParCSRMatrix *matrix = (hypre_ParCSRMatrix *) A;
+
+   if (hypre_ParCSRMatrixShellMatvec(matrix))
+   {
+      if (!hypre_ParCSRMatrixShellMatvecT(matrix))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "No transpose product set for shell operator\n");
+         return hypre_error_flag;
+      }
+      return ( (hypre_ParCSRMatrixShellMatvecT(matrix))
+               ( hypre_ParCSRMatrixShellData(matrix), alpha,
+                 (HYPRE_ParVector) x, beta, (HYPRE_ParVector) y ) );
+   }
+
    return ( hypre_ParCSRMatrixMatvecT( alpha,
                                        (hypre_ParCSRMatrix *) A,
                                        (hypre_ParVector *) x,
@@ -262,6 +289,110 @@ hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovNumVectors
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovNumVectors( void *x )
+{
+   return ( hypre_ParVectorNumVectors( (hypre_ParVector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMultiInnerProd( void       *x,
+                               void       *y,
+                               HYPRE_Real *result )
+{
+   return ( hypre_ParVectorMultiInnerProd( (hypre_ParVector *) x,
+                                           (hypre_ParVector *) y, result ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiAxpy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMultiAxpy( HYPRE_Complex *alpha,
+                          void          *x,
+                          void          *y )
+{
+   return ( hypre_ParVectorMultiAxpy( alpha, (hypre_ParVector *) x,
+                                      (hypre_ParVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiScaleVector
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMultiScaleVector( HYPRE_Complex *alpha,
+                                 void          *x )
+{
+   return ( hypre_ParVectorMultiScale( alpha, (hypre_ParVector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdLocal
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdLocal( void       *x,
+                               void       *y,
+                               HYPRE_Real *result )
+{
+   *result = hypre_SeqVectorInnerProd(
+      hypre_ParVectorLocalVector((hypre_ParVector *) x),
+      hypre_ParVectorLocalVector((hypre_ParVector *) y) );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovIAllreduce
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovIAllreduce( void        *x,
+                           HYPRE_Real  *sendbuf,
+                           HYPRE_Real  *recvbuf,
+                           HYPRE_Int    count,
+                           void       **request )
+{
+   hypre_MPI_Request *mpi_request = hypre_CTAlloc(hypre_MPI_Request, 1, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Iallreduce(sendbuf, recvbuf, count, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                        hypre_ParVectorComm((hypre_ParVector *) x), mpi_request);
+   *request = (void *) mpi_request;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovWait
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovWait( void *request )
+{
+   hypre_MPI_Request *mpi_request = (hypre_MPI_Request *) request;
+   hypre_MPI_Status   status;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Wait(mpi_request, &status);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+   hypre_TFree(mpi_request, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
 
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovCommInfo
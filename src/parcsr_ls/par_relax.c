@@ -99,6 +99,13 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    HYPRE_Real      one_minus_omega;
    HYPRE_Real      prod;
 
+   /* levels with single-precision values */
+   if (hypre_BoomerAMGRelaxFloatSupported(A, relax_type, l1_norms))
+   {
+      return hypre_BoomerAMGRelaxFloat(A, f, cf_marker, relax_type, relax_points,
+                                       relax_weight, omega, l1_norms, u, Vtemp, Ztemp);
+   }
+
    one_minus_weight = 1.0 - relax_weight;
    one_minus_omega = 1.0 - omega;
    hypre_MPI_Comm_size(comm,&num_procs);
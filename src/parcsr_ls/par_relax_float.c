@@ -0,0 +1,552 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Pointwise relaxation on matrices with single-precision values
+ *
+ * hypre_BoomerAMGRelax calls hypre_BoomerAMGRelaxFloat when the local blocks
+ * of A have a float copy of their values (see hypre_CSRMatrixSetDataFloat).
+ * The sweeps compute the same updates as relax types 0, 3, 4, 6, 8, 13 and
+ * 14 of hypre_BoomerAMGRelax, but read the matrix entries in single
+ * precision. u, f, the residuals and the l1 norms stay in full precision.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxFloatSweepGS
+ *
+ * Gauss-Seidel (SOR) sweep over the rows [ns, ne) of a thread, in reverse
+ * order if forward = 0.  Only rows with cf_marker[i] == relax_points are
+ * relaxed if relax_points is nonzero.  Columns in [ns, ne) use the current
+ * values of u, the others the values in tmp_data.  If l1_norms is given,
+ * the residual includes the diagonal and u is corrected, otherwise u is
+ * replaced.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGRelaxFloatSweepGS( hypre_ParCSRMatrix *A,
+                                  HYPRE_Real         *f_data,
+                                  HYPRE_Int          *cf_marker,
+                                  HYPRE_Int           relax_points,
+                                  HYPRE_Real         *l1_norms,
+                                  HYPRE_Real          relax_weight,
+                                  HYPRE_Real          omega,
+                                  HYPRE_Int           ns,
+                                  HYPRE_Int           ne,
+                                  HYPRE_Int           forward,
+                                  HYPRE_Real         *u_data,
+                                  HYPRE_Real         *Vtemp_data,
+                                  HYPRE_Real         *tmp_data,
+                                  HYPRE_Real         *Vext_data )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   float           *A_diag_data = hypre_CSRMatrixDataFloat(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   float           *A_offd_data = hypre_CSRMatrixDataFloat(A_offd);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+
+   HYPRE_Int        weighted = (relax_weight != 1 || omega != 1);
+   HYPRE_Real       one_minus_omega = 1.0 - omega;
+   HYPRE_Real       prod = 1.0 - relax_weight*omega;
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Real       diag, res, res0, res2;
+   HYPRE_Int        k, i, ii, jj;
+
+   for (k = 0; k < ne - ns; k++)
+   {
+      i = forward ? ns + k : ne - 1 - k;
+
+      if (relax_points && cf_marker[i] != relax_points)
+      {
+         continue;
+      }
+
+      diag = l1_norms ? l1_norms[i] : (HYPRE_Real) A_diag_data[A_diag_i[i]];
+      if (diag == zero)
+      {
+         continue;
+      }
+
+      res = f_data[i];
+      if (weighted)
+      {
+         res0 = 0.0;
+         res2 = 0.0;
+         for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            if (ii >= ns && ii < ne)
+            {
+               res0 -= (HYPRE_Real) A_diag_data[jj] * u_data[ii];
+               res2 += (HYPRE_Real) A_diag_data[jj] * Vtemp_data[ii];
+            }
+            else
+            {
+               res -= (HYPRE_Real) A_diag_data[jj] * tmp_data[ii];
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= (HYPRE_Real) A_offd_data[jj] * Vext_data[ii];
+         }
+         u_data[i] *= prod;
+         u_data[i] += relax_weight*(omega*res + res0 + one_minus_omega*res2) / diag;
+      }
+      else
+      {
+         for (jj = l1_norms ? A_diag_i[i] : A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            if (ii >= ns && ii < ne)
+            {
+               res -= (HYPRE_Real) A_diag_data[jj] * u_data[ii];
+            }
+            else
+            {
+               res -= (HYPRE_Real) A_diag_data[jj] * tmp_data[ii];
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= (HYPRE_Real) A_offd_data[jj] * Vext_data[ii];
+         }
+         if (l1_norms)
+         {
+            u_data[i] += res / diag;
+         }
+         else
+         {
+            u_data[i] = res / diag;
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxFloatSweepJacobi
+ *
+ * Weighted Jacobi update of the rows [ns, ne), using the old values in
+ * Vtemp_data.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGRelaxFloatSweepJacobi( hypre_ParCSRMatrix *A,
+                                      HYPRE_Real         *f_data,
+                                      HYPRE_Int          *cf_marker,
+                                      HYPRE_Int           relax_points,
+                                      HYPRE_Real          relax_weight,
+                                      HYPRE_Int           ns,
+                                      HYPRE_Int           ne,
+                                      HYPRE_Real         *u_data,
+                                      HYPRE_Real         *Vtemp_data,
+                                      HYPRE_Real         *Vext_data )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   float           *A_diag_data = hypre_CSRMatrixDataFloat(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   float           *A_offd_data = hypre_CSRMatrixDataFloat(A_offd);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+
+   HYPRE_Real       one_minus_weight = 1.0 - relax_weight;
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Real       diag, res;
+   HYPRE_Int        i, ii, jj;
+
+   for (i = ns; i < ne; i++)
+   {
+      if (relax_points && cf_marker[i] != relax_points)
+      {
+         continue;
+      }
+
+      diag = (HYPRE_Real) A_diag_data[A_diag_i[i]];
+      if (diag == zero)
+      {
+         continue;
+      }
+
+      res = f_data[i];
+      for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+      {
+         ii = A_diag_j[jj];
+         res -= (HYPRE_Real) A_diag_data[jj] * Vtemp_data[ii];
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         ii = A_offd_j[jj];
+         res -= (HYPRE_Real) A_offd_data[jj] * Vext_data[ii];
+      }
+      u_data[i] *= one_minus_weight;
+      u_data[i] += relax_weight * res / diag;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxFloatSupported
+ *
+ * Returns 1 if hypre_BoomerAMGRelaxFloat can handle relax_type on A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxFloatSupported( hypre_ParCSRMatrix *A,
+                                    HYPRE_Int           relax_type,
+                                    HYPRE_Real         *l1_norms )
+{
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+
+   /* an offd block without entries has no float copy (nor needs one) */
+   if ( !hypre_CSRMatrixDataFloat(A_diag) ||
+        (!hypre_CSRMatrixDataFloat(A_offd) &&
+         hypre_CSRMatrixI(A_offd)[hypre_CSRMatrixNumRows(A_offd)] > 0) )
+   {
+      return 0;
+   }
+
+   switch (relax_type)
+   {
+      case 0:
+      case 3:
+      case 4:
+      case 6:
+         return 1;
+      case 8:
+      case 13:
+      case 14:
+         return (l1_norms != NULL);
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxFloat
+ *
+ * Relax types 0, 3, 4, 6, 8, 13 and 14 using the single-precision values
+ * of A.  Check hypre_BoomerAMGRelaxFloatSupported before calling.  With
+ * several threads, the hybrid smoothers are Gauss-Seidel within the row
+ * range of a thread and Jacobi between ranges, as in hypre_BoomerAMGRelax.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxFloat( hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           HYPRE_Int          *cf_marker,
+                           HYPRE_Int           relax_type,
+                           HYPRE_Int           relax_points,
+                           HYPRE_Real          relax_weight,
+                           HYPRE_Real          omega,
+                           HYPRE_Real         *l1_norms,
+                           hypre_ParVector    *u,
+                           hypre_ParVector    *Vtemp,
+                           hypre_ParVector    *Ztemp )
+{
+   MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int               n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Int               num_threads = hypre_NumThreads();
+   HYPRE_Real             *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real             *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real             *Vtemp_data = NULL;
+   HYPRE_Real             *tmp_data = NULL;
+   HYPRE_Real             *Vext_data = NULL;
+   HYPRE_Real             *v_buf_data = NULL;
+   HYPRE_Int               jacobi = 0, forward = 0, backward = 0, use_l1 = 0;
+   HYPRE_Int               weighted = (relax_weight != 1 || omega != 1);
+   HYPRE_Int               own_tmp = 0;
+   HYPRE_Int               num_procs, num_sends, begin, end, size, rest, i, t;
+
+   switch (relax_type)
+   {
+      case 0:
+         jacobi = 1;
+         break;
+      case 3:
+         forward = 1;
+         break;
+      case 4:
+         backward = 1;
+         break;
+      case 6:
+         forward = 1; backward = 1;
+         break;
+      case 13:
+         forward = 1; use_l1 = 1;
+         break;
+      case 14:
+         backward = 1; use_l1 = 1;
+         break;
+      case 8:
+         forward = 1; backward = 1; use_l1 = 1;
+         break;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin      = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end        = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      v_buf_data = hypre_CTAlloc(HYPRE_Real, end, HYPRE_MEMORY_HOST);
+      Vext_data  = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = begin; i < end; i++)
+      {
+         v_buf_data[i-begin] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,i)];
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
+   }
+
+   /*-----------------------------------------------------------------
+    * Copy current approximation into temporary vectors.
+    *-----------------------------------------------------------------*/
+
+   if (jacobi || weighted)
+   {
+      Vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         Vtemp_data[i] = u_data[i];
+      }
+      tmp_data = Vtemp_data;
+   }
+   else if (num_threads > 1)
+   {
+      if (Ztemp)
+      {
+         tmp_data = hypre_VectorData(hypre_ParVectorLocalVector(Ztemp));
+      }
+      else
+      {
+         tmp_data = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+         own_tmp = 1;
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         tmp_data[i] = u_data[i];
+      }
+   }
+
+   if (comm_handle)
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+   }
+
+   /*-----------------------------------------------------------------
+    * Relax the rows of each thread
+    *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   size = n / num_threads;
+   rest = n - size*num_threads;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_threads; t++)
+   {
+      HYPRE_Int ns = t*size + hypre_min(t, rest);
+      HYPRE_Int ne = ns + size + (t < rest ? 1 : 0);
+
+      if (jacobi)
+      {
+         hypre_BoomerAMGRelaxFloatSweepJacobi(A, f_data, cf_marker, relax_points,
+                                              relax_weight, ns, ne,
+                                              u_data, Vtemp_data, Vext_data);
+         continue;
+      }
+      if (forward)
+      {
+         hypre_BoomerAMGRelaxFloatSweepGS(A, f_data, cf_marker, relax_points,
+                                          use_l1 ? l1_norms : NULL, relax_weight, omega,
+                                          ns, ne, 1, u_data, Vtemp_data, tmp_data, Vext_data);
+      }
+      if (backward)
+      {
+         hypre_BoomerAMGRelaxFloatSweepGS(A, f_data, cf_marker, relax_points,
+                                          use_l1 ? l1_norms : NULL, relax_weight, omega,
+                                          ns, ne, 0, u_data, Vtemp_data, tmp_data, Vext_data);
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   if (own_tmp)
+   {
+      hypre_TFree(tmp_data, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFloatLevelFloatOnly
+ *
+ * Returns 1 if the cycle applies the operator of a converted level only
+ * through the float kernels (single-vector matvecs, the float smoothers and
+ * the Gaussian elimination coarse solve, which works on its own copy), so
+ * that its full-precision values are not needed after the setup.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGFloatLevelFloatOnly( hypre_ParAMGData *amg_data,
+                                    HYPRE_Int         level )
+{
+   hypre_ParCSRMatrix  *A               = hypre_ParAMGDataAArray(amg_data)[level];
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Real          *l1_norms_level;
+   HYPRE_Int            relax_type;
+
+   if ( (hypre_ParAMGDataAdditive(amg_data)     > -1 &&
+         hypre_ParAMGDataAdditive(amg_data)     < num_levels) ||
+        (hypre_ParAMGDataMultAdditive(amg_data) > -1 &&
+         hypre_ParAMGDataMultAdditive(amg_data) < num_levels) ||
+        (hypre_ParAMGDataSimple(amg_data)       > -1 &&
+         hypre_ParAMGDataSimple(amg_data)       < num_levels) ||
+        hypre_ParAMGDataSmoothNumLevels(amg_data) > level ||
+        hypre_ParAMGDataGridRelaxPoints(amg_data) != NULL )
+   {
+      return 0;
+   }
+
+   l1_norms_level = (l1_norms && l1_norms[level]) ? hypre_VectorData(l1_norms[level]) : NULL;
+
+   if (level == num_levels - 1)
+   {
+      relax_type = grid_relax_type[3];
+#ifdef HYPRE_USING_DSUPERLU
+      if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
+      {
+         return 0;
+      }
+#endif
+      return ( relax_type == 9 || relax_type == 99 || relax_type == 199 ||
+               hypre_BoomerAMGRelaxFloatSupported(A, relax_type, l1_norms_level) );
+   }
+
+   return ( hypre_BoomerAMGRelaxFloatSupported(A, grid_relax_type[1], l1_norms_level) &&
+            hypre_BoomerAMGRelaxFloatSupported(A, grid_relax_type[2], l1_norms_level) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFloatLevelsSetup
+ *
+ * Creates (or refreshes) the single-precision copies of the operators on
+ * levels float_level, ..., num_levels-1 and of the interpolation and
+ * restriction operators between them.  Level 0 is never converted, since
+ * its matrix is shared with the outer Krylov method.  float_level <= 0
+ * removes all copies.
+ *
+ * With float_drop_double set, the full-precision values of a converted
+ * operator are then freed if the cycle does not need them (see
+ * hypre_BoomerAMGFloatLevelFloatOnly; the transfer operators are only used
+ * in matvecs), so these levels are stored in single precision.
+ * hypre_BoomerAMGResetup then falls back to a full setup.  This must be called after everything else in the setup that
+ * reads the operator values, including hypre_BoomerAMGSetupStats.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGFloatLevelsSetup( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array    = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array    = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            float_level = hypre_ParAMGDataFloatLevel(amg_data);
+   HYPRE_Int            level;
+
+   for (level = 1; level < num_levels; level++)
+   {
+      hypre_ParCSRMatrix *ops[3];
+      HYPRE_Int           k, use_float;
+
+      ops[0] = A_array[level];
+      ops[1] = P_array[level-1];
+      ops[2] = (R_array && R_array[level-1] != P_array[level-1]) ? R_array[level-1] : NULL;
+
+      for (k = 0; k < 3; k++)
+      {
+         if (!ops[k])
+         {
+            continue;
+         }
+
+         /* transfer operators are converted if both of their levels are */
+         use_float = float_level > 0 && (k == 0 ? level : level-1) >= float_level;
+         if (use_float)
+         {
+            hypre_CSRMatrixSetDataFloat(hypre_ParCSRMatrixDiag(ops[k]));
+            hypre_CSRMatrixSetDataFloat(hypre_ParCSRMatrixOffd(ops[k]));
+            if ( hypre_ParAMGDataFloatDropDouble(amg_data) &&
+                 (k > 0 || hypre_BoomerAMGFloatLevelFloatOnly(amg_data, level)) )
+            {
+               hypre_CSRMatrixDropData(hypre_ParCSRMatrixDiag(ops[k]));
+               hypre_CSRMatrixDropData(hypre_ParCSRMatrixOffd(ops[k]));
+            }
+         }
+         else
+         {
+            hypre_CSRMatrixResetDataFloat(hypre_ParCSRMatrixDiag(ops[k]));
+            hypre_CSRMatrixResetDataFloat(hypre_ParCSRMatrixOffd(ops[k]));
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
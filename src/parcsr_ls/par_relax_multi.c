@@ -0,0 +1,503 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Relaxation for multivectors (several right-hand sides at once)
+ *
+ * The row loops below visit each matrix entry once and apply it to all
+ * columns of u, so that the matrix is streamed once per sweep instead of
+ * once per right-hand side.  For every column, the arithmetic is done in the
+ * same order as in hypre_BoomerAMGRelax, so that a block solve reproduces
+ * the results of solving for each right-hand side separately.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiRelaxExchange
+ *
+ * Gathers the off-processor values of all columns of u into Vext_data
+ * (column j starts at Vext_data[j*num_cols_offd]).  All columns go in one
+ * message per neighbor: the exchange uses a temporary comm package whose
+ * send and receive starts are scaled by num_vectors, with the values of an
+ * index stored contiguously for all columns.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiRelaxExchange( hypre_ParCSRMatrix *A,
+                                   HYPRE_Int           num_vectors,
+                                   HYPRE_Real         *u_data,
+                                   HYPRE_Real         *Vext_data )
+{
+   hypre_ParCSRCommPkg     *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommPkg     *tmp_comm_pkg;
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Int                n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int                num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Int                num_sends, num_recvs, begin, send_size;
+   HYPRE_Int               *send_map_starts, *recv_vec_starts;
+   HYPRE_Int                i, jv;
+   HYPRE_Real              *v_buf_data, *v_ext_data;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   begin     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+   send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) - begin;
+
+   send_map_starts = hypre_CTAlloc(HYPRE_Int, num_sends+1, HYPRE_MEMORY_HOST);
+   recv_vec_starts = hypre_CTAlloc(HYPRE_Int, num_recvs+1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_sends; i++)
+   {
+      send_map_starts[i] = num_vectors *
+                           (hypre_ParCSRCommPkgSendMapStart(comm_pkg, i) - begin);
+   }
+   for (i = 0; i <= num_recvs; i++)
+   {
+      recv_vec_starts[i] = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+   }
+
+   tmp_comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgComm(tmp_comm_pkg)           = hypre_ParCSRCommPkgComm(comm_pkg);
+   hypre_ParCSRCommPkgNumSends(tmp_comm_pkg)       = num_sends;
+   hypre_ParCSRCommPkgNumRecvs(tmp_comm_pkg)       = num_recvs;
+   hypre_ParCSRCommPkgSendProcs(tmp_comm_pkg)      = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   hypre_ParCSRCommPkgRecvProcs(tmp_comm_pkg)      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   hypre_ParCSRCommPkgSendMapStarts(tmp_comm_pkg)  = send_map_starts;
+   hypre_ParCSRCommPkgRecvVecStarts(tmp_comm_pkg)  = recv_vec_starts;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   v_buf_data = hypre_CTAlloc(HYPRE_Real, num_vectors*send_size, HYPRE_MEMORY_HOST);
+   v_ext_data = hypre_CTAlloc(HYPRE_Real, num_vectors*num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < send_size; i++)
+   {
+      HYPRE_Int ii = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i+begin);
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         v_buf_data[i*num_vectors+jv] = u_data[jv*n+ii];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, tmp_comm_pkg, v_buf_data, v_ext_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         Vext_data[jv*num_cols_offd+i] = v_ext_data[i*num_vectors+jv];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(send_map_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(tmp_comm_pkg, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiRelaxGSBlock
+ *
+ * Gauss-Seidel sweep over the rows ns <= i < ne.  Values of u outside of
+ * this block are taken from tmp_data (the values before the sweep), as in
+ * the threaded hybrid smoothers.  With use_l1 set, the sweep is the l1
+ * variant (u += r/l1), otherwise u = (f - sum_{j!=i} a_ij u_j)/a_ii.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGMultiRelaxGSBlock( hypre_ParCSRMatrix *A,
+                                  HYPRE_Int           ns,
+                                  HYPRE_Int           ne,
+                                  HYPRE_Int           backward,
+                                  HYPRE_Int           use_l1,
+                                  HYPRE_Int          *cf_marker,
+                                  HYPRE_Int           relax_points,
+                                  HYPRE_Real         *l1_norms,
+                                  HYPRE_Int           num_vectors,
+                                  HYPRE_Real         *f_data,
+                                  HYPRE_Real         *u_data,
+                                  HYPRE_Real         *tmp_data,
+                                  HYPRE_Real         *Vext_data,
+                                  HYPRE_Real         *res )
+{
+   hypre_CSRMatrix *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real      *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        n             = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int        first         = use_l1 ? 0 : 1;
+
+   HYPRE_Int        i, ii, jj, jv, k;
+   HYPRE_Real       a, diag;
+   HYPRE_Real      *v_data;
+
+   for (k = ns; k < ne; k++)
+   {
+      i = backward ? ne - 1 - (k - ns) : k;
+
+      /*-----------------------------------------------------------
+       * If i is of the right type ( C or F ) and the diagonal (or
+       * l1 norm) is nonzero, relax point i; otherwise, skip it.
+       *-----------------------------------------------------------*/
+
+      if (relax_points && cf_marker[i] != relax_points)
+      {
+         continue;
+      }
+      diag = use_l1 ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+      if (diag == 0.0)
+      {
+         continue;
+      }
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         res[jv] = f_data[jv*n + i];
+      }
+      for (jj = A_diag_i[i] + first; jj < A_diag_i[i+1]; jj++)
+      {
+         ii = A_diag_j[jj];
+         a  = A_diag_data[jj];
+         v_data = (ii >= ns && ii < ne) ? u_data : tmp_data;
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            res[jv] -= a * v_data[jv*n + ii];
+         }
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         ii = A_offd_j[jj];
+         a  = A_offd_data[jj];
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            res[jv] -= a * Vext_data[jv*num_cols_offd + ii];
+         }
+      }
+
+      if (use_l1)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            u_data[jv*n + i] += res[jv] / diag;
+         }
+      }
+      else
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            u_data[jv*n + i] = res[jv] / diag;
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiRelax
+ *
+ * Multivector version of hypre_BoomerAMGRelax for the relaxation types
+ *
+ *     relax_type =  0 -> Jacobi or CF-Jacobi
+ *     relax_type =  3 -> hybrid Gauss-Seidel forward solve
+ *     relax_type =  4 -> hybrid Gauss-Seidel backward solve
+ *     relax_type =  6 -> hybrid symmetric Gauss-Seidel
+ *     relax_type =  8 -> hybrid l1 symmetric Gauss-Seidel
+ *     relax_type = 13 -> hybrid l1 Gauss-Seidel forward solve
+ *     relax_type = 14 -> hybrid l1 Gauss-Seidel backward solve
+ *     relax_type = 18 -> l1-Jacobi (CF-l1-Jacobi if relax_points != 0)
+ *
+ * The Gauss-Seidel types are only available with relax_weight = omega = 1.
+ * u, f, Vtemp and Ztemp are multivectors with the same number of columns;
+ * Ztemp is only used with more than one thread and may be NULL otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiRelax( hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           HYPRE_Int          *cf_marker,
+                           HYPRE_Int           relax_type,
+                           HYPRE_Int           relax_points,
+                           HYPRE_Real          relax_weight,
+                           HYPRE_Real         *l1_norms,
+                           hypre_ParVector    *u,
+                           hypre_ParVector    *Vtemp,
+                           hypre_ParVector    *Ztemp )
+{
+   MPI_Comm         comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real      *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        n             = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   HYPRE_Int        num_vectors   = hypre_ParVectorNumVectors(u);
+   HYPRE_Real      *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real      *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real      *Vtemp_data    = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Real      *Vext_data     = NULL;
+   HYPRE_Real      *tmp_data      = NULL;
+   HYPRE_Real      *res_data;
+
+   HYPRE_Int        num_procs, num_threads;
+   HYPRE_Int        relax_error = 0;
+   HYPRE_Int        i, ii, j, jj, jv;
+   HYPRE_Int        ns, ne, size, rest;
+   HYPRE_Int        use_l1, forward, backward;
+   HYPRE_Real       one_minus_weight = 1.0 - relax_weight;
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Real       a, *res;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = hypre_NumThreads();
+
+   hypre_assert(hypre_ParVectorNumVectors(f) == num_vectors);
+   hypre_assert(hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(u)) == 0);
+
+   /*-----------------------------------------------------------------------
+    * l1-Jacobi on all points: u += w D^{-1}(f - A u), D_ii = ||A(i,:)||_1,
+    * with the residual computed by a (multivector) matvec
+    *-----------------------------------------------------------------------*/
+
+   if (relax_type == 18 && relax_points == 0)
+   {
+      hypre_ParVectorCopy(f, Vtemp);
+      hypre_ParCSRMatrixMatvec(-relax_weight, A, u, relax_weight, Vtemp);
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         HYPRE_Real *u_col = u_data + jv*n;
+         HYPRE_Real *v_col = Vtemp_data + jv*n;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < n; i++)
+         {
+            u_col[i] += v_col[i] / l1_norms[i];
+         }
+      }
+
+      return relax_error;
+   }
+
+   if (num_procs > 1)
+   {
+      Vext_data = hypre_CTAlloc(HYPRE_Real, num_vectors*num_cols_offd, HYPRE_MEMORY_HOST);
+      hypre_BoomerAMGMultiRelaxExchange(A, num_vectors, u_data, Vext_data);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   switch (relax_type)
+   {
+      case 0: /* Weighted Jacobi */
+      case 18: /* CF l1-Jacobi */
+      {
+         use_l1 = (relax_type == 18);
+
+         /*-----------------------------------------------------------------
+          * Copy current approximation into temporary vector.
+          *-----------------------------------------------------------------*/
+
+         hypre_ParVectorCopy(u, Vtemp);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,ii,jj,jv,a,res)
+#endif
+         {
+            res = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < n; i++)
+            {
+               if ( (relax_points && cf_marker[i] != relax_points) ||
+                    A_diag_data[A_diag_i[i]] == zero )
+               {
+                  continue;
+               }
+
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  res[jv] = f_data[jv*n + i];
+               }
+               for (jj = A_diag_i[i] + (use_l1 ? 0 : 1); jj < A_diag_i[i+1]; jj++)
+               {
+                  ii = A_diag_j[jj];
+                  a  = A_diag_data[jj];
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     res[jv] -= a * Vtemp_data[jv*n + ii];
+                  }
+               }
+               for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+               {
+                  ii = A_offd_j[jj];
+                  a  = A_offd_data[jj];
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     res[jv] -= a * Vext_data[jv*num_cols_offd + ii];
+                  }
+               }
+
+               if (use_l1)
+               {
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     u_data[jv*n + i] += (relax_weight * res[jv]) / l1_norms[i];
+                  }
+               }
+               else
+               {
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     u_data[jv*n + i] *= one_minus_weight;
+                     u_data[jv*n + i] += relax_weight * res[jv] / A_diag_data[A_diag_i[i]];
+                  }
+               }
+            }
+
+            hypre_TFree(res, HYPRE_MEMORY_HOST);
+         }
+      }
+      break;
+
+      case 3:  /* hybrid Gauss-Seidel forward solve */
+      case 4:  /* hybrid Gauss-Seidel backward solve */
+      case 6:  /* hybrid symmetric Gauss-Seidel */
+      case 8:  /* hybrid l1 symmetric Gauss-Seidel */
+      case 13: /* hybrid l1 Gauss-Seidel forward solve */
+      case 14: /* hybrid l1 Gauss-Seidel backward solve */
+      {
+         use_l1   = (relax_type == 8 || relax_type == 13 || relax_type == 14);
+         forward  = (relax_type != 4 && relax_type != 14);
+         backward = (relax_type == 4 || relax_type == 14 ||
+                     relax_type == 6 || relax_type == 8);
+
+         res_data = hypre_CTAlloc(HYPRE_Real, num_threads*num_vectors, HYPRE_MEMORY_HOST);
+
+         if (num_threads > 1)
+         {
+            tmp_data = hypre_VectorData(hypre_ParVectorLocalVector(Ztemp));
+            hypre_ParVectorCopy(u, Ztemp);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j,ns,ne,rest,size) HYPRE_SMP_SCHEDULE
+#endif
+            for (j = 0; j < num_threads; j++)
+            {
+               size = n/num_threads;
+               rest = n - size*num_threads;
+               if (j < rest)
+               {
+                  ns = j*size+j;
+                  ne = (j+1)*size+j+1;
+               }
+               else
+               {
+                  ns = j*size+rest;
+                  ne = (j+1)*size+rest;
+               }
+               if (forward)
+               {
+                  hypre_BoomerAMGMultiRelaxGSBlock(A, ns, ne, 0, use_l1, cf_marker,
+                                                   relax_points, l1_norms, num_vectors,
+                                                   f_data, u_data, tmp_data, Vext_data,
+                                                   res_data + j*num_vectors);
+               }
+               if (backward)
+               {
+                  hypre_BoomerAMGMultiRelaxGSBlock(A, ns, ne, 1, use_l1, cf_marker,
+                                                   relax_points, l1_norms, num_vectors,
+                                                   f_data, u_data, tmp_data, Vext_data,
+                                                   res_data + j*num_vectors);
+               }
+            }
+         }
+         else
+         {
+            if (forward)
+            {
+               hypre_BoomerAMGMultiRelaxGSBlock(A, 0, n, 0, use_l1, cf_marker,
+                                                relax_points, l1_norms, num_vectors,
+                                                f_data, u_data, u_data, Vext_data,
+                                                res_data);
+            }
+            if (backward)
+            {
+               hypre_BoomerAMGMultiRelaxGSBlock(A, 0, n, 1, use_l1, cf_marker,
+                                                relax_points, l1_norms, num_vectors,
+                                                f_data, u_data, u_data, Vext_data,
+                                                res_data);
+            }
+         }
+
+         hypre_TFree(res_data, HYPRE_MEMORY_HOST);
+      }
+      break;
+
+      default:
+         hypre_error_in_arg(4);
+         relax_error = 1;
+         break;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+
+   return relax_error;
+}
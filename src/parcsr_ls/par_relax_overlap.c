@@ -0,0 +1,399 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Split-phase hybrid Gauss-Seidel relaxation
+ *
+ * The local rows are split once, at smoother setup, into interior rows (no
+ * entries in A_offd) and boundary rows.  Interior rows do not need any
+ * off-processor values, so they are relaxed while the halo exchange is in
+ * flight; the boundary rows are relaxed after the exchange has completed.
+ * Off-processor values are the ones before the sweep, as in
+ * hypre_BoomerAMGRelax, only the order in which the local rows are visited
+ * changes.  For the symmetric smoothers the backward sweep visits the rows
+ * in exactly the reverse order of the forward sweep.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxOverlapSetup
+ *
+ * Returns in rows_ptr the local rows of A, interior rows first, followed by
+ * the boundary rows, both in increasing order.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxOverlapSetup( hypre_ParCSRMatrix  *A,
+                                  HYPRE_Int          **rows_ptr,
+                                  HYPRE_Int           *num_interior_ptr )
+{
+   hypre_CSRMatrix *A_offd   = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int        n        = hypre_CSRMatrixNumRows(A_offd);
+   HYPRE_Int       *rows;
+   HYPRE_Int        i, cnt = 0, num_interior;
+
+   rows = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < n; i++)
+   {
+      if (A_offd_i[i+1] == A_offd_i[i])
+      {
+         rows[cnt++] = i;
+      }
+   }
+   num_interior = cnt;
+   for (i = 0; i < n; i++)
+   {
+      if (A_offd_i[i+1] > A_offd_i[i])
+      {
+         rows[cnt++] = i;
+      }
+   }
+
+   *rows_ptr = rows;
+   *num_interior_ptr = num_interior;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxOverlapSweep
+ *
+ * Relaxes rows[0..num_rows-1] (in reverse order if forward = 0), using the
+ * same update formulas as the sequential paths of hypre_BoomerAMGRelax.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGRelaxOverlapSweep( hypre_ParCSRMatrix *A,
+                                  HYPRE_Real         *f_data,
+                                  HYPRE_Int          *cf_marker,
+                                  HYPRE_Int           relax_points,
+                                  HYPRE_Real          relax_weight,
+                                  HYPRE_Real          omega,
+                                  HYPRE_Real         *l1_norms,
+                                  HYPRE_Int          *rows,
+                                  HYPRE_Int           num_rows,
+                                  HYPRE_Int           forward,
+                                  HYPRE_Real         *u_data,
+                                  HYPRE_Real         *Vtemp_data,
+                                  HYPRE_Real         *Vext_data )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real      *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+
+   HYPRE_Int        weighted = (relax_weight != 1 || omega != 1);
+   HYPRE_Real       one_minus_omega = 1.0 - omega;
+   HYPRE_Real       prod = 1.0 - relax_weight*omega;
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Real       diag, res, res0, res2;
+   HYPRE_Int        k, i, ii, jj;
+
+   for (k = 0; k < num_rows; k++)
+   {
+      i = forward ? rows[k] : rows[num_rows-1-k];
+
+      if (relax_points != 0 && cf_marker[i] != relax_points)
+      {
+         continue;
+      }
+
+      /*-----------------------------------------------------------
+       * If diagonal is nonzero, relax point i; otherwise, skip it.
+       *-----------------------------------------------------------*/
+
+      diag = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+      if (diag == zero)
+      {
+         continue;
+      }
+
+      res = f_data[i];
+      if (weighted)
+      {
+         res0 = 0.0;
+         res2 = 0.0;
+         for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            res0 -= A_diag_data[jj] * u_data[ii];
+            res2 += A_diag_data[jj] * Vtemp_data[ii];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * Vext_data[ii];
+         }
+         u_data[i] *= prod;
+         u_data[i] += relax_weight*(omega*res + res0 + one_minus_omega*res2) / diag;
+      }
+      else if (l1_norms)
+      {
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            res -= A_diag_data[jj] * u_data[ii];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * Vext_data[ii];
+         }
+         u_data[i] += res / diag;
+      }
+      else
+      {
+         for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            res -= A_diag_data[jj] * u_data[ii];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * Vext_data[ii];
+         }
+         u_data[i] = res / diag;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxOverlap
+ *
+ * Split-phase version of relax_type 3, 4, 6, 8, 13 and 14 of
+ * hypre_BoomerAMGRelax.  rows and num_interior come from
+ * hypre_BoomerAMGRelaxOverlapSetup.  Other relaxation types, and the
+ * threaded paths and levels with single-precision values, are passed on
+ * to hypre_BoomerAMGRelax.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxOverlap( hypre_ParCSRMatrix *A,
+                             hypre_ParVector    *f,
+                             HYPRE_Int          *cf_marker,
+                             HYPRE_Int           relax_type,
+                             HYPRE_Int           relax_points,
+                             HYPRE_Real          relax_weight,
+                             HYPRE_Real          omega,
+                             HYPRE_Real         *l1_norms,
+                             HYPRE_Int          *rows,
+                             HYPRE_Int           num_interior,
+                             hypre_ParVector    *u,
+                             hypre_ParVector    *Vtemp,
+                             hypre_ParVector    *Ztemp )
+{
+   MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int               n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Int               num_boundary = n - num_interior;
+   HYPRE_Int              *boundary = rows + num_interior;
+   HYPRE_Real             *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real             *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real             *Vtemp_data = NULL;
+   HYPRE_Real             *Vext_data = NULL;
+   HYPRE_Real             *v_buf_data = NULL;
+   HYPRE_Int               forward, backward;
+   HYPRE_Int               num_procs, num_sends, begin, end, i;
+
+   switch (relax_type)
+   {
+      case 3:
+      case 13:
+         forward = 1; backward = 0;
+         break;
+      case 4:
+      case 14:
+         forward = 0; backward = 1;
+         break;
+      case 6:
+      case 8:
+         forward = 1; backward = 1;
+         break;
+      default:
+         forward = 0; backward = 0;
+         break;
+   }
+
+   if ((!forward && !backward) || hypre_NumThreads() > 1 || (n && !rows) ||
+       hypre_BoomerAMGRelaxFloatSupported(A, relax_type, l1_norms))
+   {
+      return hypre_BoomerAMGRelax(A, f, cf_marker, relax_type, relax_points,
+                                  relax_weight, omega, l1_norms, u, Vtemp, Ztemp);
+   }
+   if (relax_type == 3 || relax_type == 4 || relax_type == 6)
+   {
+      l1_norms = NULL;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (relax_weight != 1 || omega != 1)
+   {
+      Vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+      for (i = 0; i < n; i++)
+      {
+         Vtemp_data[i] = u_data[i];
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Post the halo exchange
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin      = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end        = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      v_buf_data = hypre_CTAlloc(HYPRE_Real, end, HYPRE_MEMORY_HOST);
+      Vext_data  = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+      for (i = begin; i < end; i++)
+      {
+         v_buf_data[i-begin] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,i)];
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   /*-----------------------------------------------------------------
+    * Interior rows, while the messages are in flight
+    *-----------------------------------------------------------------*/
+
+   hypre_BoomerAMGRelaxOverlapSweep(A, f_data, cf_marker, relax_points,
+                                    relax_weight, omega, l1_norms,
+                                    rows, num_interior, forward,
+                                    u_data, Vtemp_data, Vext_data);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   if (comm_handle)
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   /*-----------------------------------------------------------------
+    * Boundary rows, then for the symmetric smoothers the backward sweep
+    * over the boundary and interior rows
+    *-----------------------------------------------------------------*/
+
+   hypre_BoomerAMGRelaxOverlapSweep(A, f_data, cf_marker, relax_points,
+                                    relax_weight, omega, l1_norms,
+                                    boundary, num_boundary, forward,
+                                    u_data, Vtemp_data, Vext_data);
+
+   if (forward && backward)
+   {
+      hypre_BoomerAMGRelaxOverlapSweep(A, f_data, cf_marker, relax_points,
+                                       relax_weight, omega, l1_norms,
+                                       rows, n, 0,
+                                       u_data, Vtemp_data, Vext_data);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxOverlapIF
+ *
+ * Same as hypre_BoomerAMGRelaxIF, using hypre_BoomerAMGRelaxOverlap.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxOverlapIF( hypre_ParCSRMatrix *A,
+                               hypre_ParVector    *f,
+                               HYPRE_Int          *cf_marker,
+                               HYPRE_Int           relax_type,
+                               HYPRE_Int           relax_order,
+                               HYPRE_Int           cycle_type,
+                               HYPRE_Real          relax_weight,
+                               HYPRE_Real          omega,
+                               HYPRE_Real         *l1_norms,
+                               HYPRE_Int          *rows,
+                               HYPRE_Int           num_interior,
+                               hypre_ParVector    *u,
+                               hypre_ParVector    *Vtemp,
+                               hypre_ParVector    *Ztemp )
+{
+   HYPRE_Int i, Solve_err_flag = 0;
+   HYPRE_Int relax_points[2];
+
+   if (relax_order == 1 && cycle_type < 3)
+   {
+      if (cycle_type < 2)
+      {
+         relax_points[0] = 1;
+         relax_points[1] = -1;
+      }
+      else
+      {
+         relax_points[0] = -1;
+         relax_points[1] = 1;
+      }
+
+      for (i = 0; i < 2; i++)
+      {
+         Solve_err_flag = hypre_BoomerAMGRelaxOverlap(A, f, cf_marker, relax_type,
+                                                      relax_points[i], relax_weight,
+                                                      omega, l1_norms, rows, num_interior,
+                                                      u, Vtemp, Ztemp);
+      }
+   }
+   else
+   {
+      Solve_err_flag = hypre_BoomerAMGRelaxOverlap(A, f, cf_marker, relax_type, 0,
+                                                   relax_weight, omega, l1_norms,
+                                                   rows, num_interior, u, Vtemp, Ztemp);
+   }
+
+   return Solve_err_flag;
+}
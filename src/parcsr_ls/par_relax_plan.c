@@ -0,0 +1,640 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Pointwise relaxation driven by a precomputed hypre_ParAMGRelaxPlan
+ *
+ * The sweeps compute the same updates as the corresponding relax types of
+ * hypre_BoomerAMGRelax and hypre_ParCSRRelax_L1_Jacobi, but take the thread
+ * row ranges, the C/F row lists and the (l1) diagonal inverses from the plan
+ * instead of recomputing them in every call.  With several threads, the
+ * hybrid smoothers are Gauss-Seidel within the row range of a thread and
+ * Jacobi between ranges, as in hypre_BoomerAMGRelax; the ranges hold roughly
+ * the same number of nonzeros instead of the same number of rows.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxPlanUpdate
+ *
+ * Recomputes the diagonal inverses from the current values of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxPlanUpdate( hypre_ParAMGRelaxPlan *plan,
+                                hypre_ParCSRMatrix    *A,
+                                HYPRE_Real            *l1_norms )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        n           = hypre_ParAMGRelaxPlanNumRows(plan);
+   HYPRE_Real      *inv_diag    = hypre_ParAMGRelaxPlanInvDiag(plan);
+   HYPRE_Real      *inv_l1      = hypre_ParAMGRelaxPlanInvL1Norms(plan);
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Int        i;
+
+   if (l1_norms && !inv_l1)
+   {
+      inv_l1 = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+      hypre_ParAMGRelaxPlanInvL1Norms(plan) = inv_l1;
+   }
+   else if (!l1_norms && inv_l1)
+   {
+      hypre_TFree(inv_l1, HYPRE_MEMORY_HOST);
+      hypre_ParAMGRelaxPlanInvL1Norms(plan) = NULL;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < n; i++)
+   {
+      inv_diag[i] = (A_diag_data[A_diag_i[i]] != zero) ? 1.0 / A_diag_data[A_diag_i[i]] : zero;
+      if (inv_l1)
+      {
+         inv_l1[i] = (l1_norms[i] != zero) ? 1.0 / l1_norms[i] : zero;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxPlanCreate
+ *
+ * cf_marker may be NULL if the level is never relaxed in C/F order, and
+ * l1_norms may be NULL if the level has none.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxPlanCreate( hypre_ParCSRMatrix     *A,
+                                HYPRE_Int              *cf_marker,
+                                HYPRE_Real             *l1_norms,
+                                hypre_ParAMGRelaxPlan **plan_ptr )
+{
+   HYPRE_Int             *A_diag_i = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int             *A_offd_i = hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Int              n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int              num_threads = hypre_NumThreads();
+   hypre_ParAMGRelaxPlan *plan;
+   HYPRE_Int             *thread_starts;
+   HYPRE_Int             *C_rows = NULL, *C_starts = NULL;
+   HYPRE_Int             *F_rows = NULL, *F_starts = NULL;
+   HYPRE_Real             nnz, target;
+   HYPRE_Int              i, t, num_C = 0, num_F = 0;
+
+   plan = hypre_CTAlloc(hypre_ParAMGRelaxPlan, 1, HYPRE_MEMORY_HOST);
+
+   /* thread row ranges with (about) the same number of nonzeros */
+   thread_starts = hypre_CTAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
+   nnz = (HYPRE_Real) (A_diag_i[n] + A_offd_i[n]);
+   i = 0;
+   for (t = 1; t < num_threads; t++)
+   {
+      target = nnz * (HYPRE_Real) t / (HYPRE_Real) num_threads;
+      while (i < n && (HYPRE_Real) (A_diag_i[i] + A_offd_i[i]) < target)
+      {
+         i++;
+      }
+      thread_starts[t] = i;
+   }
+   thread_starts[num_threads] = n;
+
+   /* C and F rows of each thread range */
+   if (cf_marker)
+   {
+      for (i = 0; i < n; i++)
+      {
+         if (cf_marker[i] == 1)
+         {
+            num_C++;
+         }
+         else if (cf_marker[i] == -1)
+         {
+            num_F++;
+         }
+      }
+      C_rows   = hypre_CTAlloc(HYPRE_Int, num_C, HYPRE_MEMORY_HOST);
+      F_rows   = hypre_CTAlloc(HYPRE_Int, num_F, HYPRE_MEMORY_HOST);
+      C_starts = hypre_CTAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
+      F_starts = hypre_CTAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
+      num_C = num_F = 0;
+      for (t = 0; t < num_threads; t++)
+      {
+         for (i = thread_starts[t]; i < thread_starts[t+1]; i++)
+         {
+            if (cf_marker[i] == 1)
+            {
+               C_rows[num_C++] = i;
+            }
+            else if (cf_marker[i] == -1)
+            {
+               F_rows[num_F++] = i;
+            }
+         }
+         C_starts[t+1] = num_C;
+         F_starts[t+1] = num_F;
+      }
+   }
+
+   hypre_ParAMGRelaxPlanNumRows(plan)      = n;
+   hypre_ParAMGRelaxPlanNumThreads(plan)   = num_threads;
+   hypre_ParAMGRelaxPlanThreadStarts(plan) = thread_starts;
+   hypre_ParAMGRelaxPlanCRows(plan)        = C_rows;
+   hypre_ParAMGRelaxPlanCStarts(plan)      = C_starts;
+   hypre_ParAMGRelaxPlanFRows(plan)        = F_rows;
+   hypre_ParAMGRelaxPlanFStarts(plan)      = F_starts;
+   hypre_ParAMGRelaxPlanInvDiag(plan)      = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   hypre_ParAMGRelaxPlanInvL1Norms(plan)   = NULL;
+
+   hypre_BoomerAMGRelaxPlanUpdate(plan, A, l1_norms);
+
+   *plan_ptr = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxPlanDestroy( hypre_ParAMGRelaxPlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(hypre_ParAMGRelaxPlanThreadStarts(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGRelaxPlanCRows(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGRelaxPlanCStarts(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGRelaxPlanFRows(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGRelaxPlanFStarts(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGRelaxPlanInvDiag(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGRelaxPlanInvL1Norms(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxPlanSweepGS
+ *
+ * Gauss-Seidel (SOR) sweep over the rows k = kb, ..., ke-1 of a thread
+ * (rows[k] if rows is given, k otherwise), in reverse order if forward = 0.
+ * Columns in [ns, ne) use the current values of u, the others the values
+ * in tmp_data.  If use_diag is set, the residual includes the diagonal and
+ * u is corrected (l1 smoothers), otherwise u is replaced.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGRelaxPlanSweepGS( hypre_ParCSRMatrix *A,
+                                 HYPRE_Real         *f_data,
+                                 HYPRE_Real         *inv,
+                                 HYPRE_Int           use_diag,
+                                 HYPRE_Real          relax_weight,
+                                 HYPRE_Real          omega,
+                                 HYPRE_Int           ns,
+                                 HYPRE_Int           ne,
+                                 HYPRE_Int          *rows,
+                                 HYPRE_Int           kb,
+                                 HYPRE_Int           ke,
+                                 HYPRE_Int           forward,
+                                 HYPRE_Real         *u_data,
+                                 HYPRE_Real         *Vtemp_data,
+                                 HYPRE_Real         *tmp_data,
+                                 HYPRE_Real         *Vext_data )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real      *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+
+   HYPRE_Int        weighted = (relax_weight != 1 || omega != 1);
+   HYPRE_Real       one_minus_omega = 1.0 - omega;
+   HYPRE_Real       prod = 1.0 - relax_weight*omega;
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Real       res, res0, res2;
+   HYPRE_Int        k, i, ii, jj;
+
+   for (k = 0; k < ke - kb; k++)
+   {
+      i = forward ? kb + k : ke - 1 - k;
+      if (rows)
+      {
+         i = rows[i];
+      }
+
+      if (inv[i] == zero)
+      {
+         continue;
+      }
+
+      res = f_data[i];
+      if (weighted)
+      {
+         res0 = 0.0;
+         res2 = 0.0;
+         for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            if (ii >= ns && ii < ne)
+            {
+               res0 -= A_diag_data[jj] * u_data[ii];
+               res2 += A_diag_data[jj] * Vtemp_data[ii];
+            }
+            else
+            {
+               res -= A_diag_data[jj] * tmp_data[ii];
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * Vext_data[ii];
+         }
+         u_data[i] *= prod;
+         u_data[i] += relax_weight*(omega*res + res0 + one_minus_omega*res2) * inv[i];
+      }
+      else
+      {
+         for (jj = use_diag ? A_diag_i[i] : A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            if (ii >= ns && ii < ne)
+            {
+               res -= A_diag_data[jj] * u_data[ii];
+            }
+            else
+            {
+               res -= A_diag_data[jj] * tmp_data[ii];
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * Vext_data[ii];
+         }
+         if (use_diag)
+         {
+            u_data[i] += res * inv[i];
+         }
+         else
+         {
+            u_data[i] = res * inv[i];
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxPlanSweepJacobi
+ *
+ * Weighted Jacobi (relax type 0) or l1-Jacobi (relax type 18) update of
+ * the rows k = kb, ..., ke-1, using the old values in Vtemp_data.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGRelaxPlanSweepJacobi( hypre_ParCSRMatrix *A,
+                                     HYPRE_Real         *f_data,
+                                     HYPRE_Real         *inv_diag,
+                                     HYPRE_Real         *inv_l1,
+                                     HYPRE_Real          relax_weight,
+                                     HYPRE_Int          *rows,
+                                     HYPRE_Int           kb,
+                                     HYPRE_Int           ke,
+                                     HYPRE_Real         *u_data,
+                                     HYPRE_Real         *Vtemp_data,
+                                     HYPRE_Real         *Vext_data )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real      *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+
+   HYPRE_Real       one_minus_weight = 1.0 - relax_weight;
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Real       res;
+   HYPRE_Int        k, i, ii, jj;
+
+   for (k = kb; k < ke; k++)
+   {
+      i = rows ? rows[k] : k;
+
+      if (inv_diag[i] == zero)
+      {
+         continue;
+      }
+
+      res = f_data[i];
+      for (jj = inv_l1 ? A_diag_i[i] : A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+      {
+         ii = A_diag_j[jj];
+         res -= A_diag_data[jj] * Vtemp_data[ii];
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         ii = A_offd_j[jj];
+         res -= A_offd_data[jj] * Vext_data[ii];
+      }
+
+      if (inv_l1)
+      {
+         u_data[i] += relax_weight * res * inv_l1[i];
+      }
+      else
+      {
+         u_data[i] *= one_minus_weight;
+         u_data[i] += relax_weight * res * inv_diag[i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxWithPlan
+ *
+ * Relax types 0, 3, 4, 6, 8, 13, 14 and 18 using plan.  Other relaxation
+ * types, or a plan that does not match the call (different number of
+ * threads, no C/F rows or l1 norms) are passed on to hypre_BoomerAMGRelax
+ * together with l1_norms, as are levels with single-precision values.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxWithPlan( hypre_ParCSRMatrix    *A,
+                              hypre_ParVector       *f,
+                              HYPRE_Int             *cf_marker,
+                              HYPRE_Int              relax_type,
+                              HYPRE_Int              relax_points,
+                              HYPRE_Real             relax_weight,
+                              HYPRE_Real             omega,
+                              HYPRE_Real            *l1_norms,
+                              hypre_ParAMGRelaxPlan *plan,
+                              hypre_ParVector       *u,
+                              hypre_ParVector       *Vtemp,
+                              hypre_ParVector       *Ztemp )
+{
+   MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int               n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Int               num_threads = hypre_ParAMGRelaxPlanNumThreads(plan);
+   HYPRE_Int              *thread_starts = hypre_ParAMGRelaxPlanThreadStarts(plan);
+   HYPRE_Real             *inv_diag = hypre_ParAMGRelaxPlanInvDiag(plan);
+   HYPRE_Real             *inv_l1 = hypre_ParAMGRelaxPlanInvL1Norms(plan);
+   HYPRE_Real             *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real             *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real             *Vtemp_data = NULL;
+   HYPRE_Real             *tmp_data = NULL;
+   HYPRE_Real             *Vext_data = NULL;
+   HYPRE_Real             *v_buf_data = NULL;
+   HYPRE_Real             *inv = NULL;
+   HYPRE_Int              *rows = NULL;
+   HYPRE_Int              *row_starts = NULL;
+   HYPRE_Int               jacobi = 0, forward = 0, backward = 0, use_l1 = 0;
+   HYPRE_Int               weighted = (relax_weight != 1 || omega != 1);
+   HYPRE_Int               num_procs, num_sends, begin, end, i, t;
+
+   switch (relax_type)
+   {
+      case 0:
+         jacobi = 1;
+         break;
+      case 18:
+         jacobi = 1; use_l1 = 1;
+         break;
+      case 3:
+         forward = 1;
+         break;
+      case 4:
+         backward = 1;
+         break;
+      case 6:
+         forward = 1; backward = 1;
+         break;
+      case 13:
+         forward = 1; use_l1 = 1;
+         break;
+      case 14:
+         backward = 1; use_l1 = 1;
+         break;
+      case 8:
+         forward = 1; backward = 1; use_l1 = 1;
+         break;
+   }
+
+   if (relax_points == 1)
+   {
+      rows       = hypre_ParAMGRelaxPlanCRows(plan);
+      row_starts = hypre_ParAMGRelaxPlanCStarts(plan);
+   }
+   else if (relax_points == -1)
+   {
+      rows       = hypre_ParAMGRelaxPlanFRows(plan);
+      row_starts = hypre_ParAMGRelaxPlanFStarts(plan);
+   }
+
+   if ( (!jacobi && !forward && !backward) ||
+        (relax_points != 0 && !row_starts) ||
+        (use_l1 && !inv_l1) ||
+        hypre_BoomerAMGRelaxFloatSupported(A, relax_type, l1_norms) ||
+        hypre_ParAMGRelaxPlanNumRows(plan) != n ||
+        num_threads != hypre_NumThreads() ||
+        (num_threads > 1 && !jacobi && !weighted && !Ztemp) )
+   {
+      return hypre_BoomerAMGRelax(A, f, cf_marker, relax_type, relax_points,
+                                  relax_weight, omega, l1_norms, u, Vtemp, Ztemp);
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin      = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end        = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      v_buf_data = hypre_CTAlloc(HYPRE_Real, end, HYPRE_MEMORY_HOST);
+      Vext_data  = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = begin; i < end; i++)
+      {
+         v_buf_data[i-begin] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,i)];
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
+   }
+
+   /*-----------------------------------------------------------------
+    * Copy current approximation into temporary vectors.
+    *-----------------------------------------------------------------*/
+
+   if (jacobi || weighted)
+   {
+      Vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         Vtemp_data[i] = u_data[i];
+      }
+      tmp_data = Vtemp_data;
+   }
+   else if (num_threads > 1)
+   {
+      tmp_data = hypre_VectorData(hypre_ParVectorLocalVector(Ztemp));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         tmp_data[i] = u_data[i];
+      }
+   }
+
+   if (comm_handle)
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+   }
+
+   /*-----------------------------------------------------------------
+    * Relax the rows of each thread
+    *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   inv = use_l1 ? inv_l1 : inv_diag;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_threads; t++)
+   {
+      HYPRE_Int ns = thread_starts[t];
+      HYPRE_Int ne = thread_starts[t+1];
+      HYPRE_Int kb = row_starts ? row_starts[t]   : ns;
+      HYPRE_Int ke = row_starts ? row_starts[t+1] : ne;
+
+      if (jacobi)
+      {
+         hypre_BoomerAMGRelaxPlanSweepJacobi(A, f_data, inv_diag, use_l1 ? inv_l1 : NULL,
+                                             relax_weight, rows, kb, ke,
+                                             u_data, Vtemp_data, Vext_data);
+         continue;
+      }
+      if (forward)
+      {
+         hypre_BoomerAMGRelaxPlanSweepGS(A, f_data, inv, use_l1, relax_weight, omega,
+                                         ns, ne, rows, kb, ke, 1,
+                                         u_data, Vtemp_data, tmp_data, Vext_data);
+      }
+      if (backward)
+      {
+         hypre_BoomerAMGRelaxPlanSweepGS(A, f_data, inv, use_l1, relax_weight, omega,
+                                         ns, ne, rows, kb, ke, 0,
+                                         u_data, Vtemp_data, tmp_data, Vext_data);
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxWithPlanIF
+ *
+ * Same as hypre_BoomerAMGRelaxIF, using hypre_BoomerAMGRelaxWithPlan.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxWithPlanIF( hypre_ParCSRMatrix    *A,
+                                hypre_ParVector       *f,
+                                HYPRE_Int             *cf_marker,
+                                HYPRE_Int              relax_type,
+                                HYPRE_Int              relax_order,
+                                HYPRE_Int              cycle_type,
+                                HYPRE_Real             relax_weight,
+                                HYPRE_Real             omega,
+                                HYPRE_Real            *l1_norms,
+                                hypre_ParAMGRelaxPlan *plan,
+                                hypre_ParVector       *u,
+                                hypre_ParVector       *Vtemp,
+                                hypre_ParVector       *Ztemp )
+{
+   HYPRE_Int i, Solve_err_flag = 0;
+   HYPRE_Int relax_points[2];
+
+   if (relax_order == 1 && cycle_type < 3)
+   {
+      if (cycle_type < 2)
+      {
+         relax_points[0] = 1;
+         relax_points[1] = -1;
+      }
+      else
+      {
+         relax_points[0] = -1;
+         relax_points[1] = 1;
+      }
+
+      for (i = 0; i < 2; i++)
+      {
+         Solve_err_flag = hypre_BoomerAMGRelaxWithPlan(A, f, cf_marker, relax_type,
+                                                       relax_points[i], relax_weight,
+                                                       omega, l1_norms, plan,
+                                                       u, Vtemp, Ztemp);
+      }
+   }
+   else
+   {
+      Solve_err_flag = hypre_BoomerAMGRelaxWithPlan(A, f, cf_marker, relax_type, 0,
+                                                    relax_weight, omega, l1_norms,
+                                                    plan, u, Vtemp, Ztemp);
+   }
+
+   return Solve_err_flag;
+}
@@ -266,6 +266,7 @@ HYPRE_Int HYPRE_AMSFEIDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGCreate ( HYPRE_Solver *solver );
 HYPRE_Int HYPRE_BoomerAMGDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGResetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSetRestriction ( HYPRE_Solver solver , HYPRE_Int restr_par );
@@ -433,6 +434,11 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver , HYPRE_Int nonga
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver , HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver , HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver , HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetFusedRAP ( HYPRE_Solver solver , HYPRE_Int fused_rap );
+HYPRE_Int HYPRE_BoomerAMGGetRAPPeakMemory ( HYPRE_Solver solver , HYPRE_Real *peak_memory );
+HYPRE_Int HYPRE_BoomerAMGSetPhaseStats ( HYPRE_Solver solver , HYPRE_Int phase_stats );
+HYPRE_Int HYPRE_BoomerAMGGetPhaseStats ( HYPRE_Solver solver , HYPRE_Int level , HYPRE_Int phase , HYPRE_Real *time , HYPRE_Real *bytes , HYPRE_Real *messages , HYPRE_Real *nnz );
+HYPRE_Int HYPRE_BoomerAMGPrintPhaseStats ( HYPRE_Solver solver , const char *filename );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver , HYPRE_Int slu_threshold );
 #endif
@@ -506,6 +512,7 @@ HYPRE_Int HYPRE_ParCSRFlexGMRESDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_ParCSRFlexGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
@@ -525,6 +532,7 @@ HYPRE_Int HYPRE_ParCSRGMRESDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_ParCSRGMRESSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRGMRESSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_ParCSRGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_ParCSRGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
@@ -637,6 +645,7 @@ HYPRE_Int HYPRE_ParCSRLGMRESDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_ParCSRLGMRESSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRLGMRESSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRLGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_ParCSRLGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_ParCSRLGMRESSetAugDim ( HYPRE_Solver solver , HYPRE_Int aug_dim );
 HYPRE_Int HYPRE_ParCSRLGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRLGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -695,6 +704,8 @@ HYPRE_Int HYPRE_ParCSRPCGSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter )
 HYPRE_Int HYPRE_ParCSRPCGSetStopCrit ( HYPRE_Solver solver , HYPRE_Int stop_crit );
 HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm ( HYPRE_Solver solver , HYPRE_Int two_norm );
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange ( HYPRE_Solver solver , HYPRE_Int rel_change );
+HYPRE_Int HYPRE_ParCSRPCGSetPipelined ( HYPRE_Solver solver , HYPRE_Int pipelined );
+HYPRE_Int HYPRE_ParCSRPCGSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
 HYPRE_Int HYPRE_ParCSRPCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_ParCSRPCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
 HYPRE_Int HYPRE_ParCSRPCGSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
@@ -802,6 +813,10 @@ HYPRE_Int hypre_BoomerAMGSetRelaxType ( void *data , HYPRE_Int relax_type );
 HYPRE_Int hypre_BoomerAMGSetCycleRelaxType ( void *data , HYPRE_Int relax_type , HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGGetCycleRelaxType ( void *data , HYPRE_Int *relax_type , HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGSetRelaxOrder ( void *data , HYPRE_Int relax_order );
+HYPRE_Int hypre_BoomerAMGSetRelaxOverlap ( void *data , HYPRE_Int relax_overlap );
+HYPRE_Int hypre_BoomerAMGSetRelaxPlan ( void *data , HYPRE_Int relax_plan );
+HYPRE_Int hypre_BoomerAMGSetFloatLevel ( void *data , HYPRE_Int float_level );
+HYPRE_Int hypre_BoomerAMGSetFloatDropDouble ( void *data , HYPRE_Int float_drop_double );
 HYPRE_Int hypre_BoomerAMGGetRelaxOrder ( void *data , HYPRE_Int *relax_order );
 HYPRE_Int hypre_BoomerAMGSetGridRelaxType ( void *data , HYPRE_Int *grid_relax_type );
 HYPRE_Int hypre_BoomerAMGGetGridRelaxType ( void *data , HYPRE_Int **grid_relax_type );
@@ -915,6 +930,9 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data , HYPRE_Int nongalerk_num_
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data , HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data , HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data , HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetFusedRAP ( void *data , HYPRE_Int fused_rap );
+HYPRE_Int hypre_BoomerAMGGetRAPPeakMemory ( void *data , HYPRE_Real *peak_memory );
+HYPRE_Int hypre_BoomerAMGSetPhaseStats ( void *data , HYPRE_Int phase_stats );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data , HYPRE_Int slu_threshold );
 #endif
@@ -924,8 +942,21 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
+/* par_amg_phase_stats.c */
+HYPRE_Int hypre_BoomerAMGPhaseStatsInitialize ( void *data , HYPRE_Int num_levels );
+HYPRE_Int hypre_BoomerAMGPhaseStatsDestroy ( void *data );
+HYPRE_Int hypre_BoomerAMGPhaseBegin ( void *data , HYPRE_Int level , HYPRE_Int phase );
+HYPRE_Int hypre_BoomerAMGPhaseEnd ( void *data , HYPRE_Int level , HYPRE_Int phase , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGGetPhaseStats ( void *data , HYPRE_Int level , HYPRE_Int phase , HYPRE_Real *time , HYPRE_Real *bytes , HYPRE_Real *messages , HYPRE_Real *nnz );
+HYPRE_Int hypre_BoomerAMGPrintPhaseStats ( void *data , const char *filename );
+
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGResetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGRAPPlansDestroy ( void *amg_vdata );
+
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGSolveMulti ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
 /* par_amg_solveT.c */
 HYPRE_Int hypre_BoomerAMGSolveT ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
@@ -988,6 +1019,12 @@ HYPRE_Int hypre_BoomerAMGCoarsenCR ( hypre_ParCSRMatrix *A , HYPRE_Int **CF_mark
 /* par_cycle.c */
 HYPRE_Int hypre_BoomerAMGCycle ( void *amg_vdata , hypre_ParVector **F_array , hypre_ParVector **U_array );
 
+/* par_cycle_multi.c */
+HYPRE_Int hypre_BoomerAMGMultiCycleSupported ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGMultiVectorsCreate ( void *amg_vdata , HYPRE_Int num_vectors );
+HYPRE_Int hypre_BoomerAMGMultiVectorsDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGMultiCycle ( void *amg_vdata , hypre_ParVector **F_array , hypre_ParVector **U_array );
+
 /* par_difconv.c */
 HYPRE_ParCSRMatrix GenerateDifConv ( MPI_Comm comm , HYPRE_BigInt nx , HYPRE_BigInt ny , HYPRE_BigInt nz , HYPRE_Int P , HYPRE_Int Q , HYPRE_Int R , HYPRE_Int p , HYPRE_Int q , HYPRE_Int r , HYPRE_Real *value );
 
@@ -1108,6 +1145,23 @@ HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data , HYPRE_Int level ,
 /* par_relax_interface.c */
 HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
 
+/* par_relax_overlap.c */
+HYPRE_Int hypre_BoomerAMGRelaxOverlapSetup ( hypre_ParCSRMatrix *A , HYPRE_Int **rows_ptr , HYPRE_Int *num_interior_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxOverlap ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , HYPRE_Int *rows , HYPRE_Int num_interior , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxOverlapIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , HYPRE_Int *rows , HYPRE_Int num_interior , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
+/* par_relax_float.c */
+HYPRE_Int hypre_BoomerAMGRelaxFloatSupported ( hypre_ParCSRMatrix *A , HYPRE_Int relax_type , HYPRE_Real *l1_norms );
+HYPRE_Int hypre_BoomerAMGRelaxFloat ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGFloatLevelsSetup ( void *amg_vdata );
+
+/* par_relax_plan.c */
+HYPRE_Int hypre_BoomerAMGRelaxPlanUpdate ( hypre_ParAMGRelaxPlan *plan , hypre_ParCSRMatrix *A , HYPRE_Real *l1_norms );
+HYPRE_Int hypre_BoomerAMGRelaxPlanCreate ( hypre_ParCSRMatrix *A , HYPRE_Int *cf_marker , HYPRE_Real *l1_norms , hypre_ParAMGRelaxPlan **plan_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxPlanDestroy ( hypre_ParAMGRelaxPlan *plan );
+HYPRE_Int hypre_BoomerAMGRelaxWithPlan ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParAMGRelaxPlan *plan , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxWithPlanIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParAMGRelaxPlan *plan , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
 /* par_relax_more.c */
 HYPRE_Int hypre_ParCSRMaxEigEstimate ( hypre_ParCSRMatrix *A , HYPRE_Int scale , HYPRE_Real *max_eig );
 HYPRE_Int hypre_ParCSRMaxEigEstimateCG ( hypre_ParCSRMatrix *A , HYPRE_Int scale , HYPRE_Int max_iter , HYPRE_Real *max_eig , HYPRE_Real *min_eig );
@@ -1118,6 +1172,9 @@ HYPRE_Int hypre_LINPACKcgtql1 ( HYPRE_Int *n , HYPRE_Real *d , HYPRE_Real *e , H
 HYPRE_Real hypre_LINPACKcgpthy ( HYPRE_Real *a , HYPRE_Real *b );
 HYPRE_Int hypre_ParCSRRelax_L1_Jacobi ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp );
 
+/* par_relax_multi.c */
+HYPRE_Int hypre_BoomerAMGMultiRelax ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
 /* par_rotate_7pt.c */
 HYPRE_ParCSRMatrix GenerateRotate7pt ( MPI_Comm comm , HYPRE_BigInt nx , HYPRE_BigInt ny , HYPRE_Int P , HYPRE_Int Q , HYPRE_Int p , HYPRE_Int q , HYPRE_Real alpha , HYPRE_Real eps );
 
@@ -1214,6 +1271,13 @@ HYPRE_Int hypre_ParKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha , void *x );
 HYPRE_Int hypre_ParKrylovAxpy ( HYPRE_Complex alpha , void *x , void *y );
+HYPRE_Int hypre_ParKrylovNumVectors ( void *x );
+HYPRE_Int hypre_ParKrylovMultiInnerProd ( void *x , void *y , HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovMultiAxpy ( HYPRE_Complex *alpha , void *x , void *y );
+HYPRE_Int hypre_ParKrylovMultiScaleVector ( HYPRE_Complex *alpha , void *x );
+HYPRE_Int hypre_ParKrylovInnerProdLocal ( void *x , void *y , HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovIAllreduce ( void *x , HYPRE_Real *sendbuf , HYPRE_Real *recvbuf , HYPRE_Int count , void **request );
+HYPRE_Int hypre_ParKrylovWait ( void *request );
 HYPRE_Int hypre_ParKrylovCommInfo ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
 HYPRE_Int hypre_ParKrylovIdentitySetup ( void *vdata , void *A , void *b , void *x );
 HYPRE_Int hypre_ParKrylovIdentity ( void *vdata , void *A , void *b , void *x );
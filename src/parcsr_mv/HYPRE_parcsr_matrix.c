@@ -411,3 +411,17 @@ HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex      alpha,
                alpha, (hypre_ParCSRMatrix *) A,
                (hypre_ParVector *) x, beta, (hypre_ParVector *) y) );
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetShellMatvec
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetShellMatvec( HYPRE_ParCSRMatrix         A,
+                                  HYPRE_ParCSRShellMatvecFcn matvec,
+                                  HYPRE_ParCSRShellMatvecFcn matvecT,
+                                  void                      *data )
+{
+   return ( hypre_ParCSRMatrixSetShellMatvec( (hypre_ParCSRMatrix *) A,
+                                              matvec, matvecT, data ) );
+}
@@ -30,6 +30,15 @@ typedef struct hypre_ParCSRMatrix_struct *HYPRE_ParCSRMatrix;
 struct hypre_ParVector_struct;
 typedef struct hypre_ParVector_struct *HYPRE_ParVector;
 
+/* User-supplied y = alpha*A*x + beta*y.  Attached to a matrix with
+ * HYPRE_ParCSRMatrixSetShellMatvec, it replaces the matrix entries in the
+ * parcsr Krylov solvers (PCG, GMRES, FlexGMRES, LGMRES, COGMRES, BiCGSTAB,
+ * CGNR), while preconditioners such as BoomerAMG keep using the assembled
+ * entries. */
+typedef HYPRE_Int (*HYPRE_ParCSRShellMatvecFcn)( void *data, HYPRE_Complex alpha,
+                                                 HYPRE_ParVector x, HYPRE_Complex beta,
+                                                 HYPRE_ParVector y );
+
 /*--------------------------------------------------------------------------
  * Prototypes
  *--------------------------------------------------------------------------*/
@@ -50,6 +59,7 @@ HYPRE_Int HYPRE_ParCSRMatrixRestoreRow( HYPRE_ParCSRMatrix matrix , HYPRE_BigInt
 HYPRE_Int HYPRE_CSRMatrixToParCSRMatrix( MPI_Comm comm , HYPRE_CSRMatrix A_CSR , HYPRE_BigInt *row_partitioning , HYPRE_BigInt *col_partitioning , HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixMatvec( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetShellMatvec( HYPRE_ParCSRMatrix A , HYPRE_ParCSRShellMatvecFcn matvec , HYPRE_ParCSRShellMatvecFcn matvecT , void *data );
 
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate( MPI_Comm comm , HYPRE_BigInt global_size , HYPRE_BigInt *partitioning , HYPRE_ParVector *vector );
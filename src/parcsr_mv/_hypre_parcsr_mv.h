@@ -85,6 +85,17 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
 
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+   /* distributed graph communicator over the union of send_procs and
+      recv_procs; counts and displacements are per neighbor for job 1 */
+   HYPRE_Int                    has_neighbor_comm;
+   MPI_Comm                     neighbor_comm;
+   hypre_int                   *neighbor_send_counts;
+   hypre_int                   *neighbor_send_displs;
+   hypre_int                   *neighbor_recv_counts;
+   hypre_int                   *neighbor_recv_displs;
+#endif
+
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Complex *tmp_data;
@@ -117,6 +128,15 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
 
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+#define hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)     (comm_pkg -> has_neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg)        (comm_pkg -> neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg)  (comm_pkg -> neighbor_send_counts)
+#define hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg)  (comm_pkg -> neighbor_send_displs)
+#define hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg)  (comm_pkg -> neighbor_recv_counts)
+#define hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg)  (comm_pkg -> neighbor_recv_displs)
+#endif
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
 #define hypre_ParCSRCommPkgBufData(comm_pkg)             ((comm_pkg) -> buf_data)
@@ -359,6 +379,12 @@ typedef struct hypre_ParCSRMatrix_struct
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
 
+   /* Optional user operator that the Krylov solvers apply instead of
+      diag/offd, which then only serve as preconditioner matrix */
+   HYPRE_ParCSRShellMatvecFcn  shell_matvec;
+   HYPRE_ParCSRShellMatvecFcn  shell_matvecT;
+   void                       *shell_data;
+
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
    HYPRE_Complex        *bdiaginv;
@@ -404,6 +430,9 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixShellMatvec(matrix)            ((matrix) -> shell_matvec)
+#define hypre_ParCSRMatrixShellMatvecT(matrix)           ((matrix) -> shell_matvecT)
+#define hypre_ParCSRMatrixShellData(matrix)              ((matrix) -> shell_data)
 #if defined(HYPRE_USING_CUDA)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -426,6 +455,70 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic data for recomputing C = R^T A P when only the values of R, A
+ * and P change (see par_csr_rap_plan.c)
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* operand sizes the plan was built for */
+   HYPRE_Int             num_rows_A;
+   HYPRE_Int             num_cols_offd_A;
+   HYPRE_Int             num_nonzeros_A;
+   HYPRE_Int             num_nonzeros_P;
+   HYPRE_Int             num_nonzeros_R;
+   HYPRE_Int             num_nonzeros_C;
+   HYPRE_BigInt         *col_map_offd_A;
+
+   /* Q = A P; column c < num_cols_diag_P is a local coarse column,
+      column num_cols_diag_P + k is col_map_offd_Q[k] */
+   HYPRE_Int             num_cols_diag_P;
+   HYPRE_Int             num_cols_offd_Q;
+   HYPRE_Int            *P_offd_to_Q;
+   HYPRE_Int            *Q_i;
+   HYPRE_Int            *Q_j;
+   HYPRE_Complex        *Q_data;
+
+   /* rows of P matching the columns of A_offd */
+   hypre_ParCSRCommPkg  *P_ext_comm_pkg;
+   HYPRE_Int             P_ext_num_send_rows;
+   HYPRE_Int            *P_ext_send_rows;
+   HYPRE_Complex        *P_ext_send_data;
+   HYPRE_Int            *P_ext_i;
+   HYPRE_Int            *P_ext_j;
+   HYPRE_Complex        *P_ext_data;
+
+   /* transposes of R_diag and R_offd, perm points back into R */
+   HYPRE_Int             num_cols_diag_R;
+   HYPRE_Int             num_cols_offd_R;
+   HYPRE_Int            *RT_diag_i;
+   HYPRE_Int            *RT_diag_j;
+   HYPRE_Int            *RT_diag_perm;
+   HYPRE_Complex        *RT_diag_data;
+   HYPRE_Int            *RT_offd_i;
+   HYPRE_Int            *RT_offd_j;
+   HYPRE_Int            *RT_offd_perm;
+   HYPRE_Complex        *RT_offd_data;
+
+   /* contributions to coarse rows owned by other processors (in the
+      column numbering of Q) and their positions in C on the owner */
+   HYPRE_Int            *C_int_i;
+   HYPRE_Int            *C_int_j;
+   HYPRE_Complex        *C_int_data;
+   hypre_ParCSRCommPkg  *C_ext_comm_pkg;
+   HYPRE_Int             C_ext_size;
+   HYPRE_Int            *C_ext_pos;
+   HYPRE_Complex        *C_ext_data;
+
+   /* column c of Q is column Q_to_C[c] of C: c < num_cols_diag_C in C_diag,
+      num_cols_diag_C + k for col_map_offd_C[k]; -1 if C has no such column */
+   HYPRE_Int             num_cols_diag_C;
+   HYPRE_Int             num_cols_offd_C;
+   HYPRE_Int            *Q_to_C;
+
+} hypre_ParCSRRAPPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -689,6 +782,7 @@ HYPRE_Int HYPRE_CSRMatrixToParCSRMatrix ( MPI_Comm comm , HYPRE_CSRMatrix A_CSR
 HYPRE_Int HYPRE_CSRMatrixToParCSRMatrix_WithNewPartitioning ( MPI_Comm comm , HYPRE_CSRMatrix A_CSR , HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixMatvec ( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT ( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetShellMatvec ( HYPRE_ParCSRMatrix A , HYPRE_ParCSRShellMatvecFcn matvec , HYPRE_ParCSRShellMatvecFcn matvecT , void *data );
 HYPRE_Int hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A, HYPRE_Real tol, HYPRE_Int max_row_elmts, HYPRE_Int rescale, HYPRE_Int nrm_type);
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate ( MPI_Comm comm , HYPRE_BigInt global_size , HYPRE_BigInt *partitioning , HYPRE_ParVector *vector );
@@ -789,6 +883,9 @@ HYPRE_Int
 hypre_ParCSRCommPkgCreate(MPI_Comm comm, HYPRE_BigInt *col_map_offd, HYPRE_BigInt first_col_diag, HYPRE_BigInt *col_starts, HYPRE_Int num_cols_diag, HYPRE_Int num_cols_offd, hypre_ParCSRCommPkg *comm_pkg);
 HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+HYPRE_Int hypre_ParCSRCommPkgCreateNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
+#endif
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros , HYPRE_Int num_rows , HYPRE_Complex *a_data , HYPRE_Int *a_i , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_matrix_datatype );
 HYPRE_Int hypre_BuildCSRJDataType ( HYPRE_Int num_nonzeros , HYPRE_Complex *a_data , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_jdata_datatype );
 HYPRE_Int hypre_ParCSRFindExtendCommPkg(MPI_Comm comm, HYPRE_BigInt global_num_cols, HYPRE_BigInt first_col_diag, HYPRE_Int num_cols_diag, HYPRE_BigInt *col_starts, hypre_IJAssumedPart *apart, HYPRE_Int indices_len, HYPRE_BigInt *indices, hypre_ParCSRCommPkg **extend_comm_pkg);
@@ -858,6 +955,7 @@ HYPRE_Int hypre_ParCSRMatrixInitialize ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_data );
+HYPRE_Int hypre_ParCSRMatrixSetShellMatvec ( hypre_ParCSRMatrix *matrix , HYPRE_ParCSRShellMatvecFcn matvec , HYPRE_ParCSRShellMatvecFcn matvecT , void *data );
 HYPRE_Int hypre_ParCSRMatrixSetRowStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_row_starts );
 HYPRE_Int hypre_ParCSRMatrixSetColStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_col_starts );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm , const char *file_name );
@@ -899,9 +997,16 @@ hypre_ParCSRMatrix *hypre_ParCSRTMatMatKTDevice( hypre_ParCSRMatrix  *A, hypre_P
 hypre_ParCSRMatrix *hypre_ParCSRTMatMatKT( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B, HYPRE_Int keep_transpose);
 hypre_ParCSRMatrix *hypre_ParCSRTMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B);
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *P , HYPRE_Int keepTranspose );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKT_v2( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose, HYPRE_Int fused, HYPRE_Real *peak_memory );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAP( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *P );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTDevice( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
-hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
+hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose, HYPRE_Real *peak_memory );
+hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPFusedHost( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose, HYPRE_Real *peak_memory );
+
+/* par_csr_rap_plan.c */
+HYPRE_Int hypre_ParCSRRAPPlanCreate ( hypre_ParCSRMatrix *R , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *C , hypre_ParCSRRAPPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRRAPPlanDestroy ( hypre_ParCSRRAPPlan *plan );
+HYPRE_Int hypre_ParCSRMatrixRAPNumeric ( hypre_ParCSRRAPPlan *plan , hypre_ParCSRMatrix *R , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *C );
 
 /* par_make_system.c */
 HYPRE_ParCSR_System_Problem *HYPRE_Generate2DSystem ( HYPRE_ParCSRMatrix H_L1 , HYPRE_ParCSRMatrix H_L2 , HYPRE_ParVector H_b1 , HYPRE_ParVector H_b2 , HYPRE_ParVector H_x1 , HYPRE_ParVector H_x2 , HYPRE_Complex *M_vals );
@@ -929,6 +1034,10 @@ HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha , hypre_ParVector *x , hypre
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y, HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x , hypre_ParVector **y , HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod );
+HYPRE_Int hypre_ParVectorMultiInnerProd ( hypre_ParVector *x , hypre_ParVector *y , HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorMultiAxpy ( HYPRE_Complex *alpha , hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorMultiScale ( HYPRE_Complex *alpha , hypre_ParVector *y );
+hypre_ParVector *hypre_ParMultiVectorColumnView ( hypre_ParVector *x , HYPRE_Int j );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector **z, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x , HYPRE_Real *prod_y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm , hypre_Vector *v , HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
@@ -416,148 +416,209 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    HYPRE_CUDA_CALL( cudaStreamSynchronize(hypre_HandleCudaComputeStream(hypre_handle())) );
 #endif
 
-   num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
-
-   hypre_MPI_Comm_size(comm, &num_procs);
-   hypre_MPI_Comm_rank(comm, &my_id);
+   /* account for the outgoing traffic of this exchange (bytes are only
+    * known for the typed jobs) */
+   if (job == 2 || job == 12 || job == 22)
+   {
+      hypre_HandleCommNumMessages(hypre_handle()) += (HYPRE_Real) num_recvs;
+   }
+   else
+   {
+      hypre_HandleCommNumMessages(hypre_handle()) += (HYPRE_Real) num_sends;
+   }
+   hypre_HandleCommNumBytes(hypre_handle()) += (HYPRE_Real) num_send_bytes;
 
-   j = 0;
-   switch (job)
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+   if (hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
    {
-      case  1:
+      /* post the whole exchange as one neighborhood collective; the
+         transpose jobs swap the roles of the send and recv counts */
+      hypre_MPI_Datatype mpi_type;
+      hypre_int *send_counts, *send_displs, *recv_counts, *recv_displs;
+
+      switch (job)
       {
-         HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
-         HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
-         for (i = 0; i < num_recvs; i++)
-         {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         for (i = 0; i < num_sends; i++)
-         {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
-            hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         break;
+         case 11:
+         case 12:
+            mpi_type = HYPRE_MPI_INT;
+            break;
+         case 21:
+         case 22:
+            mpi_type = HYPRE_MPI_BIG_INT;
+            break;
+         default:
+            mpi_type = HYPRE_MPI_COMPLEX;
+            break;
       }
-      case  2:
+
+      if (job == 2 || job == 12 || job == 22)
       {
-         HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
-         HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
-         for (i = 0; i < num_sends; i++)
-         {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
-            hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         for (i = 0; i < num_recvs; i++)
-         {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         break;
+         send_counts = hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg);
+         send_displs = hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg);
+         recv_counts = hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg);
+         recv_displs = hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg);
       }
-      case  11:
+      else
       {
-         HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
-         HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
-         for (i = 0; i < num_recvs; i++)
-         {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
-         }
-         for (i = 0; i < num_sends; i++)
-         {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
-         }
-         break;
+         send_counts = hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg);
+         send_displs = hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg);
+         recv_counts = hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg);
+         recv_displs = hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg);
       }
-      case  12:
+
+      num_requests = 1;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+      hypre_MPI_Ineighbor_alltoallv(send_data, send_counts, send_displs, mpi_type,
+                                    recv_data, recv_counts, recv_displs, mpi_type,
+                                    hypre_ParCSRCommPkgNeighborComm(comm_pkg), requests);
+   }
+   else
+#endif
+   {
+      num_requests = num_sends + num_recvs;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+      hypre_MPI_Comm_size(comm, &num_procs);
+      hypre_MPI_Comm_rank(comm, &my_id);
+
+      j = 0;
+      switch (job)
       {
-         HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
-         HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
-         for (i = 0; i < num_sends; i++)
+         case  1:
          {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
+            HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
+               hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         for (i = 0; i < num_recvs; i++)
+         case  2:
          {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
+            HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
+               hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         break;
-      }
-      case  21:
-      {
-         HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
-         HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
-         for (i = 0; i < num_recvs; i++)
+         case  11:
          {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
+            HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         for (i = 0; i < num_sends; i++)
+         case  12:
          {
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
+            HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         break;
-      }
-      case  22:
-      {
-         HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
-         HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
-         for (i = 0; i < num_sends; i++)
+         case  21:
          {
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
+            HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_sends; i++)
+            {
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         for (i = 0; i < num_recvs; i++)
+         case  22:
          {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
+            HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
+            for (i = 0; i < num_sends; i++)
+            {
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         break;
       }
    }
+
    /*--------------------------------------------------------------------
     * set up comm_handle and return
     *--------------------------------------------------------------------*/
@@ -943,8 +1004,94 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
                                     comm_pkg );
 #endif
 
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+   hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+#endif
+
+   return hypre_error_flag;
+}
+
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+/* ----------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNeighborComm
+ * builds a distributed graph communicator over the union of the send and
+ * recv procs of comm_pkg, so that hypre_ParCSRCommHandleCreate can post
+ * the exchange as a single neighborhood collective.  The graph is
+ * symmetric, which lets the transpose jobs use the same communicator.
+ * This is collective over the comm of comm_pkg.
+ * ---------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   MPI_Comm   comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int  num_procs, num_neighbors;
+   HYPRE_Int *neighbors;
+   HYPRE_Int  i, k;
+   hypre_int *send_counts, *send_displs, *recv_counts, *recv_displs;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   if (num_procs < 2 || hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   /* sorted union of send_procs and recv_procs */
+   neighbors = hypre_TAlloc(HYPRE_Int, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      neighbors[i] = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      neighbors[num_sends + i] = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+   }
+   hypre_qsort0(neighbors, 0, num_sends + num_recvs - 1);
+   num_neighbors = 0;
+   for (i = 0; i < num_sends + num_recvs; i++)
+   {
+      if (num_neighbors == 0 || neighbors[i] != neighbors[num_neighbors-1])
+      {
+         neighbors[num_neighbors++] = neighbors[i];
+      }
+   }
+
+   send_counts = hypre_CTAlloc(hypre_int, num_neighbors, HYPRE_MEMORY_HOST);
+   send_displs = hypre_CTAlloc(hypre_int, num_neighbors, HYPRE_MEMORY_HOST);
+   recv_counts = hypre_CTAlloc(hypre_int, num_neighbors, HYPRE_MEMORY_HOST);
+   recv_displs = hypre_CTAlloc(hypre_int, num_neighbors, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_sends; i++)
+   {
+      k = hypre_BinarySearch(neighbors, hypre_ParCSRCommPkgSendProc(comm_pkg, i), num_neighbors);
+      send_displs[k] = (hypre_int) hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+      send_counts[k] = (hypre_int) (hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) -
+                                    hypre_ParCSRCommPkgSendMapStart(comm_pkg, i));
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      k = hypre_BinarySearch(neighbors, hypre_ParCSRCommPkgRecvProc(comm_pkg, i), num_neighbors);
+      recv_displs[k] = (hypre_int) hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+      recv_counts[k] = (hypre_int) (hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i+1) -
+                                    hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i));
+   }
+
+   hypre_MPI_Dist_graph_create_adjacent(comm, num_neighbors, neighbors, num_neighbors, neighbors,
+                                        0, &hypre_ParCSRCommPkgNeighborComm(comm_pkg));
+
+   hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)    = 1;
+   hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg) = send_counts;
+   hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg) = send_displs;
+   hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg) = recv_counts;
+   hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg) = recv_displs;
+
+   hypre_TFree(neighbors, HYPRE_MEMORY_HOST);
+
    return hypre_error_flag;
 }
+#endif
 
 
 HYPRE_Int
@@ -961,6 +1108,17 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
    }
 #endif
 
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+   if (hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
+   {
+      hypre_MPI_Comm_free(&hypre_ParCSRCommPkgNeighborComm(comm_pkg));
+      hypre_TFree(hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg), HYPRE_MEMORY_HOST);
+   }
+#endif
+
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
       hypre_TFree(hypre_ParCSRCommPkgSendProcs(comm_pkg), HYPRE_MEMORY_HOST);
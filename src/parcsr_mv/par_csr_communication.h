@@ -70,6 +70,17 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
 
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+   /* distributed graph communicator over the union of send_procs and
+      recv_procs; counts and displacements are per neighbor for job 1 */
+   HYPRE_Int                    has_neighbor_comm;
+   MPI_Comm                     neighbor_comm;
+   hypre_int                   *neighbor_send_counts;
+   hypre_int                   *neighbor_send_displs;
+   hypre_int                   *neighbor_recv_counts;
+   hypre_int                   *neighbor_recv_displs;
+#endif
+
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Complex *tmp_data;
@@ -102,6 +113,15 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
 
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+#define hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)     (comm_pkg -> has_neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg)        (comm_pkg -> neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg)  (comm_pkg -> neighbor_send_counts)
+#define hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg)  (comm_pkg -> neighbor_send_displs)
+#define hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg)  (comm_pkg -> neighbor_recv_counts)
+#define hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg)  (comm_pkg -> neighbor_recv_displs)
+#endif
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
 #define hypre_ParCSRCommPkgBufData(comm_pkg)             ((comm_pkg) -> buf_data)
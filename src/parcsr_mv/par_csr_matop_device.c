@@ -1509,22 +1509,31 @@ hypre_ParCSRDiagScale( HYPRE_ParCSRMatrix HA,
    HYPRE_Real *A_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A));
    HYPRE_Int *A_i = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(A));
    HYPRE_Int local_size = hypre_VectorSize(hypre_ParVectorLocalVector(x));
+   HYPRE_Int num_vectors = hypre_VectorNumVectors(hypre_ParVectorLocalVector(x));
    HYPRE_Int ierr = 0;
+   HYPRE_Int jv;
+
+   /* multivectors are scaled column by column ('column' storage) */
+   for (jv = 0; jv < num_vectors; jv++)
+   {
 #if defined(HYPRE_USING_CUDA)
-   hypreDevice_DiagScaleVector(local_size, A_i, A_data, y_data, x_data);
-   //hypre_SyncCudaComputeStream(hypre_handle());
+      hypreDevice_DiagScaleVector(local_size, A_i, A_data, y_data, x_data);
+      //hypre_SyncCudaComputeStream(hypre_handle());
 #else /* #if defined(HYPRE_USING_CUDA) */
-   HYPRE_Int i;
+      HYPRE_Int i;
 #if defined(HYPRE_USING_DEVICE_OPENMP)
 #pragma omp target teams distribute parallel for private(i) is_device_ptr(x_data,y_data,A_data,A_i)
 #elif defined(HYPRE_USING_OPENMP)
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-   for (i = 0; i < local_size; i++)
-   {
-      x_data[i] = y_data[i]/A_data[A_i[i]];
-   }
+      for (i = 0; i < local_size; i++)
+      {
+         x_data[i] = y_data[i]/A_data[A_i[i]];
+      }
 #endif /* #if defined(HYPRE_USING_CUDA) */
+      x_data += local_size;
+      y_data += local_size;
+   }
 
    return ierr;
 }
@@ -114,6 +114,9 @@ hypre_ParCSRMatrixCreate( MPI_Comm comm,
    hypre_ParCSRMatrixColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixDeviceColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixProcOrdering(matrix) = NULL;
+   hypre_ParCSRMatrixShellMatvec(matrix) = NULL;
+   hypre_ParCSRMatrixShellMatvecT(matrix) = NULL;
+   hypre_ParCSRMatrixShellData(matrix) = NULL;
 
    hypre_ParCSRMatrixAssumedPartition(matrix) = NULL;
    hypre_ParCSRMatrixOwnsAssumedPartition(matrix) = 1;
@@ -432,6 +435,35 @@ hypre_ParCSRMatrixSetDataOwner( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetShellMatvec
+ *
+ * Attaches a user operator to the matrix.  The parcsr Krylov solvers apply
+ * it instead of the stored entries; everything else, in particular a
+ * preconditioner set up with the matrix, still uses the stored entries.
+ * matvecT may be NULL if no transpose product is needed.  Pass
+ * matvec = NULL to detach the operator.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetShellMatvec( hypre_ParCSRMatrix         *matrix,
+                                  HYPRE_ParCSRShellMatvecFcn  matvec,
+                                  HYPRE_ParCSRShellMatvecFcn  matvecT,
+                                  void                       *data )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixShellMatvec(matrix)  = matvec;
+   hypre_ParCSRMatrixShellMatvecT(matrix) = matvecT;
+   hypre_ParCSRMatrixShellData(matrix)    = data;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixSetRowStartsOwner
  *--------------------------------------------------------------------------*/
@@ -2650,6 +2682,9 @@ hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A,
 
    hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
 
+   hypre_CSRMatrixResetSell(A_diag);
+   hypre_CSRMatrixResetSell(A_offd);
+
    return hypre_error_flag;
 }
 
@@ -3249,6 +3284,9 @@ hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A,
    hypre_TFree(num_lost_per_thread, HYPRE_MEMORY_HOST);
    hypre_TFree(num_lost_offd_per_thread, HYPRE_MEMORY_HOST);
 
+   hypre_CSRMatrixResetSell(A_diag);
+   hypre_CSRMatrixResetSell(A_offd);
+
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_INTERP_TRUNC] += hypre_MPI_Wtime();
 #endif
@@ -80,6 +80,12 @@ typedef struct hypre_ParCSRMatrix_struct
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
 
+   /* Optional user operator that the Krylov solvers apply instead of
+      diag/offd, which then only serve as preconditioner matrix */
+   HYPRE_ParCSRShellMatvecFcn  shell_matvec;
+   HYPRE_ParCSRShellMatvecFcn  shell_matvecT;
+   void                       *shell_data;
+
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
    HYPRE_Complex        *bdiaginv;
@@ -125,6 +131,9 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixShellMatvec(matrix)            ((matrix) -> shell_matvec)
+#define hypre_ParCSRMatrixShellMatvecT(matrix)           ((matrix) -> shell_matvecT)
+#define hypre_ParCSRMatrixShellData(matrix)              ((matrix) -> shell_data)
 #if defined(HYPRE_USING_CUDA)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -147,6 +156,70 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic data for recomputing C = R^T A P when only the values of R, A
+ * and P change (see par_csr_rap_plan.c)
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* operand sizes the plan was built for */
+   HYPRE_Int             num_rows_A;
+   HYPRE_Int             num_cols_offd_A;
+   HYPRE_Int             num_nonzeros_A;
+   HYPRE_Int             num_nonzeros_P;
+   HYPRE_Int             num_nonzeros_R;
+   HYPRE_Int             num_nonzeros_C;
+   HYPRE_BigInt         *col_map_offd_A;
+
+   /* Q = A P; column c < num_cols_diag_P is a local coarse column,
+      column num_cols_diag_P + k is col_map_offd_Q[k] */
+   HYPRE_Int             num_cols_diag_P;
+   HYPRE_Int             num_cols_offd_Q;
+   HYPRE_Int            *P_offd_to_Q;
+   HYPRE_Int            *Q_i;
+   HYPRE_Int            *Q_j;
+   HYPRE_Complex        *Q_data;
+
+   /* rows of P matching the columns of A_offd */
+   hypre_ParCSRCommPkg  *P_ext_comm_pkg;
+   HYPRE_Int             P_ext_num_send_rows;
+   HYPRE_Int            *P_ext_send_rows;
+   HYPRE_Complex        *P_ext_send_data;
+   HYPRE_Int            *P_ext_i;
+   HYPRE_Int            *P_ext_j;
+   HYPRE_Complex        *P_ext_data;
+
+   /* transposes of R_diag and R_offd, perm points back into R */
+   HYPRE_Int             num_cols_diag_R;
+   HYPRE_Int             num_cols_offd_R;
+   HYPRE_Int            *RT_diag_i;
+   HYPRE_Int            *RT_diag_j;
+   HYPRE_Int            *RT_diag_perm;
+   HYPRE_Complex        *RT_diag_data;
+   HYPRE_Int            *RT_offd_i;
+   HYPRE_Int            *RT_offd_j;
+   HYPRE_Int            *RT_offd_perm;
+   HYPRE_Complex        *RT_offd_data;
+
+   /* contributions to coarse rows owned by other processors (in the
+      column numbering of Q) and their positions in C on the owner */
+   HYPRE_Int            *C_int_i;
+   HYPRE_Int            *C_int_j;
+   HYPRE_Complex        *C_int_data;
+   hypre_ParCSRCommPkg  *C_ext_comm_pkg;
+   HYPRE_Int             C_ext_size;
+   HYPRE_Int            *C_ext_pos;
+   HYPRE_Complex        *C_ext_data;
+
+   /* column c of Q is column Q_to_C[c] of C: c < num_cols_diag_C in C_diag,
+      num_cols_diag_C + k for col_map_offd_C[k]; -1 if C has no such column */
+   HYPRE_Int             num_cols_diag_C;
+   HYPRE_Int             num_cols_offd_C;
+   HYPRE_Int            *Q_to_C;
+
+} hypre_ParCSRRAPPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
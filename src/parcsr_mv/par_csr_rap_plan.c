@@ -0,0 +1,971 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Galerkin product C = R^T A P with a reusable symbolic phase.
+ *
+ * hypre_ParCSRRAPPlanCreate records the structure of Q = A P, of the
+ * transposes of R, of the external rows of P and of the coarse rows that are
+ * sent to other processors, together with the position of every contribution
+ * in an existing matrix C, usually the result of hypre_ParCSRMatrixRAPKT or
+ * hypre_BoomerAMGBuildCoarseOperatorKT.  hypre_ParCSRMatrixRAPNumeric then
+ * recomputes the values of C in place after the values (but not the
+ * sparsity patterns) of R, A and P have changed.  It only exchanges values
+ * and does not allocate matrices or communication packages.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * Communication package for a value-only exchange of CSR rows.  The procs
+ * arrays are copied, the starts arrays are taken over.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRCommPkg *
+hypre_ParCSRRAPPlanCommPkgCreate( MPI_Comm    comm,
+                                  HYPRE_Int   num_sends,
+                                  HYPRE_Int  *send_procs,
+                                  HYPRE_Int  *send_starts,
+                                  HYPRE_Int   num_recvs,
+                                  HYPRE_Int  *recv_procs,
+                                  HYPRE_Int  *recv_starts )
+{
+   hypre_ParCSRCommPkg *comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommPkgComm(comm_pkg)     = comm;
+   hypre_ParCSRCommPkgNumSends(comm_pkg) = num_sends;
+   hypre_ParCSRCommPkgNumRecvs(comm_pkg) = num_recvs;
+
+   hypre_ParCSRCommPkgSendProcs(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(comm_pkg), send_procs, HYPRE_Int, num_sends,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgRecvProcs(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(comm_pkg), recv_procs, HYPRE_Int, num_recvs,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_starts;
+   hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = recv_starts;
+
+   return comm_pkg;
+}
+
+/*--------------------------------------------------------------------------
+ * Structure of the transpose of a CSR pattern.  AT_perm maps every entry of
+ * the transpose to the corresponding entry of A.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRRAPPlanTranspose( HYPRE_Int   num_rows,
+                              HYPRE_Int   num_cols,
+                              HYPRE_Int  *A_i,
+                              HYPRE_Int  *A_j,
+                              HYPRE_Int **AT_i_ptr,
+                              HYPRE_Int **AT_j_ptr,
+                              HYPRE_Int **AT_perm_ptr )
+{
+   HYPRE_Int  nnz     = A_i[num_rows];
+   HYPRE_Int *AT_i    = hypre_CTAlloc(HYPRE_Int, num_cols + 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int *AT_j    = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   HYPRE_Int *AT_perm = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   HYPRE_Int  i, jj, pos;
+
+   for (jj = 0; jj < nnz; jj++)
+   {
+      AT_i[A_j[jj] + 1]++;
+   }
+   for (i = 0; i < num_cols; i++)
+   {
+      AT_i[i + 1] += AT_i[i];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         pos = AT_i[A_j[jj]]++;
+         AT_j[pos]    = i;
+         AT_perm[pos] = jj;
+      }
+   }
+   for (i = num_cols; i > 0; i--)
+   {
+      AT_i[i] = AT_i[i - 1];
+   }
+   AT_i[0] = 0;
+
+   *AT_i_ptr    = AT_i;
+   *AT_j_ptr    = AT_j;
+   *AT_perm_ptr = AT_perm;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanCreate
+ *
+ * Builds the symbolic data for C = R^T A P, where C already holds the
+ * sparsity pattern of the product.  If some contribution of R^T A P has no
+ * entry in C, no plan is returned (*plan_ptr = NULL) on any processor.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanCreate( hypre_ParCSRMatrix   *R,
+                           hypre_ParCSRMatrix   *A,
+                           hypre_ParCSRMatrix   *P,
+                           hypre_ParCSRMatrix   *C,
+                           hypre_ParCSRRAPPlan **plan_ptr )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+
+   hypre_CSRMatrix     *A_diag   = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix     *A_offd   = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int           *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int           *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int            num_rows_A      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_BigInt        *col_map_offd_A  = hypre_ParCSRMatrixColMapOffd(A);
+
+   hypre_CSRMatrix     *P_diag   = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrix     *P_offd   = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int           *P_diag_i = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int           *P_diag_j = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Int           *P_offd_i = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int           *P_offd_j = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Int            num_cols_diag_P  = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int            num_cols_offd_P  = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_BigInt        *col_map_offd_P   = hypre_ParCSRMatrixColMapOffd(P);
+   HYPRE_BigInt         first_col_diag_P = hypre_ParCSRMatrixFirstColDiag(P);
+   HYPRE_BigInt         last_col_diag_P  = first_col_diag_P + (HYPRE_BigInt) num_cols_diag_P - 1;
+
+   hypre_CSRMatrix     *R_diag = hypre_ParCSRMatrixDiag(R);
+   hypre_CSRMatrix     *R_offd = hypre_ParCSRMatrixOffd(R);
+   HYPRE_Int            num_cols_diag_R = hypre_CSRMatrixNumCols(R_diag);
+   HYPRE_Int            num_cols_offd_R = hypre_CSRMatrixNumCols(R_offd);
+
+   hypre_CSRMatrix     *C_diag   = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrix     *C_offd   = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int           *C_diag_i = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int           *C_diag_j = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Int           *C_offd_i = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int           *C_offd_j = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Int            num_rows_C       = hypre_CSRMatrixNumRows(C_diag);
+   HYPRE_Int            num_cols_diag_C  = hypre_CSRMatrixNumCols(C_diag);
+   HYPRE_Int            num_cols_offd_C  = hypre_CSRMatrixNumCols(C_offd);
+   HYPRE_Int            nnz_diag_C       = C_diag_i[num_rows_C];
+   HYPRE_BigInt        *col_map_offd_C   = hypre_ParCSRMatrixColMapOffd(C);
+   HYPRE_BigInt         first_col_diag_C = hypre_ParCSRMatrixFirstColDiag(C);
+   HYPRE_BigInt         last_col_diag_C  = first_col_diag_C + (HYPRE_BigInt) num_cols_diag_C - 1;
+
+   hypre_ParCSRCommPkg *comm_pkg_A;
+   hypre_ParCSRCommPkg *comm_pkg_R;
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_ParCSRRAPPlan *plan;
+   hypre_CSRMatrix     *P_ext;
+   void                *request;
+
+   HYPRE_Int            num_sends, num_recvs;
+   HYPRE_Int           *send_map_starts, *send_map_elmts, *recv_vec_starts;
+   HYPRE_Int           *send_starts, *recv_starts;
+   HYPRE_Int           *P_ext_i, *P_ext_j, *Q_i, *Q_j, *C_int_i, *C_int_j;
+   HYPRE_Int           *RT_diag_i, *RT_diag_j, *RT_offd_i, *RT_offd_j;
+   HYPRE_Int           *P_offd_to_Q, *Q_to_C, *C_ext_i, *C_ext_pos, *marker;
+   HYPRE_BigInt        *P_ext_big_j, *col_map_offd_Q, *C_int_big_j, *C_ext_big_j;
+   HYPRE_Int            num_cols_offd_Q, num_cols_Q, num_marker, num_send_rows;
+   HYPRE_Int            i, ii, jj, kk, k, c, cnt, pass;
+   HYPRE_Int            incompatible, mismatch, any_mismatch;
+   HYPRE_BigInt         big_c;
+
+   *plan_ptr = NULL;
+
+   incompatible = ( hypre_CSRMatrixNumRows(R_diag) != num_rows_A ||
+                    hypre_CSRMatrixNumCols(A_diag) != hypre_CSRMatrixNumRows(P_diag) ||
+                    num_rows_C != num_cols_diag_R ||
+                    num_cols_diag_C != num_cols_diag_P ||
+                    first_col_diag_C != first_col_diag_P );
+   hypre_MPI_Allreduce(&incompatible, &mismatch, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (mismatch)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, " Error! Incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   if (!hypre_ParCSRMatrixCommPkg(R))
+   {
+      hypre_MatvecCommPkgCreate(R);
+   }
+   comm_pkg_A = hypre_ParCSRMatrixCommPkg(A);
+   comm_pkg_R = hypre_ParCSRMatrixCommPkg(R);
+
+   plan = hypre_CTAlloc(hypre_ParCSRRAPPlan, 1, HYPRE_MEMORY_HOST);
+
+   plan -> num_rows_A      = num_rows_A;
+   plan -> num_cols_offd_A = num_cols_offd_A;
+   plan -> num_nonzeros_A  = A_diag_i[num_rows_A] + A_offd_i[num_rows_A];
+   plan -> num_nonzeros_P  = P_diag_i[hypre_CSRMatrixNumRows(P_diag)] +
+                             P_offd_i[hypre_CSRMatrixNumRows(P_offd)];
+   plan -> num_nonzeros_R  = hypre_CSRMatrixI(R_diag)[num_rows_A] +
+                             hypre_CSRMatrixI(R_offd)[num_rows_A];
+   plan -> num_nonzeros_C  = nnz_diag_C + C_offd_i[num_rows_C];
+   plan -> col_map_offd_A  = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_A, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(plan -> col_map_offd_A, col_map_offd_A, HYPRE_BigInt, num_cols_offd_A,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * External rows of P and their value-only communication package
+    *-----------------------------------------------------------------------*/
+
+   hypre_ParcsrGetExternalRowsInit(P, num_cols_offd_A, col_map_offd_A, comm_pkg_A, 0, &request);
+   P_ext = hypre_ParcsrGetExternalRowsWait(request);
+   P_ext_big_j = hypre_CSRMatrixBigJ(P_ext);
+
+   num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+   num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+   send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_A);
+   send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A);
+   recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_A);
+   num_send_rows   = send_map_starts[num_sends];
+
+   P_ext_i = hypre_TAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(P_ext_i, hypre_CSRMatrixI(P_ext), HYPRE_Int, num_cols_offd_A + 1,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   send_starts = hypre_CTAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   recv_starts = hypre_CTAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      send_starts[i + 1] = send_starts[i];
+      for (jj = send_map_starts[i]; jj < send_map_starts[i + 1]; jj++)
+      {
+         k = send_map_elmts[jj];
+         send_starts[i + 1] += P_diag_i[k + 1] - P_diag_i[k] + P_offd_i[k + 1] - P_offd_i[k];
+      }
+   }
+   for (i = 0; i <= num_recvs; i++)
+   {
+      recv_starts[i] = P_ext_i[recv_vec_starts[i]];
+   }
+
+   plan -> P_ext_comm_pkg =
+      hypre_ParCSRRAPPlanCommPkgCreate(comm, num_sends, hypre_ParCSRCommPkgSendProcs(comm_pkg_A),
+                                       send_starts, num_recvs,
+                                       hypre_ParCSRCommPkgRecvProcs(comm_pkg_A), recv_starts);
+   plan -> P_ext_num_send_rows = num_send_rows;
+   plan -> P_ext_send_rows     = hypre_TAlloc(HYPRE_Int, num_send_rows, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(plan -> P_ext_send_rows, send_map_elmts, HYPRE_Int, num_send_rows,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   plan -> P_ext_send_data = hypre_CTAlloc(HYPRE_Complex, send_starts[num_sends], HYPRE_MEMORY_HOST);
+   plan -> P_ext_data      = hypre_CTAlloc(HYPRE_Complex, P_ext_i[num_cols_offd_A], HYPRE_MEMORY_HOST);
+   plan -> P_ext_i         = P_ext_i;
+
+   /*-----------------------------------------------------------------------
+    * Column numbering of Q: local coarse columns first, then the union of
+    * the off-processor columns of P and P_ext in increasing order
+    *-----------------------------------------------------------------------*/
+
+   col_map_offd_Q = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_P + P_ext_i[num_cols_offd_A],
+                                 HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (i = 0; i < num_cols_offd_P; i++)
+   {
+      col_map_offd_Q[cnt++] = col_map_offd_P[i];
+   }
+   for (jj = 0; jj < P_ext_i[num_cols_offd_A]; jj++)
+   {
+      if (P_ext_big_j[jj] < first_col_diag_P || P_ext_big_j[jj] > last_col_diag_P)
+      {
+         col_map_offd_Q[cnt++] = P_ext_big_j[jj];
+      }
+   }
+   num_cols_offd_Q = 0;
+   if (cnt)
+   {
+      hypre_BigQsort0(col_map_offd_Q, 0, cnt - 1);
+      num_cols_offd_Q = 1;
+      for (i = 1; i < cnt; i++)
+      {
+         if (col_map_offd_Q[i] > col_map_offd_Q[num_cols_offd_Q - 1])
+         {
+            col_map_offd_Q[num_cols_offd_Q++] = col_map_offd_Q[i];
+         }
+      }
+   }
+   num_cols_Q = num_cols_diag_P + num_cols_offd_Q;
+
+   P_offd_to_Q = hypre_TAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_P; i++)
+   {
+      P_offd_to_Q[i] = hypre_BigBinarySearch(col_map_offd_Q, col_map_offd_P[i], num_cols_offd_Q);
+   }
+
+   P_ext_j = hypre_TAlloc(HYPRE_Int, P_ext_i[num_cols_offd_A], HYPRE_MEMORY_HOST);
+   for (jj = 0; jj < P_ext_i[num_cols_offd_A]; jj++)
+   {
+      big_c = P_ext_big_j[jj];
+      if (big_c < first_col_diag_P || big_c > last_col_diag_P)
+      {
+         P_ext_j[jj] = num_cols_diag_P +
+                       hypre_BigBinarySearch(col_map_offd_Q, big_c, num_cols_offd_Q);
+      }
+      else
+      {
+         P_ext_j[jj] = (HYPRE_Int) (big_c - first_col_diag_P);
+      }
+   }
+   hypre_CSRMatrixDestroy(P_ext);
+
+   plan -> num_cols_diag_P = num_cols_diag_P;
+   plan -> num_cols_offd_Q = num_cols_offd_Q;
+   plan -> P_offd_to_Q     = P_offd_to_Q;
+   plan -> P_ext_j         = P_ext_j;
+
+   num_marker = hypre_max(num_cols_Q, num_cols_diag_C + num_cols_offd_C);
+   marker = hypre_TAlloc(HYPRE_Int, num_marker, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Pattern of Q = A P: count in the first pass, fill in the second
+    *-----------------------------------------------------------------------*/
+
+   Q_i = hypre_CTAlloc(HYPRE_Int, num_rows_A + 1, HYPRE_MEMORY_HOST);
+   Q_j = NULL;
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (c = 0; c < num_cols_Q; c++)
+      {
+         marker[c] = -1;
+      }
+      cnt = 0;
+      for (i = 0; i < num_rows_A; i++)
+      {
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            k = A_diag_j[jj];
+            for (kk = P_diag_i[k]; kk < P_diag_i[k + 1]; kk++)
+            {
+               c = P_diag_j[kk];
+               if (marker[c] != i)
+               {
+                  marker[c] = i;
+                  if (pass)
+                  {
+                     Q_j[cnt] = c;
+                  }
+                  cnt++;
+               }
+            }
+            for (kk = P_offd_i[k]; kk < P_offd_i[k + 1]; kk++)
+            {
+               c = num_cols_diag_P + P_offd_to_Q[P_offd_j[kk]];
+               if (marker[c] != i)
+               {
+                  marker[c] = i;
+                  if (pass)
+                  {
+                     Q_j[cnt] = c;
+                  }
+                  cnt++;
+               }
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            k = A_offd_j[jj];
+            for (kk = P_ext_i[k]; kk < P_ext_i[k + 1]; kk++)
+            {
+               c = P_ext_j[kk];
+               if (marker[c] != i)
+               {
+                  marker[c] = i;
+                  if (pass)
+                  {
+                     Q_j[cnt] = c;
+                  }
+                  cnt++;
+               }
+            }
+         }
+         Q_i[i + 1] = cnt;
+      }
+      if (!pass)
+      {
+         Q_j = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+      }
+   }
+   plan -> Q_i    = Q_i;
+   plan -> Q_j    = Q_j;
+   plan -> Q_data = hypre_CTAlloc(HYPRE_Complex, Q_i[num_rows_A], HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Transposes of R_diag and R_offd
+    *-----------------------------------------------------------------------*/
+
+   hypre_ParCSRRAPPlanTranspose(num_rows_A, num_cols_diag_R,
+                                hypre_CSRMatrixI(R_diag), hypre_CSRMatrixJ(R_diag),
+                                &RT_diag_i, &RT_diag_j, &(plan -> RT_diag_perm));
+   hypre_ParCSRRAPPlanTranspose(num_rows_A, num_cols_offd_R,
+                                hypre_CSRMatrixI(R_offd), hypre_CSRMatrixJ(R_offd),
+                                &RT_offd_i, &RT_offd_j, &(plan -> RT_offd_perm));
+   plan -> num_cols_diag_R = num_cols_diag_R;
+   plan -> num_cols_offd_R = num_cols_offd_R;
+   plan -> RT_diag_i       = RT_diag_i;
+   plan -> RT_diag_j       = RT_diag_j;
+   plan -> RT_diag_data    = hypre_CTAlloc(HYPRE_Complex, RT_diag_i[num_cols_diag_R], HYPRE_MEMORY_HOST);
+   plan -> RT_offd_i       = RT_offd_i;
+   plan -> RT_offd_j       = RT_offd_j;
+   plan -> RT_offd_data    = hypre_CTAlloc(HYPRE_Complex, RT_offd_i[num_cols_offd_R], HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Pattern of C_int = R_offd^T Q, the rows sent to the owners of the
+    * off-processor columns of R
+    *-----------------------------------------------------------------------*/
+
+   C_int_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_R + 1, HYPRE_MEMORY_HOST);
+   C_int_j = NULL;
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (c = 0; c < num_cols_Q; c++)
+      {
+         marker[c] = -1;
+      }
+      cnt = 0;
+      for (ii = 0; ii < num_cols_offd_R; ii++)
+      {
+         for (jj = RT_offd_i[ii]; jj < RT_offd_i[ii + 1]; jj++)
+         {
+            i = RT_offd_j[jj];
+            for (kk = Q_i[i]; kk < Q_i[i + 1]; kk++)
+            {
+               c = Q_j[kk];
+               if (marker[c] != ii)
+               {
+                  marker[c] = ii;
+                  if (pass)
+                  {
+                     C_int_j[cnt] = c;
+                  }
+                  cnt++;
+               }
+            }
+         }
+         C_int_i[ii + 1] = cnt;
+      }
+      if (!pass)
+      {
+         C_int_j = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+      }
+   }
+   plan -> C_int_i    = C_int_i;
+   plan -> C_int_j    = C_int_j;
+   plan -> C_int_data = hypre_CTAlloc(HYPRE_Complex, C_int_i[num_cols_offd_R], HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Send the pattern of C_int to the owning processors (the reverse of
+    * the communication package of R) and set up the value exchange
+    *-----------------------------------------------------------------------*/
+
+   num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_R);
+   num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_R);
+   send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_R);
+   send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_R);
+   recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_R);
+   num_send_rows   = send_map_starts[num_sends];
+
+   {
+      HYPRE_Int *C_int_rownnz = hypre_TAlloc(HYPRE_Int, num_cols_offd_R, HYPRE_MEMORY_HOST);
+
+      for (ii = 0; ii < num_cols_offd_R; ii++)
+      {
+         C_int_rownnz[ii] = C_int_i[ii + 1] - C_int_i[ii];
+      }
+      C_ext_i = hypre_CTAlloc(HYPRE_Int, num_send_rows + 1, HYPRE_MEMORY_HOST);
+      comm_handle = hypre_ParCSRCommHandleCreate(12, comm_pkg_R, C_int_rownnz, C_ext_i + 1);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      hypre_TFree(C_int_rownnz, HYPRE_MEMORY_HOST);
+   }
+   for (i = 0; i < num_send_rows; i++)
+   {
+      C_ext_i[i + 1] += C_ext_i[i];
+   }
+
+   send_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   recv_starts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_recvs; i++)
+   {
+      send_starts[i] = C_int_i[recv_vec_starts[i]];
+   }
+   for (i = 0; i <= num_sends; i++)
+   {
+      recv_starts[i] = C_ext_i[send_map_starts[i]];
+   }
+   /* note that the order of send/recv is reversed */
+   plan -> C_ext_comm_pkg =
+      hypre_ParCSRRAPPlanCommPkgCreate(comm, num_recvs, hypre_ParCSRCommPkgRecvProcs(comm_pkg_R),
+                                       send_starts, num_sends,
+                                       hypre_ParCSRCommPkgSendProcs(comm_pkg_R), recv_starts);
+   plan -> C_ext_size = C_ext_i[num_send_rows];
+   plan -> C_ext_data = hypre_CTAlloc(HYPRE_Complex, C_ext_i[num_send_rows], HYPRE_MEMORY_HOST);
+
+   C_int_big_j = hypre_TAlloc(HYPRE_BigInt, C_int_i[num_cols_offd_R], HYPRE_MEMORY_HOST);
+   C_ext_big_j = hypre_TAlloc(HYPRE_BigInt, C_ext_i[num_send_rows], HYPRE_MEMORY_HOST);
+   for (jj = 0; jj < C_int_i[num_cols_offd_R]; jj++)
+   {
+      c = C_int_j[jj];
+      C_int_big_j[jj] = (c < num_cols_diag_P) ? first_col_diag_P + (HYPRE_BigInt) c :
+                        col_map_offd_Q[c - num_cols_diag_P];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(21, plan -> C_ext_comm_pkg, C_int_big_j, C_ext_big_j);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   hypre_TFree(C_int_big_j, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Locate every contribution in C.  C rows are marked with the position
+    * of their entries: k for C_diag, nnz_diag_C + k for C_offd.
+    *-----------------------------------------------------------------------*/
+
+   mismatch = 0;
+
+   Q_to_C = hypre_TAlloc(HYPRE_Int, num_cols_Q, HYPRE_MEMORY_HOST);
+   for (c = 0; c < num_cols_diag_P; c++)
+   {
+      Q_to_C[c] = c;
+   }
+   for (c = 0; c < num_cols_offd_Q; c++)
+   {
+      k = hypre_BigBinarySearch(col_map_offd_C, col_map_offd_Q[c], num_cols_offd_C);
+      Q_to_C[num_cols_diag_P + c] = (k < 0) ? -1 : num_cols_diag_C + k;
+   }
+   plan -> num_cols_diag_C = num_cols_diag_C;
+   plan -> num_cols_offd_C = num_cols_offd_C;
+   plan -> Q_to_C          = Q_to_C;
+
+   for (c = 0; c < num_cols_diag_C + num_cols_offd_C; c++)
+   {
+      marker[c] = -1;
+   }
+
+   C_ext_pos = hypre_CTAlloc(HYPRE_Int, C_ext_i[num_send_rows], HYPRE_MEMORY_HOST);
+   for (ii = 0; ii < num_send_rows && !mismatch; ii++)
+   {
+      i = send_map_elmts[ii];
+      for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+      {
+         marker[C_diag_j[jj]] = jj;
+      }
+      for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+      {
+         marker[num_cols_diag_C + C_offd_j[jj]] = nnz_diag_C + jj;
+      }
+      for (jj = C_ext_i[ii]; jj < C_ext_i[ii + 1]; jj++)
+      {
+         big_c = C_ext_big_j[jj];
+         if (big_c < first_col_diag_C || big_c > last_col_diag_C)
+         {
+            k = hypre_BigBinarySearch(col_map_offd_C, big_c, num_cols_offd_C);
+            c = (k < 0) ? -1 : num_cols_diag_C + k;
+         }
+         else
+         {
+            c = (HYPRE_Int) (big_c - first_col_diag_C);
+         }
+         if (c < 0 || marker[c] < 0)
+         {
+            mismatch = 1;
+            break;
+         }
+         C_ext_pos[jj] = marker[c];
+      }
+      for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+      {
+         marker[C_diag_j[jj]] = -1;
+      }
+      for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+      {
+         marker[num_cols_diag_C + C_offd_j[jj]] = -1;
+      }
+   }
+   plan -> C_ext_pos = C_ext_pos;
+   hypre_TFree(C_ext_big_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(C_ext_i, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows_C && !mismatch; i++)
+   {
+      for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+      {
+         marker[C_diag_j[jj]] = jj;
+      }
+      for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+      {
+         marker[num_cols_diag_C + C_offd_j[jj]] = nnz_diag_C + jj;
+      }
+      for (jj = RT_diag_i[i]; jj < RT_diag_i[i + 1] && !mismatch; jj++)
+      {
+         ii = RT_diag_j[jj];
+         for (kk = Q_i[ii]; kk < Q_i[ii + 1]; kk++)
+         {
+            c = Q_to_C[Q_j[kk]];
+            if (c < 0 || marker[c] < 0)
+            {
+               mismatch = 1;
+               break;
+            }
+         }
+      }
+      for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+      {
+         marker[C_diag_j[jj]] = -1;
+      }
+      for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+      {
+         marker[num_cols_diag_C + C_offd_j[jj]] = -1;
+      }
+   }
+
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(col_map_offd_Q, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Allreduce(&mismatch, &any_mismatch, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (any_mismatch)
+   {
+      hypre_ParCSRRAPPlanDestroy(plan);
+      return hypre_error_flag;
+   }
+
+   *plan_ptr = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanDestroy( hypre_ParCSRRAPPlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(plan -> col_map_offd_A, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> P_offd_to_Q, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> Q_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> Q_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> Q_data, HYPRE_MEMORY_HOST);
+      if (plan -> P_ext_comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(plan -> P_ext_comm_pkg);
+      }
+      hypre_TFree(plan -> P_ext_send_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> P_ext_send_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> P_ext_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> P_ext_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> P_ext_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> RT_diag_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> RT_diag_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> RT_diag_perm, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> RT_diag_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> RT_offd_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> RT_offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> RT_offd_perm, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> RT_offd_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_int_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_int_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_int_data, HYPRE_MEMORY_HOST);
+      if (plan -> C_ext_comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(plan -> C_ext_comm_pkg);
+      }
+      hypre_TFree(plan -> C_ext_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_ext_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> Q_to_C, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPNumeric
+ *
+ * Overwrites the values of C with R^T A P, using a plan built by
+ * hypre_ParCSRRAPPlanCreate for matrices with the same sparsity patterns.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRAPNumeric( hypre_ParCSRRAPPlan *plan,
+                              hypre_ParCSRMatrix  *R,
+                              hypre_ParCSRMatrix  *A,
+                              hypre_ParCSRMatrix  *P,
+                              hypre_ParCSRMatrix  *C )
+{
+   hypre_CSRMatrix        *A_diag      = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int              *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex          *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int              *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex          *A_offd_data = hypre_CSRMatrixData(A_offd);
+
+   hypre_CSRMatrix        *P_diag      = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrix        *P_offd      = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int              *P_diag_i    = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int              *P_diag_j    = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex          *P_diag_data = hypre_CSRMatrixData(P_diag);
+   HYPRE_Int              *P_offd_i    = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int              *P_offd_j    = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex          *P_offd_data = hypre_CSRMatrixData(P_offd);
+
+   HYPRE_Complex          *R_diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(R));
+   HYPRE_Complex          *R_offd_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(R));
+
+   hypre_CSRMatrix        *C_diag      = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrix        *C_offd      = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int              *C_diag_i    = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int              *C_diag_j    = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex          *C_diag_data = hypre_CSRMatrixData(C_diag);
+   HYPRE_Int              *C_offd_i    = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int              *C_offd_j    = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex          *C_offd_data = hypre_CSRMatrixData(C_offd);
+   HYPRE_Int               num_rows_C  = hypre_CSRMatrixNumRows(C_diag);
+
+   HYPRE_Int               num_rows_A      = plan -> num_rows_A;
+   HYPRE_Int               num_cols_diag_P = plan -> num_cols_diag_P;
+   HYPRE_Int               num_cols_Q      = num_cols_diag_P + plan -> num_cols_offd_Q;
+   HYPRE_Int               num_cols_diag_C = plan -> num_cols_diag_C;
+   HYPRE_Int               num_cols_C      = num_cols_diag_C + plan -> num_cols_offd_C;
+   HYPRE_Int               nnz_diag_C      = C_diag_i[num_rows_C];
+   HYPRE_Int              *P_offd_to_Q     = plan -> P_offd_to_Q;
+   HYPRE_Int              *P_ext_i         = plan -> P_ext_i;
+   HYPRE_Int              *P_ext_j         = plan -> P_ext_j;
+   HYPRE_Complex          *P_ext_data      = plan -> P_ext_data;
+   HYPRE_Complex          *P_ext_send_data = plan -> P_ext_send_data;
+   HYPRE_Int              *P_ext_send_rows = plan -> P_ext_send_rows;
+   HYPRE_Int              *Q_i             = plan -> Q_i;
+   HYPRE_Int              *Q_j             = plan -> Q_j;
+   HYPRE_Complex          *Q_data          = plan -> Q_data;
+   HYPRE_Int              *RT_diag_i       = plan -> RT_diag_i;
+   HYPRE_Int              *RT_diag_j       = plan -> RT_diag_j;
+   HYPRE_Complex          *RT_diag_data    = plan -> RT_diag_data;
+   HYPRE_Int              *RT_offd_i       = plan -> RT_offd_i;
+   HYPRE_Int              *RT_offd_j       = plan -> RT_offd_j;
+   HYPRE_Complex          *RT_offd_data    = plan -> RT_offd_data;
+   HYPRE_Int              *C_int_i         = plan -> C_int_i;
+   HYPRE_Int              *C_int_j         = plan -> C_int_j;
+   HYPRE_Complex          *C_int_data      = plan -> C_int_data;
+   HYPRE_Int              *C_ext_pos       = plan -> C_ext_pos;
+   HYPRE_Complex          *C_ext_data      = plan -> C_ext_data;
+   HYPRE_Int              *Q_to_C          = plan -> Q_to_C;
+   HYPRE_Int               num_cols_diag_R = plan -> num_cols_diag_R;
+   HYPRE_Int               num_cols_offd_R = plan -> num_cols_offd_R;
+
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int               i, jj, kk, cnt;
+
+   if ( hypre_CSRMatrixNumRows(A_diag) != num_rows_A ||
+        hypre_CSRMatrixNumCols(A_offd) != plan -> num_cols_offd_A ||
+        A_diag_i[num_rows_A] + A_offd_i[num_rows_A] != plan -> num_nonzeros_A ||
+        P_diag_i[hypre_CSRMatrixNumRows(P_diag)] +
+        P_offd_i[hypre_CSRMatrixNumRows(P_offd)] != plan -> num_nonzeros_P ||
+        hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(R))[num_rows_A] +
+        hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(R))[num_rows_A] != plan -> num_nonzeros_R ||
+        nnz_diag_C + C_offd_i[num_rows_C] != plan -> num_nonzeros_C )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "RAP plan does not match the matrix structure!\n");
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Exchange the values of the external rows of P, same packing as in
+    * hypre_ParcsrGetExternalRowsInit: the diag entries, then the offd entries
+    *-----------------------------------------------------------------------*/
+
+   cnt = 0;
+   for (i = 0; i < plan -> P_ext_num_send_rows; i++)
+   {
+      HYPRE_Int row = P_ext_send_rows[i];
+
+      for (jj = P_diag_i[row]; jj < P_diag_i[row + 1]; jj++)
+      {
+         P_ext_send_data[cnt++] = P_diag_data[jj];
+      }
+      for (jj = P_offd_i[row]; jj < P_offd_i[row + 1]; jj++)
+      {
+         P_ext_send_data[cnt++] = P_offd_data[jj];
+      }
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(1, plan -> P_ext_comm_pkg, P_ext_send_data, P_ext_data);
+
+   /* overlap: values of the transposes of R */
+   for (jj = 0; jj < RT_diag_i[num_cols_diag_R]; jj++)
+   {
+      RT_diag_data[jj] = R_diag_data[plan -> RT_diag_perm[jj]];
+   }
+   for (jj = 0; jj < RT_offd_i[num_cols_offd_R]; jj++)
+   {
+      RT_offd_data[jj] = R_offd_data[plan -> RT_offd_perm[jj]];
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /*-----------------------------------------------------------------------
+    * Q = A P
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, jj, kk)
+#endif
+   {
+      HYPRE_Int     *marker = hypre_TAlloc(HYPRE_Int, num_cols_Q, HYPRE_MEMORY_HOST);
+      HYPRE_Int      ns, ne, k;
+      HYPRE_Complex  a_entry;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows_A);
+
+      for (i = ns; i < ne; i++)
+      {
+         for (jj = Q_i[i]; jj < Q_i[i + 1]; jj++)
+         {
+            marker[Q_j[jj]] = jj;
+            Q_data[jj] = 0.0;
+         }
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            k = A_diag_j[jj];
+            a_entry = A_diag_data[jj];
+            for (kk = P_diag_i[k]; kk < P_diag_i[k + 1]; kk++)
+            {
+               Q_data[marker[P_diag_j[kk]]] += a_entry * P_diag_data[kk];
+            }
+            for (kk = P_offd_i[k]; kk < P_offd_i[k + 1]; kk++)
+            {
+               Q_data[marker[num_cols_diag_P + P_offd_to_Q[P_offd_j[kk]]]] +=
+                  a_entry * P_offd_data[kk];
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            k = A_offd_j[jj];
+            a_entry = A_offd_data[jj];
+            for (kk = P_ext_i[k]; kk < P_ext_i[k + 1]; kk++)
+            {
+               Q_data[marker[P_ext_j[kk]]] += a_entry * P_ext_data[kk];
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------------------
+    * C_int = R_offd^T Q, sent to the owning processors
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, jj, kk)
+#endif
+   {
+      HYPRE_Int     *marker = hypre_TAlloc(HYPRE_Int, num_cols_Q, HYPRE_MEMORY_HOST);
+      HYPRE_Int      ns, ne, k;
+      HYPRE_Complex  r_entry;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_cols_offd_R);
+
+      for (i = ns; i < ne; i++)
+      {
+         for (jj = C_int_i[i]; jj < C_int_i[i + 1]; jj++)
+         {
+            marker[C_int_j[jj]] = jj;
+            C_int_data[jj] = 0.0;
+         }
+         for (jj = RT_offd_i[i]; jj < RT_offd_i[i + 1]; jj++)
+         {
+            k = RT_offd_j[jj];
+            r_entry = RT_offd_data[jj];
+            for (kk = Q_i[k]; kk < Q_i[k + 1]; kk++)
+            {
+               C_int_data[marker[Q_j[kk]]] += r_entry * Q_data[kk];
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, plan -> C_ext_comm_pkg, C_int_data, C_ext_data);
+
+   /*-----------------------------------------------------------------------
+    * Local part C = R_diag^T Q, overlapped with the exchange of C_int
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, jj, kk)
+#endif
+   {
+      HYPRE_Int     *marker = hypre_TAlloc(HYPRE_Int, num_cols_C, HYPRE_MEMORY_HOST);
+      HYPRE_Int      ns, ne, k, pos;
+      HYPRE_Complex  r_entry;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows_C);
+
+      for (i = ns; i < ne; i++)
+      {
+         for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+         {
+            marker[C_diag_j[jj]] = jj;
+            C_diag_data[jj] = 0.0;
+         }
+         for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+         {
+            marker[num_cols_diag_C + C_offd_j[jj]] = nnz_diag_C + jj;
+            C_offd_data[jj] = 0.0;
+         }
+         for (jj = RT_diag_i[i]; jj < RT_diag_i[i + 1]; jj++)
+         {
+            k = RT_diag_j[jj];
+            r_entry = RT_diag_data[jj];
+            for (kk = Q_i[k]; kk < Q_i[k + 1]; kk++)
+            {
+               pos = marker[Q_to_C[Q_j[kk]]];
+               if (pos < nnz_diag_C)
+               {
+                  C_diag_data[pos] += r_entry * Q_data[kk];
+               }
+               else
+               {
+                  C_offd_data[pos - nnz_diag_C] += r_entry * Q_data[kk];
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* add the contributions from other processors */
+   for (jj = 0; jj < plan -> C_ext_size; jj++)
+   {
+      kk = C_ext_pos[jj];
+      if (kk < nnz_diag_C)
+      {
+         C_diag_data[kk] += C_ext_data[jj];
+      }
+      else
+      {
+         C_offd_data[kk - nnz_diag_C] += C_ext_data[jj];
+      }
+   }
+
+   hypre_CSRMatrixResetSell(hypre_ParCSRMatrixDiag(C));
+   hypre_CSRMatrixResetSell(hypre_ParCSRMatrixOffd(C));
+
+   return hypre_error_flag;
+}
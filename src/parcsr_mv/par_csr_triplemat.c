@@ -498,11 +498,68 @@ hypre_ParCSRTMatMat( hypre_ParCSRMatrix  *A,
    return hypre_ParCSRTMatMatKT( A, B, 0);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_RAPMemoryAdd, hypre_RAPMemorySub : bookkeeping of the storage (in
+ * bytes) of the intermediate matrices of the triple products below, used
+ * to report their high-water mark
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_RAPMemorySize( hypre_CSRMatrix *A )
+{
+   HYPRE_Real bytes, nnz;
+
+   if (!A)
+   {
+      return 0.0;
+   }
+
+   nnz   = (HYPRE_Real) hypre_CSRMatrixNumNonzeros(A);
+   bytes = (HYPRE_Real) (hypre_CSRMatrixNumRows(A) + 1) * sizeof(HYPRE_Int);
+   if (hypre_CSRMatrixJ(A))
+   {
+      bytes += nnz * sizeof(HYPRE_Int);
+   }
+   if (hypre_CSRMatrixBigJ(A))
+   {
+      bytes += nnz * sizeof(HYPRE_BigInt);
+   }
+   if (hypre_CSRMatrixData(A))
+   {
+      bytes += nnz * sizeof(HYPRE_Complex);
+   }
+
+   return bytes;
+}
+
+static void
+hypre_RAPMemoryAdd( HYPRE_Real      *mem,
+                    HYPRE_Real      *peak,
+                    hypre_CSRMatrix *A )
+{
+   *mem += hypre_RAPMemorySize(A);
+   *peak = hypre_max(*peak, *mem);
+}
+
+static void
+hypre_RAPMemorySub( HYPRE_Real      *mem,
+                    hypre_CSRMatrix *A )
+{
+   *mem -= hypre_RAPMemorySize(A);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPKTHost : computes C = R^T*A*P as R^T*(A*P).
+ * If peak_memory is not NULL, it returns the high-water mark (in bytes) of
+ * the matrices allocated during the product.
+ *--------------------------------------------------------------------------*/
+
 hypre_ParCSRMatrix*
 hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
                              hypre_ParCSRMatrix *A,
                              hypre_ParCSRMatrix *P,
-                             HYPRE_Int           keep_transpose )
+                             HYPRE_Int           keep_transpose,
+                             HYPRE_Real         *peak_memory )
 {
    MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
 
@@ -582,6 +639,7 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
    HYPRE_BigInt     n_rows_A, n_cols_A;
    HYPRE_BigInt     n_rows_P, n_cols_P;
    HYPRE_Int        cnt, i;
+   HYPRE_Real       mem = 0.0, peak = 0.0;
 
    n_rows_R = hypre_ParCSRMatrixGlobalNumRows(R);
    n_cols_R = hypre_ParCSRMatrixGlobalNumCols(R);
@@ -628,15 +686,22 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
        *--------------------------------------------------------------------*/
       Ps_ext = hypre_ParCSRMatrixExtractBExt(P, A, 1); /* contains communication
                                                           which should be explicitly included to allow for overlap */
+      hypre_RAPMemoryAdd(&mem, &peak, Ps_ext);
       if (num_cols_offd_A)
       {
          last_col_diag_P = first_col_diag_P + num_cols_diag_P -1;
          hypre_CSRMatrixSplit(Ps_ext, first_col_diag_P, last_col_diag_P, num_cols_offd_P, col_map_offd_P,
                               &num_cols_offd_Q, &col_map_offd_Q, &Pext_diag, &Pext_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, Pext_diag);
+         hypre_RAPMemoryAdd(&mem, &peak, Pext_offd);
          /* These require data from other processes */
          APext_diag = hypre_CSRMatrixMultiply(A_offd, Pext_diag);
          APext_offd = hypre_CSRMatrixMultiply(A_offd, Pext_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, APext_diag);
+         hypre_RAPMemoryAdd(&mem, &peak, APext_offd);
 
+         hypre_RAPMemorySub(&mem, Pext_diag);
+         hypre_RAPMemorySub(&mem, Pext_offd);
          hypre_CSRMatrixDestroy(Pext_diag);
          hypre_CSRMatrixDestroy(Pext_offd);
       }
@@ -649,14 +714,17 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
             col_map_offd_Q[i] = col_map_offd_P[i];
          }
       }
+      hypre_RAPMemorySub(&mem, Ps_ext);
       hypre_CSRMatrixDestroy(Ps_ext);
       /* These are local and could be overlapped with communication */
       AP_diag = hypre_CSRMatrixMultiply(A_diag, P_diag);
+      hypre_RAPMemoryAdd(&mem, &peak, AP_diag);
 
       if (num_cols_offd_P)
       {
          HYPRE_Int i;
          AP_offd = hypre_CSRMatrixMultiply(A_diag, P_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, AP_offd);
          if (num_cols_offd_Q > num_cols_offd_P)
          {
             map_P_to_Q = hypre_CTAlloc(HYPRE_Int,num_cols_offd_P, HYPRE_MEMORY_HOST);
@@ -688,6 +756,9 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       if (num_cols_offd_A) /* number of rows for Pext_diag */
       {
          Q_diag = hypre_CSRMatrixAdd(AP_diag, APext_diag);
+         hypre_RAPMemoryAdd(&mem, &peak, Q_diag);
+         hypre_RAPMemorySub(&mem, AP_diag);
+         hypre_RAPMemorySub(&mem, APext_diag);
          hypre_CSRMatrixDestroy(AP_diag);
          hypre_CSRMatrixDestroy(APext_diag);
       }
@@ -699,6 +770,9 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       if (num_cols_offd_P && num_cols_offd_A)
       {
          Q_offd = hypre_CSRMatrixAdd(AP_offd, APext_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, Q_offd);
+         hypre_RAPMemorySub(&mem, AP_offd);
+         hypre_RAPMemorySub(&mem, APext_offd);
          hypre_CSRMatrixDestroy(APext_offd);
          hypre_CSRMatrixDestroy(AP_offd);
       }
@@ -713,6 +787,7 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       else
       {
          Q_offd = hypre_CSRMatrixClone(A_offd, 1);
+         hypre_RAPMemoryAdd(&mem, &peak, Q_offd);
       }
 
       Q = hypre_ParCSRMatrixCreate(comm, n_rows_A, n_cols_P, row_starts_A,
@@ -729,10 +804,13 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       hypre_ParCSRMatrixColMapOffd(Q) = col_map_offd_Q;
 
       hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
+      hypre_RAPMemoryAdd(&mem, &peak, RT_diag);
       C_tmp_diag = hypre_CSRMatrixMultiply(RT_diag, Q_diag);
+      hypre_RAPMemoryAdd(&mem, &peak, C_tmp_diag);
       if (num_cols_offd_Q)
       {
          C_tmp_offd = hypre_CSRMatrixMultiply(RT_diag, Q_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, C_tmp_offd);
          /* RL: WHY NEED THIS?
          if (C_tmp_offd->num_nonzeros == 0)
          {
@@ -744,6 +822,7 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       {
          C_tmp_offd = hypre_CSRMatrixClone(Q_offd, 1);
          hypre_CSRMatrixNumRows(C_tmp_offd) = num_cols_diag_R;
+         hypre_RAPMemoryAdd(&mem, &peak, C_tmp_offd);
       }
 
       if (keep_transpose)
@@ -752,6 +831,7 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       }
       else
       {
+         hypre_RAPMemorySub(&mem, RT_diag);
          hypre_CSRMatrixDestroy(RT_diag);
       }
 
@@ -760,10 +840,14 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
          hypre_CSRMatrixTranspose(R_offd, &RT_offd, 1);
          C_int_diag = hypre_CSRMatrixMultiply(RT_offd, Q_diag);
          C_int_offd = hypre_CSRMatrixMultiply(RT_offd, Q_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, RT_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, C_int_diag);
+         hypre_RAPMemoryAdd(&mem, &peak, C_int_offd);
 
          hypre_ParCSRMatrixDiag(Q) = C_int_diag;
          hypre_ParCSRMatrixOffd(Q) = C_int_offd;
          C_int = hypre_MergeDiagAndOffd(Q);
+         hypre_RAPMemoryAdd(&mem, &peak, C_int);
          hypre_ParCSRMatrixDiag(Q) = Q_diag;
          hypre_ParCSRMatrixOffd(Q) = Q_offd;
       }
@@ -776,10 +860,14 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       /* contains communication; should be explicitly included to allow for overlap */
       hypre_ExchangeExternalRowsInit(C_int, comm_pkg_R, &request);
       C_ext = hypre_ExchangeExternalRowsWait(request);
+      hypre_RAPMemoryAdd(&mem, &peak, C_ext);
 
+      hypre_RAPMemorySub(&mem, C_int);
       hypre_CSRMatrixDestroy(C_int);
       if (num_cols_offd_R)
       {
+         hypre_RAPMemorySub(&mem, C_int_diag);
+         hypre_RAPMemorySub(&mem, C_int_offd);
          hypre_CSRMatrixDestroy(C_int_diag);
          hypre_CSRMatrixDestroy(C_int_offd);
          if (keep_transpose)
@@ -788,6 +876,7 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
          }
          else
          {
+            hypre_RAPMemorySub(&mem, RT_offd);
             hypre_CSRMatrixDestroy(RT_offd);
          }
       }
@@ -808,7 +897,10 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
          hypre_CSRMatrixSplit(C_ext, first_col_diag_C, last_col_diag_C,
                               num_cols_offd_Q, col_map_offd_Q, &num_cols_offd_C, &col_map_offd_C,
                               &C_ext_diag, &C_ext_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, C_ext_diag);
+         hypre_RAPMemoryAdd(&mem, &peak, C_ext_offd);
 
+         hypre_RAPMemorySub(&mem, C_ext);
          hypre_CSRMatrixDestroy(C_ext);
          C_ext = NULL;
          /*if (C_ext_offd->num_nonzeros == 0) C_ext_offd->num_cols = 0;*/
@@ -841,6 +933,8 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
          hypre_TFree(map_Q_to_C, HYPRE_MEMORY_HOST);
          hypre_CSRMatrixNumCols(C_tmp_offd) = num_cols_offd_C;
       }
+      hypre_RAPMemorySub(&mem, Q_diag);
+      hypre_RAPMemorySub(&mem, Q_offd);
       hypre_ParCSRMatrixDestroy(Q);
 
       /*-----------------------------------------------------------------------
@@ -851,6 +945,9 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       if (C_ext_diag)
       {
          C_diag = hypre_CSRMatrixAddPartial(C_tmp_diag, C_ext_diag, send_map_elmts_R);
+         hypre_RAPMemoryAdd(&mem, &peak, C_diag);
+         hypre_RAPMemorySub(&mem, C_tmp_diag);
+         hypre_RAPMemorySub(&mem, C_ext_diag);
          hypre_CSRMatrixDestroy(C_tmp_diag);
          hypre_CSRMatrixDestroy(C_ext_diag);
       }
@@ -861,6 +958,9 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       if (C_ext_offd)
       {
          C_offd = hypre_CSRMatrixAddPartial(C_tmp_offd, C_ext_offd, send_map_elmts_R);
+         hypre_RAPMemoryAdd(&mem, &peak, C_offd);
+         hypre_RAPMemorySub(&mem, C_tmp_offd);
+         hypre_RAPMemorySub(&mem, C_ext_offd);
          hypre_CSRMatrixDestroy(C_tmp_offd);
          hypre_CSRMatrixDestroy(C_ext_offd);
       }
@@ -874,6 +974,9 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       Q_diag = hypre_CSRMatrixMultiply(A_diag, P_diag);
       hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
       C_diag = hypre_CSRMatrixMultiply(RT_diag, Q_diag);
+      hypre_RAPMemoryAdd(&mem, &peak, Q_diag);
+      hypre_RAPMemoryAdd(&mem, &peak, RT_diag);
+      hypre_RAPMemoryAdd(&mem, &peak, C_diag);
       C_offd = hypre_CSRMatrixCreate(num_cols_diag_R, 0, 0);
       hypre_CSRMatrixInitialize_v2(C_offd, 0, hypre_CSRMatrixMemoryLocation(C_diag));
       if (keep_transpose)
@@ -917,14 +1020,699 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       hypre_MatvecCommPkgCreate(C);
    }
 
+   if (peak_memory)
+   {
+      *peak_memory = peak;
+   }
+
    return C;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPFusedRows
+ *
+ * Computes the rows of RT*A*P given by the rows of RT (the transpose of the
+ * diag or offd part of R) without forming A*P. Each row is assembled from
+ * the fine rows it couples to in a marker array of length
+ * num_cols_diag_P + num_cols_offd_Q, the only scratch used.
+ * Columns of the diag part of P are local, those of P_offd are mapped to
+ * the Q numbering by map_P_to_Q (or left as is if map_P_to_Q is NULL), and
+ * Pext_diag/Pext_offd are the external rows of P for the columns of A_offd.
+ * If diag_first is set, row i of C_diag starts with column i.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixRAPFusedRows( hypre_CSRMatrix  *RT,
+                                hypre_CSRMatrix  *A_diag,
+                                hypre_CSRMatrix  *A_offd,
+                                hypre_CSRMatrix  *P_diag,
+                                hypre_CSRMatrix  *P_offd,
+                                HYPRE_Int        *map_P_to_Q,
+                                hypre_CSRMatrix  *Pext_diag,
+                                hypre_CSRMatrix  *Pext_offd,
+                                HYPRE_Int         num_cols_offd_Q,
+                                HYPRE_Int         diag_first,
+                                hypre_CSRMatrix **C_diag_ptr,
+                                hypre_CSRMatrix **C_offd_ptr )
+{
+   HYPRE_Int        num_rows_C      = hypre_CSRMatrixNumRows(RT);
+   HYPRE_Int        num_cols_diag_C = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int       *RT_i            = hypre_CSRMatrixI(RT);
+   HYPRE_Int       *RT_j            = hypre_CSRMatrixJ(RT);
+   HYPRE_Complex   *RT_data         = hypre_CSRMatrixData(RT);
+   HYPRE_Int       *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex   *A_diag_data     = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_offd_i        = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j        = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex   *A_offd_data     = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int        num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int       *P_diag_i        = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j        = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex   *P_diag_data     = hypre_CSRMatrixData(P_diag);
+   HYPRE_Int       *P_offd_i        = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int       *P_offd_j        = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex   *P_offd_data     = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int       *Pext_diag_i     = NULL;
+   HYPRE_Int       *Pext_diag_j     = NULL;
+   HYPRE_Complex   *Pext_diag_data  = NULL;
+   HYPRE_Int       *Pext_offd_i     = NULL;
+   HYPRE_Int       *Pext_offd_j     = NULL;
+   HYPRE_Complex   *Pext_offd_data  = NULL;
+
+   hypre_CSRMatrix *C_diag, *C_offd;
+   HYPRE_Int       *C_diag_i, *C_offd_i;
+   HYPRE_Int       *C_diag_j = NULL, *C_offd_j = NULL;
+   HYPRE_Complex   *C_diag_data = NULL, *C_offd_data = NULL;
+
+   HYPRE_Int        num_threads = hypre_NumThreads();
+   HYPRE_Int       *diag_count, *offd_count;
+
+   HYPRE_MemoryLocation memory_location_C = hypre_CSRMatrixMemoryLocation(A_diag);
+
+   if (num_cols_offd_A)
+   {
+      Pext_diag_i    = hypre_CSRMatrixI(Pext_diag);
+      Pext_diag_j    = hypre_CSRMatrixJ(Pext_diag);
+      Pext_diag_data = hypre_CSRMatrixData(Pext_diag);
+      Pext_offd_i    = hypre_CSRMatrixI(Pext_offd);
+      Pext_offd_j    = hypre_CSRMatrixJ(Pext_offd);
+      Pext_offd_data = hypre_CSRMatrixData(Pext_offd);
+   }
+
+   C_diag_i   = hypre_CTAlloc(HYPRE_Int, num_rows_C+1, memory_location_C);
+   C_offd_i   = hypre_CTAlloc(HYPRE_Int, num_rows_C+1, memory_location_C);
+   diag_count = hypre_CTAlloc(HYPRE_Int, num_threads, HYPRE_MEMORY_HOST);
+   offd_count = hypre_CTAlloc(HYPRE_Int, num_threads, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      HYPRE_Int     *marker;
+      HYPRE_Int      ns, ne, ii, i1, i, k, kk, ja, jp, jj, col;
+      HYPRE_Int      diag_start, offd_start, cnt_diag, cnt_offd;
+      HYPRE_Complex  r_entry, ra_entry;
+
+      ii = hypre_GetThreadNum();
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows_C);
+
+      /* marker[col] is the position of col in the current row (diag columns
+       * first, then offd columns shifted by num_cols_diag_C) */
+      marker = hypre_TAlloc(HYPRE_Int, num_cols_diag_C + num_cols_offd_Q, HYPRE_MEMORY_HOST);
+      for (i1 = 0; i1 < num_cols_diag_C + num_cols_offd_Q; i1++)
+      {
+         marker[i1] = -1;
+      }
+
+      /* first pass: count the nonzeros of each row */
+      cnt_diag = 0;
+      cnt_offd = 0;
+      for (i = ns; i < ne; i++)
+      {
+         diag_start = cnt_diag;
+         offd_start = cnt_offd;
+         C_diag_i[i] = cnt_diag;
+         C_offd_i[i] = cnt_offd;
+         if (diag_first)
+         {
+            marker[i] = cnt_diag++;
+         }
+         for (kk = RT_i[i]; kk < RT_i[i+1]; kk++)
+         {
+            k = RT_j[kk];
+            for (ja = A_diag_i[k]; ja < A_diag_i[k+1]; ja++)
+            {
+               jj = A_diag_j[ja];
+               for (jp = P_diag_i[jj]; jp < P_diag_i[jj+1]; jp++)
+               {
+                  col = P_diag_j[jp];
+                  if (marker[col] < diag_start)
+                  {
+                     marker[col] = cnt_diag++;
+                  }
+               }
+               for (jp = P_offd_i[jj]; jp < P_offd_i[jj+1]; jp++)
+               {
+                  col = num_cols_diag_C + (map_P_to_Q ? map_P_to_Q[P_offd_j[jp]] : P_offd_j[jp]);
+                  if (marker[col] < offd_start)
+                  {
+                     marker[col] = cnt_offd++;
+                  }
+               }
+            }
+            if (num_cols_offd_A)
+            {
+               for (ja = A_offd_i[k]; ja < A_offd_i[k+1]; ja++)
+               {
+                  jj = A_offd_j[ja];
+                  for (jp = Pext_diag_i[jj]; jp < Pext_diag_i[jj+1]; jp++)
+                  {
+                     col = Pext_diag_j[jp];
+                     if (marker[col] < diag_start)
+                     {
+                        marker[col] = cnt_diag++;
+                     }
+                  }
+                  for (jp = Pext_offd_i[jj]; jp < Pext_offd_i[jj+1]; jp++)
+                  {
+                     col = num_cols_diag_C + Pext_offd_j[jp];
+                     if (marker[col] < offd_start)
+                     {
+                        marker[col] = cnt_offd++;
+                     }
+                  }
+               }
+            }
+         }
+      }
+      diag_count[ii] = cnt_diag;
+      offd_count[ii] = cnt_offd;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      if (ii)
+      {
+         cnt_diag = 0;
+         cnt_offd = 0;
+         for (i1 = 0; i1 < ii; i1++)
+         {
+            cnt_diag += diag_count[i1];
+            cnt_offd += offd_count[i1];
+         }
+         for (i = ns; i < ne; i++)
+         {
+            C_diag_i[i] += cnt_diag;
+            C_offd_i[i] += cnt_offd;
+         }
+      }
+      else
+      {
+         C_diag_i[num_rows_C] = 0;
+         C_offd_i[num_rows_C] = 0;
+         for (i1 = 0; i1 < hypre_NumActiveThreads(); i1++)
+         {
+            C_diag_i[num_rows_C] += diag_count[i1];
+            C_offd_i[num_rows_C] += offd_count[i1];
+         }
+         C_diag = hypre_CSRMatrixCreate(num_rows_C, num_cols_diag_C, C_diag_i[num_rows_C]);
+         hypre_CSRMatrixI(C_diag) = C_diag_i;
+         hypre_CSRMatrixInitialize_v2(C_diag, 0, memory_location_C);
+         C_diag_j = hypre_CSRMatrixJ(C_diag);
+         C_diag_data = hypre_CSRMatrixData(C_diag);
+
+         C_offd = hypre_CSRMatrixCreate(num_rows_C, num_cols_offd_Q, C_offd_i[num_rows_C]);
+         hypre_CSRMatrixI(C_offd) = C_offd_i;
+         hypre_CSRMatrixInitialize_v2(C_offd, 0, memory_location_C);
+         C_offd_j = hypre_CSRMatrixJ(C_offd);
+         C_offd_data = hypre_CSRMatrixData(C_offd);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      /* second pass: column indices and values */
+      for (i1 = 0; i1 < num_cols_diag_C + num_cols_offd_Q; i1++)
+      {
+         marker[i1] = -1;
+      }
+
+      cnt_diag = C_diag_i[ns];
+      cnt_offd = C_offd_i[ns];
+      for (i = ns; i < ne; i++)
+      {
+         diag_start = cnt_diag;
+         offd_start = cnt_offd;
+         if (diag_first)
+         {
+            marker[i] = cnt_diag;
+            C_diag_j[cnt_diag] = i;
+            C_diag_data[cnt_diag++] = 0.0;
+         }
+         for (kk = RT_i[i]; kk < RT_i[i+1]; kk++)
+         {
+            k = RT_j[kk];
+            r_entry = RT_data[kk];
+            for (ja = A_diag_i[k]; ja < A_diag_i[k+1]; ja++)
+            {
+               jj = A_diag_j[ja];
+               ra_entry = r_entry * A_diag_data[ja];
+               for (jp = P_diag_i[jj]; jp < P_diag_i[jj+1]; jp++)
+               {
+                  col = P_diag_j[jp];
+                  if (marker[col] < diag_start)
+                  {
+                     marker[col] = cnt_diag;
+                     C_diag_j[cnt_diag] = col;
+                     C_diag_data[cnt_diag++] = ra_entry * P_diag_data[jp];
+                  }
+                  else
+                  {
+                     C_diag_data[marker[col]] += ra_entry * P_diag_data[jp];
+                  }
+               }
+               for (jp = P_offd_i[jj]; jp < P_offd_i[jj+1]; jp++)
+               {
+                  col = map_P_to_Q ? map_P_to_Q[P_offd_j[jp]] : P_offd_j[jp];
+                  if (marker[num_cols_diag_C + col] < offd_start)
+                  {
+                     marker[num_cols_diag_C + col] = cnt_offd;
+                     C_offd_j[cnt_offd] = col;
+                     C_offd_data[cnt_offd++] = ra_entry * P_offd_data[jp];
+                  }
+                  else
+                  {
+                     C_offd_data[marker[num_cols_diag_C + col]] += ra_entry * P_offd_data[jp];
+                  }
+               }
+            }
+            if (num_cols_offd_A)
+            {
+               for (ja = A_offd_i[k]; ja < A_offd_i[k+1]; ja++)
+               {
+                  jj = A_offd_j[ja];
+                  ra_entry = r_entry * A_offd_data[ja];
+                  for (jp = Pext_diag_i[jj]; jp < Pext_diag_i[jj+1]; jp++)
+                  {
+                     col = Pext_diag_j[jp];
+                     if (marker[col] < diag_start)
+                     {
+                        marker[col] = cnt_diag;
+                        C_diag_j[cnt_diag] = col;
+                        C_diag_data[cnt_diag++] = ra_entry * Pext_diag_data[jp];
+                     }
+                     else
+                     {
+                        C_diag_data[marker[col]] += ra_entry * Pext_diag_data[jp];
+                     }
+                  }
+                  for (jp = Pext_offd_i[jj]; jp < Pext_offd_i[jj+1]; jp++)
+                  {
+                     col = Pext_offd_j[jp];
+                     if (marker[num_cols_diag_C + col] < offd_start)
+                     {
+                        marker[num_cols_diag_C + col] = cnt_offd;
+                        C_offd_j[cnt_offd] = col;
+                        C_offd_data[cnt_offd++] = ra_entry * Pext_offd_data[jp];
+                     }
+                     else
+                     {
+                        C_offd_data[marker[num_cols_diag_C + col]] += ra_entry * Pext_offd_data[jp];
+                     }
+                  }
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   hypre_TFree(diag_count, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_count, HYPRE_MEMORY_HOST);
+
+   *C_diag_ptr = C_diag;
+   *C_offd_ptr = C_offd;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPFusedHost : computes C = R^T*A*P like
+ * hypre_ParCSRMatrixRAPKTHost, but row by row, so that neither A*P nor the
+ * partial products R^T*(A*P) are stored.  The external rows of P, the
+ * transposes of R and the contributions to coarse rows owned by other
+ * processors are the only intermediate matrices; each thread works in a
+ * marker array of length equal to the local number of columns of C.
+ * The price is that a row of A*P is recomputed for every coarse row it
+ * contributes to.
+ * If peak_memory is not NULL, it returns the high-water mark (in bytes) of
+ * the matrices and work arrays allocated during the product.
+ * Note that, as for hypre_ParCSRMatrixRAPKT, C does not own row_starts
+ * and takes over col_starts from P.
+ *--------------------------------------------------------------------------*/
+
 hypre_ParCSRMatrix*
-hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix  *R,
-                         hypre_ParCSRMatrix  *A,
-                         hypre_ParCSRMatrix  *P,
-                         HYPRE_Int            keep_transpose)
+hypre_ParCSRMatrixRAPFusedHost( hypre_ParCSRMatrix *R,
+                                hypre_ParCSRMatrix *A,
+                                hypre_ParCSRMatrix *P,
+                                HYPRE_Int           keep_transpose,
+                                HYPRE_Real         *peak_memory )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
+
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int        num_rows_diag_A = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_diag_A = hypre_CSRMatrixNumCols(A_diag);
+   HYPRE_Int        num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_CSRMatrix *P_diag = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrix *P_offd = hypre_ParCSRMatrixOffd(P);
+   HYPRE_BigInt    *col_map_offd_P = hypre_ParCSRMatrixColMapOffd(P);
+   HYPRE_BigInt     first_col_diag_P = hypre_ParCSRMatrixFirstColDiag(P);
+   HYPRE_BigInt    *col_starts_P = hypre_ParCSRMatrixColStarts(P);
+   HYPRE_Int        num_rows_diag_P = hypre_CSRMatrixNumRows(P_diag);
+   HYPRE_Int        num_cols_diag_P = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int        num_cols_offd_P = hypre_CSRMatrixNumCols(P_offd);
+
+   hypre_CSRMatrix *R_diag = hypre_ParCSRMatrixDiag(R);
+   hypre_CSRMatrix *R_offd = hypre_ParCSRMatrixOffd(R);
+   HYPRE_Int        num_rows_diag_R = hypre_CSRMatrixNumRows(R_diag);
+   HYPRE_Int        num_cols_diag_R = hypre_CSRMatrixNumCols(R_diag);
+   HYPRE_Int        num_cols_offd_R = hypre_CSRMatrixNumCols(R_offd);
+   HYPRE_BigInt    *col_starts_R = hypre_ParCSRMatrixColStarts(R);
+   hypre_CSRMatrix *RT_diag = NULL;
+   hypre_CSRMatrix *RT_offd = NULL;
+
+   HYPRE_BigInt    *col_map_offd_Q = NULL;
+   HYPRE_Int        num_cols_offd_Q = 0;
+   HYPRE_Int       *map_P_to_Q = NULL;
+   hypre_CSRMatrix *Ps_ext = NULL;
+   hypre_CSRMatrix *Pext_diag = NULL;
+   hypre_CSRMatrix *Pext_offd = NULL;
+
+   hypre_ParCSRMatrix *C;
+   hypre_CSRMatrix    *C_diag = NULL;
+   hypre_CSRMatrix    *C_offd = NULL;
+   HYPRE_BigInt       *col_map_offd_C = NULL;
+   HYPRE_Int           num_cols_offd_C = 0;
+
+   HYPRE_BigInt     n_rows_R, n_cols_R;
+   HYPRE_BigInt     n_rows_A, n_cols_A;
+   HYPRE_BigInt     n_rows_P, n_cols_P;
+   HYPRE_Int        num_procs, my_id;
+   HYPRE_Int        cnt, i;
+   HYPRE_Real       mem = 0.0, peak = 0.0, scratch;
+
+   n_rows_R = hypre_ParCSRMatrixGlobalNumRows(R);
+   n_cols_R = hypre_ParCSRMatrixGlobalNumCols(R);
+   n_rows_A = hypre_ParCSRMatrixGlobalNumRows(A);
+   n_cols_A = hypre_ParCSRMatrixGlobalNumCols(A);
+   n_rows_P = hypre_ParCSRMatrixGlobalNumRows(P);
+   n_cols_P = hypre_ParCSRMatrixGlobalNumCols(P);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (n_rows_R != n_rows_A || num_rows_diag_R != num_rows_diag_A
+         || n_cols_A != n_rows_P || num_cols_diag_A != num_rows_diag_P)
+   {
+        hypre_error_w_msg(HYPRE_ERROR_GENERIC," Error! Incompatible matrix dimensions!\n");
+        return NULL;
+   }
+
+   /*-----------------------------------------------------------------------
+    *  External rows of P, split in columns owned by this processor and
+    *  others (col_map_offd_Q is the union of the latter and col_map_offd_P)
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1 && num_cols_offd_A)
+   {
+      HYPRE_BigInt last_col_diag_P = first_col_diag_P + num_cols_diag_P - 1;
+
+      Ps_ext = hypre_ParCSRMatrixExtractBExt(P, A, 1);
+      hypre_RAPMemoryAdd(&mem, &peak, Ps_ext);
+      hypre_CSRMatrixSplit(Ps_ext, first_col_diag_P, last_col_diag_P, num_cols_offd_P, col_map_offd_P,
+                           &num_cols_offd_Q, &col_map_offd_Q, &Pext_diag, &Pext_offd);
+      hypre_RAPMemoryAdd(&mem, &peak, Pext_diag);
+      hypre_RAPMemoryAdd(&mem, &peak, Pext_offd);
+      hypre_RAPMemorySub(&mem, Ps_ext);
+      hypre_CSRMatrixDestroy(Ps_ext);
+
+      if (num_cols_offd_Q > num_cols_offd_P)
+      {
+         map_P_to_Q = hypre_CTAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+         cnt = 0;
+         for (i = 0; i < num_cols_offd_Q && cnt < num_cols_offd_P; i++)
+         {
+            if (col_map_offd_Q[i] == col_map_offd_P[cnt])
+            {
+               map_P_to_Q[cnt++] = i;
+            }
+         }
+      }
+   }
+   else
+   {
+      num_cols_offd_Q = num_cols_offd_P;
+      col_map_offd_Q = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd_Q, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_offd_P; i++)
+      {
+         col_map_offd_Q[i] = col_map_offd_P[i];
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    *  Local rows of C
+    *-----------------------------------------------------------------------*/
+
+   hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
+   hypre_RAPMemoryAdd(&mem, &peak, RT_diag);
+
+   /* the marker arrays of hypre_ParCSRMatrixRAPFusedRows */
+   scratch = (HYPRE_Real) hypre_NumThreads() * (num_cols_diag_P + num_cols_offd_Q) * sizeof(HYPRE_Int);
+
+   mem += scratch;
+   hypre_ParCSRMatrixRAPFusedRows(RT_diag, A_diag, A_offd, P_diag, P_offd, map_P_to_Q,
+                                  Pext_diag, Pext_offd, num_cols_offd_Q,
+                                  num_cols_diag_R == num_cols_diag_P, &C_diag, &C_offd);
+   hypre_RAPMemoryAdd(&mem, &peak, C_diag);
+   hypre_RAPMemoryAdd(&mem, &peak, C_offd);
+   mem -= scratch;
+
+   if (keep_transpose)
+   {
+      R->diagT = RT_diag;
+   }
+   else
+   {
+      hypre_RAPMemorySub(&mem, RT_diag);
+      hypre_CSRMatrixDestroy(RT_diag);
+   }
+
+   /*-----------------------------------------------------------------------
+    *  Contributions to coarse rows of other processors: compute, send and
+    *  add the ones received to C
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      hypre_ParCSRCommPkg *comm_pkg_R;
+      hypre_CSRMatrix     *C_int = NULL;
+      hypre_CSRMatrix     *C_ext = NULL;
+      hypre_CSRMatrix     *C_ext_diag = NULL;
+      hypre_CSRMatrix     *C_ext_offd = NULL;
+      hypre_CSRMatrix     *C_tmp;
+      HYPRE_Int           *send_map_elmts_R;
+      void                *request;
+
+      if (!hypre_ParCSRMatrixCommPkg(R))
+      {
+         hypre_MatvecCommPkgCreate(R);
+      }
+      comm_pkg_R = hypre_ParCSRMatrixCommPkg(R);
+
+      if (num_cols_offd_R)
+      {
+         hypre_CSRMatrix *C_int_diag = NULL;
+         hypre_CSRMatrix *C_int_offd = NULL;
+         HYPRE_Int       *C_int_i, *C_int_diag_i, *C_int_offd_i;
+         HYPRE_Int       *C_int_diag_j, *C_int_offd_j;
+         HYPRE_BigInt    *C_int_j;
+         HYPRE_Complex   *C_int_data, *C_int_diag_data, *C_int_offd_data;
+         HYPRE_Int        j;
+
+         hypre_CSRMatrixTranspose(R_offd, &RT_offd, 1);
+         hypre_RAPMemoryAdd(&mem, &peak, RT_offd);
+         mem += scratch;
+         hypre_ParCSRMatrixRAPFusedRows(RT_offd, A_diag, A_offd, P_diag, P_offd, map_P_to_Q,
+                                        Pext_diag, Pext_offd, num_cols_offd_Q, 0,
+                                        &C_int_diag, &C_int_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, C_int_diag);
+         hypre_RAPMemoryAdd(&mem, &peak, C_int_offd);
+         mem -= scratch;
+
+         /* merge with global column indices for the exchange */
+         C_int = hypre_CSRMatrixCreate(num_cols_offd_R, n_cols_P,
+                                       hypre_CSRMatrixNumNonzeros(C_int_diag) +
+                                       hypre_CSRMatrixNumNonzeros(C_int_offd));
+         hypre_CSRMatrixMemoryLocation(C_int) = hypre_CSRMatrixMemoryLocation(C_int_diag);
+         hypre_CSRMatrixBigInitialize(C_int);
+         hypre_RAPMemoryAdd(&mem, &peak, C_int);
+
+         C_int_i         = hypre_CSRMatrixI(C_int);
+         C_int_j         = hypre_CSRMatrixBigJ(C_int);
+         C_int_data      = hypre_CSRMatrixData(C_int);
+         C_int_diag_i    = hypre_CSRMatrixI(C_int_diag);
+         C_int_diag_j    = hypre_CSRMatrixJ(C_int_diag);
+         C_int_diag_data = hypre_CSRMatrixData(C_int_diag);
+         C_int_offd_i    = hypre_CSRMatrixI(C_int_offd);
+         C_int_offd_j    = hypre_CSRMatrixJ(C_int_offd);
+         C_int_offd_data = hypre_CSRMatrixData(C_int_offd);
+
+         cnt = 0;
+         for (i = 0; i < num_cols_offd_R; i++)
+         {
+            C_int_i[i] = cnt;
+            for (j = C_int_diag_i[i]; j < C_int_diag_i[i+1]; j++)
+            {
+               C_int_j[cnt] = first_col_diag_P + (HYPRE_BigInt) C_int_diag_j[j];
+               C_int_data[cnt++] = C_int_diag_data[j];
+            }
+            for (j = C_int_offd_i[i]; j < C_int_offd_i[i+1]; j++)
+            {
+               C_int_j[cnt] = col_map_offd_Q[C_int_offd_j[j]];
+               C_int_data[cnt++] = C_int_offd_data[j];
+            }
+         }
+         C_int_i[num_cols_offd_R] = cnt;
+
+         hypre_RAPMemorySub(&mem, C_int_diag);
+         hypre_RAPMemorySub(&mem, C_int_offd);
+         hypre_CSRMatrixDestroy(C_int_diag);
+         hypre_CSRMatrixDestroy(C_int_offd);
+         if (keep_transpose)
+         {
+            R->offdT = RT_offd;
+         }
+         else
+         {
+            hypre_RAPMemorySub(&mem, RT_offd);
+            hypre_CSRMatrixDestroy(RT_offd);
+         }
+      }
+      else
+      {
+         C_int = hypre_CSRMatrixCreate(0,0,0);
+         hypre_CSRMatrixInitialize(C_int);
+      }
+
+      /* external rows of P are no longer needed */
+      hypre_RAPMemorySub(&mem, Pext_diag);
+      hypre_RAPMemorySub(&mem, Pext_offd);
+      hypre_CSRMatrixDestroy(Pext_diag);
+      hypre_CSRMatrixDestroy(Pext_offd);
+      hypre_TFree(map_P_to_Q, HYPRE_MEMORY_HOST);
+
+      hypre_ExchangeExternalRowsInit(C_int, comm_pkg_R, &request);
+      C_ext = hypre_ExchangeExternalRowsWait(request);
+      hypre_RAPMemoryAdd(&mem, &peak, C_ext);
+
+      hypre_RAPMemorySub(&mem, C_int);
+      hypre_CSRMatrixDestroy(C_int);
+
+      if (C_ext)
+      {
+         hypre_CSRMatrixSplit(C_ext, first_col_diag_P, first_col_diag_P + num_cols_diag_P - 1,
+                              num_cols_offd_Q, col_map_offd_Q, &num_cols_offd_C, &col_map_offd_C,
+                              &C_ext_diag, &C_ext_offd);
+         hypre_RAPMemoryAdd(&mem, &peak, C_ext_diag);
+         hypre_RAPMemoryAdd(&mem, &peak, C_ext_offd);
+         hypre_RAPMemorySub(&mem, C_ext);
+         hypre_CSRMatrixDestroy(C_ext);
+      }
+      else
+      {
+         num_cols_offd_C = num_cols_offd_Q;
+         col_map_offd_C = col_map_offd_Q;
+         col_map_offd_Q = NULL;
+      }
+
+      /* renumber the offd columns of the local rows */
+      if (num_cols_offd_C > num_cols_offd_Q && num_cols_offd_Q)
+      {
+         HYPRE_Int *map_Q_to_C = hypre_CTAlloc(HYPRE_Int, num_cols_offd_Q, HYPRE_MEMORY_HOST);
+         HYPRE_Int *C_offd_j   = hypre_CSRMatrixJ(C_offd);
+
+         cnt = 0;
+         for (i = 0; i < num_cols_offd_C && cnt < num_cols_offd_Q; i++)
+         {
+            if (col_map_offd_C[i] == col_map_offd_Q[cnt])
+            {
+               map_Q_to_C[cnt++] = i;
+            }
+         }
+         for (i = 0; i < hypre_CSRMatrixNumNonzeros(C_offd); i++)
+         {
+            C_offd_j[i] = map_Q_to_C[C_offd_j[i]];
+         }
+         hypre_TFree(map_Q_to_C, HYPRE_MEMORY_HOST);
+      }
+      hypre_CSRMatrixNumCols(C_offd) = num_cols_offd_C;
+      hypre_TFree(col_map_offd_Q, HYPRE_MEMORY_HOST);
+
+      send_map_elmts_R = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_R);
+      if (C_ext_diag)
+      {
+         C_tmp = hypre_CSRMatrixAddPartial(C_diag, C_ext_diag, send_map_elmts_R);
+         hypre_RAPMemoryAdd(&mem, &peak, C_tmp);
+         hypre_RAPMemorySub(&mem, C_diag);
+         hypre_RAPMemorySub(&mem, C_ext_diag);
+         hypre_CSRMatrixDestroy(C_diag);
+         hypre_CSRMatrixDestroy(C_ext_diag);
+         C_diag = C_tmp;
+      }
+      if (C_ext_offd)
+      {
+         C_tmp = hypre_CSRMatrixAddPartial(C_offd, C_ext_offd, send_map_elmts_R);
+         hypre_RAPMemoryAdd(&mem, &peak, C_tmp);
+         hypre_RAPMemorySub(&mem, C_offd);
+         hypre_RAPMemorySub(&mem, C_ext_offd);
+         hypre_CSRMatrixDestroy(C_offd);
+         hypre_CSRMatrixDestroy(C_ext_offd);
+         C_offd = C_tmp;
+      }
+   }
+   else
+   {
+      num_cols_offd_C = 0;
+      hypre_TFree(col_map_offd_Q, HYPRE_MEMORY_HOST);
+   }
+
+   C = hypre_ParCSRMatrixCreate(comm, n_cols_R, n_cols_P, col_starts_R,
+                                col_starts_P, num_cols_offd_C, 0, 0);
+
+   /* Note that C does not own the partitionings */
+   hypre_ParCSRMatrixSetColStartsOwner(P,0);
+   hypre_ParCSRMatrixSetColStartsOwner(R,0);
+
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(C));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(C));
+   hypre_ParCSRMatrixDiag(C) = C_diag;
+   hypre_ParCSRMatrixOffd(C) = C_offd;
+   hypre_ParCSRMatrixColMapOffd(C) = col_map_offd_C;
+
+   if (num_procs > 1)
+   {
+      hypre_MatvecCommPkgCreate(C);
+   }
+
+   if (peak_memory)
+   {
+      *peak_memory = peak;
+   }
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPKT_v2 : computes C = R^T*A*P with the fused row-wise
+ * kernel if fused is set, and as R^T*(A*P) otherwise.  On the host,
+ * peak_memory (if not NULL) returns the high-water mark in bytes of the
+ * intermediate storage of the product; it is set to zero on the device.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatrixRAPKT_v2( hypre_ParCSRMatrix  *R,
+                            hypre_ParCSRMatrix  *A,
+                            hypre_ParCSRMatrix  *P,
+                            HYPRE_Int            keep_transpose,
+                            HYPRE_Int            fused,
+                            HYPRE_Real          *peak_memory )
 {
 #if defined(HYPRE_USING_CUDA)
    hypre_NvtxPushRange("TripleMat-RAP");
@@ -939,11 +1727,20 @@ hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix  *R,
    if (exec == HYPRE_EXEC_DEVICE)
    {
       C = hypre_ParCSRMatrixRAPKTDevice(R, A, P, keep_transpose);
+      if (peak_memory)
+      {
+         *peak_memory = 0.0;
+      }
    }
    else
 #endif
+   if (fused)
+   {
+      C = hypre_ParCSRMatrixRAPFusedHost(R, A, P, keep_transpose, peak_memory);
+   }
+   else
    {
-      C = hypre_ParCSRMatrixRAPKTHost(R, A, P, keep_transpose);
+      C = hypre_ParCSRMatrixRAPKTHost(R, A, P, keep_transpose, peak_memory);
    }
 
 #if defined(HYPRE_USING_CUDA)
@@ -953,6 +1750,15 @@ hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix  *R,
    return C;
 }
 
+hypre_ParCSRMatrix*
+hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix  *R,
+                         hypre_ParCSRMatrix  *A,
+                         hypre_ParCSRMatrix  *P,
+                         HYPRE_Int            keep_transpose)
+{
+   return hypre_ParCSRMatrixRAPKT_v2( R, A, P, keep_transpose, 0, NULL);
+}
+
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAP( hypre_ParCSRMatrix *R,
            hypre_ParCSRMatrix  *A,
            hypre_ParCSRMatrix  *P )
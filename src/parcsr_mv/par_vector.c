@@ -542,6 +542,103 @@ hypre_ParVectorMassInnerProd( hypre_ParVector  *x,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorMultiInnerProd
+ *
+ * result[j] = <x_j, y_j> for each column j of the multivectors x and y,
+ * with a single global reduction for all columns.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorMultiInnerProd( hypre_ParVector *x,
+                               hypre_ParVector *y,
+                               HYPRE_Real      *result )
+{
+   MPI_Comm      comm        = hypre_ParVectorComm(x);
+   hypre_Vector *x_local     = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local     = hypre_ParVectorLocalVector(y);
+   HYPRE_Int     num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Real   *local_result;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   hypre_SeqVectorMultiInnerProd(x_local, y_local, local_result);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, num_vectors, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorMultiAxpy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorMultiAxpy( HYPRE_Complex   *alpha,
+                          hypre_ParVector *x,
+                          hypre_ParVector *y )
+{
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+
+   return hypre_SeqVectorMultiAxpy(alpha, x_local, y_local);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorMultiScale
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorMultiScale( HYPRE_Complex   *alpha,
+                           hypre_ParVector *y )
+{
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+
+   return hypre_SeqVectorMultiScale(alpha, y_local);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorColumnView
+ *
+ * Returns a single-vector hypre_ParVector that aliases column j of the
+ * multivector x (column storage).  The view does not own the data or the
+ * partitioning and must be destroyed before x.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParVector *
+hypre_ParMultiVectorColumnView( hypre_ParVector *x,
+                                HYPRE_Int        j )
+{
+   hypre_Vector    *x_local = hypre_ParVectorLocalVector(x);
+   hypre_ParVector *column;
+   hypre_Vector    *column_local;
+
+   hypre_assert(hypre_VectorMultiVecStorageMethod(x_local) == 0);
+   hypre_assert(j >= 0 && j < hypre_VectorNumVectors(x_local));
+
+   column = hypre_ParVectorCreate(hypre_ParVectorComm(x),
+                                  hypre_ParVectorGlobalSize(x),
+                                  hypre_ParVectorPartitioning(x));
+   hypre_ParVectorSetPartitioningOwner(column, 0);
+
+   column_local = hypre_ParVectorLocalVector(column);
+   hypre_VectorData(column_local) = hypre_VectorData(x_local) +
+                                    j * hypre_VectorVectorStride(x_local);
+   hypre_SeqVectorSetDataOwner(column_local, 0);
+   hypre_ParVectorInitialize_v2(column, hypre_ParVectorMemoryLocation(x));
+
+   return column;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorMassDotpTwo
  *--------------------------------------------------------------------------*/
@@ -35,6 +35,8 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixJ(matrix)              = NULL;
    hypre_CSRMatrixBigJ(matrix)           = NULL;
    hypre_CSRMatrixRownnz(matrix)         = NULL;
+   hypre_CSRMatrixSell(matrix)           = NULL;
+   hypre_CSRMatrixDataFloat(matrix)      = NULL;
    hypre_CSRMatrixNumRows(matrix)        = num_rows;
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
@@ -62,6 +64,8 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixSellDestroy(hypre_CSRMatrixSell(matrix));
+      hypre_TFree(hypre_CSRMatrixDataFloat(matrix), HYPRE_MEMORY_HOST);
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
@@ -649,6 +653,8 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
       hypre_TMemcpy(B_data, A_data, HYPRE_Complex, num_nonzeros, memory_location_B, memory_location_A);
    }
 
+   hypre_CSRMatrixResetSell(B);
+
    return ierr;
 }
 
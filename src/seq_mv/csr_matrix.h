@@ -16,6 +16,39 @@
 #ifndef hypre_CSR_MATRIX_HEADER
 #define hypre_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma companion layout of a CSR Matrix
+ *
+ * Nonempty rows are sorted by decreasing length inside windows of `sigma'
+ * rows and grouped into chunks of `chunk_size' rows. Each chunk is stored
+ * column-major and padded to the length of its longest row, so that one
+ * SIMD lane processes one row.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int      chunk_size;
+   HYPRE_Int      sigma;
+   HYPRE_Int      num_rows;     /* number of (nonempty) rows stored */
+   HYPRE_Int      num_chunks;
+   HYPRE_Int     *chunk_ptr;    /* offset of each chunk into j and data */
+   HYPRE_Int     *chunk_len;    /* padded row length of each chunk */
+   HYPRE_Int     *perm;         /* CSR row of each stored row */
+   HYPRE_Int     *j;
+   HYPRE_Complex *data;
+
+} hypre_CSRMatrixSell;
+
+#define hypre_CSRMatrixSellChunkSize(sell)    ((sell) -> chunk_size)
+#define hypre_CSRMatrixSellSigma(sell)        ((sell) -> sigma)
+#define hypre_CSRMatrixSellNumRows(sell)      ((sell) -> num_rows)
+#define hypre_CSRMatrixSellNumChunks(sell)    ((sell) -> num_chunks)
+#define hypre_CSRMatrixSellChunkPtr(sell)     ((sell) -> chunk_ptr)
+#define hypre_CSRMatrixSellChunkLen(sell)     ((sell) -> chunk_len)
+#define hypre_CSRMatrixSellPerm(sell)         ((sell) -> perm)
+#define hypre_CSRMatrixSellJ(sell)            ((sell) -> j)
+#define hypre_CSRMatrixSellData(sell)         ((sell) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -40,6 +73,15 @@ typedef struct
    HYPRE_Int     *rownnz;
    HYPRE_Int      num_rownnz;
 
+   /* SELL-C-sigma copy for vectorized host matvecs, built on first use.
+    * Invariant: it mirrors i, j and data, so any routine that changes the
+    * pattern or the values in place must discard it with
+    * hypre_CSRMatrixResetSell before the next matvec. */
+   hypre_CSRMatrixSell *sell;
+
+   /* single-precision copy of data for matvecs on lower-precision levels */
+   float         *data_float;
+
    /* memory location of arrays i, j, data */
    HYPRE_MemoryLocation      memory_location;
 
@@ -58,6 +100,8 @@ typedef struct
 #define hypre_CSRMatrixNumNonzeros(matrix)    ((matrix) -> num_nonzeros)
 #define hypre_CSRMatrixRownnz(matrix)         ((matrix) -> rownnz)
 #define hypre_CSRMatrixNumRownnz(matrix)      ((matrix) -> num_rownnz)
+#define hypre_CSRMatrixSell(matrix)           ((matrix) -> sell)
+#define hypre_CSRMatrixDataFloat(matrix)      ((matrix) -> data_float)
 #define hypre_CSRMatrixOwnsData(matrix)       ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix) ((matrix) -> memory_location)
 
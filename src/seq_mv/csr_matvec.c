@@ -91,6 +91,46 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    if (num_cols != x_size && (num_rows != y_size || num_rows != b_size))
       ierr = 3;
 
+   /*-----------------------------------------------------------------------
+    * Use the single-precision values of A, if present
+    *-----------------------------------------------------------------------*/
+
+   if ( hypre_CSRMatrixDataFloat(A) &&
+        alpha != 0.0 && num_vectors == 1 && offset == 0 && x != y )
+   {
+      hypre_CSRMatrixMatvecFloat(alpha, A, x, beta, b, y);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_MATVEC] += hypre_MPI_Wtime() - time_begin;
+#endif
+
+      return ierr;
+   }
+
+   /* the double values were dropped (see hypre_CSRMatrixDropData) */
+   if ( !hypre_CSRMatrixData(A) && hypre_CSRMatrixDataFloat(A) && alpha != 0.0 )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matvec needs the double values dropped from a single-precision matrix");
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Use the SELL-C-sigma copy of A, if requested
+    *-----------------------------------------------------------------------*/
+
+   if ( hypre_HandleSpMVUseSell(hypre_handle()) &&
+        alpha != 0.0 && num_vectors == 1 && offset == 0 && x != y )
+   {
+      hypre_CSRMatrixMatvecSell(alpha, A, x, beta, b, y);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_MATVEC] += hypre_MPI_Wtime() - time_begin;
+#endif
+
+      return ierr;
+   }
+
    /*-----------------------------------------------------------------------
     * Do (alpha == 0.0) computation - RDF: USE MACHINE EPS
     *-----------------------------------------------------------------------*/
@@ -491,6 +531,39 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
 
    if (num_rows != x_size && num_cols != y_size)
       ierr = 3;
+
+   /*-----------------------------------------------------------------------
+    * Use the single-precision values of A, if present
+    *-----------------------------------------------------------------------*/
+
+   if ( hypre_CSRMatrixDataFloat(A) &&
+        alpha != 0.0 && num_vectors == 1 && x != y )
+   {
+      hypre_CSRMatrixMatvecTFloat(alpha, A, x, beta, y);
+
+      return ierr;
+   }
+
+   /* the double values were dropped (see hypre_CSRMatrixDropData) */
+   if ( !hypre_CSRMatrixData(A) && hypre_CSRMatrixDataFloat(A) && alpha != 0.0 )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "MatvecT needs the double values dropped from a single-precision matrix");
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Use the SELL-C-sigma copy of A, if requested
+    *-----------------------------------------------------------------------*/
+
+   if ( hypre_HandleSpMVUseSell(hypre_handle()) &&
+        alpha != 0.0 && num_vectors == 1 && x != y )
+   {
+      hypre_CSRMatrixMatvecTSell(alpha, A, x, beta, y);
+
+      return ierr;
+   }
+
    /*-----------------------------------------------------------------------
     * Do (alpha == 0.0) computation - RDF: USE MACHINE EPS
     *-----------------------------------------------------------------------*/
@@ -0,0 +1,264 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single-precision value copy and host matvec functions for hypre_CSRMatrix.
+ *
+ * When a matrix has a float copy of its values (see hypre_CSRMatrixSetDataFloat),
+ * the host matvecs read the matrix entries from that copy, which halves the
+ * memory traffic for the values. Vectors and the accumulation stay in
+ * HYPRE_Complex precision. The copy is owned by the CSR matrix and must be
+ * refreshed with hypre_CSRMatrixSetDataFloat if the values change.  Once it
+ * exists, the full-precision values may be released with
+ * hypre_CSRMatrixDropData; the float copy then becomes the only one.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetDataFloat
+ *
+ * (Re)builds the single-precision copy of the values from the current data.
+ * Only host matrices with real values are supported; otherwise nothing is
+ * done and the matvecs keep using the full-precision data.  If the
+ * full-precision data has been dropped, the existing copy is kept.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetDataFloat( hypre_CSRMatrix *matrix )
+{
+#if !defined(HYPRE_COMPLEX)
+   HYPRE_Int      num_nonzeros;
+   HYPRE_Complex *data;
+   float         *data_float;
+   HYPRE_Int      i;
+
+   if (!matrix || !hypre_CSRMatrixData(matrix) ||
+       hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(matrix)) != hypre_MEMORY_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   num_nonzeros = hypre_CSRMatrixI(matrix) ?
+                  hypre_CSRMatrixI(matrix)[hypre_CSRMatrixNumRows(matrix)] : 0;
+   data         = hypre_CSRMatrixData(matrix);
+
+   hypre_TFree(hypre_CSRMatrixDataFloat(matrix), HYPRE_MEMORY_HOST);
+   data_float = hypre_TAlloc(float, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      data_float[i] = (float) data[i];
+   }
+
+   hypre_CSRMatrixDataFloat(matrix) = data_float;
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixResetDataFloat
+ *
+ * Discards the single-precision copy; matvecs use the full-precision data.
+ * Nothing is done if the full-precision data has been dropped.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixResetDataFloat( hypre_CSRMatrix *matrix )
+{
+   if (matrix && hypre_CSRMatrixData(matrix))
+   {
+      hypre_TFree(hypre_CSRMatrixDataFloat(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDataFloat(matrix) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixDropData
+ *
+ * Frees the full-precision values of a matrix that has a float copy, so
+ * that the values are stored in single precision only.  Afterwards only
+ * the float kernels (single-vector matvecs and the float smoothers) may be
+ * applied to the matrix.  Matrices that do not own their data, or have no
+ * float copy, are left unchanged.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixDropData( hypre_CSRMatrix *matrix )
+{
+   if (matrix && hypre_CSRMatrixDataFloat(matrix) && hypre_CSRMatrixOwnsData(matrix))
+   {
+      hypre_CSRMatrixResetSell(matrix);
+      hypre_TFree(hypre_CSRMatrixData(matrix), hypre_CSRMatrixMemoryLocation(matrix));
+      hypre_CSRMatrixData(matrix) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecFloat
+ *
+ * y = alpha*A*x + beta*b using the float copy of the values, for single
+ * vectors only. b may be equal to y, but x may not.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecFloat( HYPRE_Complex    alpha,
+                            hypre_CSRMatrix *A,
+                            hypre_Vector    *x,
+                            HYPRE_Complex    beta,
+                            hypre_Vector    *b,
+                            hypre_Vector    *y )
+{
+   HYPRE_Int      num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int     *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int     *A_j      = hypre_CSRMatrixJ(A);
+   float         *A_data   = hypre_CSRMatrixDataFloat(A);
+
+   HYPRE_Complex *x_data   = hypre_VectorData(x);
+   HYPRE_Complex *b_data   = hypre_VectorData(b);
+   HYPRE_Complex *y_data   = hypre_VectorData(y);
+   HYPRE_Complex  temp;
+   HYPRE_Int      i, jj;
+
+   if (beta == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,temp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         temp = 0.0;
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            temp += (HYPRE_Complex) A_data[jj] * x_data[A_j[jj]];
+         }
+         y_data[i] = alpha * temp;
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,temp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         temp = 0.0;
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            temp += (HYPRE_Complex) A_data[jj] * x_data[A_j[jj]];
+         }
+         y_data[i] = alpha * temp + beta * b_data[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTFloat
+ *
+ * y = alpha*A^T*x + beta*y using the float copy of the values, for single
+ * vectors only (x != y).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTFloat( HYPRE_Complex    alpha,
+                             hypre_CSRMatrix *A,
+                             hypre_Vector    *x,
+                             HYPRE_Complex    beta,
+                             hypre_Vector    *y )
+{
+   HYPRE_Int      num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int      num_cols = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int     *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int     *A_j      = hypre_CSRMatrixJ(A);
+   float         *A_data   = hypre_CSRMatrixDataFloat(A);
+
+   HYPRE_Complex *x_data   = hypre_VectorData(x);
+   HYPRE_Complex *y_data   = hypre_VectorData(y);
+   HYPRE_Complex *y_data_expand = NULL;
+   HYPRE_Int      num_threads = hypre_NumThreads();
+   HYPRE_Int      i, jj, t;
+
+   if (beta == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols; i++)
+      {
+         y_data[i] = 0.0;
+      }
+   }
+   else if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols; i++)
+      {
+         y_data[i] *= beta;
+      }
+   }
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*num_cols, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,jj)
+#endif
+   {
+      HYPRE_Complex *y_thread = y_data;
+      HYPRE_Complex  xi;
+
+      if (y_data_expand)
+      {
+         y_thread = y_data_expand + hypre_GetThreadNum()*num_cols;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         xi = alpha * x_data[i];
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            y_thread[A_j[jj]] += (HYPRE_Complex) A_data[jj] * xi;
+         }
+      }
+   }
+
+   if (y_data_expand)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,t) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols; i++)
+      {
+         for (t = 0; t < num_threads; t++)
+         {
+            y_data[i] += y_data_expand[t*num_cols + i];
+         }
+      }
+      hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,518 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma layout and host matvec functions for hypre_CSRMatrix class.
+ *
+ * The SELL copy is built lazily on the first matvec after
+ * HYPRE_SetSpMVUseSell(1) and is freed together with the CSR matrix.
+ * Since it holds its own copy of the pattern and values, every routine that
+ * writes i, j or data of an existing matrix calls hypre_CSRMatrixResetSell
+ * (IJ assemble, hypre_CSRMatrixCopy, numeric SpGEMM and RAP, truncation,
+ * AMG resetup). New code that updates a matrix in place must do the same.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE) && !defined(HYPRE_LONG_DOUBLE)
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#define HYPRE_SELL_USING_AVX512
+#elif defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#define HYPRE_SELL_USING_AVX2
+#endif
+#endif
+
+/* chunk size C is the number of double lanes of the SIMD unit */
+#if defined(HYPRE_SELL_USING_AVX2)
+#define HYPRE_SELL_CHUNK_SIZE 4
+#else
+#define HYPRE_SELL_CHUNK_SIZE 8
+#endif
+
+/* sorting scope sigma (a multiple of C, so chunks never straddle windows) */
+#define HYPRE_SELL_SIGMA (32 * HYPRE_SELL_CHUNK_SIZE)
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrixSell *
+hypre_CSRMatrixSellCreate( hypre_CSRMatrix *A )
+{
+   HYPRE_Int           num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int          *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int          *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Complex      *A_data   = hypre_CSRMatrixData(A);
+
+   HYPRE_Int           C        = HYPRE_SELL_CHUNK_SIZE;
+   HYPRE_Int           sigma    = HYPRE_SELL_SIGMA;
+
+   hypre_CSRMatrixSell *sell;
+   HYPRE_Int           *perm, *chunk_ptr, *chunk_len, *sell_j;
+   HYPRE_Complex       *sell_data;
+   HYPRE_Int            n, num_chunks, c, r, i, k, w, w_end, row, len, jpad;
+
+   sell = hypre_CTAlloc(hypre_CSRMatrixSell, 1, HYPRE_MEMORY_HOST);
+
+   /* count the nonempty rows */
+   n = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (A_i[i+1] > A_i[i])
+      {
+         n++;
+      }
+   }
+   num_chunks = (n + C - 1) / C;
+
+   perm      = hypre_TAlloc(HYPRE_Int, num_chunks * C, HYPRE_MEMORY_HOST);
+   chunk_ptr = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len = hypre_TAlloc(HYPRE_Int, num_chunks,     HYPRE_MEMORY_HOST);
+
+   n = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (A_i[i+1] > A_i[i])
+      {
+         perm[n++] = i;
+      }
+   }
+
+   /* sort each window of sigma rows by decreasing row length; the insertion
+    * sort is stable, so rows of equal length keep their original order */
+   for (w = 0; w < n; w += sigma)
+   {
+      w_end = hypre_min(w + sigma, n);
+      for (i = w + 1; i < w_end; i++)
+      {
+         row = perm[i];
+         len = A_i[row+1] - A_i[row];
+         for (k = i; k > w && A_i[perm[k-1]+1] - A_i[perm[k-1]] < len; k--)
+         {
+            perm[k] = perm[k-1];
+         }
+         perm[k] = row;
+      }
+   }
+
+   /* pad the last chunk with copies of a valid row */
+   for (i = n; i < num_chunks * C; i++)
+   {
+      perm[i] = perm[n-1];
+   }
+
+   /* the first row of each chunk is its longest one */
+   chunk_ptr[0] = 0;
+   for (c = 0; c < num_chunks; c++)
+   {
+      row = perm[c*C];
+      chunk_len[c] = A_i[row+1] - A_i[row];
+      chunk_ptr[c+1] = chunk_ptr[c] + chunk_len[c] * C;
+   }
+
+   sell_j    = hypre_TAlloc(HYPRE_Int,     chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+   sell_data = hypre_TAlloc(HYPRE_Complex, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c,r,k,row,len,jpad) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      /* padding points at a column the chunk touches anyway */
+      jpad = A_j[A_i[perm[c*C]]];
+      for (r = 0; r < C; r++)
+      {
+         row = perm[c*C + r];
+         len = (c*C + r < n) ? A_i[row+1] - A_i[row] : 0;
+         for (k = 0; k < len; k++)
+         {
+            sell_j[chunk_ptr[c] + k*C + r]    = A_j[A_i[row] + k];
+            sell_data[chunk_ptr[c] + k*C + r] = A_data[A_i[row] + k];
+         }
+         for (k = len; k < chunk_len[c]; k++)
+         {
+            sell_j[chunk_ptr[c] + k*C + r]    = jpad;
+            sell_data[chunk_ptr[c] + k*C + r] = 0.0;
+         }
+      }
+   }
+
+   hypre_CSRMatrixSellChunkSize(sell) = C;
+   hypre_CSRMatrixSellSigma(sell)     = sigma;
+   hypre_CSRMatrixSellNumRows(sell)   = n;
+   hypre_CSRMatrixSellNumChunks(sell) = num_chunks;
+   hypre_CSRMatrixSellChunkPtr(sell)  = chunk_ptr;
+   hypre_CSRMatrixSellChunkLen(sell)  = chunk_len;
+   hypre_CSRMatrixSellPerm(sell)      = perm;
+   hypre_CSRMatrixSellJ(sell)         = sell_j;
+   hypre_CSRMatrixSellData(sell)      = sell_data;
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDestroy( hypre_CSRMatrixSell *sell )
+{
+   if (sell)
+   {
+      hypre_TFree(hypre_CSRMatrixSellChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSellChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSellPerm(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSellJ(sell),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSellData(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetSell
+ *
+ * (Re)builds the SELL copy of the matrix from its current CSR arrays.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetSell( hypre_CSRMatrix *matrix )
+{
+   hypre_CSRMatrixSellDestroy(hypre_CSRMatrixSell(matrix));
+   hypre_CSRMatrixSell(matrix) = hypre_CSRMatrixSellCreate(matrix);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixResetSell
+ *
+ * Discards the SELL copy, e.g. after the CSR values have been modified.
+ * It is rebuilt by the next matvec that needs it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixResetSell( hypre_CSRMatrix *matrix )
+{
+   if (matrix)
+   {
+      hypre_CSRMatrixSellDestroy(hypre_CSRMatrixSell(matrix));
+      hypre_CSRMatrixSell(matrix) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellChunkDot
+ *
+ * sums[r] = sum_k data[k*C+r] * x[j[k*C+r]], r = 0, ..., C-1
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRMatrixSellChunkDot( HYPRE_Int      len,
+                             HYPRE_Int     *j,
+                             HYPRE_Complex *data,
+                             HYPRE_Complex *x,
+                             HYPRE_Complex *sums )
+{
+   HYPRE_Int k;
+
+#if defined(HYPRE_SELL_USING_AVX512)
+   __m512d acc = _mm512_setzero_pd();
+   for (k = 0; k < len; k++, j += 8, data += 8)
+   {
+#ifdef HYPRE_BIGINT
+      __m512d xg = _mm512_i64gather_pd(_mm512_loadu_si512((const void *) j), x, 8);
+#else
+      __m512d xg = _mm512_i32gather_pd(_mm256_loadu_si256((const __m256i *) j), x, 8);
+#endif
+      acc = _mm512_fmadd_pd(_mm512_loadu_pd(data), xg, acc);
+   }
+   _mm512_storeu_pd(sums, acc);
+#elif defined(HYPRE_SELL_USING_AVX2)
+   __m256d acc = _mm256_setzero_pd();
+   for (k = 0; k < len; k++, j += 4, data += 4)
+   {
+#ifdef HYPRE_BIGINT
+      __m256d xg = _mm256_i64gather_pd(x, _mm256_loadu_si256((const __m256i *) j), 8);
+#else
+      __m256d xg = _mm256_i32gather_pd(x, _mm_loadu_si128((const __m128i *) j), 8);
+#endif
+      acc = _mm256_fmadd_pd(_mm256_loadu_pd(data), xg, acc);
+   }
+   _mm256_storeu_pd(sums, acc);
+#else
+   HYPRE_Int r;
+   for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+   {
+      sums[r] = 0.0;
+   }
+   for (k = 0; k < len; k++, j += HYPRE_SELL_CHUNK_SIZE, data += HYPRE_SELL_CHUNK_SIZE)
+   {
+      for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+      {
+         sums[r] += data[r] * x[j[r]];
+      }
+   }
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellChunkScale
+ *
+ * prods[r] = data[r] * xr[r], r = 0, ..., C-1
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRMatrixSellChunkScale( HYPRE_Complex *data,
+                               HYPRE_Complex *xr,
+                               HYPRE_Complex *prods )
+{
+#if defined(HYPRE_SELL_USING_AVX512)
+   _mm512_storeu_pd(prods, _mm512_mul_pd(_mm512_loadu_pd(data), _mm512_loadu_pd(xr)));
+#elif defined(HYPRE_SELL_USING_AVX2)
+   _mm256_storeu_pd(prods, _mm256_mul_pd(_mm256_loadu_pd(data), _mm256_loadu_pd(xr)));
+#else
+   HYPRE_Int r;
+   for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+   {
+      prods[r] = data[r] * xr[r];
+   }
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSell
+ *
+ * y = alpha*A*x + beta*b, for single vectors only. b may be equal to y,
+ * but x may not.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSell( HYPRE_Complex    alpha,
+                           hypre_CSRMatrix *A,
+                           hypre_Vector    *x,
+                           HYPRE_Complex    beta,
+                           hypre_Vector    *b,
+                           hypre_Vector    *y )
+{
+   HYPRE_Int            num_rows = hypre_CSRMatrixNumRows(A);
+   hypre_CSRMatrixSell *sell;
+   HYPRE_Int           *chunk_ptr, *chunk_len, *perm, *sell_j;
+   HYPRE_Complex       *sell_data;
+   HYPRE_Int            n, num_chunks, C, c, r, nr, row, i;
+
+   HYPRE_Complex       *x_data = hypre_VectorData(x);
+   HYPRE_Complex       *b_data = hypre_VectorData(b);
+   HYPRE_Complex       *y_data = hypre_VectorData(y);
+   HYPRE_Complex        sums[HYPRE_SELL_CHUNK_SIZE];
+
+   if (!hypre_CSRMatrixSell(A))
+   {
+      hypre_CSRMatrixSetSell(A);
+   }
+
+   sell       = hypre_CSRMatrixSell(A);
+   C          = hypre_CSRMatrixSellChunkSize(sell);
+   n          = hypre_CSRMatrixSellNumRows(sell);
+   num_chunks = hypre_CSRMatrixSellNumChunks(sell);
+   chunk_ptr  = hypre_CSRMatrixSellChunkPtr(sell);
+   chunk_len  = hypre_CSRMatrixSellChunkLen(sell);
+   perm       = hypre_CSRMatrixSellPerm(sell);
+   sell_j     = hypre_CSRMatrixSellJ(sell);
+   sell_data  = hypre_CSRMatrixSellData(sell);
+
+   /* empty rows are not stored: scale all of y first and accumulate */
+   if (n < num_rows)
+   {
+      if (beta == 0.0)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            y_data[i] = 0.0;
+         }
+      }
+      else if (beta != 1.0 || b_data != y_data)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            y_data[i] = beta * b_data[i];
+         }
+      }
+      beta   = 1.0;
+      b_data = y_data;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c,r,nr,row,sums) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      hypre_CSRMatrixSellChunkDot(chunk_len[c], sell_j + chunk_ptr[c],
+                                  sell_data + chunk_ptr[c], x_data, sums);
+
+      nr = hypre_min(C, n - c*C);
+      if (beta == 0.0)
+      {
+         for (r = 0; r < nr; r++)
+         {
+            y_data[perm[c*C + r]] = alpha * sums[r];
+         }
+      }
+      else
+      {
+         for (r = 0; r < nr; r++)
+         {
+            row = perm[c*C + r];
+            y_data[row] = alpha * sums[r] + beta * b_data[row];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSell
+ *
+ * y = alpha*A^T*x + beta*y, for single vectors only (x != y).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSell( HYPRE_Complex    alpha,
+                            hypre_CSRMatrix *A,
+                            hypre_Vector    *x,
+                            HYPRE_Complex    beta,
+                            hypre_Vector    *y )
+{
+   HYPRE_Int            num_cols = hypre_CSRMatrixNumCols(A);
+   hypre_CSRMatrixSell *sell;
+   HYPRE_Int           *chunk_ptr, *chunk_len, *perm, *sell_j;
+   HYPRE_Complex       *sell_data;
+   HYPRE_Int            n, num_chunks, C, c, r, k, nr, i, t;
+
+   HYPRE_Complex       *x_data = hypre_VectorData(x);
+   HYPRE_Complex       *y_data = hypre_VectorData(y);
+   HYPRE_Complex       *y_data_expand = NULL;
+   HYPRE_Int            num_threads = hypre_NumThreads();
+
+   if (!hypre_CSRMatrixSell(A))
+   {
+      hypre_CSRMatrixSetSell(A);
+   }
+
+   sell       = hypre_CSRMatrixSell(A);
+   C          = hypre_CSRMatrixSellChunkSize(sell);
+   n          = hypre_CSRMatrixSellNumRows(sell);
+   num_chunks = hypre_CSRMatrixSellNumChunks(sell);
+   chunk_ptr  = hypre_CSRMatrixSellChunkPtr(sell);
+   chunk_len  = hypre_CSRMatrixSellChunkLen(sell);
+   perm       = hypre_CSRMatrixSellPerm(sell);
+   sell_j     = hypre_CSRMatrixSellJ(sell);
+   sell_data  = hypre_CSRMatrixSellData(sell);
+
+   if (beta == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols; i++)
+      {
+         y_data[i] = 0.0;
+      }
+   }
+   else if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols; i++)
+      {
+         y_data[i] *= beta;
+      }
+   }
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*num_cols, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(c,r,k,nr,i,t)
+#endif
+   {
+      HYPRE_Complex  xr[HYPRE_SELL_CHUNK_SIZE];
+      HYPRE_Complex  prods[HYPRE_SELL_CHUNK_SIZE];
+      HYPRE_Complex *y_thread = y_data;
+      HYPRE_Int     *j_c;
+      HYPRE_Complex *data_c;
+
+      if (y_data_expand)
+      {
+         y_thread = y_data_expand + hypre_GetThreadNum()*num_cols;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (c = 0; c < num_chunks; c++)
+      {
+         nr = hypre_min(C, n - c*C);
+         for (r = 0; r < nr; r++)
+         {
+            xr[r] = alpha * x_data[perm[c*C + r]];
+         }
+         for (r = nr; r < C; r++)
+         {
+            xr[r] = 0.0;
+         }
+
+         j_c    = sell_j    + chunk_ptr[c];
+         data_c = sell_data + chunk_ptr[c];
+         for (k = 0; k < chunk_len[c]; k++, j_c += C, data_c += C)
+         {
+            /* lanes may share a column, so the scatter stays scalar */
+            hypre_CSRMatrixSellChunkScale(data_c, xr, prods);
+            for (r = 0; r < C; r++)
+            {
+               y_thread[j_c[r]] += prods[r];
+            }
+         }
+      }
+
+      if (y_data_expand)
+      {
+         /* implied barrier */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_cols; i++)
+         {
+            for (t = 0; t < num_threads; t++)
+            {
+               y_data[i] += y_data_expand[t*num_cols + i];
+            }
+         }
+      }
+   }
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
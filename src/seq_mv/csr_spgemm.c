@@ -0,0 +1,472 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Two-pass (symbolic/numeric) host sparse matrix-matrix multiplication
+ * for hypre_CSRMatrix class.
+ *
+ * The symbolic phase computes the row pointer and the column indices of
+ * C = A*B, the numeric phase fills in the values of an existing C and may
+ * be called again whenever the values (but not the patterns) of A and B
+ * change.  Each thread accumulates its rows either in a dense marker array
+ * of length ncols(B) or, when B is wide compared to the rows of C, in a
+ * small open-addressing hash table sized by the row's flop count.
+ *
+ * The column ordering is the one of hypre_CSRMatrixMultiply: if C is square,
+ * the diagonal entry comes first, and the other entries are in the order in
+ * which they are first generated.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/* multiplicative hashing with linear probing; the table size is a power of 2.
+ * The product is taken in unsigned arithmetic, where wrap-around is defined. */
+#define HYPRE_SPGEMM_HASH(key, mask) \
+   ((HYPRE_Int)(((hypre_uint)(key) * 107u) & (hypre_uint)(mask)))
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpGemmHashSize
+ *
+ * Returns the smallest power of two that is at least twice n.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixSpGemmHashSize( HYPRE_Int n )
+{
+   HYPRE_Int size = 1;
+
+   while (size < 2*n)
+   {
+      size <<= 1;
+   }
+
+   return size;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpGemmRowBound
+ *
+ * Upper bound of the number of nonzeros in row ic of A*B.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_CSRMatrixSpGemmRowBound( HYPRE_Int  ic,
+                               HYPRE_Int *A_i,
+                               HYPRE_Int *A_j,
+                               HYPRE_Int *B_i,
+                               HYPRE_Int  allsquare,
+                               HYPRE_Int  ncols_B )
+{
+   HYPRE_Int ia, ja, bound = allsquare;
+
+   for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+   {
+      ja = A_j[ia];
+      bound += B_i[ja+1] - B_i[ja];
+   }
+
+   return hypre_min(bound, ncols_B);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplySymbolicHost
+ *
+ * Creates C = A*B with row pointer and column indices.  The data array is
+ * allocated but not set; use hypre_CSRMatrixMultiplyNumericHost for that.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMultiplySymbolicHost( hypre_CSRMatrix  *A,
+                                     hypre_CSRMatrix  *B,
+                                     hypre_CSRMatrix **C_ptr )
+{
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         nrows_A  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         ncols_A  = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int        *B_i      = hypre_CSRMatrixI(B);
+   HYPRE_Int        *B_j      = hypre_CSRMatrixJ(B);
+   HYPRE_Int         nrows_B  = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int         ncols_B  = hypre_CSRMatrixNumCols(B);
+   hypre_CSRMatrix  *C        = NULL;
+   HYPRE_Int        *C_i;
+   HYPRE_Int        *C_j      = NULL;
+
+   HYPRE_Int         allsquare = 0;
+   HYPRE_Int         max_num_threads;
+   HYPRE_Int        *jj_count;
+
+   /* see hypre_CSRMatrixMultiplyHost */
+   HYPRE_MemoryLocation memory_location_C = hypre_max(hypre_CSRMatrixMemoryLocation(A),
+                                                      hypre_CSRMatrixMemoryLocation(B));
+
+   *C_ptr = NULL;
+
+   if (ncols_A != nrows_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,"Warning! incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   if (nrows_A == ncols_B)
+   {
+      allsquare = 1;
+   }
+
+   C_i = hypre_CTAlloc(HYPRE_Int, nrows_A+1, memory_location_C);
+
+   max_num_threads = hypre_NumThreads();
+   jj_count = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      HYPRE_Int *marker = NULL;
+      HYPRE_Int  ns, ne, ii, i1, jj, num_threads;
+      HYPRE_Int  ic, ia, ja, ib, jb, h, mask;
+      HYPRE_Int  max_bound = 0, size = 0, use_hash, num_nonzeros, counter;
+
+      ii = hypre_GetThreadNum();
+      num_threads = hypre_NumActiveThreads();
+      hypre_GetSimpleThreadPartition(&ns, &ne, nrows_A);
+
+      /* choose the accumulator: a hash table is used when its largest
+       * instance is still clearly smaller than a dense marker array */
+      for (ic = ns; ic < ne; ic++)
+      {
+         max_bound = hypre_max(max_bound,
+                               hypre_CSRMatrixSpGemmRowBound(ic, A_i, A_j, B_i, allsquare, ncols_B));
+      }
+      use_hash = (hypre_CSRMatrixSpGemmHashSize(max_bound) < ncols_B);
+
+      if (use_hash)
+      {
+         size = hypre_CSRMatrixSpGemmHashSize(max_bound);
+      }
+      else
+      {
+         size = ncols_B;
+      }
+      marker = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      for (h = 0; h < size; h++)
+      {
+         marker[h] = -1;
+      }
+
+      /* first pass: count the nonzeros of each row */
+      num_nonzeros = 0;
+      for (ic = ns; ic < ne; ic++)
+      {
+         C_i[ic] = num_nonzeros;
+         if (use_hash)
+         {
+            mask = hypre_CSRMatrixSpGemmHashSize(
+                      hypre_CSRMatrixSpGemmRowBound(ic, A_i, A_j, B_i, allsquare, ncols_B)) - 1;
+            for (h = 0; h <= mask; h++)
+            {
+               marker[h] = -1;
+            }
+            if (allsquare)
+            {
+               marker[HYPRE_SPGEMM_HASH(ic, mask)] = ic;
+               num_nonzeros++;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  h  = HYPRE_SPGEMM_HASH(jb, mask);
+                  while (marker[h] != -1 && marker[h] != jb)
+                  {
+                     h = (h + 1) & mask;
+                  }
+                  if (marker[h] == -1)
+                  {
+                     marker[h] = jb;
+                     num_nonzeros++;
+                  }
+               }
+            }
+         }
+         else
+         {
+            if (allsquare)
+            {
+               marker[ic] = ic;
+               num_nonzeros++;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  if (marker[jb] != ic)
+                  {
+                     marker[jb] = ic;
+                     num_nonzeros++;
+                  }
+               }
+            }
+         }
+      }
+      jj_count[ii] = num_nonzeros;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      if (ii)
+      {
+         jj = jj_count[0];
+         for (i1 = 1; i1 < ii; i1++)
+         {
+            jj += jj_count[i1];
+         }
+
+         for (i1 = ns; i1 < ne; i1++)
+         {
+            C_i[i1] += jj;
+         }
+      }
+      else
+      {
+         C_i[nrows_A] = 0;
+         for (i1 = 0; i1 < num_threads; i1++)
+         {
+            C_i[nrows_A] += jj_count[i1];
+         }
+
+         C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
+         hypre_CSRMatrixI(C) = C_i;
+         hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
+         C_j = hypre_CSRMatrixJ(C);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      /* second pass: fill in the column indices */
+      for (h = 0; h < size; h++)
+      {
+         marker[h] = -1;
+      }
+
+      counter = C_i[ns];
+      for (ic = ns; ic < ne; ic++)
+      {
+         if (use_hash)
+         {
+            mask = hypre_CSRMatrixSpGemmHashSize(
+                      hypre_CSRMatrixSpGemmRowBound(ic, A_i, A_j, B_i, allsquare, ncols_B)) - 1;
+            for (h = 0; h <= mask; h++)
+            {
+               marker[h] = -1;
+            }
+            if (allsquare)
+            {
+               marker[HYPRE_SPGEMM_HASH(ic, mask)] = ic;
+               C_j[counter++] = ic;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  h  = HYPRE_SPGEMM_HASH(jb, mask);
+                  while (marker[h] != -1 && marker[h] != jb)
+                  {
+                     h = (h + 1) & mask;
+                  }
+                  if (marker[h] == -1)
+                  {
+                     marker[h] = jb;
+                     C_j[counter++] = jb;
+                  }
+               }
+            }
+         }
+         else
+         {
+            if (allsquare)
+            {
+               marker[ic] = ic;
+               C_j[counter++] = ic;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  if (marker[jb] != ic)
+                  {
+                     marker[jb] = ic;
+                     C_j[counter++] = jb;
+                  }
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   hypre_TFree(jj_count, HYPRE_MEMORY_HOST);
+
+   *C_ptr = C;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyNumericHost
+ *
+ * Computes the values of C = A*B on the pattern of C, which is normally
+ * the one created by hypre_CSRMatrixMultiplySymbolicHost for A and B (or
+ * for matrices with the same patterns).  Products that fall outside the
+ * pattern of C are dropped.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMultiplyNumericHost( hypre_CSRMatrix *A,
+                                    hypre_CSRMatrix *B,
+                                    hypre_CSRMatrix *C )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         nrows_A  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         ncols_A  = hypre_CSRMatrixNumCols(A);
+   HYPRE_Complex    *B_data   = hypre_CSRMatrixData(B);
+   HYPRE_Int        *B_i      = hypre_CSRMatrixI(B);
+   HYPRE_Int        *B_j      = hypre_CSRMatrixJ(B);
+   HYPRE_Int         nrows_B  = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int         ncols_B  = hypre_CSRMatrixNumCols(B);
+   HYPRE_Complex    *C_data   = hypre_CSRMatrixData(C);
+   HYPRE_Int        *C_i      = hypre_CSRMatrixI(C);
+   HYPRE_Int        *C_j      = hypre_CSRMatrixJ(C);
+
+   if (ncols_A != nrows_B || hypre_CSRMatrixNumRows(C) != nrows_A ||
+       hypre_CSRMatrixNumCols(C) != ncols_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,"Warning! incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      HYPRE_Int     *keys = NULL, *pos = NULL;
+      HYPRE_Int      ns, ne, ic, ia, ja, ib, jb, jc, h, mask;
+      HYPRE_Int      row_start, row_end, max_row = 0, size, use_hash;
+      HYPRE_Complex  a_entry;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, nrows_A);
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         max_row = hypre_max(max_row, C_i[ic+1] - C_i[ic]);
+      }
+      use_hash = (hypre_CSRMatrixSpGemmHashSize(max_row) < ncols_B);
+
+      if (use_hash)
+      {
+         size = hypre_CSRMatrixSpGemmHashSize(max_row);
+         keys = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         size = ncols_B;
+      }
+      pos = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      for (h = 0; h < size; h++)
+      {
+         pos[h] = -1;
+      }
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         row_start = C_i[ic];
+         row_end   = C_i[ic+1];
+
+         if (use_hash)
+         {
+            mask = hypre_CSRMatrixSpGemmHashSize(row_end - row_start) - 1;
+            for (h = 0; h <= mask; h++)
+            {
+               keys[h] = -1;
+            }
+            for (jc = row_start; jc < row_end; jc++)
+            {
+               h = HYPRE_SPGEMM_HASH(C_j[jc], mask);
+               while (keys[h] != -1)
+               {
+                  h = (h + 1) & mask;
+               }
+               keys[h] = C_j[jc];
+               pos[h]  = jc;
+               C_data[jc] = 0.0;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  h  = HYPRE_SPGEMM_HASH(jb, mask);
+                  while (keys[h] != -1 && keys[h] != jb)
+                  {
+                     h = (h + 1) & mask;
+                  }
+                  if (keys[h] == jb)
+                  {
+                     C_data[pos[h]] += a_entry*B_data[ib];
+                  }
+               }
+            }
+         }
+         else
+         {
+            for (jc = row_start; jc < row_end; jc++)
+            {
+               pos[C_j[jc]] = jc;
+               C_data[jc] = 0.0;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jc = pos[B_j[ib]];
+                  if (jc >= row_start)
+                  {
+                     C_data[jc] += a_entry*B_data[ib];
+                  }
+               }
+            }
+         }
+      }
+
+      hypre_TFree(keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(pos, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   hypre_CSRMatrixResetSell(C);
+
+   return hypre_error_flag;
+}
@@ -70,10 +70,30 @@ HYPRE_Int hypre_CSRMatrixMatvecOutOfPlaceOOMP (HYPRE_Int trans, HYPRE_Complex al
 HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y , HYPRE_Int *CF_marker_x , HYPRE_Int *CF_marker_y , HYPRE_Int fpt );
+
+/* csr_matvec_sell.c */
+hypre_CSRMatrixSell *hypre_CSRMatrixSellCreate ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrixSell *sell );
+HYPRE_Int hypre_CSRMatrixSetSell ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixResetSell ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixMatvecSell ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSell ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
+
+/* csr_matvec_float.c */
+HYPRE_Int hypre_CSRMatrixSetDataFloat ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixResetDataFloat ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixDropData ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixMatvecFloat ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTFloat ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 #ifdef HYPRE_USING_CUDA
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
 HYPRE_Int hypre_CSRMatrixMatvecDeviceBIGINT( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
 #endif
+
+/* csr_spgemm.c */
+HYPRE_Int hypre_CSRMatrixMultiplySymbolicHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , hypre_CSRMatrix **C_ptr );
+HYPRE_Int hypre_CSRMatrixMultiplyNumericHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , hypre_CSRMatrix *C );
+
 /* genpart.c */
 HYPRE_Int hypre_GeneratePartitioning ( HYPRE_BigInt length , HYPRE_Int num_procs , HYPRE_BigInt **part_ptr );
 HYPRE_Int hypre_GenerateLocalPartitioning ( HYPRE_BigInt length , HYPRE_Int num_procs , HYPRE_Int myid , HYPRE_BigInt **part_ptr );
@@ -159,6 +179,9 @@ HYPRE_Int hypre_SeqVectorScale( HYPRE_Complex alpha, hypre_Vector *y );
 
 HYPRE_Int hypre_SeqVectorAxpy ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x , hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorMultiInnerProd ( hypre_Vector *x , hypre_Vector *y , HYPRE_Real *result );
+HYPRE_Int hypre_SeqVectorMultiAxpy ( HYPRE_Complex *alpha , hypre_Vector *x , hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorMultiScale ( HYPRE_Complex *alpha , hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd8(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
@@ -36,6 +36,39 @@ extern "C" {
 #ifndef hypre_CSR_MATRIX_HEADER
 #define hypre_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma companion layout of a CSR Matrix
+ *
+ * Nonempty rows are sorted by decreasing length inside windows of `sigma'
+ * rows and grouped into chunks of `chunk_size' rows. Each chunk is stored
+ * column-major and padded to the length of its longest row, so that one
+ * SIMD lane processes one row.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int      chunk_size;
+   HYPRE_Int      sigma;
+   HYPRE_Int      num_rows;     /* number of (nonempty) rows stored */
+   HYPRE_Int      num_chunks;
+   HYPRE_Int     *chunk_ptr;    /* offset of each chunk into j and data */
+   HYPRE_Int     *chunk_len;    /* padded row length of each chunk */
+   HYPRE_Int     *perm;         /* CSR row of each stored row */
+   HYPRE_Int     *j;
+   HYPRE_Complex *data;
+
+} hypre_CSRMatrixSell;
+
+#define hypre_CSRMatrixSellChunkSize(sell)    ((sell) -> chunk_size)
+#define hypre_CSRMatrixSellSigma(sell)        ((sell) -> sigma)
+#define hypre_CSRMatrixSellNumRows(sell)      ((sell) -> num_rows)
+#define hypre_CSRMatrixSellNumChunks(sell)    ((sell) -> num_chunks)
+#define hypre_CSRMatrixSellChunkPtr(sell)     ((sell) -> chunk_ptr)
+#define hypre_CSRMatrixSellChunkLen(sell)     ((sell) -> chunk_len)
+#define hypre_CSRMatrixSellPerm(sell)         ((sell) -> perm)
+#define hypre_CSRMatrixSellJ(sell)            ((sell) -> j)
+#define hypre_CSRMatrixSellData(sell)         ((sell) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -60,6 +93,15 @@ typedef struct
    HYPRE_Int     *rownnz;
    HYPRE_Int      num_rownnz;
 
+   /* SELL-C-sigma copy for vectorized host matvecs, built on first use.
+    * Invariant: it mirrors i, j and data, so any routine that changes the
+    * pattern or the values in place must discard it with
+    * hypre_CSRMatrixResetSell before the next matvec. */
+   hypre_CSRMatrixSell *sell;
+
+   /* single-precision copy of data for matvecs on lower-precision levels */
+   float         *data_float;
+
    /* memory location of arrays i, j, data */
    HYPRE_MemoryLocation      memory_location;
 
@@ -78,6 +120,8 @@ typedef struct
 #define hypre_CSRMatrixNumNonzeros(matrix)    ((matrix) -> num_nonzeros)
 #define hypre_CSRMatrixRownnz(matrix)         ((matrix) -> rownnz)
 #define hypre_CSRMatrixNumRownnz(matrix)      ((matrix) -> num_rownnz)
+#define hypre_CSRMatrixSell(matrix)           ((matrix) -> sell)
+#define hypre_CSRMatrixDataFloat(matrix)      ((matrix) -> data_float)
 #define hypre_CSRMatrixOwnsData(matrix)       ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix) ((matrix) -> memory_location)
 
@@ -327,10 +371,30 @@ HYPRE_Int hypre_CSRMatrixMatvecOutOfPlaceOOMP (HYPRE_Int trans, HYPRE_Complex al
 HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y , HYPRE_Int *CF_marker_x , HYPRE_Int *CF_marker_y , HYPRE_Int fpt );
+
+/* csr_matvec_sell.c */
+hypre_CSRMatrixSell *hypre_CSRMatrixSellCreate ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrixSell *sell );
+HYPRE_Int hypre_CSRMatrixSetSell ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixResetSell ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixMatvecSell ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSell ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
+
+/* csr_matvec_float.c */
+HYPRE_Int hypre_CSRMatrixSetDataFloat ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixResetDataFloat ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixDropData ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixMatvecFloat ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTFloat ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 #ifdef HYPRE_USING_CUDA
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
 HYPRE_Int hypre_CSRMatrixMatvecDeviceBIGINT( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
 #endif
+
+/* csr_spgemm.c */
+HYPRE_Int hypre_CSRMatrixMultiplySymbolicHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , hypre_CSRMatrix **C_ptr );
+HYPRE_Int hypre_CSRMatrixMultiplyNumericHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , hypre_CSRMatrix *C );
+
 /* genpart.c */
 HYPRE_Int hypre_GeneratePartitioning ( HYPRE_BigInt length , HYPRE_Int num_procs , HYPRE_BigInt **part_ptr );
 HYPRE_Int hypre_GenerateLocalPartitioning ( HYPRE_BigInt length , HYPRE_Int num_procs , HYPRE_Int myid , HYPRE_BigInt **part_ptr );
@@ -416,6 +480,9 @@ HYPRE_Int hypre_SeqVectorScale( HYPRE_Complex alpha, hypre_Vector *y );
 
 HYPRE_Int hypre_SeqVectorAxpy ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x , hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorMultiInnerProd ( hypre_Vector *x , hypre_Vector *y , HYPRE_Real *result );
+HYPRE_Int hypre_SeqVectorMultiAxpy ( HYPRE_Complex *alpha , hypre_Vector *x , hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorMultiScale ( HYPRE_Complex *alpha , hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd8(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
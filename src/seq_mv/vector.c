@@ -593,6 +593,118 @@ hypre_SeqVectorInnerProd( hypre_Vector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorColumn
+ *
+ * Sets col to be a single-vector view (not owning data) of column j of the
+ * multivector x. Only 'column' storage of multivectors is supported.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SeqVectorColumn( hypre_Vector *x,
+                       HYPRE_Int     j,
+                       hypre_Vector *col )
+{
+   *col = *x;
+   hypre_VectorData(col)         = hypre_VectorData(x) + j * hypre_VectorVectorStride(x);
+   hypre_VectorOwnsData(col)     = 0;
+   hypre_VectorNumVectors(col)   = 1;
+   hypre_VectorVectorStride(col) = hypre_VectorSize(x);
+   hypre_VectorIndexStride(col)  = 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorMultiInnerProd
+ *
+ * result[j] = <x_j, y_j> for each column j of the multivectors x and y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorMultiInnerProd( hypre_Vector *x,
+                               hypre_Vector *y,
+                               HYPRE_Real   *result )
+{
+   HYPRE_Int    num_vectors = hypre_VectorNumVectors(x);
+   hypre_Vector x_col, y_col;
+   HYPRE_Int    j;
+
+   hypre_assert( hypre_VectorIndexStride(x) == 1 && hypre_VectorIndexStride(y) == 1 );
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      hypre_SeqVectorColumn(x, j, &x_col);
+      hypre_SeqVectorColumn(y, j, &y_col);
+      result[j] = hypre_SeqVectorInnerProd(&x_col, &y_col);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorMultiAxpy
+ *
+ * y_j = y_j + alpha[j] * x_j for each column j of the multivectors x and y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorMultiAxpy( HYPRE_Complex *alpha,
+                          hypre_Vector  *x,
+                          hypre_Vector  *y )
+{
+   HYPRE_Int    num_vectors = hypre_VectorNumVectors(x);
+   hypre_Vector x_col, y_col;
+   HYPRE_Int    j;
+
+   hypre_assert( hypre_VectorIndexStride(x) == 1 && hypre_VectorIndexStride(y) == 1 );
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      if (alpha[j] != 0.0)
+      {
+         hypre_SeqVectorColumn(x, j, &x_col);
+         hypre_SeqVectorColumn(y, j, &y_col);
+         hypre_SeqVectorAxpy(alpha[j], &x_col, &y_col);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorMultiScale
+ *
+ * y_j = alpha[j] * y_j for each column j of the multivector y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorMultiScale( HYPRE_Complex *alpha,
+                           hypre_Vector  *y )
+{
+   HYPRE_Int    num_vectors = hypre_VectorNumVectors(y);
+   hypre_Vector y_col;
+   HYPRE_Int    j;
+
+   hypre_assert( hypre_VectorIndexStride(y) == 1 );
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      if (alpha[j] != 1.0)
+      {
+         hypre_SeqVectorColumn(y, j, &y_col);
+         if (alpha[j] == 0.0)
+         {
+            hypre_SeqVectorSetConstantValues(&y_col, 0.0);
+         }
+         else
+         {
+            hypre_SeqVectorScale(alpha[j], &y_col);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 //TODO
 
 /*--------------------------------------------------------------------------
@@ -25,6 +25,9 @@ HYPRE_SStructFlexGMRESCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   fgmres_functions->MassInnerProd = hypre_SStructKrylovMassInnerProd;
+   fgmres_functions->MassDotpTwo   = hypre_SStructKrylovMassDotpTwo;
+   fgmres_functions->MassAxpy      = hypre_SStructKrylovMassAxpy;
 
    *solver = ( (HYPRE_SStructSolver) hypre_FlexGMRESCreate( fgmres_functions ) );
 
@@ -80,6 +83,16 @@ HYPRE_SStructFlexGMRESSetKDim( HYPRE_SStructSolver solver,
    return( HYPRE_FlexGMRESSetKDim( (HYPRE_Solver) solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructFlexGMRESSetCGS( HYPRE_SStructSolver solver,
+                              HYPRE_Int           cgs )
+{
+   return( HYPRE_FlexGMRESSetCGS( (HYPRE_Solver) solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -25,6 +25,9 @@ HYPRE_SStructGMRESCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   gmres_functions->MassInnerProd = hypre_SStructKrylovMassInnerProd;
+   gmres_functions->MassDotpTwo   = hypre_SStructKrylovMassDotpTwo;
+   gmres_functions->MassAxpy      = hypre_SStructKrylovMassAxpy;
 
    *solver = ( (HYPRE_SStructSolver) hypre_GMRESCreate( gmres_functions ) );
 
@@ -80,6 +83,16 @@ HYPRE_SStructGMRESSetKDim( HYPRE_SStructSolver solver,
    return( HYPRE_GMRESSetKDim( (HYPRE_Solver) solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructGMRESSetCGS( HYPRE_SStructSolver solver,
+                          HYPRE_Int           cgs )
+{
+   return( HYPRE_GMRESSetCGS( (HYPRE_Solver) solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -25,6 +25,9 @@ HYPRE_SStructLGMRESCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   lgmres_functions->MassInnerProd = hypre_SStructKrylovMassInnerProd;
+   lgmres_functions->MassDotpTwo   = hypre_SStructKrylovMassDotpTwo;
+   lgmres_functions->MassAxpy      = hypre_SStructKrylovMassAxpy;
 
    *solver = ( (HYPRE_SStructSolver) hypre_LGMRESCreate( lgmres_functions ) );
 
@@ -80,6 +83,16 @@ HYPRE_SStructLGMRESSetKDim( HYPRE_SStructSolver solver,
    return( HYPRE_LGMRESSetKDim( (HYPRE_Solver) solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructLGMRESSetCGS( HYPRE_SStructSolver solver,
+                           HYPRE_Int           cgs )
+{
+   return( HYPRE_LGMRESSetCGS( (HYPRE_Solver) solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -793,6 +793,14 @@ HYPRE_Int
 HYPRE_SStructPCGSetRelChange(HYPRE_SStructSolver solver,
                              HYPRE_Int           rel_change);
 
+HYPRE_Int
+HYPRE_SStructPCGSetPipelined(HYPRE_SStructSolver solver,
+                             HYPRE_Int           pipelined);
+
+HYPRE_Int
+HYPRE_SStructPCGSetSStep(HYPRE_SStructSolver solver,
+                         HYPRE_Int           s_step);
+
 HYPRE_Int
 HYPRE_SStructPCGSetPrecond(HYPRE_SStructSolver          solver,
                            HYPRE_PtrToSStructSolverFcn  precond,
@@ -905,6 +913,10 @@ HYPRE_Int
 HYPRE_SStructGMRESSetKDim(HYPRE_SStructSolver solver,
                           HYPRE_Int           k_dim);
 
+HYPRE_Int
+HYPRE_SStructGMRESSetCGS(HYPRE_SStructSolver solver,
+                         HYPRE_Int           cgs);
+
 /*
  * RE-VISIT
  **/
@@ -1006,6 +1018,10 @@ HYPRE_Int
 HYPRE_SStructFlexGMRESSetKDim(HYPRE_SStructSolver solver,
                               HYPRE_Int           k_dim);
 
+HYPRE_Int
+HYPRE_SStructFlexGMRESSetCGS(HYPRE_SStructSolver solver,
+                             HYPRE_Int           cgs);
+
 HYPRE_Int
 HYPRE_SStructFlexGMRESSetPrecond(HYPRE_SStructSolver          solver,
                                  HYPRE_PtrToSStructSolverFcn  precond,
@@ -1104,6 +1120,11 @@ HYPRE_SStructLGMRESSetMaxIter(HYPRE_SStructSolver solver,
 HYPRE_Int
 HYPRE_SStructLGMRESSetKDim(HYPRE_SStructSolver solver,
                            HYPRE_Int           k_dim);
+
+HYPRE_Int
+HYPRE_SStructLGMRESSetCGS(HYPRE_SStructSolver solver,
+                          HYPRE_Int           cgs);
+
 HYPRE_Int
 HYPRE_SStructLGMRESSetAugDim(HYPRE_SStructSolver solver,
                              HYPRE_Int           aug_dim);
@@ -24,6 +24,9 @@ HYPRE_SStructPCGCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   pcg_functions->InnerProdLocal = hypre_SStructKrylovInnerProdLocal;
+   pcg_functions->IAllreduce     = hypre_SStructKrylovIAllreduce;
+   pcg_functions->Wait           = hypre_SStructKrylovWait;
 
    *solver = ( (HYPRE_SStructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -118,6 +121,26 @@ HYPRE_SStructPCGSetRelChange( HYPRE_SStructSolver solver,
    return( HYPRE_PCGSetRelChange( (HYPRE_Solver) solver, rel_change ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPCGSetPipelined( HYPRE_SStructSolver solver,
+                              HYPRE_Int           pipelined )
+{
+   return( HYPRE_PCGSetPipelined( (HYPRE_Solver) solver, pipelined ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPCGSetSStep( HYPRE_SStructSolver solver,
+                          HYPRE_Int           s_step )
+{
+   return( HYPRE_PCGSetSStep( (HYPRE_Solver) solver, s_step ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -328,6 +328,7 @@ HYPRE_Int HYPRE_SStructFlexGMRESDestroy ( HYPRE_SStructSolver solver );
 HYPRE_Int HYPRE_SStructFlexGMRESSetup ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector b , HYPRE_SStructVector x );
 HYPRE_Int HYPRE_SStructFlexGMRESSolve ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector b , HYPRE_SStructVector x );
 HYPRE_Int HYPRE_SStructFlexGMRESSetKDim ( HYPRE_SStructSolver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_SStructFlexGMRESSetCGS ( HYPRE_SStructSolver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_SStructFlexGMRESSetTol ( HYPRE_SStructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_SStructFlexGMRESSetAbsoluteTol ( HYPRE_SStructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_SStructFlexGMRESSetMinIter ( HYPRE_SStructSolver solver , HYPRE_Int min_iter );
@@ -346,6 +347,7 @@ HYPRE_Int HYPRE_SStructGMRESDestroy ( HYPRE_SStructSolver solver );
 HYPRE_Int HYPRE_SStructGMRESSetup ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector b , HYPRE_SStructVector x );
 HYPRE_Int HYPRE_SStructGMRESSolve ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector b , HYPRE_SStructVector x );
 HYPRE_Int HYPRE_SStructGMRESSetKDim ( HYPRE_SStructSolver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_SStructGMRESSetCGS ( HYPRE_SStructSolver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_SStructGMRESSetTol ( HYPRE_SStructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_SStructGMRESSetAbsoluteTol ( HYPRE_SStructSolver solver , HYPRE_Real atol );
 HYPRE_Int HYPRE_SStructGMRESSetMinIter ( HYPRE_SStructSolver solver , HYPRE_Int min_iter );
@@ -398,6 +400,7 @@ HYPRE_Int HYPRE_SStructLGMRESDestroy ( HYPRE_SStructSolver solver );
 HYPRE_Int HYPRE_SStructLGMRESSetup ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector b , HYPRE_SStructVector x );
 HYPRE_Int HYPRE_SStructLGMRESSolve ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector b , HYPRE_SStructVector x );
 HYPRE_Int HYPRE_SStructLGMRESSetKDim ( HYPRE_SStructSolver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_SStructLGMRESSetCGS ( HYPRE_SStructSolver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_SStructLGMRESSetAugDim ( HYPRE_SStructSolver solver , HYPRE_Int aug_dim );
 HYPRE_Int HYPRE_SStructLGMRESSetTol ( HYPRE_SStructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_SStructLGMRESSetAbsoluteTol ( HYPRE_SStructSolver solver , HYPRE_Real atol );
@@ -444,6 +447,8 @@ HYPRE_Int HYPRE_SStructPCGSetAbsoluteTol ( HYPRE_SStructSolver solver , HYPRE_Re
 HYPRE_Int HYPRE_SStructPCGSetMaxIter ( HYPRE_SStructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_SStructPCGSetTwoNorm ( HYPRE_SStructSolver solver , HYPRE_Int two_norm );
 HYPRE_Int HYPRE_SStructPCGSetRelChange ( HYPRE_SStructSolver solver , HYPRE_Int rel_change );
+HYPRE_Int HYPRE_SStructPCGSetPipelined ( HYPRE_SStructSolver solver , HYPRE_Int pipelined );
+HYPRE_Int HYPRE_SStructPCGSetSStep ( HYPRE_SStructSolver solver , HYPRE_Int s_step );
 HYPRE_Int HYPRE_SStructPCGSetPrecond ( HYPRE_SStructSolver solver , HYPRE_PtrToSStructSolverFcn precond , HYPRE_PtrToSStructSolverFcn precond_setup , void *precond_data );
 HYPRE_Int HYPRE_SStructPCGSetLogging ( HYPRE_SStructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_SStructPCGSetPrintLevel ( HYPRE_SStructSolver solver , HYPRE_Int level );
@@ -505,6 +510,12 @@ HYPRE_Int hypre_SStructKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_SStructKrylovClearVector ( void *x );
 HYPRE_Int hypre_SStructKrylovScaleVector ( HYPRE_Complex alpha , void *x );
 HYPRE_Int hypre_SStructKrylovAxpy ( HYPRE_Complex alpha , void *x , void *y );
+HYPRE_Int hypre_SStructKrylovInnerProdLocal ( void *x , void *y , HYPRE_Real *result );
+HYPRE_Int hypre_SStructKrylovIAllreduce ( void *x , HYPRE_Real *sendbuf , HYPRE_Real *recvbuf , HYPRE_Int count , void **request );
+HYPRE_Int hypre_SStructKrylovWait ( void *request );
+HYPRE_Int hypre_SStructKrylovMassInnerProd ( void *x , void **y , HYPRE_Int k , HYPRE_Int unroll , void *result );
+HYPRE_Int hypre_SStructKrylovMassDotpTwo ( void *x , void *y , void **z , HYPRE_Int k , HYPRE_Int unroll , void *result_x , void *result_y );
+HYPRE_Int hypre_SStructKrylovMassAxpy ( HYPRE_Complex *alpha , void **x , void *y , HYPRE_Int k , HYPRE_Int unroll );
 HYPRE_Int hypre_SStructKrylovCommInfo ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
 
 /* maxwell_grad.c */
@@ -258,6 +258,139 @@ hypre_SStructKrylovAxpy( HYPRE_Complex alpha,
                                (hypre_SStructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovInnerProdLocal( void       *x,
+                                   void       *y,
+                                   HYPRE_Real *result )
+{
+   return ( hypre_SStructInnerProdLocal( (hypre_SStructVector *) x,
+                                         (hypre_SStructVector *) y, result ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovIAllreduce( void        *x,
+                               HYPRE_Real  *sendbuf,
+                               HYPRE_Real  *recvbuf,
+                               HYPRE_Int    count,
+                               void       **request )
+{
+   hypre_MPI_Request *mpi_request = hypre_CTAlloc(hypre_MPI_Request, 1, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Iallreduce(sendbuf, recvbuf, count, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                        hypre_SStructVectorComm((hypre_SStructVector *) x), mpi_request);
+   *request = (void *) mpi_request;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovWait( void *request )
+{
+   hypre_MPI_Request *mpi_request = (hypre_MPI_Request *) request;
+   hypre_MPI_Status   status;
+
+   hypre_MPI_Wait(mpi_request, &status);
+   hypre_TFree(mpi_request, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes <x,y[j]> for j = 0,...,k-1 with a single reduction.  The unroll
+ * argument is ignored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovMassInnerProd( void       *x,
+                                  void      **y,
+                                  HYPRE_Int   k,
+                                  HYPRE_Int   unroll,
+                                  void       *result )
+{
+   hypre_SStructVector *xv = (hypre_SStructVector *) x;
+   HYPRE_Real  *local_result;
+   HYPRE_Int    j;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, k, HYPRE_MEMORY_HOST);
+   for (j = 0; j < k; j++)
+   {
+      hypre_SStructInnerProdLocal(xv, (hypre_SStructVector *) y[j], &local_result[j]);
+   }
+   hypre_MPI_Allreduce(local_result, result, k, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, hypre_SStructVectorComm(xv));
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes <x,z[j]> and <y,z[j]> for j = 0,...,k-1 with a single reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovMassDotpTwo( void       *x,
+                                void       *y,
+                                void      **z,
+                                HYPRE_Int   k,
+                                HYPRE_Int   unroll,
+                                void       *result_x,
+                                void       *result_y )
+{
+   hypre_SStructVector *xv = (hypre_SStructVector *) x;
+   hypre_SStructVector *yv = (hypre_SStructVector *) y;
+   HYPRE_Real  *local_result, *result;
+   HYPRE_Int    j;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, 2*k, HYPRE_MEMORY_HOST);
+   result       = hypre_CTAlloc(HYPRE_Real, 2*k, HYPRE_MEMORY_HOST);
+   for (j = 0; j < k; j++)
+   {
+      hypre_SStructInnerProdLocal(xv, (hypre_SStructVector *) z[j], &local_result[j]);
+      hypre_SStructInnerProdLocal(yv, (hypre_SStructVector *) z[j], &local_result[k+j]);
+   }
+   hypre_MPI_Allreduce(local_result, result, 2*k, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, hypre_SStructVectorComm(xv));
+   for (j = 0; j < k; j++)
+   {
+      ((HYPRE_Real *) result_x)[j] = result[j];
+      ((HYPRE_Real *) result_y)[j] = result[k+j];
+   }
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+   hypre_TFree(result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes y += sum_j alpha[j]*x[j].  The unroll argument is ignored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovMassAxpy( HYPRE_Complex  *alpha,
+                             void          **x,
+                             void           *y,
+                             HYPRE_Int       k,
+                             HYPRE_Int       unroll )
+{
+   HYPRE_Int j;
+
+   for (j = 0; j < k; j++)
+   {
+      hypre_SStructAxpy(alpha[j], (hypre_SStructVector *) x[j], (hypre_SStructVector *) y);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -24,6 +24,9 @@ HYPRE_StructFlexGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   fgmres_functions->MassInnerProd = hypre_StructKrylovMassInnerProd;
+   fgmres_functions->MassDotpTwo   = hypre_StructKrylovMassDotpTwo;
+   fgmres_functions->MassAxpy      = hypre_StructKrylovMassAxpy;
 
    *solver = ( (HYPRE_StructSolver) hypre_FlexGMRESCreate( fgmres_functions ) );
 
@@ -104,6 +107,15 @@ HYPRE_StructFlexGMRESSetKDim( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructFlexGMRESSetCGS( HYPRE_StructSolver solver,
+                             HYPRE_Int          cgs )
+{
+   return( HYPRE_FlexGMRESSetCGS( (HYPRE_Solver) solver, cgs ) );
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructFlexGMRESSetPrecond( HYPRE_StructSolver         solver,
                                  HYPRE_PtrToStructSolverFcn precond,
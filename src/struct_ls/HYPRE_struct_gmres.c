@@ -24,6 +24,9 @@ HYPRE_StructGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   gmres_functions->MassInnerProd = hypre_StructKrylovMassInnerProd;
+   gmres_functions->MassDotpTwo   = hypre_StructKrylovMassDotpTwo;
+   gmres_functions->MassAxpy      = hypre_StructKrylovMassAxpy;
 
    *solver = ( (HYPRE_StructSolver) hypre_GMRESCreate( gmres_functions ) );
 
@@ -104,6 +107,15 @@ HYPRE_StructGMRESSetKDim( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructGMRESSetCGS( HYPRE_StructSolver solver,
+                         HYPRE_Int          cgs )
+{
+   return( HYPRE_GMRESSetCGS( (HYPRE_Solver) solver, cgs ) );
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructGMRESSetPrecond( HYPRE_StructSolver         solver,
                              HYPRE_PtrToStructSolverFcn precond,
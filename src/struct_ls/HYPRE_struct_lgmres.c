@@ -24,6 +24,9 @@ HYPRE_StructLGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   lgmres_functions->MassInnerProd = hypre_StructKrylovMassInnerProd;
+   lgmres_functions->MassDotpTwo   = hypre_StructKrylovMassDotpTwo;
+   lgmres_functions->MassAxpy      = hypre_StructKrylovMassAxpy;
 
    *solver = ( (HYPRE_StructSolver) hypre_LGMRESCreate( lgmres_functions ) );
 
@@ -100,6 +103,15 @@ HYPRE_StructLGMRESSetKDim( HYPRE_StructSolver solver,
    return( HYPRE_LGMRESSetKDim( (HYPRE_Solver) solver, k_dim ) );
 }
 
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructLGMRESSetCGS( HYPRE_StructSolver solver,
+                          HYPRE_Int          cgs )
+{
+   return( HYPRE_LGMRESSetCGS( (HYPRE_Solver) solver, cgs ) );
+}
+
 
 
 /*==========================================================================*/
@@ -288,6 +288,35 @@ HYPRE_Int HYPRE_StructPFMGSetNumPostRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
                                  HYPRE_Int          skip_relax);
 
+/**
+ * (Optional) Set the number of relaxation sweeps done per ghost exchange.
+ * With \e relax_tile_depth \f$ k > 1 \f$, Jacobi and red-black
+ * Gauss-Seidel sweeps are applied in groups of up to \f$ k \f$ after one
+ * exchange of \f$ k \f$ ghost layers (\f$ 2k \f$ for red-black), redoing
+ * the relaxation redundantly on the ghost points, and the sweeps of a group
+ * are pipelined plane by plane for cache reuse.  This needs a copy of each
+ * level matrix with the wider ghost layers.  It applies to variable
+ * coefficient 2D and 3D problems on the CPU and is limited by the neighbor
+ * information kept by the grid; other levels use the untiled relaxation.
+ * The default is 1 (no tiling).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetRelaxTileDepth(HYPRE_StructSolver solver,
+                                      HYPRE_Int          relax_tile_depth);
+
+/**
+ * (Optional) Solve the coarsest grid directly once it has at most
+ * \e coarse_solve_size points.  Coarsening stops at that size, and the
+ * coarse matrix is gathered onto every process and factored with a dense
+ * LU, so each V-cycle ends with one gather instead of the latency-bound
+ * relaxation sweeps on a grid that is spread thinly over all processes.
+ * The factorization costs \f$ O(n^3) \f$ on every process, so sizes of up to
+ * a few thousand points are sensible.  If the coarse matrix is singular
+ * (e.g., for pure Neumann or fully periodic problems), relaxation is used on
+ * that grid instead.  The default is 0 (no direct solve).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetCoarseSolveSize(HYPRE_StructSolver solver,
+                                       HYPRE_Int          coarse_solve_size);
+
 /*
  * RE-VISIT
  **/
@@ -557,6 +586,12 @@ HYPRE_Int HYPRE_StructPCGSetTwoNorm(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPCGSetRelChange(HYPRE_StructSolver solver,
                                 HYPRE_Int          rel_change);
 
+HYPRE_Int HYPRE_StructPCGSetPipelined(HYPRE_StructSolver solver,
+                                HYPRE_Int          pipelined);
+
+HYPRE_Int HYPRE_StructPCGSetSStep(HYPRE_StructSolver solver,
+                            HYPRE_Int          s_step);
+
 HYPRE_Int HYPRE_StructPCGSetPrecond(HYPRE_StructSolver         solver,
                               HYPRE_PtrToStructSolverFcn precond,
                               HYPRE_PtrToStructSolverFcn precond_setup,
@@ -641,6 +676,9 @@ HYPRE_Int HYPRE_StructGMRESSetMaxIter(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructGMRESSetKDim(HYPRE_StructSolver solver,
                              HYPRE_Int          k_dim);
 
+HYPRE_Int HYPRE_StructGMRESSetCGS(HYPRE_StructSolver solver,
+                             HYPRE_Int          cgs);
+
 HYPRE_Int HYPRE_StructGMRESSetPrecond(HYPRE_StructSolver         solver,
                                 HYPRE_PtrToStructSolverFcn precond,
                                 HYPRE_PtrToStructSolverFcn precond_setup,
@@ -707,6 +745,9 @@ HYPRE_Int HYPRE_StructFlexGMRESSetMaxIter(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructFlexGMRESSetKDim(HYPRE_StructSolver solver,
                                  HYPRE_Int          k_dim);
 
+HYPRE_Int HYPRE_StructFlexGMRESSetCGS(HYPRE_StructSolver solver,
+                                 HYPRE_Int          cgs);
+
 HYPRE_Int HYPRE_StructFlexGMRESSetPrecond(HYPRE_StructSolver         solver,
                                     HYPRE_PtrToStructSolverFcn precond,
                                     HYPRE_PtrToStructSolverFcn precond_setup,
@@ -777,6 +818,9 @@ HYPRE_Int HYPRE_StructLGMRESSetMaxIter(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructLGMRESSetKDim(HYPRE_StructSolver solver,
                               HYPRE_Int          k_dim);
 
+HYPRE_Int HYPRE_StructLGMRESSetCGS(HYPRE_StructSolver solver,
+                              HYPRE_Int          cgs);
+
 HYPRE_Int HYPRE_StructLGMRESSetAugDim(HYPRE_StructSolver solver,
                                 HYPRE_Int          aug_dim);
 
@@ -29,6 +29,9 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   pcg_functions->InnerProdLocal = hypre_StructKrylovInnerProdLocal;
+   pcg_functions->IAllreduce     = hypre_StructKrylovIAllreduce;
+   pcg_functions->Wait           = hypre_StructKrylovWait;
 
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -118,6 +121,24 @@ HYPRE_StructPCGSetRelChange( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructPCGSetPipelined( HYPRE_StructSolver solver,
+                             HYPRE_Int          pipelined )
+{
+   return( HYPRE_PCGSetPipelined( (HYPRE_Solver) solver, pipelined ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPCGSetSStep( HYPRE_StructSolver solver,
+                         HYPRE_Int          s_step )
+{
+   return( HYPRE_PCGSetSStep( (HYPRE_Solver) solver, s_step ) );
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructPCGSetPrecond( HYPRE_StructSolver         solver,
                            HYPRE_PtrToStructSolverFcn precond,
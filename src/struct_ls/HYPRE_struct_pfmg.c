@@ -250,6 +250,40 @@ HYPRE_StructPFMGGetSkipRelax( HYPRE_StructSolver solver,
    return( hypre_PFMGGetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetRelaxTileDepth( HYPRE_StructSolver solver,
+                                   HYPRE_Int          relax_tile_depth )
+{
+   return( hypre_PFMGSetRelaxTileDepth( (void *) solver, relax_tile_depth) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetRelaxTileDepth( HYPRE_StructSolver solver,
+                                   HYPRE_Int        * relax_tile_depth )
+{
+   return( hypre_PFMGGetRelaxTileDepth( (void *) solver, relax_tile_depth) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetCoarseSolveSize( HYPRE_StructSolver solver,
+                                    HYPRE_Int          coarse_solve_size )
+{
+   return( hypre_PFMGSetCoarseSolveSize( (void *) solver, coarse_solve_size) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetCoarseSolveSize( HYPRE_StructSolver solver,
+                                    HYPRE_Int        * coarse_solve_size )
+{
+   return( hypre_PFMGGetCoarseSolveSize( (void *) solver, coarse_solve_size) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -27,6 +27,13 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/* coarse_solve.c */
+void *hypre_StructCoarseSolveCreate ( MPI_Comm comm );
+HYPRE_Int hypre_StructCoarseSolveDestroy ( void *coarse_vdata );
+HYPRE_Int hypre_StructCoarseSolveSetup ( void *coarse_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_StructCoarseSolve ( void *coarse_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_StructCoarseSolveGetFactored ( void *coarse_vdata , HYPRE_Int *factored );
+
 /* coarsen.c */
 HYPRE_Int hypre_StructMapFineToCoarse ( hypre_Index findex , hypre_Index index , hypre_Index stride , hypre_Index cindex );
 HYPRE_Int hypre_StructMapCoarseToFine ( hypre_Index cindex , hypre_Index index , hypre_Index stride , hypre_Index findex );
@@ -97,6 +104,7 @@ HYPRE_Int HYPRE_StructFlexGMRESSetTol ( HYPRE_StructSolver solver , HYPRE_Real t
 HYPRE_Int HYPRE_StructFlexGMRESSetAbsoluteTol ( HYPRE_StructSolver solver , HYPRE_Real atol );
 HYPRE_Int HYPRE_StructFlexGMRESSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_StructFlexGMRESSetKDim ( HYPRE_StructSolver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_StructFlexGMRESSetCGS ( HYPRE_StructSolver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_StructFlexGMRESSetPrecond ( HYPRE_StructSolver solver , HYPRE_PtrToStructSolverFcn precond , HYPRE_PtrToStructSolverFcn precond_setup , HYPRE_StructSolver precond_solver );
 HYPRE_Int HYPRE_StructFlexGMRESSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_StructFlexGMRESSetPrintLevel ( HYPRE_StructSolver solver , HYPRE_Int print_level );
@@ -113,6 +121,7 @@ HYPRE_Int HYPRE_StructGMRESSetTol ( HYPRE_StructSolver solver , HYPRE_Real tol )
 HYPRE_Int HYPRE_StructGMRESSetAbsoluteTol ( HYPRE_StructSolver solver , HYPRE_Real atol );
 HYPRE_Int HYPRE_StructGMRESSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_StructGMRESSetKDim ( HYPRE_StructSolver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_StructGMRESSetCGS ( HYPRE_StructSolver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_StructGMRESSetPrecond ( HYPRE_StructSolver solver , HYPRE_PtrToStructSolverFcn precond , HYPRE_PtrToStructSolverFcn precond_setup , HYPRE_StructSolver precond_solver );
 HYPRE_Int HYPRE_StructGMRESSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_StructGMRESSetPrintLevel ( HYPRE_StructSolver solver , HYPRE_Int print_level );
@@ -172,6 +181,7 @@ HYPRE_Int HYPRE_StructLGMRESSetTol ( HYPRE_StructSolver solver , HYPRE_Real tol
 HYPRE_Int HYPRE_StructLGMRESSetAbsoluteTol ( HYPRE_StructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_StructLGMRESSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_StructLGMRESSetKDim ( HYPRE_StructSolver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_StructLGMRESSetCGS ( HYPRE_StructSolver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_StructLGMRESSetAugDim ( HYPRE_StructSolver solver , HYPRE_Int aug_dim );
 HYPRE_Int HYPRE_StructLGMRESSetPrecond ( HYPRE_StructSolver solver , HYPRE_PtrToStructSolverFcn precond , HYPRE_PtrToStructSolverFcn precond_setup , HYPRE_StructSolver precond_solver );
 HYPRE_Int HYPRE_StructLGMRESSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
@@ -189,6 +199,8 @@ HYPRE_Int HYPRE_StructPCGSetAbsoluteTol ( HYPRE_StructSolver solver , HYPRE_Real
 HYPRE_Int HYPRE_StructPCGSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_StructPCGSetTwoNorm ( HYPRE_StructSolver solver , HYPRE_Int two_norm );
 HYPRE_Int HYPRE_StructPCGSetRelChange ( HYPRE_StructSolver solver , HYPRE_Int rel_change );
+HYPRE_Int HYPRE_StructPCGSetPipelined ( HYPRE_StructSolver solver , HYPRE_Int pipelined );
+HYPRE_Int HYPRE_StructPCGSetSStep ( HYPRE_StructSolver solver , HYPRE_Int s_step );
 HYPRE_Int HYPRE_StructPCGSetPrecond ( HYPRE_StructSolver solver , HYPRE_PtrToStructSolverFcn precond , HYPRE_PtrToStructSolverFcn precond_setup , HYPRE_StructSolver precond_solver );
 HYPRE_Int HYPRE_StructPCGSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_StructPCGSetPrintLevel ( HYPRE_StructSolver solver , HYPRE_Int print_level );
@@ -225,6 +237,10 @@ HYPRE_Int HYPRE_StructPFMGSetNumPostRelax ( HYPRE_StructSolver solver , HYPRE_In
 HYPRE_Int HYPRE_StructPFMGGetNumPostRelax ( HYPRE_StructSolver solver , HYPRE_Int *num_post_relax );
 HYPRE_Int HYPRE_StructPFMGSetSkipRelax ( HYPRE_StructSolver solver , HYPRE_Int skip_relax );
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax ( HYPRE_StructSolver solver , HYPRE_Int *skip_relax );
+HYPRE_Int HYPRE_StructPFMGSetRelaxTileDepth ( HYPRE_StructSolver solver , HYPRE_Int relax_tile_depth );
+HYPRE_Int HYPRE_StructPFMGGetRelaxTileDepth ( HYPRE_StructSolver solver , HYPRE_Int *relax_tile_depth );
+HYPRE_Int HYPRE_StructPFMGSetCoarseSolveSize ( HYPRE_StructSolver solver , HYPRE_Int coarse_solve_size );
+HYPRE_Int HYPRE_StructPFMGGetCoarseSolveSize ( HYPRE_StructSolver solver , HYPRE_Int *coarse_solve_size );
 HYPRE_Int HYPRE_StructPFMGSetDxyz ( HYPRE_StructSolver solver , HYPRE_Real *dxyz );
 HYPRE_Int HYPRE_StructPFMGSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_StructPFMGGetLogging ( HYPRE_StructSolver solver , HYPRE_Int *logging );
@@ -312,6 +328,12 @@ HYPRE_Int hypre_StructKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha , void *x );
 HYPRE_Int hypre_StructKrylovAxpy ( HYPRE_Complex alpha , void *x , void *y );
+HYPRE_Int hypre_StructKrylovInnerProdLocal ( void *x , void *y , HYPRE_Real *result );
+HYPRE_Int hypre_StructKrylovIAllreduce ( void *x , HYPRE_Real *sendbuf , HYPRE_Real *recvbuf , HYPRE_Int count , void **request );
+HYPRE_Int hypre_StructKrylovWait ( void *request );
+HYPRE_Int hypre_StructKrylovMassInnerProd ( void *x , void **y , HYPRE_Int k , HYPRE_Int unroll , void *result );
+HYPRE_Int hypre_StructKrylovMassDotpTwo ( void *x , void *y , void **z , HYPRE_Int k , HYPRE_Int unroll , void *result_x , void *result_y );
+HYPRE_Int hypre_StructKrylovMassAxpy ( HYPRE_Complex *alpha , void **x , void *y , HYPRE_Int k , HYPRE_Int unroll );
 HYPRE_Int hypre_StructKrylovIdentitySetup ( void *vdata , void *A , void *b , void *x );
 HYPRE_Int hypre_StructKrylovIdentity ( void *vdata , void *A , void *b , void *x );
 HYPRE_Int hypre_StructKrylovCommInfo ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
@@ -371,6 +393,10 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata , HYPRE_Int num_post_rela
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata , HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata , HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata , HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetRelaxTileDepth ( void *pfmg_vdata , HYPRE_Int relax_tile_depth );
+HYPRE_Int hypre_PFMGGetRelaxTileDepth ( void *pfmg_vdata , HYPRE_Int *relax_tile_depth );
+HYPRE_Int hypre_PFMGSetCoarseSolveSize ( void *pfmg_vdata , HYPRE_Int coarse_solve_size );
+HYPRE_Int hypre_PFMGGetCoarseSolveSize ( void *pfmg_vdata , HYPRE_Int *coarse_solve_size );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata , HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata , HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata , HYPRE_Int *logging );
@@ -393,6 +419,14 @@ HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata , HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata , HYPRE_Int max_iter );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata , HYPRE_Int zero_guess );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata , hypre_StructVector *t );
+HYPRE_Int hypre_PFMGRelaxSetTileDepth ( void *pfmg_relax_vdata , HYPRE_Int tile_depth );
+
+/* pfmg_relax_tiled.c */
+void *hypre_PFMGRelaxTiledCreate ( MPI_Comm comm );
+HYPRE_Int hypre_PFMGRelaxTiledDestroy ( void *tiled_vdata );
+HYPRE_Int hypre_PFMGRelaxTiledDepth ( hypre_StructMatrix *A , HYPRE_Int relax_type , HYPRE_Int depth );
+HYPRE_Int hypre_PFMGRelaxTiledSetup ( void *tiled_vdata , hypre_StructMatrix *A , HYPRE_Int relax_type , HYPRE_Int depth );
+HYPRE_Int hypre_PFMGRelaxTiled ( void *tiled_vdata , hypre_StructVector *b , hypre_StructVector *x , HYPRE_Int num_sweeps , HYPRE_Int zero_guess , HYPRE_Real weight , HYPRE_Int rb_start );
 
 /* pfmg_setup.c */
 HYPRE_Int hypre_PFMGSetup ( void *pfmg_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
@@ -482,12 +516,16 @@ HYPRE_Int hypre_StructInterpAssemble ( hypre_StructMatrix *A , hypre_StructMatri
 void *hypre_SemiInterpCreate ( void );
 HYPRE_Int hypre_SemiInterpSetup ( void *interp_vdata , hypre_StructMatrix *P , HYPRE_Int P_stored_as_transpose , hypre_StructVector *xc , hypre_StructVector *e , hypre_Index cindex , hypre_Index findex , hypre_Index stride );
 HYPRE_Int hypre_SemiInterp ( void *interp_vdata , hypre_StructMatrix *P , hypre_StructVector *xc , hypre_StructVector *e );
+HYPRE_Int hypre_SemiInterpCorrect ( void *interp_vdata , hypre_StructMatrix *P , hypre_StructVector *xc , hypre_StructVector *e , hypre_StructVector *x );
 HYPRE_Int hypre_SemiInterpDestroy ( void *interp_vdata );
 
 /* semi_restrict.c */
 void *hypre_SemiRestrictCreate ( void );
 HYPRE_Int hypre_SemiRestrictSetup ( void *restrict_vdata , hypre_StructMatrix *R , HYPRE_Int R_stored_as_transpose , hypre_StructVector *r , hypre_StructVector *rc , hypre_Index cindex , hypre_Index findex , hypre_Index stride );
 HYPRE_Int hypre_SemiRestrict ( void *restrict_vdata , hypre_StructMatrix *R , hypre_StructVector *r , hypre_StructVector *rc );
+HYPRE_Int hypre_SemiRestrictResidualSetup ( void *restrict_vdata , hypre_StructMatrix *A , hypre_StructVector *x );
+HYPRE_Int hypre_SemiRestrictHasResidual ( void *restrict_vdata );
+HYPRE_Int hypre_SemiRestrictResidual ( void *restrict_vdata , hypre_StructMatrix *R , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *b , hypre_StructVector *r , hypre_StructVector *rc );
 HYPRE_Int hypre_SemiRestrictDestroy ( void *restrict_vdata );
 
 /* semi_setup_rap.c */
@@ -0,0 +1,543 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Redundant direct solve for small coarse grids.
+ *
+ * The coarse matrix is gathered onto every process and factored there with a
+ * dense LU, so that each solve costs one gather of the right-hand side and no
+ * further communication.  This is meant for the bottom of a multigrid
+ * hierarchy, where the grid is small but spread over many processes, and
+ * relaxation would otherwise be dominated by latency.
+ *
+ * Global rows are numbered in process order, and within a process in the
+ * order of the boxes and of the box loop, so that the gathered right-hand
+ * side can be used as is.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_lapack.h"
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               global_size;
+   HYPRE_Int               local_size;
+   HYPRE_Int              *recv_sizes;
+   HYPRE_Int              *recv_displs;
+
+   HYPRE_Int               factored;   /* LU factors are usable */
+   HYPRE_Real             *lu;         /* LU factors of A^T, column major */
+   HYPRE_Int              *pivots;
+   HYPRE_Real             *rhs;
+   HYPRE_Real             *local_rhs;
+
+   HYPRE_Int               time_index;
+
+} hypre_StructCoarseSolveData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_StructCoarseSolveCreate( MPI_Comm  comm )
+{
+   hypre_StructCoarseSolveData *coarse_data;
+
+   coarse_data = hypre_CTAlloc(hypre_StructCoarseSolveData, 1, HYPRE_MEMORY_HOST);
+
+   (coarse_data -> comm)        = comm;
+   (coarse_data -> time_index)  = hypre_InitializeTiming("StructCoarseSolve");
+
+   /* initialize */
+   (coarse_data -> global_size) = 0;
+   (coarse_data -> local_size)  = 0;
+   (coarse_data -> recv_sizes)  = NULL;
+   (coarse_data -> recv_displs) = NULL;
+   (coarse_data -> factored)    = 0;
+   (coarse_data -> lu)          = NULL;
+   (coarse_data -> pivots)      = NULL;
+   (coarse_data -> rhs)         = NULL;
+   (coarse_data -> local_rhs)   = NULL;
+
+   return (void *) coarse_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructCoarseSolveDestroy( void *coarse_vdata )
+{
+   hypre_StructCoarseSolveData *coarse_data = (hypre_StructCoarseSolveData *)coarse_vdata;
+
+   if (coarse_data)
+   {
+      hypre_TFree(coarse_data -> recv_sizes, HYPRE_MEMORY_HOST);
+      hypre_TFree(coarse_data -> recv_displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(coarse_data -> lu, HYPRE_MEMORY_HOST);
+      hypre_TFree(coarse_data -> pivots, HYPRE_MEMORY_HOST);
+      hypre_TFree(coarse_data -> rhs, HYPRE_MEMORY_HOST);
+      hypre_TFree(coarse_data -> local_rhs, HYPRE_MEMORY_HOST);
+      hypre_FinalizeTiming(coarse_data -> time_index);
+      hypre_TFree(coarse_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns the global row of the grid point 'index', or -1 if the point is
+ * not on the grid.  Periodic directions are wrapped into the bounding box.
+ * The arrays 'keys' and 'rows' hold the bounding box ranks of all grid
+ * points, sorted, and the corresponding global rows.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructCoarseSolveFindRow( hypre_StructGrid *grid,
+                                hypre_Index       index,
+                                HYPRE_Int        *keys,
+                                HYPRE_Int        *rows,
+                                HYPRE_Int         num_keys )
+{
+   HYPRE_Int   ndim     = hypre_StructGridNDim(grid);
+   hypre_Box  *bbox     = hypre_StructGridBoundingBox(grid);
+   hypre_Index periodic;
+   HYPRE_Int   d, p, offset, pos;
+
+   hypre_CopyIndex(hypre_StructGridPeriodic(grid), periodic);
+   for (d = 0; d < ndim; d++)
+   {
+      p = hypre_IndexD(periodic, d);
+      if (p > 0)
+      {
+         offset = (hypre_IndexD(index, d) - hypre_BoxIMinD(bbox, d)) % p;
+         if (offset < 0)
+         {
+            offset += p;
+         }
+         hypre_IndexD(index, d) = hypre_BoxIMinD(bbox, d) + offset;
+      }
+   }
+
+   if (!hypre_IndexInBox(index, bbox))
+   {
+      return -1;
+   }
+
+   pos = hypre_BinarySearch(keys, hypre_BoxIndexRank(bbox, index), num_keys);
+
+   return (pos < 0) ? -1 : rows[pos];
+}
+
+/*--------------------------------------------------------------------------
+ * Gathers A onto every process and computes its LU factorization.  If A is
+ * found to be singular (as for pure Neumann or fully periodic problems), the
+ * factors are discarded and hypre_StructCoarseSolveGetFactored() returns 0.
+ * The outcome is the same on all processes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructCoarseSolveSetup( void               *coarse_vdata,
+                              hypre_StructMatrix *A,
+                              hypre_StructVector *b,
+                              hypre_StructVector *x )
+{
+   hypre_StructCoarseSolveData *coarse_data = (hypre_StructCoarseSolveData *)coarse_vdata;
+
+   MPI_Comm              comm = (coarse_data -> comm);
+
+   hypre_StructGrid     *grid;
+   hypre_BoxArray       *boxes;
+   hypre_Box            *box;
+   hypre_Box            *bbox;
+   hypre_Box            *A_dbox;
+   hypre_StructStencil  *stencil;
+   hypre_Index          *stencil_shape;
+   HYPRE_Int             stencil_size;
+   HYPRE_Int            *symm_elements;
+   HYPRE_Int             symmetric;
+   HYPRE_Int             constant_coefficient;
+   HYPRE_Int             diag_rank;
+
+   HYPRE_Int             num_procs, myid;
+   HYPRE_Int             ndim;
+   HYPRE_Int             global_size, local_size;
+   HYPRE_Int            *recv_sizes, *recv_displs;
+   HYPRE_Int            *local_keys, *keys, *rows;
+   HYPRE_Int             num_nz, max_nz, global_nz;
+   HYPRE_Int            *nz_sizes, *nz_displs;
+   HYPRE_Int            *local_ij, *ij;
+   HYPRE_Real           *local_values, *values;
+   HYPRE_Real           *lu;
+   HYPRE_Int            *pivots;
+   HYPRE_Real            value, pivot, min_pivot, max_pivot;
+   HYPRE_Int             info;
+
+   HYPRE_Real           *Ap;
+   hypre_Index           loop_size;
+   hypre_IndexRef        start;
+   hypre_Index           stride;
+   hypre_Index           index, nbr;
+   hypre_Index           diag_index;
+
+   HYPRE_Int             i, j, k, p, s, row, col;
+
+   hypre_BeginTiming(coarse_data -> time_index);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   grid                 = hypre_StructMatrixGrid(A);
+   ndim                 = hypre_StructGridNDim(grid);
+   boxes                = hypre_StructGridBoxes(grid);
+   bbox                 = hypre_StructGridBoundingBox(grid);
+   stencil              = hypre_StructMatrixStencil(A);
+   stencil_shape        = hypre_StructStencilShape(stencil);
+   stencil_size         = hypre_StructStencilSize(stencil);
+   symm_elements        = hypre_StructMatrixSymmElements(A);
+   symmetric            = hypre_StructMatrixSymmetric(A);
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+
+   hypre_SetIndex(diag_index, 0);
+   diag_rank = hypre_StructStencilElementRank(stencil, diag_index);
+
+   hypre_SetIndex(stride, 1);
+
+   local_size  = hypre_StructGridLocalSize(grid);
+
+   /*-----------------------------------------------------
+    * Number the global rows
+    *-----------------------------------------------------*/
+
+   recv_sizes  = hypre_CTAlloc(HYPRE_Int, num_procs,   HYPRE_MEMORY_HOST);
+   recv_displs = hypre_CTAlloc(HYPRE_Int, num_procs+1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&local_size, 1, HYPRE_MPI_INT,
+                       recv_sizes, 1, HYPRE_MPI_INT, comm);
+   for (p = 0; p < num_procs; p++)
+   {
+      recv_displs[p+1] = recv_displs[p] + recv_sizes[p];
+   }
+   global_size = recv_displs[num_procs];
+
+   local_keys = hypre_CTAlloc(HYPRE_Int, local_size,  HYPRE_MEMORY_HOST);
+   keys       = hypre_CTAlloc(HYPRE_Int, global_size, HYPRE_MEMORY_HOST);
+   rows       = hypre_CTAlloc(HYPRE_Int, global_size, HYPRE_MEMORY_HOST);
+
+   k = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      hypre_SerialBoxLoop0Begin(ndim, loop_size);
+      {
+         hypre_BoxLoopGetIndex(index);
+         hypre_AddIndexes(index, start, ndim, index);
+         local_keys[k++] = hypre_BoxIndexRank(bbox, index);
+      }
+      hypre_SerialBoxLoop0End();
+   }
+
+   hypre_MPI_Allgatherv(local_keys, local_size, HYPRE_MPI_INT,
+                        keys, recv_sizes, recv_displs, HYPRE_MPI_INT, comm);
+   for (j = 0; j < global_size; j++)
+   {
+      rows[j] = j;
+   }
+   hypre_qsort2i(keys, rows, 0, global_size-1);
+
+   /*-----------------------------------------------------
+    * Collect the local coefficients as (row, col, value)
+    * triplets.  Only the stored half of a symmetric
+    * matrix is visited, and mirrored.
+    *-----------------------------------------------------*/
+
+   max_nz       = 2*local_size*stencil_size;
+   local_ij     = hypre_CTAlloc(HYPRE_Int,  2*max_nz, HYPRE_MEMORY_HOST);
+   local_values = hypre_CTAlloc(HYPRE_Real, max_nz,   HYPRE_MEMORY_HOST);
+
+   num_nz = 0;
+   row = recv_displs[myid];
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      start  = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      hypre_SerialBoxLoop1Begin(ndim, loop_size,
+                                A_dbox, start, stride, Ai);
+      {
+         hypre_BoxLoopGetIndex(index);
+         hypre_AddIndexes(index, start, ndim, index);
+         for (s = 0; s < stencil_size; s++)
+         {
+            if (symm_elements[s] >= 0)
+            {
+               continue;
+            }
+
+            Ap = hypre_StructMatrixBoxData(A, i, s);
+            if ((constant_coefficient == 1) ||
+                (constant_coefficient == 2 && s != diag_rank))
+            {
+               value = Ap[0];
+            }
+            else
+            {
+               value = Ap[Ai];
+            }
+            if (value == 0.0)
+            {
+               continue;
+            }
+
+            hypre_AddIndexes(index, stencil_shape[s], ndim, nbr);
+            col = hypre_StructCoarseSolveFindRow(grid, nbr, keys, rows, global_size);
+            if (col < 0)
+            {
+               continue;
+            }
+
+            local_ij[2*num_nz]   = row;
+            local_ij[2*num_nz+1] = col;
+            local_values[num_nz] = value;
+            num_nz++;
+            if (symmetric && s != diag_rank)
+            {
+               local_ij[2*num_nz]   = col;
+               local_ij[2*num_nz+1] = row;
+               local_values[num_nz] = value;
+               num_nz++;
+            }
+         }
+         row++;
+      }
+      hypre_SerialBoxLoop1End(Ai);
+   }
+
+   /*-----------------------------------------------------
+    * Gather the triplets and assemble the dense matrix
+    *-----------------------------------------------------*/
+
+   nz_sizes  = hypre_CTAlloc(HYPRE_Int, num_procs,   HYPRE_MEMORY_HOST);
+   nz_displs = hypre_CTAlloc(HYPRE_Int, num_procs+1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&num_nz, 1, HYPRE_MPI_INT,
+                       nz_sizes, 1, HYPRE_MPI_INT, comm);
+   for (p = 0; p < num_procs; p++)
+   {
+      nz_displs[p+1] = nz_displs[p] + nz_sizes[p];
+   }
+   global_nz = nz_displs[num_procs];
+
+   values = hypre_CTAlloc(HYPRE_Real, global_nz, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgatherv(local_values, num_nz, HYPRE_MPI_REAL,
+                        values, nz_sizes, nz_displs, HYPRE_MPI_REAL, comm);
+   for (p = 0; p < num_procs; p++)
+   {
+      nz_sizes[p]  *= 2;
+      nz_displs[p] *= 2;
+   }
+   ij = hypre_CTAlloc(HYPRE_Int, 2*global_nz, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgatherv(local_ij, 2*num_nz, HYPRE_MPI_INT,
+                        ij, nz_sizes, nz_displs, HYPRE_MPI_INT, comm);
+
+   /* Storing A by rows gives A^T in the column major layout of LAPACK */
+   lu = hypre_CTAlloc(HYPRE_Real, global_size*global_size, HYPRE_MEMORY_HOST);
+   for (j = 0; j < global_nz; j++)
+   {
+      lu[ij[2*j]*global_size + ij[2*j+1]] += values[j];
+   }
+
+   hypre_TFree(local_keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_ij, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_values, HYPRE_MEMORY_HOST);
+   hypre_TFree(nz_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(nz_displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(ij, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------
+    * Factor.  A pivot that is small relative to the
+    * largest one is taken as a sign of a singular matrix.
+    *-----------------------------------------------------*/
+
+   pivots = hypre_CTAlloc(HYPRE_Int, global_size, HYPRE_MEMORY_HOST);
+   info = 0;
+   if (global_size > 0)
+   {
+      hypre_dgetrf(&global_size, &global_size, lu, &global_size, pivots, &info);
+   }
+
+   (coarse_data -> factored) = (info == 0);
+   if (info == 0 && global_size > 0)
+   {
+      min_pivot = max_pivot = hypre_abs(lu[0]);
+      for (j = 1; j < global_size; j++)
+      {
+         pivot = hypre_abs(lu[j*global_size + j]);
+         min_pivot = hypre_min(min_pivot, pivot);
+         max_pivot = hypre_max(max_pivot, pivot);
+      }
+      if (min_pivot <= global_size * HYPRE_REAL_EPSILON * max_pivot)
+      {
+         (coarse_data -> factored) = 0;
+      }
+   }
+
+   if (!(coarse_data -> factored))
+   {
+      hypre_TFree(lu, HYPRE_MEMORY_HOST);
+      hypre_TFree(pivots, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(coarse_data -> recv_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_data -> recv_displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_data -> lu, HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_data -> pivots, HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_data -> rhs, HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_data -> local_rhs, HYPRE_MEMORY_HOST);
+
+   (coarse_data -> global_size) = global_size;
+   (coarse_data -> local_size)  = local_size;
+   (coarse_data -> recv_sizes)  = recv_sizes;
+   (coarse_data -> recv_displs) = recv_displs;
+   (coarse_data -> lu)          = lu;
+   (coarse_data -> pivots)      = pivots;
+   (coarse_data -> rhs)         = hypre_CTAlloc(HYPRE_Real, global_size, HYPRE_MEMORY_HOST);
+   (coarse_data -> local_rhs)   = hypre_CTAlloc(HYPRE_Real, local_size, HYPRE_MEMORY_HOST);
+
+   hypre_EndTiming(coarse_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Solves A x = b with the factors computed in setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructCoarseSolve( void               *coarse_vdata,
+                         hypre_StructMatrix *A,
+                         hypre_StructVector *b,
+                         hypre_StructVector *x )
+{
+   hypre_StructCoarseSolveData *coarse_data = (hypre_StructCoarseSolveData *)coarse_vdata;
+
+   MPI_Comm              comm        = (coarse_data -> comm);
+   HYPRE_Int             global_size = (coarse_data -> global_size);
+   HYPRE_Int             local_size  = (coarse_data -> local_size);
+   HYPRE_Int            *recv_sizes  = (coarse_data -> recv_sizes);
+   HYPRE_Int            *recv_displs = (coarse_data -> recv_displs);
+   HYPRE_Real           *lu          = (coarse_data -> lu);
+   HYPRE_Int            *pivots      = (coarse_data -> pivots);
+   HYPRE_Real           *rhs         = (coarse_data -> rhs);
+   HYPRE_Real           *local_rhs   = (coarse_data -> local_rhs);
+
+   hypre_StructGrid     *grid;
+   hypre_BoxArray       *boxes;
+   hypre_Box            *box;
+   hypre_Box            *b_dbox;
+   hypre_Box            *x_dbox;
+   HYPRE_Real           *bp, *xp;
+   HYPRE_Int             ndim;
+   HYPRE_Int             myid, one, info;
+
+   hypre_Index           loop_size;
+   hypre_IndexRef        start;
+   hypre_Index           stride;
+
+   HYPRE_Int             i, k;
+
+   if (!(coarse_data -> factored))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Coarse matrix is not factored");
+      return hypre_error_flag;
+   }
+
+   hypre_BeginTiming(coarse_data -> time_index);
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   grid  = hypre_StructVectorGrid(x);
+   ndim  = hypre_StructGridNDim(grid);
+   boxes = hypre_StructGridBoxes(grid);
+   hypre_SetIndex(stride, 1);
+
+   /* gather b */
+   k = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      bp     = hypre_StructVectorBoxData(b, i);
+      start  = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      hypre_SerialBoxLoop1Begin(ndim, loop_size,
+                                b_dbox, start, stride, bi);
+      {
+         local_rhs[k++] = bp[bi];
+      }
+      hypre_SerialBoxLoop1End(bi);
+   }
+
+   hypre_MPI_Allgatherv(local_rhs, local_size, HYPRE_MPI_REAL,
+                        rhs, recv_sizes, recv_displs, HYPRE_MPI_REAL, comm);
+
+   /* solve with the transpose of the stored factors of A^T */
+   one = 1;
+   hypre_dgetrs("T", &global_size, &one, lu, &global_size, pivots,
+                rhs, &global_size, &info);
+
+   /* copy the local part of the solution into x */
+   k = recv_displs[myid];
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      xp     = hypre_StructVectorBoxData(x, i);
+      start  = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      hypre_SerialBoxLoop1Begin(ndim, loop_size,
+                                x_dbox, start, stride, xi);
+      {
+         xp[xi] = rhs[k++];
+      }
+      hypre_SerialBoxLoop1End(xi);
+   }
+
+   hypre_IncFLOPCount(2*global_size*global_size);
+   hypre_EndTiming(coarse_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructCoarseSolveGetFactored( void      *coarse_vdata,
+                                    HYPRE_Int *factored )
+{
+   hypre_StructCoarseSolveData *coarse_data = (hypre_StructCoarseSolveData *)coarse_vdata;
+
+   *factored = (coarse_data -> factored);
+
+   return hypre_error_flag;
+}
@@ -181,6 +181,143 @@ hypre_StructKrylovAxpy( HYPRE_Complex alpha,
                               (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProdLocal( void       *x,
+                                  void       *y,
+                                  HYPRE_Real *result )
+{
+   *result = hypre_StructInnerProdLocal( (hypre_StructVector *) x,
+                                         (hypre_StructVector *) y );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovIAllreduce( void        *x,
+                              HYPRE_Real  *sendbuf,
+                              HYPRE_Real  *recvbuf,
+                              HYPRE_Int    count,
+                              void       **request )
+{
+   hypre_MPI_Request *mpi_request = hypre_CTAlloc(hypre_MPI_Request, 1, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Iallreduce(sendbuf, recvbuf, count, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                        hypre_StructVectorComm((hypre_StructVector *) x), mpi_request);
+   *request = (void *) mpi_request;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovWait( void *request )
+{
+   hypre_MPI_Request *mpi_request = (hypre_MPI_Request *) request;
+   hypre_MPI_Status   status;
+
+   hypre_MPI_Wait(mpi_request, &status);
+   hypre_TFree(mpi_request, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes <x,y[j]> for j = 0,...,k-1 with a single reduction.  The unroll
+ * argument is ignored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovMassInnerProd( void       *x,
+                                 void      **y,
+                                 HYPRE_Int   k,
+                                 HYPRE_Int   unroll,
+                                 void       *result )
+{
+   hypre_StructVector *xv = (hypre_StructVector *) x;
+   HYPRE_Real  *local_result;
+   HYPRE_Int    j;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, k, HYPRE_MEMORY_HOST);
+   for (j = 0; j < k; j++)
+   {
+      local_result[j] = hypre_StructInnerProdLocal(xv, (hypre_StructVector *) y[j]);
+   }
+   hypre_MPI_Allreduce(local_result, result, k, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, hypre_StructVectorComm(xv));
+   hypre_IncFLOPCount(2*k*hypre_StructVectorGlobalSize(xv));
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes <x,z[j]> and <y,z[j]> for j = 0,...,k-1 with a single reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovMassDotpTwo( void       *x,
+                               void       *y,
+                               void      **z,
+                               HYPRE_Int   k,
+                               HYPRE_Int   unroll,
+                               void       *result_x,
+                               void       *result_y )
+{
+   hypre_StructVector *xv = (hypre_StructVector *) x;
+   hypre_StructVector *yv = (hypre_StructVector *) y;
+   HYPRE_Real  *local_result, *result;
+   HYPRE_Int    j;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, 2*k, HYPRE_MEMORY_HOST);
+   result       = hypre_CTAlloc(HYPRE_Real, 2*k, HYPRE_MEMORY_HOST);
+   for (j = 0; j < k; j++)
+   {
+      local_result[j] = hypre_StructInnerProdLocal(xv, (hypre_StructVector *) z[j]);
+      local_result[k+j] = hypre_StructInnerProdLocal(yv, (hypre_StructVector *) z[j]);
+   }
+   hypre_MPI_Allreduce(local_result, result, 2*k, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, hypre_StructVectorComm(xv));
+   hypre_IncFLOPCount(4*k*hypre_StructVectorGlobalSize(xv));
+   for (j = 0; j < k; j++)
+   {
+      ((HYPRE_Real *) result_x)[j] = result[j];
+      ((HYPRE_Real *) result_y)[j] = result[k+j];
+   }
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+   hypre_TFree(result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes y += sum_j alpha[j]*x[j].  The unroll argument is ignored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovMassAxpy( HYPRE_Complex  *alpha,
+                            void          **x,
+                            void           *y,
+                            HYPRE_Int       k,
+                            HYPRE_Int       unroll )
+{
+   HYPRE_Int j;
+
+   for (j = 0; j < k; j++)
+   {
+      hypre_StructAxpy(alpha[j], (hypre_StructVector *) x[j], (hypre_StructVector *) y);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
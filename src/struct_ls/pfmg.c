@@ -37,11 +37,14 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> num_pre_relax)    = 1;
    (pfmg_data -> num_post_relax)   = 1;
    (pfmg_data -> skip_relax)       = 1;
+   (pfmg_data -> relax_tile_depth) = 1;
+   (pfmg_data -> coarse_solve_size)= 0;       /* no direct coarse solve */
    (pfmg_data -> logging)          = 0;
    (pfmg_data -> print_level)      = 0;
 
    /* initialize */
    (pfmg_data -> num_levels)  = -1;
+   (pfmg_data -> coarse_solve_data) = NULL;
 #if defined(HYPRE_USING_CUDA)
    (pfmg_data -> devicelevel) = 200;
 #endif
@@ -87,6 +90,7 @@ hypre_PFMGDestroy( void *pfmg_vdata )
          hypre_TFree(pfmg_data -> matvec_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> restrict_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> interp_data_l, HYPRE_MEMORY_HOST);
+         hypre_StructCoarseSolveDestroy(pfmg_data -> coarse_solve_data);
  
          hypre_StructVectorDestroy(pfmg_data -> tx_l[0]);
          hypre_StructGridDestroy(pfmg_data -> grid_l[0]);
@@ -404,6 +408,56 @@ hypre_PFMGGetSkipRelax( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetRelaxTileDepth( void *pfmg_vdata,
+                             HYPRE_Int  relax_tile_depth )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+ 
+   (pfmg_data -> relax_tile_depth) = relax_tile_depth;
+ 
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetRelaxTileDepth( void *pfmg_vdata,
+                             HYPRE_Int *relax_tile_depth )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+ 
+   *relax_tile_depth = (pfmg_data -> relax_tile_depth);
+ 
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetCoarseSolveSize( void *pfmg_vdata,
+                              HYPRE_Int  coarse_solve_size )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+ 
+   (pfmg_data -> coarse_solve_size) = coarse_solve_size;
+ 
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetCoarseSolveSize( void *pfmg_vdata,
+                              HYPRE_Int *coarse_solve_size )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+ 
+   *coarse_solve_size = (pfmg_data -> coarse_solve_size);
+ 
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
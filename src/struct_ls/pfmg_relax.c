@@ -16,6 +16,9 @@ typedef struct
    void                   *rb_relax_data;
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
+   HYPRE_Int               rb_start;
+   HYPRE_Int               tile_depth;  /* sweeps per ghost exchange */
+   void                   *tiled_data;  /* non-NULL if tiled relaxation is used */
 
 } hypre_PFMGRelaxData;
 
@@ -32,6 +35,9 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
+   (pfmg_relax_data -> rb_start) = 1;
+   (pfmg_relax_data -> tile_depth) = 1;
+   (pfmg_relax_data -> tiled_data) = NULL;
 
    return (void *) pfmg_relax_data;
 }
@@ -48,6 +54,7 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_PFMGRelaxTiledDestroy(pfmg_relax_data -> tiled_data);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -66,6 +73,25 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
    HYPRE_Int    relax_type = (pfmg_relax_data -> relax_type);
    HYPRE_Int    constant_coefficient= hypre_StructMatrixConstantCoefficient(A);
+   void        *relax_data = (pfmg_relax_data -> relax_data);
+   HYPRE_Real   tol, weight;
+   HYPRE_Int    max_iter, zero_guess;
+
+   /* the relaxation parameters are also kept in the point relax data */
+   if (pfmg_relax_data -> tiled_data)
+   {
+      hypre_PointRelaxGetTol(relax_data, &tol);
+      if (tol == 0.0)
+      {
+         hypre_PointRelaxGetMaxIter(relax_data, &max_iter);
+         hypre_PointRelaxGetZeroGuess(relax_data, &zero_guess);
+         weight = (relax_type == 1) ? (pfmg_relax_data -> jacobi_weight) : 1.0;
+         hypre_PFMGRelaxTiled((pfmg_relax_data -> tiled_data), b, x, max_iter,
+                              zero_guess, weight, (pfmg_relax_data -> rb_start));
+
+         return hypre_error_flag;
+      }
+   }
 
    switch(relax_type)
    {
@@ -103,6 +129,7 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data  = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
    HYPRE_Int            relax_type       = (pfmg_relax_data -> relax_type);
    HYPRE_Real           jacobi_weight    = (pfmg_relax_data -> jacobi_weight); 
+   HYPRE_Int            tile_depth       = (pfmg_relax_data -> tile_depth);
 
    switch(relax_type)
    {
@@ -120,6 +147,20 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    {
       hypre_PointRelaxSetWeight(pfmg_relax_data -> relax_data, jacobi_weight);
    }
+
+   hypre_PFMGRelaxTiledDestroy(pfmg_relax_data -> tiled_data);
+   (pfmg_relax_data -> tiled_data) = NULL;
+   if (tile_depth > 1)
+   {
+      tile_depth = hypre_PFMGRelaxTiledDepth(A, relax_type, tile_depth);
+   }
+   if (tile_depth > 1)
+   {
+      (pfmg_relax_data -> tiled_data) =
+         hypre_PFMGRelaxTiledCreate(hypre_StructMatrixComm(A));
+      hypre_PFMGRelaxTiledSetup((pfmg_relax_data -> tiled_data), A, relax_type,
+                                tile_depth);
+   }
    
    return hypre_error_flag;
 }
@@ -191,10 +232,12 @@ hypre_PFMGRelaxSetPreRelax( void  *pfmg_relax_vdata )
 
       case 2: /* Red-Black Gauss-Seidel */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         (pfmg_relax_data -> rb_start) = 1;
          break;
 
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         (pfmg_relax_data -> rb_start) = 1;
          break;
    }
 
@@ -218,10 +261,12 @@ hypre_PFMGRelaxSetPostRelax( void  *pfmg_relax_vdata )
 
       case 2: /* Red-Black Gauss-Seidel */
          hypre_RedBlackGSSetStartBlack((pfmg_relax_data -> rb_relax_data));
+         (pfmg_relax_data -> rb_start) = 0;
          break;
 
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         (pfmg_relax_data -> rb_start) = 1;
          break;
    }
 
@@ -287,3 +332,18 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Number of sweeps done per ghost exchange (see pfmg_relax_tiled.c).  Takes
+ * effect in the next call to hypre_PFMGRelaxSetup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetTileDepth( void      *pfmg_relax_vdata,
+                             HYPRE_Int  tile_depth )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   (pfmg_relax_data -> tile_depth) = tile_depth;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,671 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Temporally tiled PFMG relaxation
+ *
+ * Applies up to `depth' Jacobi or red-black Gauss-Seidel sweeps per ghost
+ * exchange.  The matrix, right-hand side and iterate are copied into work
+ * objects with `depth' ghost layers (2*depth for red-black, one per
+ * half-sweep), so each sweep (stage) can be redone redundantly on the
+ * ghost points that the following stages need.  Stage s of n updates the
+ * grid box grown by n-s points.  The ghost rows of the matrix are fetched
+ * once in setup.
+ *
+ * Within a box, the stages run as a wavefront over the planes of the last
+ * dimension: in each step stage s relaxes the plane just behind the one
+ * relaxed by stage s-1, so all stages work on a slab of a few planes that
+ * stays in cache instead of streaming the whole box once per sweep.
+ *
+ * Ghost points outside the domain are identity rows (see
+ * hypre_StructMatrixAssemble) with zero right-hand side, so boundary ghost
+ * values of the iterate are taken to be zero as in the untiled relaxation.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+#if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && \
+    !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_PFMG_RELAX_TILED
+#endif
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               relax_type;   /* 0/1 Jacobi, 2/3 red-black GS */
+   HYPRE_Int               depth;        /* sweeps per ghost exchange */
+   HYPRE_Int               diag_rank;
+
+   hypre_StructMatrix     *A;            /* copy of A with deep ghost rows */
+   hypre_StructVector     *b;
+   hypre_StructVector     *x[2];         /* x[1] only used by Jacobi */
+   hypre_CommPkg          *comm_pkg;
+
+} hypre_PFMGRelaxTiledData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_PFMGRelaxTiledCreate( MPI_Comm  comm )
+{
+   hypre_PFMGRelaxTiledData *tiled_data;
+
+   tiled_data = hypre_CTAlloc(hypre_PFMGRelaxTiledData, 1, HYPRE_MEMORY_HOST);
+   (tiled_data -> comm)  = comm;
+   (tiled_data -> depth) = 1;
+
+   return (void *) tiled_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxTiledDestroy( void *tiled_vdata )
+{
+   hypre_PFMGRelaxTiledData *tiled_data = (hypre_PFMGRelaxTiledData *)tiled_vdata;
+
+   if (tiled_data)
+   {
+      hypre_StructMatrixDestroy(tiled_data -> A);
+      hypre_StructVectorDestroy(tiled_data -> b);
+      hypre_StructVectorDestroy(tiled_data -> x[0]);
+      hypre_StructVectorDestroy(tiled_data -> x[1]);
+      hypre_CommPkgDestroy(tiled_data -> comm_pkg);
+      hypre_TFree(tiled_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGRelaxTiledDepth
+ *
+ * Returns the number of sweeps per ghost exchange, at most `depth', that the
+ * tiled relaxation can do on A with this relaxation type, or 0 if it does
+ * not handle A.  Supported are variable coefficients in 2D or 3D with a
+ * stencil in the unit cube that contains the diagonal (for red-black GS, a
+ * 5-pt or 7-pt stencil and even periods).  The ghost depth is limited by the
+ * neighborhood known to the grid's box manager.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxTiledDepth( hypre_StructMatrix *A,
+                           HYPRE_Int           relax_type,
+                           HYPRE_Int           depth )
+{
+#ifdef HYPRE_PFMG_RELAX_TILED
+   hypre_StructGrid    *grid          = hypre_StructMatrixGrid(A);
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int            ndim          = hypre_StructMatrixNDim(A);
+   HYPRE_Int            red_black     = (relax_type == 2 || relax_type == 3);
+   hypre_Index          diag_index;
+   HYPRE_Int            known, max_layers;
+   HYPRE_Int            si, d, nnzd;
+
+   if (hypre_StructMatrixConstantCoefficient(A) != 0 || (ndim != 2 && ndim != 3) ||
+       relax_type < 0 || relax_type > 3)
+   {
+      return 0;
+   }
+
+   hypre_SetIndex(diag_index, 0);
+   if (hypre_StructStencilElementRank(stencil, diag_index) < 0)
+   {
+      return 0;
+   }
+
+   for (si = 0; si < stencil_size; si++)
+   {
+      nnzd = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_abs(hypre_IndexD(stencil_shape[si], d)) > 1)
+         {
+            return 0;
+         }
+         nnzd += (hypre_IndexD(stencil_shape[si], d) != 0);
+      }
+      if (red_black && nnzd > 1)
+      {
+         return 0;
+      }
+   }
+   if (red_black && stencil_size != 2*ndim + 1)
+   {
+      return 0;
+   }
+
+   /* red-black colors of periodic ghost points must match their images */
+   if (red_black)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_IndexD(hypre_StructGridPeriodic(grid), d) % 2)
+         {
+            return 0;
+         }
+      }
+   }
+
+   hypre_BoxManGetAllGlobalKnown(hypre_StructGridBoxMan(grid), &known);
+   if (!known)
+   {
+      max_layers = hypre_IndexMin(hypre_StructGridMaxDistance(grid), ndim);
+      depth = hypre_min(depth, red_black ? max_layers/2 : max_layers);
+   }
+
+   return depth;
+#else
+   return 0;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGRelaxTiledSetup
+ *
+ * Builds the deep-ghost copies of A, b and x for `depth' sweeps per ghost
+ * exchange.  depth must be a value returned by hypre_PFMGRelaxTiledDepth.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxTiledSetup( void               *tiled_vdata,
+                           hypre_StructMatrix *A,
+                           HYPRE_Int           relax_type,
+                           HYPRE_Int           depth )
+{
+   hypre_PFMGRelaxTiledData *tiled_data = (hypre_PFMGRelaxTiledData *)tiled_vdata;
+
+   MPI_Comm             comm    = (tiled_data -> comm);
+   HYPRE_Int            ndim    = hypre_StructMatrixNDim(A);
+   hypre_StructGrid    *grid    = hypre_StructMatrixGrid(A);
+   hypre_StructStencil *stencil = hypre_StructMatrixStencil(A);
+   HYPRE_Int            stencil_size = hypre_StructStencilSize(stencil);
+   hypre_BoxArray      *boxes   = hypre_StructGridBoxes(grid);
+
+   hypre_StructMatrix  *tA;
+   hypre_StructVector  *tv[3];
+   hypre_CommInfo      *comm_info;
+   hypre_CommHandle    *comm_handle;
+   hypre_Box           *box;
+   hypre_Box           *A_dbox;
+   hypre_Box           *tA_dbox;
+   HYPRE_Real          *Ap;
+   HYPRE_Real          *tAp;
+   hypre_IndexRef       start;
+   hypre_Index          loop_size;
+   hypre_Index          ustride;
+   hypre_Index          diag_index;
+   HYPRE_Int            num_ghost[2*HYPRE_MAXDIM];
+   HYPRE_Int            num_layers;
+   HYPRE_Int            i, si, d;
+
+   hypre_StructMatrixDestroy(tiled_data -> A);
+   hypre_StructVectorDestroy(tiled_data -> b);
+   hypre_StructVectorDestroy(tiled_data -> x[0]);
+   hypre_StructVectorDestroy(tiled_data -> x[1]);
+   hypre_CommPkgDestroy(tiled_data -> comm_pkg);
+
+   /* one ghost layer per stage; red-black stages are half-sweeps */
+   num_layers = (relax_type == 2 || relax_type == 3) ? 2*depth : depth;
+   for (d = 0; d < 2*HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] = (d < 2*ndim) ? num_layers : 0;
+   }
+
+   hypre_SetIndex(diag_index, 0);
+   (tiled_data -> relax_type) = relax_type;
+   (tiled_data -> depth)      = depth;
+   (tiled_data -> diag_rank)  = hypre_StructStencilElementRank(stencil, diag_index);
+
+   /*-----------------------------------------------------------
+    * Copy A and fetch the ghost rows
+    *-----------------------------------------------------------*/
+
+   tA = hypre_StructMatrixCreate(comm, grid, stencil);
+   hypre_StructMatrixSetNumGhost(tA, num_ghost);
+   hypre_StructMatrixInitialize(tA);
+
+   hypre_SetIndex(ustride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box     = hypre_BoxArrayBox(boxes, i);
+      A_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      tA_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(tA), i);
+      start   = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         Ap  = hypre_StructMatrixBoxData(A, i, si);
+         tAp = hypre_StructMatrixBoxData(tA, i, si);
+
+#define DEVICE_VAR is_device_ptr(tAp,Ap)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             A_dbox, start, ustride, Ai,
+                             tA_dbox, start, ustride, tAi);
+         {
+            tAp[tAi] = Ap[Ai];
+         }
+         hypre_BoxLoop2End(Ai, tAi);
+#undef DEVICE_VAR
+      }
+   }
+
+   hypre_StructMatrixAssemble(tA);
+
+   /*-----------------------------------------------------------
+    * Work vectors and their deep ghost exchange
+    *-----------------------------------------------------------*/
+
+   for (i = 0; i < 3; i++)
+   {
+      tv[i] = hypre_StructVectorCreate(comm, grid);
+      hypre_StructVectorSetNumGhost(tv[i], num_ghost);
+      hypre_StructVectorInitialize(tv[i]);
+      hypre_StructVectorAssemble(tv[i]);
+   }
+
+   hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+   hypre_CommPkgCreate(comm_info,
+                       hypre_StructVectorDataSpace(tv[0]),
+                       hypre_StructVectorDataSpace(tv[0]),
+                       1, NULL, 0, comm, &(tiled_data -> comm_pkg));
+   hypre_CommInfoDestroy(comm_info);
+
+   /* the first communication with a new comm_pkg completes its setup, so do
+      it here; after that x and b can be exchanged at the same time */
+   hypre_InitializeCommunication((tiled_data -> comm_pkg),
+                                 hypre_StructVectorData(tv[0]),
+                                 hypre_StructVectorData(tv[0]), 0, 0, &comm_handle);
+   hypre_FinalizeCommunication(comm_handle);
+
+   (tiled_data -> A)    = tA;
+   (tiled_data -> b)    = tv[0];
+   (tiled_data -> x[0]) = tv[1];
+   (tiled_data -> x[1]) = tv[2];
+
+   return hypre_error_flag;
+}
+
+#if defined(HYPRE_USING_OPENMP)
+#define HYPRE_PFMG_RELAX_TILED_SIMD Pragma(omp simd)
+#elif defined(__GNUC__) && !defined(__clang__)
+#define HYPRE_PFMG_RELAX_TILED_SIMD _Pragma("GCC ivdep")
+#else
+#define HYPRE_PFMG_RELAX_TILED_SIMD
+#endif
+
+/*--------------------------------------------------------------------------
+ * Row kernels: relax points istart, istart+istep, ... < ni of the row that
+ * starts at rank ri.  Jacobi rows (istep = 1) read xin and write xout;
+ * red-black rows (istep = 2) have xin = xout.  COMPUTE_RES sets res to the
+ * residual b - (A - D) x at point i.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_PFMGRelaxTiledRowLoop(COMPUTE_RES)                              \
+   if (istep == 1 && weight != 1.0)                                           \
+   {                                                                          \
+      HYPRE_PFMG_RELAX_TILED_SIMD                                             \
+      for (i = 0; i < ni; i++)                                                \
+      {                                                                       \
+         HYPRE_Real res;                                                      \
+         COMPUTE_RES;                                                         \
+         ol[i] = weight * (res / dl[i]) + weightc * il[i];                    \
+      }                                                                       \
+   }                                                                          \
+   else if (istep == 1)                                                       \
+   {                                                                          \
+      HYPRE_PFMG_RELAX_TILED_SIMD                                             \
+      for (i = 0; i < ni; i++)                                                \
+      {                                                                       \
+         HYPRE_Real res;                                                      \
+         COMPUTE_RES;                                                         \
+         ol[i] = res / dl[i];                                                 \
+      }                                                                       \
+   }                                                                          \
+   else                                                                       \
+   {                                                                          \
+      for (i = istart; i < ni; i += istep)                                    \
+      {                                                                       \
+         HYPRE_Real res;                                                      \
+         COMPUTE_RES;                                                         \
+         ol[i] = res / dl[i];                                                 \
+      }                                                                       \
+   }
+
+#define hypre_PFMGRelaxTiledRowArgs                                           \
+   HYPRE_Int    noff,                                                         \
+   HYPRE_Int    istart,                                                       \
+   HYPRE_Int    ni,                                                           \
+   HYPRE_Int    istep,                                                        \
+   HYPRE_Real   weight,                                                       \
+   HYPRE_Real **Ao,                                                           \
+   HYPRE_Int   *xoff,                                                         \
+   HYPRE_Int    ri,                                                           \
+   HYPRE_Real  *Ad,                                                           \
+   HYPRE_Real  *bp,                                                           \
+   HYPRE_Real  *xin,                                                          \
+   HYPRE_Real  *xout
+
+#define hypre_PFMGRelaxTiledRowInit                                           \
+   HYPRE_Real  *dl = Ad + ri;                                                 \
+   HYPRE_Real  *bl = bp + ri;                                                 \
+   HYPRE_Real  *il = xin + ri;                                                \
+   HYPRE_Real  *ol = xout + ri;                                               \
+   HYPRE_Real   weightc = 1.0 - weight;                                       \
+   HYPRE_Int    i
+
+/* 5-pt stencil in 2D */
+static void
+hypre_PFMGRelaxTiledRow4( hypre_PFMGRelaxTiledRowArgs )
+{
+   hypre_PFMGRelaxTiledRowInit;
+   HYPRE_Real *a0 = Ao[0] + ri, *x0 = xin + ri + xoff[0];
+   HYPRE_Real *a1 = Ao[1] + ri, *x1 = xin + ri + xoff[1];
+   HYPRE_Real *a2 = Ao[2] + ri, *x2 = xin + ri + xoff[2];
+   HYPRE_Real *a3 = Ao[3] + ri, *x3 = xin + ri + xoff[3];
+
+   hypre_PFMGRelaxTiledRowLoop(
+      res = bl[i] - a0[i] * x0[i] - a1[i] * x1[i] - a2[i] * x2[i]
+                  - a3[i] * x3[i]);
+}
+
+/* 7-pt stencil in 3D */
+static void
+hypre_PFMGRelaxTiledRow6( hypre_PFMGRelaxTiledRowArgs )
+{
+   hypre_PFMGRelaxTiledRowInit;
+   HYPRE_Real *a0 = Ao[0] + ri, *x0 = xin + ri + xoff[0];
+   HYPRE_Real *a1 = Ao[1] + ri, *x1 = xin + ri + xoff[1];
+   HYPRE_Real *a2 = Ao[2] + ri, *x2 = xin + ri + xoff[2];
+   HYPRE_Real *a3 = Ao[3] + ri, *x3 = xin + ri + xoff[3];
+   HYPRE_Real *a4 = Ao[4] + ri, *x4 = xin + ri + xoff[4];
+   HYPRE_Real *a5 = Ao[5] + ri, *x5 = xin + ri + xoff[5];
+
+   hypre_PFMGRelaxTiledRowLoop(
+      res = bl[i] - a0[i] * x0[i] - a1[i] * x1[i] - a2[i] * x2[i]
+                  - a3[i] * x3[i] - a4[i] * x4[i] - a5[i] * x5[i]);
+}
+
+/* any other stencil */
+static void
+hypre_PFMGRelaxTiledRowN( hypre_PFMGRelaxTiledRowArgs )
+{
+   hypre_PFMGRelaxTiledRowInit;
+   HYPRE_Real *al[26];
+   HYPRE_Real *xl[26];
+   HYPRE_Int   t;
+
+   for (t = 0; t < noff; t++)
+   {
+      al[t] = Ao[t] + ri;
+      xl[t] = xin + ri + xoff[t];
+   }
+
+   hypre_PFMGRelaxTiledRowLoop(
+      {
+         HYPRE_Int tt;
+         res = bl[i];
+         for (tt = 0; tt < noff; tt++)
+         {
+            res -= al[tt][i] * xl[tt][i];
+         }
+      });
+}
+
+/*--------------------------------------------------------------------------
+ * Relaxes stage s (1-based) of num_stages on all points of the plane z
+ * (in the last dimension) of the box grown by num_stages-s.  Jacobi stages
+ * read x[(s-1)%2] and write x[s%2] relative to x_cur; red-black stages
+ * relax the points of color (rb+s-1)%2 of x[x_cur] in place.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PFMGRelaxTiledPlane( hypre_PFMGRelaxTiledData *tiled_data,
+                           HYPRE_Int                 bi,
+                           HYPRE_Int                 s,
+                           HYPRE_Int                 num_stages,
+                           HYPRE_Int                 z,
+                           HYPRE_Int                 x_cur,
+                           HYPRE_Real                weight,
+                           HYPRE_Int                 rb )
+{
+   HYPRE_Int            relax_type    = (tiled_data -> relax_type);
+   HYPRE_Int            diag_rank     = (tiled_data -> diag_rank);
+   hypre_StructMatrix  *A             = (tiled_data -> A);
+   HYPRE_Int            ndim          = hypre_StructMatrixNDim(A);
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   hypre_Box           *box  = hypre_BoxArrayBox(hypre_StructGridBoxes(hypre_StructMatrixGrid(A)), bi);
+   hypre_Box           *dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), bi);
+   HYPRE_Int            red_black = (relax_type == 2 || relax_type == 3);
+   HYPRE_Int            grow = num_stages - s;
+
+   HYPRE_Real          *Ad;
+   HYPRE_Real          *Ao[26];
+   HYPRE_Int            xoff[26];
+   HYPRE_Real          *bp;
+   HYPRE_Real          *xin;
+   HYPRE_Real          *xout;
+   hypre_Index          index;
+   HYPRE_Int            ilo, jlo, ni, nj, jstride, color;
+   HYPRE_Int            noff, si, j, ri, r0, istart;
+
+   void               (*row_kernel)(HYPRE_Int, HYPRE_Int, HYPRE_Int, HYPRE_Int,
+                                    HYPRE_Real, HYPRE_Real **, HYPRE_Int *,
+                                    HYPRE_Int, HYPRE_Real *, HYPRE_Real *,
+                                    HYPRE_Real *, HYPRE_Real *);
+
+   Ad   = hypre_StructMatrixBoxData(A, bi, diag_rank);
+   noff = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      if (si != diag_rank)
+      {
+         Ao[noff]   = hypre_StructMatrixBoxData(A, bi, si);
+         xoff[noff] = hypre_BoxOffsetDistance(dbox, stencil_shape[si]);
+         noff++;
+      }
+   }
+
+   bp = hypre_StructVectorBoxData(tiled_data -> b, bi);
+   if (red_black)
+   {
+      xin  = hypre_StructVectorBoxData(tiled_data -> x[x_cur], bi);
+      xout = xin;
+   }
+   else
+   {
+      xin  = hypre_StructVectorBoxData(tiled_data -> x[(x_cur + s - 1) % 2], bi);
+      xout = hypre_StructVectorBoxData(tiled_data -> x[(x_cur + s) % 2], bi);
+   }
+   color = (rb + s - 1) % 2;
+
+   /* the plane is an ni x nj array of points (nj = 1 in 2D) */
+   ilo = hypre_BoxIMinD(box, 0) - grow;
+   ni  = hypre_BoxSizeD(box, 0) + 2*grow;
+   if (ndim == 3)
+   {
+      jlo = hypre_BoxIMinD(box, 1) - grow;
+      nj  = hypre_BoxSizeD(box, 1) + 2*grow;
+      jstride = hypre_BoxSizeD(dbox, 0);
+      hypre_SetIndex3(index, ilo, jlo, z);
+   }
+   else
+   {
+      jlo = z;
+      nj  = 1;
+      jstride = 0;
+      hypre_SetIndex3(index, ilo, z, 0);
+   }
+   r0 = hypre_BoxIndexRank(dbox, index);
+
+   switch (noff)
+   {
+      case 4:  row_kernel = hypre_PFMGRelaxTiledRow4; break;
+      case 6:  row_kernel = hypre_PFMGRelaxTiledRow6; break;
+      default: row_kernel = hypre_PFMGRelaxTiledRowN; break;
+   }
+
+   for (j = 0; j < nj; j++)
+   {
+      ri = r0 + j*jstride;
+      if (red_black)
+      {
+         /* first point of this color in the row */
+         istart = hypre_abs(color + ilo + jlo + j + ((ndim == 3) ? z : 0)) % 2;
+         row_kernel(noff, istart, ni, 2, 1.0, Ao, xoff, ri, Ad, bp, xin, xout);
+      }
+      else
+      {
+         row_kernel(noff, 0, ni, 1, weight, Ao, xoff, ri, Ad, bp, xin, xout);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGRelaxTiled
+ *
+ * Does num_sweeps sweeps of the relaxation chosen in setup on A x = b.
+ * For Jacobi, `weight' is the Jacobi weight; for red-black GS, rb_start is
+ * the color relaxed first (as in hypre_RedBlackGSSetStartRed/Black).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxTiled( void               *tiled_vdata,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x,
+                      HYPRE_Int           num_sweeps,
+                      HYPRE_Int           zero_guess,
+                      HYPRE_Real          weight,
+                      HYPRE_Int           rb_start )
+{
+   hypre_PFMGRelaxTiledData *tiled_data = (hypre_PFMGRelaxTiledData *)tiled_vdata;
+
+   HYPRE_Int            relax_type = (tiled_data -> relax_type);
+   HYPRE_Int            depth      = (tiled_data -> depth);
+   hypre_CommPkg       *comm_pkg   = (tiled_data -> comm_pkg);
+   hypre_StructVector  *tb         = (tiled_data -> b);
+   hypre_StructVector **tx         = (tiled_data -> x);
+   HYPRE_Int            ndim       = hypre_StructVectorNDim(x);
+   hypre_BoxArray      *boxes      = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+   HYPRE_Int            red_black  = (relax_type == 2 || relax_type == 3);
+
+   hypre_CommHandle    *x_handle;
+   hypre_CommHandle    *b_handle;
+   hypre_Box           *box;
+   HYPRE_Real          *xp;
+   HYPRE_Int            x_cur, first, num_tiled, num_stages;
+   HYPRE_Int            zlo, zhi, zstart, grow, step, num_steps, s, z, i;
+
+   if (num_sweeps == 0)
+   {
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+      return hypre_error_flag;
+   }
+
+   hypre_StructCopy(b, tb);
+   if (zero_guess)
+   {
+      /* zero the ghost layers too, so no exchange is needed for x */
+      xp = hypre_StructVectorData(tx[0]);
+      for (i = 0; i < hypre_StructVectorDataSize(tx[0]); i++)
+      {
+         xp[i] = 0.0;
+      }
+   }
+   else
+   {
+      hypre_StructCopy(x, tx[0]);
+   }
+
+   x_cur = 0;
+   first = 1;
+   while (num_sweeps > 0)
+   {
+      num_tiled  = hypre_min(depth, num_sweeps);
+      num_stages = red_black ? 2*num_tiled : num_tiled;
+
+      /*-----------------------------------------------------------
+       * One ghost exchange for num_tiled sweeps
+       *-----------------------------------------------------------*/
+
+      x_handle = NULL;
+      b_handle = NULL;
+      if (!(first && zero_guess))
+      {
+         xp = hypre_StructVectorData(tx[x_cur]);
+         hypre_InitializeCommunication(comm_pkg, xp, xp, 0, 0, &x_handle);
+      }
+      if (first)
+      {
+         xp = hypre_StructVectorData(tb);
+         hypre_InitializeCommunication(comm_pkg, xp, xp, 0, 1, &b_handle);
+      }
+      if (x_handle)
+      {
+         hypre_FinalizeCommunication(x_handle);
+      }
+      if (b_handle)
+      {
+         hypre_FinalizeCommunication(b_handle);
+      }
+
+      /*-----------------------------------------------------------
+       * Plane wavefront: in step `step', stage s relaxes the plane
+       * zstart + step - (s-1), one plane behind stage s-1
+       *-----------------------------------------------------------*/
+
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+         zlo = hypre_BoxIMinD(box, ndim - 1);
+         zhi = hypre_BoxIMaxD(box, ndim - 1);
+         zstart    = zlo - (num_stages - 1);
+         num_steps = (zhi - zstart + 1) + (num_stages - 1);
+
+         for (step = 0; step < num_steps; step++)
+         {
+            for (s = 1; s <= num_stages; s++)
+            {
+               grow = num_stages - s;
+               z    = zstart + step - (s - 1);
+               if (z >= zlo - grow && z <= zhi + grow)
+               {
+                  hypre_PFMGRelaxTiledPlane(tiled_data, i, s, num_stages, z,
+                                            x_cur, weight, rb_start);
+               }
+            }
+         }
+      }
+
+      if (!red_black)
+      {
+         x_cur = (x_cur + num_tiled) % 2;
+      }
+      num_sweeps -= num_tiled;
+      first = 0;
+   }
+
+   hypre_StructCopy(tx[x_cur], x);
+
+   return hypre_error_flag;
+}
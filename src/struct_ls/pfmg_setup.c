@@ -73,6 +73,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight= (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
+   HYPRE_Int             relax_tile_depth = (pfmg_data -> relax_tile_depth);
+   HYPRE_Int             coarse_solve_size = (pfmg_data -> coarse_solve_size);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
 
@@ -115,6 +117,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    void                **matvec_data_l;
    void                **restrict_data_l;
    void                **interp_data_l;
+   void                 *coarse_solve_data = NULL;
+   HYPRE_Int             cvolume, use_coarse_solve, factored;
 
    hypre_StructGrid     *grid;
    HYPRE_Int             ndim;
@@ -281,6 +285,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
          {
             cdir = -1;
          }
+
+         /* don't coarsen below the size of a directly solved grid (the
+          * bounding box volume bounds the size of the coarse grid) */
+         if ((l > 0) && (hypre_BoxVolume(cbox) <= coarse_solve_size))
+         {
+            cdir = -1;
+         }
       }
 
       /* stop coarsening */
@@ -292,6 +303,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
          {
             cmaxsize = hypre_max(cmaxsize, hypre_BoxSizeD(cbox, d));
          }
+         cvolume = hypre_BoxVolume(cbox);
 
          break;
       }
@@ -616,6 +628,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       restrict_data_l[l] = hypre_SemiRestrictCreate();
       hypre_SemiRestrictSetup(restrict_data_l[l], RT_l[l], 1, r_l[l], b_l[l+1],
                               cindex, findex, stride);
+      hypre_SemiRestrictResidualSetup(restrict_data_l[l], A_l[l], x_l[l]);
    }
 
 #if defined(HYPRE_USING_CUDA)
@@ -659,6 +672,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
+   hypre_PFMGRelaxSetTileDepth(relax_data_l[0], relax_tile_depth);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
    {
@@ -679,6 +693,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
+            hypre_PFMGRelaxSetTileDepth(relax_data_l[l], relax_tile_depth);
          }
       }
 
@@ -711,6 +726,28 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
    hypre_TFree(relax_weights, HYPRE_MEMORY_HOST);
 
+   /* set up the direct solve on the coarsest grid, keeping relaxation there
+    * as the fallback when the coarse matrix is singular */
+   l = num_levels - 1;
+   use_coarse_solve = (l > 0) && (cvolume <= coarse_solve_size);
+#if defined(HYPRE_USING_CUDA)
+   if (hypre_StructGridDataLocation(grid_l[l]) != HYPRE_MEMORY_HOST)
+   {
+      use_coarse_solve = 0;
+   }
+#endif
+   if (use_coarse_solve)
+   {
+      coarse_solve_data = hypre_StructCoarseSolveCreate(comm);
+      hypre_StructCoarseSolveSetup(coarse_solve_data, A_l[l], b_l[l], x_l[l]);
+      hypre_StructCoarseSolveGetFactored(coarse_solve_data, &factored);
+      if (!factored)
+      {
+         hypre_StructCoarseSolveDestroy(coarse_solve_data);
+         coarse_solve_data = NULL;
+      }
+   }
+
    for (l = 0; l < num_levels; l++)
    {
       /* set up the residual routine */
@@ -723,6 +760,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    (pfmg_data -> matvec_data_l)   = matvec_data_l;
    (pfmg_data -> restrict_data_l) = restrict_data_l;
    (pfmg_data -> interp_data_l)   = interp_data_l;
+   (pfmg_data -> coarse_solve_data) = coarse_solve_data;
 
    /*-----------------------------------------------------
     * Allocate space for log info
@@ -53,6 +53,7 @@ hypre_PFMGSolve( void               *pfmg_vdata,
    void                **matvec_data_l   = (pfmg_data -> matvec_data_l);
    void                **restrict_data_l = (pfmg_data -> restrict_data_l);
    void                **interp_data_l   = (pfmg_data -> interp_data_l);
+   void                 *coarse_solve_data = (pfmg_data -> coarse_solve_data);
    HYPRE_Int             logging         = (pfmg_data -> logging);
    HYPRE_Real           *norms           = (pfmg_data -> norms);
    HYPRE_Real           *rel_norms       = (pfmg_data -> rel_norms);
@@ -63,6 +64,7 @@ hypre_PFMGSolve( void               *pfmg_vdata,
 
    HYPRE_Int             i, l;
    HYPRE_Int             constant_coefficient;
+   HYPRE_Int             fused_residual;
 
 #if DEBUG
    char                  filename[255];
@@ -149,10 +151,21 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       hypre_PFMGRelax(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
       zero_guess = 0;
 
-      /* compute fine grid residual (b - Ax) */
-      hypre_StructCopy(b_l[0], r_l[0]);
-      hypre_StructMatvecCompute(matvec_data_l[0],
-                                -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      /* compute fine grid residual (b - Ax), together with its restriction
+       * when possible */
+      fused_residual = (num_levels > 1) &&
+                       hypre_SemiRestrictHasResidual(restrict_data_l[0]);
+      if (fused_residual)
+      {
+         hypre_SemiRestrictResidual(restrict_data_l[0], RT_l[0], A_l[0],
+                                    x_l[0], b_l[0], r_l[0], b_l[1]);
+      }
+      else
+      {
+         hypre_StructCopy(b_l[0], r_l[0]);
+         hypre_StructMatvecCompute(matvec_data_l[0],
+                                   -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      }
 
       /* convergence check */
       if (tol > 0.0)
@@ -186,7 +199,10 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       if (num_levels > 1)
       {
          /* restrict fine grid residual */
-         hypre_SemiRestrict(restrict_data_l[0], RT_l[0], r_l[0], b_l[1]);
+         if (!fused_residual)
+         {
+            hypre_SemiRestrict(restrict_data_l[0], RT_l[0], r_l[0], b_l[1]);
+         }
 #if DEBUG
          hypre_sprintf(filename, "zout_xdown.%02d", 0);
          hypre_StructVectorPrint(filename, x_l[0], 0);
@@ -216,20 +232,33 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
                hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
 
-               /* compute residual (b - Ax) */
-               hypre_StructCopy(b_l[l], r_l[l]);
-               hypre_StructMatvecCompute(matvec_data_l[l],
-                                         -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+               /* compute residual (b - Ax) and restrict it */
+               fused_residual = hypre_SemiRestrictHasResidual(restrict_data_l[l]);
+               if (fused_residual)
+               {
+                  hypre_SemiRestrictResidual(restrict_data_l[l], RT_l[l], A_l[l],
+                                             x_l[l], b_l[l], r_l[l], b_l[l+1]);
+               }
+               else
+               {
+                  hypre_StructCopy(b_l[l], r_l[l]);
+                  hypre_StructMatvecCompute(matvec_data_l[l],
+                                            -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+               }
             }
             else
             {
                /* inactive level, set x=0, so r=(b-Ax)=b */
                hypre_StructVectorSetConstantValues(x_l[l], 0.0);
                hypre_StructCopy(b_l[l], r_l[l]);
+               fused_residual = 0;
             }
 
             /* restrict residual */
-            hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l+1]);
+            if (!fused_residual)
+            {
+               hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l+1]);
+            }
 #if DEBUG
             hypre_printf("Level %d: b_l = %.30e\n",l+1, hypre_StructInnerProd(b_l[l+1], b_l[l+1]));
             hypre_sprintf(filename, "zout_xdown.%02d", l);
@@ -245,7 +274,11 @@ hypre_PFMGSolve( void               *pfmg_vdata,
           * Bottom
           *--------------------------------------------------*/
 
-         if (active_l[l])
+         if (coarse_solve_data)
+         {
+            hypre_StructCoarseSolve(coarse_solve_data, A_l[l], b_l[l], x_l[l]);
+         }
+         else if (active_l[l])
          {
             hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
             hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
@@ -276,8 +309,8 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_StructVectorClearAllValues(e_l[l]);
             }
             /* interpolate error and correct (x = x + Pe_c) */
-            hypre_SemiInterp(interp_data_l[l], P_l[l], x_l[l+1], e_l[l]);
-            hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            hypre_SemiInterpCorrect(interp_data_l[l], P_l[l], x_l[l+1], e_l[l],
+                                    x_l[l]);
 #if DEBUG
             hypre_sprintf(filename, "zout_eup.%02d", l);
             hypre_StructVectorPrint(filename, e_l[l], 0);
@@ -304,9 +337,18 @@ hypre_PFMGSolve( void               *pfmg_vdata,
          {
             hypre_StructVectorClearAllValues(e_l[0]);
          }
-         /* interpolate error and correct on fine grid (x = x + Pe_c) */
-         hypre_SemiInterp(interp_data_l[0], P_l[0], x_l[1], e_l[0]);
-         hypre_StructAxpy(1.0, e_l[0], x_l[0]);
+         /* interpolate error and correct on fine grid (x = x + Pe_c),
+          * keeping e for the relative change test if needed */
+         if ((tol > 0.0) && (rel_change))
+         {
+            hypre_SemiInterp(interp_data_l[0], P_l[0], x_l[1], e_l[0]);
+            hypre_StructAxpy(1.0, e_l[0], x_l[0]);
+         }
+         else
+         {
+            hypre_SemiInterpCorrect(interp_data_l[0], P_l[0], x_l[1], e_l[0],
+                                    x_l[0]);
+         }
 #if DEBUG
          hypre_printf("Level 0: x_l = %.15e\n", hypre_StructInnerProd(x_l[0], x_l[0]));
          hypre_sprintf(filename, "zout_eup.%02d", 0);
@@ -355,6 +355,7 @@ hypre_PointRelax( void               *relax_vdata,
 
    HYPRE_Int              iter, p, compute_i, i, j;
    HYPRE_Int              pointset;
+   HYPRE_Int              box_threads;
 
    HYPRE_Real             bsumsq, rsumsq;
 
@@ -389,6 +390,8 @@ hypre_PointRelax( void               *relax_vdata,
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
    if (constant_coefficient) hypre_StructVectorClearBoundGhostValues(x, 0);
 
+   box_threads = hypre_StructGridBoxThreads(hypre_StructMatrixGrid(A));
+
    rsumsq = 0.0;
    if ( tol>0.0 )
       bsumsq = hypre_StructInnerProd( b, b );
@@ -433,6 +436,9 @@ hypre_PointRelax( void               *relax_vdata,
             break;
          }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, compute_box_a, compute_box, A_data_box, b_data_box, x_data_box, Ap, AAp0, bp, xp, Ai, start, loop_size) if (box_threads) schedule(dynamic)
+#endif
          hypre_ForBoxArrayI(i, compute_box_aa)
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -545,6 +551,9 @@ hypre_PointRelax( void               *relax_vdata,
             break;
          }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, compute_box_a, compute_box, A_data_box, b_data_box, x_data_box, t_data_box, Ap, bp, xp, tp, start, loop_size) if (box_threads) schedule(dynamic)
+#endif
          hypre_ForBoxArrayI(i, compute_box_aa)
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -906,6 +915,223 @@ hypre_PointRelax_core0( void               *relax_vdata,
 }
 
 
+#if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && \
+    !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_POINT_RELAX_CC_KERNELS
+#endif
+
+#ifdef HYPRE_POINT_RELAX_CC_KERNELS
+
+#if defined(HYPRE_USING_OPENMP)
+#define HYPRE_POINT_RELAX_OMP_LINES \
+   Pragma(omp parallel for private(line) HYPRE_SMP_SCHEDULE if (!omp_in_parallel()))
+#define HYPRE_POINT_RELAX_SIMD Pragma(omp simd)
+#elif defined(__GNUC__) && !defined(__clang__)
+#define HYPRE_POINT_RELAX_OMP_LINES
+#define HYPRE_POINT_RELAX_SIMD _Pragma("GCC ivdep")
+#else
+#define HYPRE_POINT_RELAX_OMP_LINES
+#define HYPRE_POINT_RELAX_SIMD
+#endif
+
+/*--------------------------------------------------------------------------
+ * Box kernel for N constant off-diagonal coefficients Ac:
+ *
+ *    t = AApd * (b - Ac*x)
+ *
+ * in one pass over the nx x ny x nz compute box, whose first point has
+ * ranks bi0, xi0 and ti0 in the data boxes of b, x and t.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_PointRelaxCCKernel(N)                                           \
+static void                                                                   \
+hypre_PointRelaxCC##N( HYPRE_Real   AApd,                                     \
+                       HYPRE_Real  *Ac,                                       \
+                       HYPRE_Int   *xoff,                                     \
+                       HYPRE_Real  *bp,                                       \
+                       HYPRE_Real  *xp,                                       \
+                       HYPRE_Real  *tp,                                       \
+                       HYPRE_Int    nx,                                       \
+                       HYPRE_Int    ny,                                       \
+                       HYPRE_Int    nz,                                       \
+                       HYPRE_Int    bi0,                                      \
+                       HYPRE_Int    bjs,                                      \
+                       HYPRE_Int    bks,                                      \
+                       HYPRE_Int    xi0,                                      \
+                       HYPRE_Int    xjs,                                      \
+                       HYPRE_Int    xks,                                      \
+                       HYPRE_Int    ti0,                                      \
+                       HYPRE_Int    tjs,                                      \
+                       HYPRE_Int    tks )                                     \
+{                                                                             \
+   HYPRE_Int line;                                                            \
+                                                                              \
+   HYPRE_POINT_RELAX_OMP_LINES                                                \
+   for (line = 0; line < ny*nz; line++)                                       \
+   {                                                                          \
+      HYPRE_Int   j  = line % ny;                                             \
+      HYPRE_Int   k  = line / ny;                                             \
+      HYPRE_Int   xi = xi0 + j*xjs + k*xks;                                   \
+      HYPRE_Real *bl = bp + bi0 + j*bjs + k*bks;                              \
+      HYPRE_Real *tl = tp + ti0 + j*tjs + k*tks;                              \
+      HYPRE_Real  c[N];                                                       \
+      HYPRE_Real *xl[N];                                                      \
+      HYPRE_Int   i, s;                                                       \
+                                                                              \
+      for (s = 0; s < N; s++)                                                 \
+      {                                                                       \
+         c[s]  = Ac[s] * AApd;                                                \
+         xl[s] = xp + xi + xoff[s];                                           \
+      }                                                                       \
+                                                                              \
+      HYPRE_POINT_RELAX_SIMD                                                  \
+      for (i = 0; i < nx; i++)                                                \
+      {                                                                       \
+         HYPRE_Real sum = AApd * bl[i];                                       \
+         HYPRE_Int  t;                                                        \
+         for (t = 0; t < N; t++)                                              \
+         {                                                                    \
+            sum -= c[t] * xl[t][i];                                           \
+         }                                                                    \
+         tl[i] = sum;                                                         \
+      }                                                                       \
+   }                                                                          \
+}
+
+hypre_PointRelaxCCKernel(4)
+hypre_PointRelaxCCKernel(6)
+hypre_PointRelaxCCKernel(8)
+hypre_PointRelaxCCKernel(18)
+hypre_PointRelaxCCKernel(26)
+
+#endif /* HYPRE_POINT_RELAX_CC_KERNELS */
+
+/*--------------------------------------------------------------------------
+ * hypre_PointRelax_core12Stencil
+ *
+ * Does the work of hypre_PointRelax_core12 in one pass for unit stride and
+ * the common 5/9-point (2D) and 7/19/27-point (3D) stencils.  Returns 0
+ * (doing nothing) for other cases.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PointRelax_core12Stencil( HYPRE_Int           diag_rank,
+                                hypre_StructMatrix *A,
+                                HYPRE_Int           constant_coefficient,
+                                hypre_Box          *compute_box,
+                                HYPRE_Real         *bp,
+                                HYPRE_Real         *xp,
+                                HYPRE_Real         *tp,
+                                HYPRE_Int           boxarray_id,
+                                hypre_Box          *b_data_box,
+                                hypre_Box          *x_data_box,
+                                hypre_Box          *t_data_box,
+                                hypre_IndexRef      stride )
+{
+#ifdef HYPRE_POINT_RELAX_CC_KERNELS
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int              ndim          = hypre_StructMatrixNDim(A);
+   HYPRE_Int              Ai            = hypre_CCBoxIndexRank_noargs();
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   HYPRE_Real             Ac[26];
+   HYPRE_Int              xoff[26];
+   HYPRE_Real             AApd;
+   HYPRE_Int              nx, ny, nz;
+   HYPRE_Int              bi0, bjs, bks, xi0, xjs, xks, ti0, tjs, tks;
+   HYPRE_Int              si, noff, d;
+
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(stride, d) != 1)
+      {
+         return 0;
+      }
+   }
+   if ( !( (ndim == 2 && (stencil_size == 5 || stencil_size == 9)) ||
+           (ndim == 3 && (stencil_size == 7 || stencil_size == 19 ||
+                          stencil_size == 27)) ) )
+   {
+      return 0;
+   }
+
+   noff = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      if (si != diag_rank)
+      {
+         Ac[noff]   = hypre_StructMatrixBoxData(A, boxarray_id, si)[Ai];
+         xoff[noff] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+         noff++;
+      }
+   }
+   if (noff != stencil_size - 1)
+   {
+      return 0;
+   }
+
+   /* a variable diagonal is divided out afterwards by the caller */
+   if (constant_coefficient == 1)
+   {
+      AApd = 1 / hypre_StructMatrixBoxData(A, boxarray_id, diag_rank)[Ai];
+   }
+   else
+   {
+      AApd = 1;
+   }
+
+   start = hypre_BoxIMin(compute_box);
+   hypre_BoxGetSize(compute_box, loop_size);
+   nx = hypre_IndexD(loop_size, 0);
+   ny = hypre_IndexD(loop_size, 1);
+   nz = (ndim > 2) ? hypre_IndexD(loop_size, 2) : 1;
+   if (nx < 1 || ny < 1 || nz < 1)
+   {
+      return 1;
+   }
+
+   bi0 = hypre_BoxIndexRank(b_data_box, start);
+   xi0 = hypre_BoxIndexRank(x_data_box, start);
+   ti0 = hypre_BoxIndexRank(t_data_box, start);
+   bjs = hypre_BoxSizeD(b_data_box, 0);
+   xjs = hypre_BoxSizeD(x_data_box, 0);
+   tjs = hypre_BoxSizeD(t_data_box, 0);
+   bks = (ndim > 2) ? bjs * hypre_BoxSizeD(b_data_box, 1) : 0;
+   xks = (ndim > 2) ? xjs * hypre_BoxSizeD(x_data_box, 1) : 0;
+   tks = (ndim > 2) ? tjs * hypre_BoxSizeD(t_data_box, 1) : 0;
+
+   switch (noff)
+   {
+      case 4:
+         hypre_PointRelaxCC4(AApd, Ac, xoff, bp, xp, tp, nx, ny, nz,
+                             bi0, bjs, bks, xi0, xjs, xks, ti0, tjs, tks);
+         break;
+      case 6:
+         hypre_PointRelaxCC6(AApd, Ac, xoff, bp, xp, tp, nx, ny, nz,
+                             bi0, bjs, bks, xi0, xjs, xks, ti0, tjs, tks);
+         break;
+      case 8:
+         hypre_PointRelaxCC8(AApd, Ac, xoff, bp, xp, tp, nx, ny, nz,
+                             bi0, bjs, bks, xi0, xjs, xks, ti0, tjs, tks);
+         break;
+      case 18:
+         hypre_PointRelaxCC18(AApd, Ac, xoff, bp, xp, tp, nx, ny, nz,
+                              bi0, bjs, bks, xi0, xjs, xks, ti0, tjs, tks);
+         break;
+      case 26:
+         hypre_PointRelaxCC26(AApd, Ac, xoff, bp, xp, tp, nx, ny, nz,
+                              bi0, bjs, bks, xi0, xjs, xks, ti0, tjs, tks);
+         break;
+   }
+
+   return 1;
+#else
+   return 0;
+#endif
+}
+
 /* for constant_coefficient==1 or 2, all offdiagonal coefficients constant over space ...*/
 HYPRE_Int
 hypre_PointRelax_core12( void               *relax_vdata,
@@ -964,6 +1190,15 @@ hypre_PointRelax_core12( void               *relax_vdata,
    stencil_shape = hypre_StructStencilShape(stencil);
    stencil_size  = hypre_StructStencilSize(stencil);
 
+   /* one pass for the common stencils */
+   if (hypre_PointRelax_core12Stencil(diag_rank, A, constant_coefficient,
+                                      compute_box, bp, xp, tp, boxarray_id,
+                                      b_data_box, x_data_box, t_data_box,
+                                      stride))
+   {
+      return hypre_error_flag;
+   }
+
    start  = hypre_BoxIMin(compute_box);
    hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
@@ -1453,9 +1688,11 @@ HYPRE_Int hypre_relax_wtx( void *relax_vdata, HYPRE_Int pointset,
    hypre_Box             *compute_box;
    hypre_Box             *x_data_box;
    hypre_Box             *t_data_box;
+   HYPRE_Int              box_threads;
 
    compute_pkg = compute_pkgs[pointset];
    stride = pointset_strides[pointset];
+   box_threads = hypre_StructGridBoxThreads(hypre_StructVectorGrid(x));
 
    for (compute_i = 0; compute_i < 2; compute_i++)
    {
@@ -1474,6 +1711,9 @@ HYPRE_Int hypre_relax_wtx( void *relax_vdata, HYPRE_Int pointset,
          break;
       }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, compute_box_a, compute_box, x_data_box, t_data_box, xp, tp, start, loop_size) if (box_threads) schedule(dynamic)
+#endif
       hypre_ForBoxArrayI(i, compute_box_aa)
       {
          compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -1535,9 +1775,11 @@ HYPRE_Int hypre_relax_copy( void *relax_vdata, HYPRE_Int pointset,
    hypre_Box             *compute_box;
    hypre_Box             *x_data_box;
    hypre_Box             *t_data_box;
+   HYPRE_Int              box_threads;
 
    compute_pkg = compute_pkgs[pointset];
    stride = pointset_strides[pointset];
+   box_threads = hypre_StructGridBoxThreads(hypre_StructVectorGrid(x));
 
    for (compute_i = 0; compute_i < 2; compute_i++)
    {
@@ -1556,6 +1798,9 @@ HYPRE_Int hypre_relax_copy( void *relax_vdata, HYPRE_Int pointset,
          break;
       }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, compute_box_a, compute_box, x_data_box, t_data_box, xp, tp, start, loop_size) if (box_threads) schedule(dynamic)
+#endif
       hypre_ForBoxArrayI(i, compute_box_aa)
       {
          compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -339,6 +339,237 @@ hypre_SemiInterp( void               *interp_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SemiInterpCorrect
+ *
+ * Interpolates xc and adds it to x (x = x + P xc) in the same loops, so the
+ * correction is not read back in a separate axpy pass.  On return, e holds
+ * the interpolated correction as after hypre_SemiInterp (the PFMG and SMG
+ * work vectors share storage across levels, so it is kept fully defined).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiInterpCorrect( void               *interp_vdata,
+                         hypre_StructMatrix *P,
+                         hypre_StructVector *xc,
+                         hypre_StructVector *e,
+                         hypre_StructVector *x            )
+{
+   hypre_SemiInterpData   *interp_data = (hypre_SemiInterpData   *)interp_vdata;
+
+   HYPRE_Int               P_stored_as_transpose;
+   hypre_ComputePkg       *compute_pkg;
+   hypre_IndexRef          cindex;
+   hypre_IndexRef          findex;
+   hypre_IndexRef          stride;
+
+   HYPRE_Int               ndim;
+   hypre_StructGrid       *fgrid;
+   HYPRE_Int              *fgrid_ids;
+   hypre_StructGrid       *cgrid;
+   hypre_BoxArray         *cgrid_boxes;
+   HYPRE_Int              *cgrid_ids;
+
+   hypre_CommHandle       *comm_handle;
+
+   hypre_BoxArrayArray    *compute_box_aa;
+   hypre_BoxArray         *compute_box_a;
+   hypre_Box              *compute_box;
+
+   hypre_Box              *P_dbox;
+   hypre_Box              *xc_dbox;
+   hypre_Box              *e_dbox;
+   hypre_Box              *x_dbox;
+
+   HYPRE_Real             *Pp0, *Pp1;
+   HYPRE_Real             *xcp;
+   HYPRE_Real             *ep;
+   HYPRE_Real             *xp;
+
+   hypre_Index             loop_size;
+   hypre_Index             start;
+   hypre_Index             startc;
+   hypre_Index             stridec;
+
+   hypre_StructStencil    *stencil;
+   hypre_Index            *stencil_shape;
+
+   HYPRE_Int               compute_i, fi, ci, j;
+
+   HYPRE_Int               fused = 1;
+
+#if defined(HYPRE_USING_CUDA)
+   if (hypre_StructGridDataLocation(hypre_StructVectorGrid(e)) !=
+       hypre_StructGridDataLocation(hypre_StructVectorGrid(xc)))
+   {
+      fused = 0;
+   }
+#endif
+   if (hypre_StructMatrixConstantCoefficient(P))
+   {
+      fused = 0;
+   }
+
+   if (!fused)
+   {
+      /* only the C- and F-points are corrected (x may carry a base stride) */
+      hypre_SemiInterp(interp_vdata, P, xc, e);
+      hypre_SMGAxpy(1.0, e, x, (interp_data -> cindex), (interp_data -> stride));
+      hypre_SMGAxpy(1.0, e, x, (interp_data -> findex), (interp_data -> stride));
+
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Initialize some things
+    *-----------------------------------------------------------------------*/
+
+   hypre_BeginTiming(interp_data -> time_index);
+
+   P_stored_as_transpose = (interp_data -> P_stored_as_transpose);
+   compute_pkg   = (interp_data -> compute_pkg);
+   cindex        = (interp_data -> cindex);
+   findex        = (interp_data -> findex);
+   stride        = (interp_data -> stride);
+
+   ndim          = hypre_StructMatrixNDim(P);
+   stencil       = hypre_StructMatrixStencil(P);
+   stencil_shape = hypre_StructStencilShape(stencil);
+
+   hypre_SetIndex3(stridec, 1, 1, 1);
+
+   /*-----------------------------------------------------------------------
+    * Correct x at coarse points, keeping the correction in e
+    *-----------------------------------------------------------------------*/
+
+   fgrid = hypre_StructVectorGrid(e);
+   fgrid_ids = hypre_StructGridIDs(fgrid);
+   cgrid = hypre_StructVectorGrid(xc);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids = hypre_StructGridIDs(cgrid);
+
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+
+      compute_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      hypre_CopyIndex(hypre_BoxIMin(compute_box), startc);
+      hypre_StructMapCoarseToFine(startc, cindex, stride, start);
+
+      e_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(e), fi);
+      x_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+      xc_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(xc), ci);
+
+      ep  = hypre_StructVectorBoxData(e, fi);
+      xp  = hypre_StructVectorBoxData(x, fi);
+      xcp = hypre_StructVectorBoxData(xc, ci);
+
+      hypre_BoxGetSize(compute_box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(ep,xp,xcp)
+      hypre_BoxLoop3Begin(ndim, loop_size,
+                          e_dbox, start, stride, ei,
+                          x_dbox, start, stride, xi,
+                          xc_dbox, startc, stridec, xci);
+      {
+         ep[ei]  = xcp[xci];
+         xp[xi] += xcp[xci];
+      }
+      hypre_BoxLoop3End(ei, xi, xci);
+#undef DEVICE_VAR
+   }
+
+   /*-----------------------------------------------------------------------
+    * Correct x at fine points
+    *-----------------------------------------------------------------------*/
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch(compute_i)
+      {
+         case 0:
+         {
+            ep = hypre_StructVectorData(e);
+            hypre_InitializeIndtComputations(compute_pkg, ep, &comm_handle);
+            compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkg);
+         }
+         break;
+
+         case 1:
+         {
+            hypre_FinalizeIndtComputations(comm_handle);
+            compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+         }
+         break;
+      }
+
+      hypre_ForBoxArrayI(fi, compute_box_aa)
+      {
+         HYPRE_Int Pp1_offset = 0, ep0_offset, ep1_offset;
+
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, fi);
+
+         P_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(P), fi);
+         e_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(e), fi);
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+
+         if (P_stored_as_transpose)
+         {
+            Pp0 = hypre_StructMatrixBoxData(P, fi, 1);
+            Pp1 = hypre_StructMatrixBoxData(P, fi, 0);
+            Pp1_offset = -hypre_BoxOffsetDistance(P_dbox, stencil_shape[0]);
+         }
+         else
+         {
+            Pp0 = hypre_StructMatrixBoxData(P, fi, 0);
+            Pp1 = hypre_StructMatrixBoxData(P, fi, 1);
+         }
+         ep  = hypre_StructVectorBoxData(e, fi);
+         xp  = hypre_StructVectorBoxData(x, fi);
+         ep0_offset = hypre_BoxOffsetDistance(e_dbox, stencil_shape[0]);
+         ep1_offset = hypre_BoxOffsetDistance(e_dbox, stencil_shape[1]);
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+            hypre_CopyIndex(hypre_BoxIMin(compute_box), start);
+            hypre_StructMapFineToCoarse(start, findex, stride, startc);
+
+            hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+#define DEVICE_VAR is_device_ptr(ep,xp,Pp0,Pp1)
+            hypre_BoxLoop3Begin(ndim, loop_size,
+                                P_dbox, startc, stridec, Pi,
+                                e_dbox, start, stride, ei,
+                                x_dbox, start, stride, xi);
+            {
+               ep[ei]  = (Pp0[Pi]            * ep[ei+ep0_offset] +
+                          Pp1[Pi+Pp1_offset] * ep[ei+ep1_offset]);
+               xp[xi] += ep[ei];
+            }
+            hypre_BoxLoop3End(Pi, ei, xi);
+#undef DEVICE_VAR
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Return
+    *-----------------------------------------------------------------------*/
+
+   hypre_IncFLOPCount(3*hypre_StructVectorGlobalSize(xc) +
+                      hypre_StructVectorGlobalSize(x));
+   hypre_EndTiming(interp_data -> time_index);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
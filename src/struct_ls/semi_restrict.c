@@ -8,6 +8,13 @@
 #include "_hypre_struct_ls.h"
 #include "_hypre_struct_mv.hpp"
 
+/* The fused residual kernels index the stencil coefficients through host
+ * pointer arrays */
+#if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && \
+    !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_SEMI_RESTRICT_RESIDUAL
+#endif
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -19,6 +26,8 @@ typedef struct
    hypre_Index         cindex;
    hypre_Index         stride;
 
+   hypre_ComputePkg   *residual_compute_pkg;
+
    HYPRE_Int           time_index;
 
 } hypre_SemiRestrictData;
@@ -310,6 +319,362 @@ hypre_SemiRestrict( void               *restrict_vdata,
    return hypre_error_flag;
 }
 
+#ifdef HYPRE_SEMI_RESTRICT_RESIDUAL
+
+#if defined(HYPRE_USING_OPENMP)
+#define HYPRE_SEMI_RESTRICT_OMP_LINES \
+   Pragma(omp parallel for private(line) HYPRE_SMP_SCHEDULE)
+#define HYPRE_SEMI_RESTRICT_SIMD Pragma(omp simd)
+#elif defined(__GNUC__) && !defined(__clang__)
+#define HYPRE_SEMI_RESTRICT_OMP_LINES
+#define HYPRE_SEMI_RESTRICT_SIMD _Pragma("GCC ivdep")
+#else
+#define HYPRE_SEMI_RESTRICT_OMP_LINES
+#define HYPRE_SEMI_RESTRICT_SIMD
+#endif
+
+/*--------------------------------------------------------------------------
+ * Line kernel for a stencil with N entries:
+ *
+ *    r = b - A*x
+ *
+ * on the nx x ny x nz compute box.  For A, x, b and r (in that order), i0
+ * holds the rank of the first point of the box in the data box, and js and
+ * ks the ranks between consecutive points in the second and third
+ * dimensions.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_SemiRestrictResidualKernel(NAME, N)                             \
+static void                                                                   \
+NAME( HYPRE_Int    stencil_size,                                              \
+      HYPRE_Real **Ap,                                                        \
+      HYPRE_Int   *xoff,                                                      \
+      HYPRE_Real  *xp,                                                        \
+      HYPRE_Real  *bp,                                                        \
+      HYPRE_Real  *rp,                                                        \
+      HYPRE_Int    nx,                                                        \
+      HYPRE_Int    ny,                                                        \
+      HYPRE_Int    nz,                                                        \
+      HYPRE_Int   *i0,                                                        \
+      HYPRE_Int   *js,                                                        \
+      HYPRE_Int   *ks )                                                       \
+{                                                                             \
+   HYPRE_Int line;                                                            \
+                                                                              \
+   HYPRE_SEMI_RESTRICT_OMP_LINES                                              \
+   for (line = 0; line < ny*nz; line++)                                       \
+   {                                                                          \
+      HYPRE_Int   j  = line % ny;                                             \
+      HYPRE_Int   k  = line / ny;                                             \
+      HYPRE_Int   Ai = i0[0] + j*js[0] + k*ks[0];                             \
+      HYPRE_Int   xi = i0[1] + j*js[1] + k*ks[1];                             \
+      HYPRE_Real *bl = bp + i0[2] + j*js[2] + k*ks[2];                        \
+      HYPRE_Real *rl = rp + i0[3] + j*js[3] + k*ks[3];                        \
+      HYPRE_Real *al[N];                                                      \
+      HYPRE_Real *xl[N];                                                      \
+      HYPRE_Int   i, s;                                                       \
+                                                                              \
+      for (s = 0; s < N; s++)                                                 \
+      {                                                                       \
+         al[s] = Ap[s] + Ai;                                                  \
+         xl[s] = xp + xi + xoff[s];                                           \
+      }                                                                       \
+                                                                              \
+      HYPRE_SEMI_RESTRICT_SIMD                                                \
+      for (i = 0; i < nx; i++)                                                \
+      {                                                                       \
+         HYPRE_Real sum = 0.0;                                                \
+         HYPRE_Int  t;                                                        \
+         for (t = 0; t < N; t++)                                              \
+         {                                                                    \
+            sum += al[t][i] * xl[t][i];                                       \
+         }                                                                    \
+         rl[i] = bl[i] - sum;                                                 \
+      }                                                                       \
+   }                                                                          \
+}
+
+hypre_SemiRestrictResidualKernel(hypre_SemiRestrictResidual5, 5)
+hypre_SemiRestrictResidualKernel(hypre_SemiRestrictResidual7, 7)
+hypre_SemiRestrictResidualKernel(hypre_SemiRestrictResidual9, 9)
+hypre_SemiRestrictResidualKernel(hypre_SemiRestrictResidual19, 19)
+hypre_SemiRestrictResidualKernel(hypre_SemiRestrictResidual27, 27)
+hypre_SemiRestrictResidualKernel(hypre_SemiRestrictResidualN, stencil_size)
+
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiRestrictResidualSetup
+ *
+ * Sets up hypre_SemiRestrictResidual for the residual b - Ax, where A and x
+ * live on the fine grid of the restriction.  Only variable coefficient A
+ * and R, coarsened in a single direction, are supported;
+ * hypre_SemiRestrictHasResidual tells the caller whether the setup
+ * succeeded.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictResidualSetup( void               *restrict_vdata,
+                                 hypre_StructMatrix *A,
+                                 hypre_StructVector *x )
+{
+#ifdef HYPRE_SEMI_RESTRICT_RESIDUAL
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   hypre_IndexRef          stride = (restrict_data -> stride);
+   HYPRE_Int               ndim   = hypre_StructMatrixNDim(A);
+   HYPRE_Int               nc, d;
+
+   hypre_StructGrid       *grid;
+   hypre_ComputeInfo      *compute_info;
+   hypre_ComputePkg       *compute_pkg;
+
+   hypre_ComputePkgDestroy(restrict_data -> residual_compute_pkg);
+   (restrict_data -> residual_compute_pkg) = NULL;
+
+   if (hypre_StructMatrixConstantCoefficient(A) != 0 ||
+       hypre_StructMatrixConstantCoefficient(restrict_data -> R) != 0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* The residual is computed at every point of the grid, so the C- and
+    * F-points must cover it.  This excludes the SMG plane and line solves,
+    * which use a base stride. */
+   nc = 0;
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(stride, d) == 2)
+      {
+         nc++;
+      }
+      else if (hypre_IndexD(stride, d) != 1)
+      {
+         return hypre_error_flag;
+      }
+   }
+   if (nc != 1)
+   {
+      return hypre_error_flag;
+   }
+
+   /* exchange x for the stencil of A */
+   grid = hypre_StructVectorGrid(x);
+   hypre_CreateComputeInfo(grid, hypre_StructMatrixStencil(A), &compute_info);
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
+                          grid, &compute_pkg);
+
+   (restrict_data -> residual_compute_pkg) = compute_pkg;
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiRestrictHasResidual
+ *
+ * Returns 1 if hypre_SemiRestrictResidual has been set up.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictHasResidual( void *restrict_vdata )
+{
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   return (restrict_data && (restrict_data -> residual_compute_pkg) != NULL);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiRestrictResidual
+ *
+ * Computes r = b - Ax and rc = R r.
+ *
+ * The residual is formed in a single pass over A, x and b, replacing the
+ * copy, matvec and scaling passes of the unfused path, and the interior
+ * part is computed while the ghost values of x are exchanged.
+ *
+ * Computing the residual only where the restriction needs it separately at
+ * the C- and F-points was tried, but it is slower: the two point sets share
+ * cache lines, so A and x end up being read twice.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictResidual( void               *restrict_vdata,
+                            hypre_StructMatrix *R,
+                            hypre_StructMatrix *A,
+                            hypre_StructVector *x,
+                            hypre_StructVector *b,
+                            hypre_StructVector *r,
+                            hypre_StructVector *rc )
+{
+#ifdef HYPRE_SEMI_RESTRICT_RESIDUAL
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   hypre_ComputePkg       *compute_pkg;
+   HYPRE_Int               ndim;
+
+   hypre_CommHandle       *comm_handle;
+
+   hypre_BoxArrayArray    *compute_box_aa;
+   hypre_BoxArray         *compute_box_a;
+   hypre_Box              *compute_box;
+
+   hypre_Box              *dboxes[4];
+
+   HYPRE_Real            **Ap;
+   HYPRE_Int              *xoff;
+   HYPRE_Real             *xp;
+   HYPRE_Real             *bp;
+   HYPRE_Real             *rp;
+
+   hypre_Index             loop_size;
+   hypre_IndexRef          start;
+   HYPRE_Int               nx, ny, nz;
+   HYPRE_Int               i0[4], js[4], ks[4];
+
+   hypre_StructStencil    *A_stencil;
+   hypre_Index            *A_stencil_shape;
+   HYPRE_Int               A_stencil_size;
+
+   HYPRE_Int               compute_i, i, j, k, si;
+
+   if (!hypre_SemiRestrictHasResidual(restrict_vdata))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Fused residual restriction not set up");
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Initialize some things.
+    *-----------------------------------------------------------------------*/
+
+   hypre_BeginTiming(restrict_data -> time_index);
+
+   compute_pkg     = (restrict_data -> residual_compute_pkg);
+
+   ndim            = hypre_StructMatrixNDim(A);
+   A_stencil       = hypre_StructMatrixStencil(A);
+   A_stencil_shape = hypre_StructStencilShape(A_stencil);
+   A_stencil_size  = hypre_StructStencilSize(A_stencil);
+
+   Ap   = hypre_TAlloc(HYPRE_Real *, A_stencil_size, HYPRE_MEMORY_HOST);
+   xoff = hypre_TAlloc(HYPRE_Int, A_stencil_size, HYPRE_MEMORY_HOST);
+
+   /*--------------------------------------------------------------------
+    * Compute the residual
+    *--------------------------------------------------------------------*/
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch(compute_i)
+      {
+         case 0:
+         {
+            xp = hypre_StructVectorData(x);
+            hypre_InitializeIndtComputations(compute_pkg, xp, &comm_handle);
+            compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkg);
+         }
+         break;
+
+         case 1:
+         {
+            hypre_FinalizeIndtComputations(comm_handle);
+            compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+         }
+         break;
+      }
+
+      hypre_ForBoxArrayI(i, compute_box_aa)
+      {
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+         dboxes[0] = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+         dboxes[1] = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         dboxes[2] = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+         dboxes[3] = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r), i);
+
+         for (si = 0; si < A_stencil_size; si++)
+         {
+            Ap[si]   = hypre_StructMatrixBoxData(A, i, si);
+            xoff[si] = hypre_BoxOffsetDistance(dboxes[1], A_stencil_shape[si]);
+         }
+         xp = hypre_StructVectorBoxData(x, i);
+         bp = hypre_StructVectorBoxData(b, i);
+         rp = hypre_StructVectorBoxData(r, i);
+
+         for (k = 0; k < 4; k++)
+         {
+            js[k] = (ndim > 1) ? hypre_BoxSizeD(dboxes[k], 0) : 0;
+            ks[k] = (ndim > 2) ? js[k] * hypre_BoxSizeD(dboxes[k], 1) : 0;
+         }
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+            hypre_BoxGetSize(compute_box, loop_size);
+            start = hypre_BoxIMin(compute_box);
+
+            nx = hypre_IndexD(loop_size, 0);
+            ny = (ndim > 1) ? hypre_IndexD(loop_size, 1) : 1;
+            nz = (ndim > 2) ? hypre_IndexD(loop_size, 2) : 1;
+            if (nx < 1 || ny < 1 || nz < 1)
+            {
+               continue;
+            }
+
+            for (k = 0; k < 4; k++)
+            {
+               i0[k] = hypre_BoxIndexRank(dboxes[k], start);
+            }
+
+            switch (A_stencil_size)
+            {
+               case 5:
+                  hypre_SemiRestrictResidual5(A_stencil_size, Ap, xoff, xp, bp, rp,
+                                              nx, ny, nz, i0, js, ks);
+                  break;
+               case 7:
+                  hypre_SemiRestrictResidual7(A_stencil_size, Ap, xoff, xp, bp, rp,
+                                              nx, ny, nz, i0, js, ks);
+                  break;
+               case 9:
+                  hypre_SemiRestrictResidual9(A_stencil_size, Ap, xoff, xp, bp, rp,
+                                              nx, ny, nz, i0, js, ks);
+                  break;
+               case 19:
+                  hypre_SemiRestrictResidual19(A_stencil_size, Ap, xoff, xp, bp, rp,
+                                               nx, ny, nz, i0, js, ks);
+                  break;
+               case 27:
+                  hypre_SemiRestrictResidual27(A_stencil_size, Ap, xoff, xp, bp, rp,
+                                               nx, ny, nz, i0, js, ks);
+                  break;
+               default:
+                  hypre_SemiRestrictResidualN(A_stencil_size, Ap, xoff, xp, bp, rp,
+                                              nx, ny, nz, i0, js, ks);
+                  break;
+            }
+         }
+      }
+   }
+
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   hypre_IncFLOPCount(2*A_stencil_size*hypre_StructVectorGlobalSize(r));
+   hypre_EndTiming(restrict_data -> time_index);
+
+   /*--------------------------------------------------------------------
+    * Restrict
+    *--------------------------------------------------------------------*/
+
+   hypre_SemiRestrict(restrict_vdata, R, r, rc);
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -322,6 +687,7 @@ hypre_SemiRestrictDestroy( void *restrict_vdata )
    {
       hypre_StructMatrixDestroy(restrict_data -> R);
       hypre_ComputePkgDestroy(restrict_data -> compute_pkg);
+      hypre_ComputePkgDestroy(restrict_data -> residual_compute_pkg);
       hypre_FinalizeTiming(restrict_data -> time_index);
       hypre_TFree(restrict_data, HYPRE_MEMORY_HOST);
    }
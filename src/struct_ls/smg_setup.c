@@ -514,6 +514,7 @@ hypre_SMGSetup( void               *smg_vdata,
       restrict_data_l[l] = hypre_SemiRestrictCreate();
       hypre_SemiRestrictSetup(restrict_data_l[l], R_l[l], 0, r_l[l], b_l[l+1],
                               cindex, findex, stride);
+      hypre_SemiRestrictResidualSetup(restrict_data_l[l], A_l[l], x_l[l]);
 
       /* set up the coarse grid operator */
       hypre_SMGSetupRAPOp(R_l[l], A_l[l], PT_l[l], A_l[l+1],
@@ -79,6 +79,7 @@ hypre_SMGSolve( void               *smg_vdata,
    HYPRE_Real            e_dot_e = 0, x_dot_x = 1;
                     
    HYPRE_Int             i, l;
+   HYPRE_Int             fused_residual;
                     
 #if DEBUG
    char                  filename[255];
@@ -161,8 +162,19 @@ hypre_SMGSolve( void               *smg_vdata,
       hypre_SMGRelax(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
       zero_guess = 0;
 
-      /* compute fine grid residual (b - Ax) */
-      hypre_SMGResidual(residual_data_l[0], A_l[0], x_l[0], b_l[0], r_l[0]);
+      /* compute fine grid residual (b - Ax), together with its restriction
+       * when possible */
+      fused_residual = (num_levels > 1) &&
+                       hypre_SemiRestrictHasResidual(restrict_data_l[0]);
+      if (fused_residual)
+      {
+         hypre_SemiRestrictResidual(restrict_data_l[0], R_l[0], A_l[0],
+                                    x_l[0], b_l[0], r_l[0], b_l[1]);
+      }
+      else
+      {
+         hypre_SMGResidual(residual_data_l[0], A_l[0], x_l[0], b_l[0], r_l[0]);
+      }
 
       /* convergence check */
       if (tol > 0.0)
@@ -195,7 +207,10 @@ hypre_SMGSolve( void               *smg_vdata,
       if (num_levels > 1)
       {
          /* restrict fine grid residual */
-         hypre_SemiRestrict(restrict_data_l[0], R_l[0], r_l[0], b_l[1]);
+         if (!fused_residual)
+         {
+            hypre_SemiRestrict(restrict_data_l[0], R_l[0], r_l[0], b_l[1]);
+         }
 #if DEBUG
          if(hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
          {
@@ -216,12 +231,18 @@ hypre_SMGSolve( void               *smg_vdata,
             hypre_SMGRelaxSetZeroGuess(relax_data_l[l], 1);
             hypre_SMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
 
-            /* compute residual (b - Ax) */
-            hypre_SMGResidual(residual_data_l[l],
-                              A_l[l], x_l[l], b_l[l], r_l[l]);
- 
-            /* restrict residual */
-            hypre_SemiRestrict(restrict_data_l[l], R_l[l], r_l[l], b_l[l+1]);
+            /* compute residual (b - Ax) and restrict it */
+            if (hypre_SemiRestrictHasResidual(restrict_data_l[l]))
+            {
+               hypre_SemiRestrictResidual(restrict_data_l[l], R_l[l], A_l[l],
+                                          x_l[l], b_l[l], r_l[l], b_l[l+1]);
+            }
+            else
+            {
+               hypre_SMGResidual(residual_data_l[l],
+                                 A_l[l], x_l[l], b_l[l], r_l[l]);
+               hypre_SemiRestrict(restrict_data_l[l], R_l[l], r_l[l], b_l[l+1]);
+            }
 #if DEBUG
             if(hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
             {
@@ -256,8 +277,8 @@ hypre_SMGSolve( void               *smg_vdata,
          for (l = (num_levels - 2); l >= 1; l--)
          {
             /* interpolate error and correct (x = x + Pe_c) */
-            hypre_SemiInterp(interp_data_l[l], PT_l[l], x_l[l+1], e_l[l]);
-            hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            hypre_SemiInterpCorrect(interp_data_l[l], PT_l[l], x_l[l+1], e_l[l],
+                                    x_l[l]);
 #if DEBUG
             if(hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
             {
@@ -275,9 +296,18 @@ hypre_SMGSolve( void               *smg_vdata,
             hypre_SMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]); 
          }
 
-         /* interpolate error and correct on fine grid (x = x + Pe_c) */
-         hypre_SemiInterp(interp_data_l[0], PT_l[0], x_l[1], e_l[0]);
-         hypre_SMGAxpy(1.0, e_l[0], x_l[0], base_index, base_stride);
+         /* interpolate error and correct on fine grid (x = x + Pe_c),
+          * keeping e for the relative change test if needed */
+         if ((tol > 0.0) && (rel_change))
+         {
+            hypre_SemiInterp(interp_data_l[0], PT_l[0], x_l[1], e_l[0]);
+            hypre_SMGAxpy(1.0, e_l[0], x_l[0], base_index, base_stride);
+         }
+         else
+         {
+            hypre_SemiInterpCorrect(interp_data_l[0], PT_l[0], x_l[1], e_l[0],
+                                    x_l[0]);
+         }
 #if DEBUG
          if(hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
          {
@@ -389,6 +389,38 @@ HYPRE_StructMatrixPrint( const char         *filename,
    return ( hypre_StructMatrixPrint(filename, matrix, all) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixPrintBinary( const char         *filename,
+                               HYPRE_StructMatrix  matrix )
+{
+   return ( hypre_StructMatrixPrintBinary(filename, matrix) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixReadBinary( MPI_Comm             comm,
+                              const char          *filename,
+                              HYPRE_StructGrid     grid,
+                              HYPRE_Int           *num_ghost,
+                              HYPRE_StructMatrix  *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   *matrix = (HYPRE_StructMatrix)
+      hypre_StructMatrixReadBinary(comm, filename, (hypre_StructGrid *) grid, num_ghost);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
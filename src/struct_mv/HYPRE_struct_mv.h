@@ -359,6 +359,27 @@ HYPRE_Int HYPRE_StructMatrixPrint(const char         *filename,
                                   HYPRE_StructMatrix  matrix,
                                   HYPRE_Int           all);
 
+/**
+ * Print the matrix to a single binary file, written collectively with
+ * MPI-IO.  The file holds the grid boxes, the stencil, and the coefficients
+ * in the native format of the machine, and can be read back with
+ * \ref HYPRE_StructMatrixReadBinary on any number of processes.
+ **/
+HYPRE_Int HYPRE_StructMatrixPrintBinary(const char         *filename,
+                                        HYPRE_StructMatrix  matrix);
+
+/**
+ * Read a matrix written by \ref HYPRE_StructMatrixPrintBinary.  If \e grid
+ * is NULL, a grid is created from the boxes in the file, which are
+ * distributed round-robin by writing process; otherwise the matrix is read
+ * onto the given grid.  The created matrix is assembled.
+ **/
+HYPRE_Int HYPRE_StructMatrixReadBinary(MPI_Comm             comm,
+                                       const char          *filename,
+                                       HYPRE_StructGrid     grid,
+                                       HYPRE_Int           *num_ghost,
+                                       HYPRE_StructMatrix  *matrix);
+
 /**
  * Matvec operator.  This operation is \f$y = \alpha A x + \beta y\f$ .
  * Note that you can do a simple matrix-vector multiply by setting
@@ -520,6 +541,23 @@ HYPRE_Int HYPRE_StructVectorPrint(const char         *filename,
                                   HYPRE_StructVector  vector,
                                   HYPRE_Int           all);
 
+/**
+ * Print the vector to a single binary file, written collectively with
+ * MPI-IO.  See \ref HYPRE_StructMatrixPrintBinary.
+ **/
+HYPRE_Int HYPRE_StructVectorPrintBinary(const char         *filename,
+                                        HYPRE_StructVector  vector);
+
+/**
+ * Read a vector written by \ref HYPRE_StructVectorPrintBinary.  See
+ * \ref HYPRE_StructMatrixReadBinary.
+ **/
+HYPRE_Int HYPRE_StructVectorReadBinary(MPI_Comm             comm,
+                                       const char          *filename,
+                                       HYPRE_StructGrid     grid,
+                                       HYPRE_Int           *num_ghost,
+                                       HYPRE_StructVector  *vector);
+
 /**@}*/
 /**@}*/
 
@@ -299,6 +299,40 @@ HYPRE_StructVectorPrint( const char         *filename,
    return ( hypre_StructVectorPrint(filename, vector, all) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorPrintBinary( const char         *filename,
+                               HYPRE_StructVector  vector )
+{
+   return ( hypre_StructVectorPrintBinary(filename, vector) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorReadBinary( MPI_Comm             comm,
+                              const char          *filename,
+                              HYPRE_StructGrid     grid,
+                              HYPRE_Int           *num_ghost,
+                              HYPRE_StructVector  *vector )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   *vector = (HYPRE_StructVector)
+      hypre_StructVectorReadBinary(comm, filename, (hypre_StructGrid *) grid, num_ghost);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_StructVectorSetNumGhost
  *--------------------------------------------------------------------------*/
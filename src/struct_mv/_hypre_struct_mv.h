@@ -873,6 +873,10 @@ typedef struct
    HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
                                                     indexes map */
 
+   HYPRE_Int          *intersect_marker; /* Marks entries already found by
+                                            BoxManIntersect (by position) */
+   HYPRE_Int           intersect_stamp; /* Marker value of the latest query */
+
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */ 
    hypre_BoxManEntry **my_entries; /* Points into entries that are mine and
@@ -928,6 +932,8 @@ typedef struct
 #define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
 #define hypre_BoxManSize(manager)               ((manager) -> size)
 #define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManIntersectMarker(manager)    ((manager) -> intersect_marker)
+#define hypre_BoxManIntersectStamp(manager)     ((manager) -> intersect_stamp)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
@@ -995,6 +1001,7 @@ typedef struct hypre_StructGrid_struct
    hypre_Box           *bounding_box; /* Bounding box around grid */
 
    HYPRE_Int            local_size;   /* Number of grid points locally */
+   HYPRE_Int            max_box_size; /* Number of points in largest local box */
    HYPRE_BigInt         global_size;  /* Total number of grid points */
 
    hypre_Index          periodic;     /* Indicates if grid is periodic */
@@ -1010,6 +1017,12 @@ typedef struct hypre_StructGrid_struct
    HYPRE_Int            num_ghost[2*HYPRE_MAXDIM]; /* ghost layer size */
 
    hypre_BoxManager    *boxman;
+
+   /* Communication patterns computed from stencils on this grid, cached for
+    * reuse by hypre_CreateCommInfoFromStencil() */
+   HYPRE_Int            num_comm_infos;
+   HYPRE_Int           *comm_info_keys;
+   struct hypre_CommInfo_struct **comm_infos;
 #if defined(HYPRE_USING_CUDA)
    HYPRE_MemoryLocation data_location;
 #endif
@@ -1026,6 +1039,7 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridMaxDistance(grid)   ((grid) -> max_distance)
 #define hypre_StructGridBoundingBox(grid)   ((grid) -> bounding_box)
 #define hypre_StructGridLocalSize(grid)     ((grid) -> local_size)
+#define hypre_StructGridMaxBoxSize(grid)    ((grid) -> max_box_size)
 #define hypre_StructGridGlobalSize(grid)    ((grid) -> global_size)
 #define hypre_StructGridPeriodic(grid)      ((grid) -> periodic)
 #define hypre_StructGridNumPeriods(grid)    ((grid) -> num_periods)
@@ -1035,6 +1049,14 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridGhlocalSize(grid)   ((grid) -> ghlocal_size)
 #define hypre_StructGridNumGhost(grid)      ((grid) -> num_ghost)
 #define hypre_StructGridBoxMan(grid)        ((grid) -> boxman)
+#define hypre_StructGridNumCommInfos(grid)  ((grid) -> num_comm_infos)
+#define hypre_StructGridCommInfoKeys(grid)  ((grid) -> comm_info_keys)
+#define hypre_StructGridCommInfos(grid)     ((grid) -> comm_infos)
+
+/* Key of a cached communication pattern: the ghost growth in each direction
+ * followed by the 3^ndim stencil footprint (see communication_info.c) */
+#define hypre_StructGridCommInfoKeySize     (2*HYPRE_MAXDIM + 27)
+#define hypre_StructGridCommInfoMaxCached   16
 
 #define hypre_StructGridBox(grid, i)        (hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i))
 #define hypre_StructGridNumBoxes(grid)      (hypre_BoxArraySize(hypre_StructGridBoxes(grid)))
@@ -1213,6 +1235,15 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent exchange: after the first communication the buffer sizes
+    * are fixed, so the buffers and (persistent) requests are kept here */
+   HYPRE_Int           persistent_tag;  /* tag of the requests (-1 if none) */
+   HYPRE_Int           persistent_busy; /* are they in use by a handle? */
+   hypre_MPI_Request  *persistent_requests;
+   hypre_MPI_Status   *persistent_status;
+   HYPRE_Complex     **persistent_send_buffers;
+   HYPRE_Complex     **persistent_recv_buffers;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -1238,6 +1269,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* are the buffers and requests those of the CommPkg? */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1329,6 +1363,13 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistentTag(comm_pkg)         (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentBusy(comm_pkg)        (comm_pkg -> persistent_busy)
+#define hypre_CommPkgPersistentRequests(comm_pkg)    (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)      (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg) (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg) (comm_pkg -> persistent_recv_buffers)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1344,6 +1385,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 
 #endif
 /******************************************************************************
@@ -1707,6 +1749,7 @@ HYPRE_Int hypre_CommInfoSetTransforms ( hypre_CommInfo *comm_info , HYPRE_Int nu
 HYPRE_Int hypre_CommInfoGetTransforms ( hypre_CommInfo *comm_info , HYPRE_Int *num_transforms , hypre_Index **coords , hypre_Index **dirs );
 HYPRE_Int hypre_CommInfoProjectSend ( hypre_CommInfo *comm_info , hypre_Index index , hypre_Index stride );
 HYPRE_Int hypre_CommInfoProjectRecv ( hypre_CommInfo *comm_info , hypre_Index index , hypre_Index stride );
+HYPRE_Int hypre_CommInfoClone ( hypre_CommInfo *comm_info , hypre_CommInfo **clone_ptr );
 HYPRE_Int hypre_CommInfoDestroy ( hypre_CommInfo *comm_info );
 HYPRE_Int hypre_CreateCommInfoFromStencil ( hypre_StructGrid *grid , hypre_StructStencil *stencil , hypre_CommInfo **comm_info_ptr );
 HYPRE_Int hypre_CreateCommInfoFromNumGhost ( hypre_StructGrid *grid , HYPRE_Int *num_ghost , hypre_CommInfo **comm_info_ptr );
@@ -1750,6 +1793,8 @@ HYPRE_Int HYPRE_StructMatrixGetGrid ( HYPRE_StructMatrix matrix , HYPRE_StructGr
 HYPRE_Int HYPRE_StructMatrixSetSymmetric ( HYPRE_StructMatrix matrix , HYPRE_Int symmetric );
 HYPRE_Int HYPRE_StructMatrixSetConstantEntries ( HYPRE_StructMatrix matrix , HYPRE_Int nentries , HYPRE_Int *entries );
 HYPRE_Int HYPRE_StructMatrixPrint ( const char *filename , HYPRE_StructMatrix matrix , HYPRE_Int all );
+HYPRE_Int HYPRE_StructMatrixPrintBinary ( const char *filename , HYPRE_StructMatrix matrix );
+HYPRE_Int HYPRE_StructMatrixReadBinary ( MPI_Comm comm , const char *filename , HYPRE_StructGrid grid , HYPRE_Int *num_ghost , HYPRE_StructMatrix *matrix );
 HYPRE_Int HYPRE_StructMatrixMatvec ( HYPRE_Complex alpha , HYPRE_StructMatrix A , HYPRE_StructVector x , HYPRE_Complex beta , HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructMatrixClearBoundary( HYPRE_StructMatrix matrix );
 
@@ -1771,6 +1816,8 @@ HYPRE_Int HYPRE_StructVectorGetValues ( HYPRE_StructVector vector , HYPRE_Int *g
 HYPRE_Int HYPRE_StructVectorGetBoxValues ( HYPRE_StructVector vector , HYPRE_Int *ilower , HYPRE_Int *iupper , HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructVectorAssemble ( HYPRE_StructVector vector );
 HYPRE_Int HYPRE_StructVectorPrint ( const char *filename , HYPRE_StructVector vector , HYPRE_Int all );
+HYPRE_Int HYPRE_StructVectorPrintBinary ( const char *filename , HYPRE_StructVector vector );
+HYPRE_Int HYPRE_StructVectorReadBinary ( MPI_Comm comm , const char *filename , HYPRE_StructGrid grid , HYPRE_Int *num_ghost , HYPRE_StructVector *vector );
 HYPRE_Int HYPRE_StructVectorSetNumGhost ( HYPRE_StructVector vector , HYPRE_Int *num_ghost );
 HYPRE_Int HYPRE_StructVectorCopy ( HYPRE_StructVector x , HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructVectorSetConstantValues ( HYPRE_StructVector vector , HYPRE_Complex values );
@@ -1792,6 +1839,7 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type , HYPRE_Int *boxn
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_Box *data_box , HYPRE_Int data_box_offset , hypre_CommEntryType *comm_entry );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action , HYPRE_Int tag , hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
+HYPRE_Int hypre_ProgressCommunication ( hypre_CommHandle *comm_handle , HYPRE_Int *done );
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action );
 HYPRE_Int hypre_CommPkgDestroy ( hypre_CommPkg *comm_pkg );
 
@@ -1803,6 +1851,7 @@ HYPRE_Int hypre_StructPartialCopy ( hypre_StructVector *x , hypre_StructVector *
 HYPRE_Int hypre_StructGridCreate ( MPI_Comm comm , HYPRE_Int dim , hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridRef ( hypre_StructGrid *grid , hypre_StructGrid **grid_ref );
 HYPRE_Int hypre_StructGridDestroy ( hypre_StructGrid *grid );
+HYPRE_Int hypre_StructGridClearCommInfos ( hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridSetPeriodic ( hypre_StructGrid *grid , hypre_Index periodic );
 HYPRE_Int hypre_StructGridSetExtents ( hypre_StructGrid *grid , hypre_Index ilower , hypre_Index iupper );
 HYPRE_Int hypre_StructGridSetBoxes ( hypre_StructGrid *grid , hypre_BoxArray *boxes );
@@ -1816,11 +1865,13 @@ HYPRE_Int hypre_ComputeBoxnums ( hypre_BoxArray *boxes , HYPRE_Int *procs , HYPR
 HYPRE_Int hypre_StructGridPrint ( FILE *file , hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridRead ( MPI_Comm comm , FILE *file , hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridSetNumGhost ( hypre_StructGrid *grid , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructGridBoxThreads ( hypre_StructGrid *grid );
 #if defined(HYPRE_USING_CUDA)
 HYPRE_Int hypre_StructGridGetMaxBoxSize(hypre_StructGrid *grid);
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid, HYPRE_Int data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x , hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x , hypre_StructVector *y );
 
 /* struct_io.c */
@@ -1829,6 +1880,9 @@ HYPRE_Int hypre_PrintCCVDBoxArrayData ( FILE *file , hypre_BoxArray *box_array ,
 HYPRE_Int hypre_PrintCCBoxArrayData ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Complex *data );
 HYPRE_Int hypre_ReadBoxArrayData ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Int dim , HYPRE_Complex *data );
 HYPRE_Int hypre_ReadBoxArrayData_CC ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int stencil_size , HYPRE_Int real_stencil_size , HYPRE_Int constant_coefficient , HYPRE_Int dim , HYPRE_Complex *data );
+HYPRE_Int hypre_PrintBinaryStructData ( const char *filename , hypre_StructGrid *grid , HYPRE_Int kind , HYPRE_Int info_size , HYPRE_BigInt *info , HYPRE_Int num_const , HYPRE_Complex *const_values , HYPRE_Int num_var , hypre_BoxArray *data_space , HYPRE_Complex **var_data );
+HYPRE_Int hypre_ReadBinaryStructHeader ( MPI_Comm comm , const char *filename , HYPRE_Int kind , HYPRE_Int *info_size_ptr , HYPRE_BigInt **info_ptr , HYPRE_Int *num_const_ptr , HYPRE_Complex **const_values_ptr , HYPRE_Int *num_var_ptr , hypre_StructGrid **grid_ptr );
+HYPRE_Int hypre_ReadBinaryBoxArrayData ( MPI_Comm comm , const char *filename , HYPRE_Int kind , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_var , HYPRE_Complex **var_data );
 
 /* struct_matrix.c */
 HYPRE_Complex *hypre_StructMatrixExtractPointerByIndex ( hypre_StructMatrix *matrix , HYPRE_Int b , hypre_Index index );
@@ -1851,6 +1905,8 @@ HYPRE_Int hypre_StructMatrixClearGhostValues ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixPrint ( const char *filename , hypre_StructMatrix *matrix , HYPRE_Int all );
 HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix , hypre_StructMatrix *to_matrix );
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm , const char *filename , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixPrintBinary ( const char *filename , hypre_StructMatrix *matrix );
+hypre_StructMatrix *hypre_StructMatrixReadBinary ( MPI_Comm comm , const char *filename , hypre_StructGrid *grid , HYPRE_Int *num_ghost );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
 
 /* struct_matrix_mask.c */
@@ -1866,6 +1922,11 @@ HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha , hypre_StructMatrix *A ,
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y );
 
+/* struct_matvec_stencil.c */
+HYPRE_Int hypre_StructMatvecStencilSupported ( hypre_StructMatrix *A , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecCC0Stencil ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecCCStencil ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+
 /* struct_scale.c */
 HYPRE_Int hypre_StructScale ( HYPRE_Complex alpha , hypre_StructVector *y );
 
@@ -1901,6 +1962,8 @@ hypre_CommPkg *hypre_StructVectorGetMigrateCommPkg ( hypre_StructVector *from_ve
 HYPRE_Int hypre_StructVectorMigrate ( hypre_CommPkg *comm_pkg , hypre_StructVector *from_vector , hypre_StructVector *to_vector );
 HYPRE_Int hypre_StructVectorPrint ( const char *filename , hypre_StructVector *vector , HYPRE_Int all );
 hypre_StructVector *hypre_StructVectorRead ( MPI_Comm comm , const char *filename , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorPrintBinary ( const char *filename , hypre_StructVector *vector );
+hypre_StructVector *hypre_StructVectorReadBinary ( MPI_Comm comm , const char *filename , hypre_StructGrid *grid , HYPRE_Int *num_ghost );
 hypre_StructVector *hypre_StructVectorClone ( hypre_StructVector *vector );
 
 #if defined(HYPRE_USING_DEVICE_OPENMP)
@@ -2498,7 +2561,9 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
 #else
 #define Pragma(x) _Pragma(HYPRE_XSTR(x))
 #endif
-#define OMP1 Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
+/* box loops run serially inside loops that hand out whole boxes to the
+ * threads (see hypre_StructGridBoxThreads) */
+#define OMP1 Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE if (!omp_in_parallel()))
 #else
 #define OMP1
 #endif
@@ -457,6 +457,8 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
    hypre_BoxManInfoObjects(manager) = hypre_TAlloc(char, max_nentries*info_size, HYPRE_MEMORY_HOST);
 
    hypre_BoxManIndexTable(manager) = NULL;
+   hypre_BoxManIntersectMarker(manager) = NULL;
+   hypre_BoxManIntersectStamp(manager)  = 0;
    
    hypre_BoxManNumProcsSort(manager)     = 0;
    hypre_BoxManIdsSort(manager)          = hypre_CTAlloc(HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
@@ -576,6 +578,7 @@ hypre_BoxManDestroy( hypre_BoxManager *manager )
       hypre_Free((char *)hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
       
       hypre_TFree(hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManIntersectMarker(manager), HYPRE_MEMORY_HOST);
       
       hypre_TFree(hypre_BoxManIdsSort(manager), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_BoxManProcsSort(manager), HYPRE_MEMORY_HOST);
@@ -816,17 +819,25 @@ hypre_BoxManGetEntry( hypre_BoxManager *manager,
          }
       }
       
-      else /* otherwise find proc (TO DO: just have procs_sort not contain
-              duplicates - then we could do a regular binary search (though this
-              list is probably short)- this has to be changed in assemble, then
-              also memory management in addentry - but currently this is not
-              necessary because proc = myid for all current hypre calls) */
+      else /* otherwise find proc (the entries are sorted by proc, so do a
+              binary search over the first entry of each distinct proc) */
       {
+         HYPRE_Int  low = 0, high = num_proc - 1;
+
          start = -1;
-         for (i = 0; i< num_proc; i++)
+         while (low <= high)
          {
+            i = low + (high - low)/2;
             offset = proc_offsets[i];
-            if (proc == procs_sort[offset])
+            if (proc < procs_sort[offset])
+            {
+               high = i - 1;
+            }
+            else if (proc > procs_sort[offset])
+            {
+               low = i + 1;
+            }
+            else
             {
                start = offset;
                finish = proc_offsets[i+1];
@@ -1132,7 +1143,7 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    HYPRE_Int  is_gather, global_is_gather;
    HYPRE_Int  nentries;
    HYPRE_Int *procs_sort, *ids_sort;
-   HYPRE_Int  i, j, k;
+   HYPRE_Int  i, j;
 
    HYPRE_Int need_to_sort = 1; /* default it to sort */
    //HYPRE_Int short_sort = 0; /*do abreviated sort */
@@ -2219,8 +2230,6 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    {
       HYPRE_Int *indexes[HYPRE_MAXDIM];
       HYPRE_Int  size[HYPRE_MAXDIM];
-      HYPRE_Int  iminmax[2];
-      HYPRE_Int  index_not_there;
       HYPRE_Int  d, e, itsize;
       HYPRE_Int  mystart, myfinish;
       HYPRE_Int  imin[HYPRE_MAXDIM];
@@ -2257,51 +2266,27 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
          indexes[d] = hypre_CTAlloc(HYPRE_Int,  2*nentries, HYPRE_MEMORY_HOST);
          size[d] = 0;
       }
-      /* loop through each entry and get index */
-      for (e = 0; e < nentries; e++)
+      /* collect the min and max of each entry in each dim, then sort and
+         remove duplicates (inserting them one at a time into a sorted array
+         is quadratic in the number of entries) */
+      for (d = 0; d < ndim; d++)
       {
-         entry  = &entries[e]; /* grab the entry - get min and max extents */
-         entry_imin = hypre_BoxManEntryIMin(entry);
-         entry_imax = hypre_BoxManEntryIMax(entry);
-
-          /* in each dim, check if min/max positions are already in the table */
-         for (d = 0; d < ndim; d++)
+         for (e = 0; e < nentries; e++)
          {
-            iminmax[0] = hypre_IndexD(entry_imin, d);
-            iminmax[1] = hypre_IndexD(entry_imax, d) + 1;
-
-            /* do the min then the max */
-            for (i = 0; i < 2; i++)
+            entry = &entries[e];
+            indexes[d][2*e]     = hypre_IndexD(hypre_BoxManEntryIMin(entry), d);
+            indexes[d][2*e + 1] = hypre_IndexD(hypre_BoxManEntryIMax(entry), d) + 1;
+         }
+         hypre_qsort0(indexes[d], 0, 2*nentries - 1);
+         for (e = 0; e < 2*nentries; e++)
+         {
+            if ((size[d] == 0) || (indexes[d][e] != indexes[d][size[d] - 1]))
             {
-               /* find the new index position in the indexes array */
-               index_not_there = 1;
-
-               if (!i)
-               {
-                  location = hypre_BinarySearch2(indexes[d], iminmax[i], 0,
-                                                 size[d]-1, &j);
-                  if (location != -1) index_not_there = 0;               
-               }
-               else /* for max, we can start seach at min position */
-               {
-                  location = hypre_BinarySearch2(indexes[d], iminmax[i], j,
-                                                 size[d]-1, &j);
-                  if (location != -1) index_not_there = 0;
-               }
-               
-               /* if the index is already there, don't add it again */
-               if (index_not_there)
-               {
-                  for (k = size[d]; k > j; k--) /* make room for new index */
-                  {
-                     indexes[d][k] = indexes[d][k-1];
-                  }
-                  indexes[d][j] = iminmax[i];
-                  size[d]++; /* increase the size in that dimension */
-               }
-            } /* end of for min and max */
-         } /* end of for each dimension of the entry */
-      } /* end of for each entry loop */
+               indexes[d][size[d]] = indexes[d][e];
+               size[d]++;
+            }
+         }
+      }
 
       if (nentries) 
       {
@@ -2406,6 +2391,7 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
                                                         re-assemble - shouldn't
                                                         be though */
       hypre_BoxManIndexTable(manager) = index_table;
+      hypre_TFree(hypre_BoxManIntersectMarker(manager), HYPRE_MEMORY_HOST);
 
       for (d = 0; d < ndim; d++)
       {
@@ -2434,6 +2420,50 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Return the location k of 'index' in the (sorted) indexes array of the box
+ * manager in dimension d, i.e., indexes[k] <= index < indexes[k+1], with -1
+ * if index is below all of the indexes and size if it is beyond them.  The
+ * neighborhood of 'guess' is checked first, since consecutive queries tend to
+ * be close together, before resorting to a binary search.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManFindIndexD( hypre_BoxManager *manager,
+                        HYPRE_Int         d,
+                        HYPRE_Int         index,
+                        HYPRE_Int         guess )
+{
+   HYPRE_Int  *indexes = hypre_BoxManIndexesD(manager, d);
+   HYPRE_Int   size    = hypre_BoxManSizeD(manager, d);
+   HYPRE_Int   low, high, m;
+
+   guess = hypre_max(hypre_min(guess, size), -1);
+   if ( ((guess < 0)     || (indexes[guess] <= index)) &&
+        ((guess >= size) || (index < indexes[guess + 1])) )
+   {
+      return guess;
+   }
+
+   /* find the first of indexes[0..size] that is greater than index */
+   low  = 0;
+   high = size + 1;
+   while (low < high)
+   {
+      m = low + (high - low)/2;
+      if (indexes[m] <= index)
+      {
+         low = m + 1;
+      }
+      else
+      {
+         high = m;
+      }
+   }
+
+   return (low - 1);
+}
+
 /*--------------------------------------------------------------------------
  * Given a box (lower and upper indices), return a list of boxes in the global
  * grid that are intersected by this box. The user must insure that a processor
@@ -2458,11 +2488,10 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
 {
    HYPRE_Int           ndim = hypre_BoxManNDim(manager);
    HYPRE_Int           d;
-   HYPRE_Int           find_index_d, current_index_d;
-   HYPRE_Int          *man_indexes_d;
+   HYPRE_Int           current_index_d;
    HYPRE_Int           man_index_size_d;
-   HYPRE_Int           nentries;
-   HYPRE_Int          *marker, position;
+   HYPRE_Int           nentries, entries_alloc;
+   HYPRE_Int          *marker, stamp, position;
    hypre_Box          *index_box, *table_box;
    hypre_Index         stride, loop_size;
    hypre_Index         man_ilower, man_iupper;
@@ -2498,28 +2527,11 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
       man_ilower[d] = 0;
       man_iupper[d] = 0;
 
-      man_indexes_d = hypre_BoxManIndexesD(manager, d);
       man_index_size_d = hypre_BoxManSizeD(manager, d);
 
       /* -----find location of ilower[d] in  indexes-----*/
-      find_index_d = hypre_IndexD(ilower, d);
-
-      /* Start looking in place indicated by last_index stored in map */
-      current_index_d = hypre_BoxManLastIndexD(manager, d);
-
-      /* Loop downward if target index is less than current location */
-      while ( (current_index_d >= 0 ) &&
-              (find_index_d < man_indexes_d[current_index_d]) )
-      {
-         current_index_d --;
-      }
-
-      /* Loop upward if target index is greater than current location */
-      while ( (current_index_d <= (man_index_size_d - 1)) &&
-              (find_index_d >= man_indexes_d[current_index_d + 1]) )
-      {
-         current_index_d ++;
-      }
+      current_index_d = hypre_BoxManFindIndexD(
+         manager, d, hypre_IndexD(ilower, d), hypre_BoxManLastIndexD(manager, d));
 
       if( current_index_d > (man_index_size_d - 1) )
       {
@@ -2533,15 +2545,9 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
       }
 
       /* -----find location of iupper[d] in  indexes-----*/
-      
-      find_index_d = hypre_IndexD(iupper, d);
+      current_index_d = hypre_max(current_index_d, hypre_BoxManFindIndexD(
+                                     manager, d, hypre_IndexD(iupper, d), current_index_d));
 
-      /* Loop upward if target index is greater than current location */
-      while ( (current_index_d <= (man_index_size_d-1)) &&
-              (find_index_d >= man_indexes_d[current_index_d+1]) )
-      {
-         current_index_d ++;
-      }
       if( current_index_d < 0 )
       {
          *entries_ptr  = NULL;
@@ -2556,12 +2562,30 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
 
    /*-----------------------------------------------------------------
     * If we reach this point, then set up the entries array.
-    * Use a marker array to ensure unique entries.
+    * Use a marker array to ensure unique entries.  The marker is kept in
+    * the manager and stamped with a new value for each call, so that the
+    * cost of a query does not depend on the total number of entries.
     *-----------------------------------------------------------------*/
 
-   nentries = hypre_BoxManMaxNEntries(manager);
-   entries  = hypre_CTAlloc(hypre_BoxManEntry *,  nentries, HYPRE_MEMORY_HOST); /* realloc below */
-   marker   = hypre_CTAlloc(HYPRE_Int,  nentries, HYPRE_MEMORY_HOST);
+   if (hypre_BoxManIntersectMarker(manager) == NULL)
+   {
+      hypre_BoxManIntersectMarker(manager) =
+         hypre_CTAlloc(HYPRE_Int, hypre_BoxManNEntries(manager), HYPRE_MEMORY_HOST);
+      hypre_BoxManIntersectStamp(manager) = 0;
+   }
+   if (hypre_BoxManIntersectStamp(manager) >= (1 << 30)) /* start over */
+   {
+      for (position = 0; position < hypre_BoxManNEntries(manager); position++)
+      {
+         hypre_BoxManIntersectMarker(manager)[position] = 0;
+      }
+      hypre_BoxManIntersectStamp(manager) = 0;
+   }
+   marker = hypre_BoxManIntersectMarker(manager);
+   stamp  = ++hypre_BoxManIntersectStamp(manager);
+
+   entries_alloc = 16;
+   entries  = hypre_TAlloc(hypre_BoxManEntry *,  entries_alloc, HYPRE_MEMORY_HOST); /* realloc below */
    index_table = hypre_BoxManIndexTable(manager);
 
    nentries = 0;
@@ -2582,10 +2606,16 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
       {
          position = hypre_BoxManEntryPosition(entry);
 
-         if (marker[position] == 0) /* Add entry and mark as added */
+         if (marker[position] != stamp) /* Add entry and mark as added */
          {
+            if (nentries == entries_alloc)
+            {
+               entries_alloc *= 2;
+               entries = hypre_TReAlloc(entries, hypre_BoxManEntry *,
+                                        entries_alloc, HYPRE_MEMORY_HOST);
+            }
             entries[nentries] = entry;
-            marker[position]  = 1;
+            marker[position]  = stamp;
             nentries++;
          }
 
@@ -2604,7 +2634,6 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
 
    hypre_BoxDestroy(table_box);
    hypre_BoxDestroy(index_box);
-   hypre_TFree(marker, HYPRE_MEMORY_HOST);
 
    *entries_ptr  = entries;
    *nentries_ptr = nentries;
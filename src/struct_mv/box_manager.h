@@ -101,6 +101,10 @@ typedef struct
    HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
                                                     indexes map */
 
+   HYPRE_Int          *intersect_marker; /* Marks entries already found by
+                                            BoxManIntersect (by position) */
+   HYPRE_Int           intersect_stamp; /* Marker value of the latest query */
+
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */ 
    hypre_BoxManEntry **my_entries; /* Points into entries that are mine and
@@ -156,6 +160,8 @@ typedef struct
 #define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
 #define hypre_BoxManSize(manager)               ((manager) -> size)
 #define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManIntersectMarker(manager)    ((manager) -> intersect_marker)
+#define hypre_BoxManIntersectStamp(manager)     ((manager) -> intersect_stamp)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
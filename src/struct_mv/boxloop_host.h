@@ -25,7 +25,9 @@
 #else
 #define Pragma(x) _Pragma(HYPRE_XSTR(x))
 #endif
-#define OMP1 Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
+/* box loops run serially inside loops that hand out whole boxes to the
+ * threads (see hypre_StructGridBoxThreads) */
+#define OMP1 Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE if (!omp_in_parallel()))
 #else
 #define OMP1
 #endif
@@ -123,6 +123,89 @@ hypre_CommInfoProjectRecv( hypre_CommInfo  *comm_info,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Copy an array of per-box integer arrays laid out like 'boxes'.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int **
+hypre_CommInfoCloneBoxInts( HYPRE_Int           **ints,
+                            hypre_BoxArrayArray  *boxes )
+{
+   HYPRE_Int  **ints_clone = NULL;
+   HYPRE_Int    i, n;
+
+   if (ints != NULL)
+   {
+      ints_clone = hypre_CTAlloc(HYPRE_Int *, hypre_BoxArrayArraySize(boxes),
+                                 HYPRE_MEMORY_HOST);
+      hypre_ForBoxArrayI(i, boxes)
+      {
+         n = hypre_BoxArraySize(hypre_BoxArrayArrayBoxArray(boxes, i));
+         ints_clone[i] = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(ints_clone[i], ints[i], HYPRE_Int, n,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   return ints_clone;
+}
+
+/*--------------------------------------------------------------------------
+ * Return a deep copy of comm_info.  Since hypre_CommPkgCreate() takes
+ * ownership of its CommInfo argument, this is used to hand out copies of the
+ * patterns cached on a grid.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommInfoClone( hypre_CommInfo   *comm_info,
+                     hypre_CommInfo  **clone_ptr )
+{
+   hypre_CommInfo       *clone;
+   hypre_BoxArrayArray  *send_boxes = hypre_CommInfoSendBoxes(comm_info);
+   hypre_BoxArrayArray  *recv_boxes = hypre_CommInfoRecvBoxes(comm_info);
+   HYPRE_Int             num_transforms = hypre_CommInfoNumTransforms(comm_info);
+
+   hypre_CommInfoCreate(
+      hypre_BoxArrayArrayDuplicate(send_boxes),
+      hypre_BoxArrayArrayDuplicate(recv_boxes),
+      hypre_CommInfoCloneBoxInts(hypre_CommInfoSendProcesses(comm_info), send_boxes),
+      hypre_CommInfoCloneBoxInts(hypre_CommInfoRecvProcesses(comm_info), recv_boxes),
+      hypre_CommInfoCloneBoxInts(hypre_CommInfoSendRBoxnums(comm_info), send_boxes),
+      hypre_CommInfoCloneBoxInts(hypre_CommInfoRecvRBoxnums(comm_info), recv_boxes),
+      hypre_BoxArrayArrayDuplicate(hypre_CommInfoSendRBoxes(comm_info)),
+      hypre_BoxArrayArrayDuplicate(hypre_CommInfoRecvRBoxes(comm_info)),
+      hypre_CommInfoBoxesMatch(comm_info), &clone);
+
+   hypre_CopyIndex(hypre_CommInfoSendStride(comm_info),
+                   hypre_CommInfoSendStride(clone));
+   hypre_CopyIndex(hypre_CommInfoRecvStride(comm_info),
+                   hypre_CommInfoRecvStride(clone));
+
+   hypre_CommInfoNumTransforms(clone) = num_transforms;
+   if (hypre_CommInfoCoords(comm_info) != NULL)
+   {
+      hypre_CommInfoCoords(clone) = hypre_TAlloc(hypre_Index, num_transforms,
+                                                 HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_CommInfoCoords(clone), hypre_CommInfoCoords(comm_info),
+                    hypre_Index, num_transforms, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   if (hypre_CommInfoDirs(comm_info) != NULL)
+   {
+      hypre_CommInfoDirs(clone) = hypre_TAlloc(hypre_Index, num_transforms,
+                                               HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_CommInfoDirs(clone), hypre_CommInfoDirs(comm_info),
+                    hypre_Index, num_transforms, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_CommInfoSendTransforms(clone) =
+      hypre_CommInfoCloneBoxInts(hypre_CommInfoSendTransforms(comm_info), send_boxes);
+   hypre_CommInfoRecvTransforms(clone) =
+      hypre_CommInfoCloneBoxInts(hypre_CommInfoRecvTransforms(comm_info), recv_boxes);
+
+   *clone_ptr = clone;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -288,6 +371,12 @@ hypre_CommInfoDestroy( hypre_CommInfo  *comm_info )
  *    B. Boxes in the send and recv regions do not need to be in any
  *       particular order (including those that are periodic).  
  *
+ *    C. The result depends on the stencil only through the "grow"
+ *       information and the stencil grid, so it is cached on the grid
+ *       under that key and a copy is returned for later stencils with the
+ *       same footprint (e.g., the matvec, relaxation, and residual
+ *       computations of a solver setup all share one intersection pass).
+ *
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -327,6 +416,9 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
    hypre_Box             *stencil_box, *sbox; /* extents of the stencil grid */
    HYPRE_Int             *stencil_grid;
    HYPRE_Int              grow[HYPRE_MAXDIM][2];
+   HYPRE_Int              key[hypre_StructGridCommInfoKeySize];
+   HYPRE_Int             *keys;
+   HYPRE_Int              num_cached;
                        
    hypre_BoxManEntry    **entries;
    hypre_BoxManEntry     *entry;
@@ -437,6 +529,41 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
       hypre_SerialBoxLoop1End(si);
    }
 
+   /*------------------------------------------------------
+    * Return a copy of the cached pattern if there is one
+    *------------------------------------------------------*/
+
+   for (i = 0; i < hypre_StructGridCommInfoKeySize; i++)
+   {
+      key[i] = 0;
+   }
+   for (d = 0; d < ndim; d++)
+   {
+      key[2*d]     = grow[d][0];
+      key[2*d + 1] = grow[d][1];
+   }
+   for (si = 0; si < hypre_BoxVolume(stencil_box); si++)
+   {
+      key[2*HYPRE_MAXDIM + si] = stencil_grid[si];
+   }
+
+   num_cached = hypre_StructGridNumCommInfos(grid);
+   keys       = hypre_StructGridCommInfoKeys(grid);
+   for (j = 0; j < num_cached; j++)
+   {
+      if (memcmp(&keys[j*hypre_StructGridCommInfoKeySize], key,
+                 hypre_StructGridCommInfoKeySize*sizeof(HYPRE_Int)) == 0)
+      {
+         hypre_BoxDestroy(stencil_box);
+         hypre_BoxDestroy(sbox);
+         hypre_TFree(stencil_grid, HYPRE_MEMORY_HOST);
+
+         hypre_CommInfoClone(hypre_StructGridCommInfos(grid)[j], comm_info_ptr);
+
+         return hypre_error_flag;
+      }
+   }
+
    /*------------------------------------------------------
     * Compute send/recv boxes and procs for each local box
     *------------------------------------------------------*/
@@ -778,6 +905,26 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
                         send_rboxnums, recv_rboxnums, send_rboxes, recv_rboxes,
                         1, comm_info_ptr);
 
+   /* Cache a copy on the grid for later stencils with the same footprint */
+   if (num_cached < hypre_StructGridCommInfoMaxCached)
+   {
+      if (num_cached == 0)
+      {
+         hypre_StructGridCommInfoKeys(grid) =
+            hypre_TAlloc(HYPRE_Int, hypre_StructGridCommInfoMaxCached *
+                         hypre_StructGridCommInfoKeySize, HYPRE_MEMORY_HOST);
+         hypre_StructGridCommInfos(grid) =
+            hypre_TAlloc(hypre_CommInfo *, hypre_StructGridCommInfoMaxCached,
+                         HYPRE_MEMORY_HOST);
+      }
+      keys = hypre_StructGridCommInfoKeys(grid);
+      hypre_TMemcpy(&keys[num_cached*hypre_StructGridCommInfoKeySize], key,
+                    HYPRE_Int, hypre_StructGridCommInfoKeySize,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_CommInfoClone(*comm_info_ptr, &hypre_StructGridCommInfos(grid)[num_cached]);
+      hypre_StructGridNumCommInfos(grid) = num_cached + 1;
+   }
+
    return hypre_error_flag;
 }
 
@@ -35,11 +35,17 @@ hypre_StructAxpy( HYPRE_Complex       alpha,
    hypre_IndexRef    start;
    hypre_Index       unit_stride;
 
+   HYPRE_Int         box_threads;
    HYPRE_Int         i;
 
    hypre_SetIndex(unit_stride, 1);
 
    boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   box_threads = hypre_StructGridBoxThreads(hypre_StructVectorGrid(y));
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, box, start, x_data_box, y_data_box, xp, yp, loop_size) if (box_threads) schedule(dynamic)
+#endif
    hypre_ForBoxI(i, boxes)
    {
       box   = hypre_BoxArrayBox(boxes, i);
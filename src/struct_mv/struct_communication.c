@@ -129,6 +129,7 @@ hypre_CommPkgCreate( hypre_CommInfo   *comm_info,
 
    hypre_CommPkgComm(comm_pkg)      = comm;
    hypre_CommPkgFirstComm(comm_pkg) = 1;
+   hypre_CommPkgPersistentTag(comm_pkg) = -1;
    hypre_CommPkgNDim(comm_pkg)      = ndim;
    hypre_CommPkgNumValues(comm_pkg) = num_values;
    hypre_CommPkgNumOrders(comm_pkg) = 0;
@@ -759,11 +760,104 @@ hypre_CommTypeSetEntry( hypre_Box           *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Set up the persistent buffers and requests of a communication package for
+ * the given tag.  This is only done after the first communication, since the
+ * buffer sizes change once the prefix information has been exchanged.  The
+ * buffers are allocated once; the requests are re-created if the tag changes.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommPkgSetPersistent( hypre_CommPkg  *comm_pkg,
+                            HYPRE_Int       tag )
+{
+   HYPRE_Int            num_sends = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm      = hypre_CommPkgComm(comm_pkg);
+   HYPRE_Int            num_requests = num_sends + num_recvs;
+
+   hypre_MPI_Request   *requests  = hypre_CommPkgPersistentRequests(comm_pkg);
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+   hypre_CommType      *comm_type;
+   HYPRE_Int            i, j;
+
+   if (requests == NULL)
+   {
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+      hypre_CommPkgPersistentRequests(comm_pkg) = requests;
+      hypre_CommPkgPersistentStatus(comm_pkg) =
+         hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+
+      send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         send_buffers[0] = hypre_TAlloc(HYPRE_Complex, hypre_CommPkgSendBufsize(comm_pkg),
+                                        HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
+            send_buffers[i] = send_buffers[i-1] + hypre_CommTypeBufsize(comm_type);
+         }
+      }
+      hypre_CommPkgPersistentSendBuffers(comm_pkg) = send_buffers;
+
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+      if (num_recvs > 0)
+      {
+         recv_buffers[0] = hypre_TAlloc(HYPRE_Complex, hypre_CommPkgRecvBufsize(comm_pkg),
+                                        HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
+            recv_buffers[i] = recv_buffers[i-1] + hypre_CommTypeBufsize(comm_type);
+         }
+      }
+      hypre_CommPkgPersistentRecvBuffers(comm_pkg) = recv_buffers;
+   }
+   else
+   {
+      for (j = 0; j < num_requests; j++)
+      {
+         hypre_MPI_Request_free(&requests[j]);
+      }
+   }
+
+   send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+   recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+
+   /* same request order as in hypre_InitializeCommunication(): recvs first */
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_MPI_Recv_init(recv_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      hypre_MPI_Send_init(send_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+
+   hypre_CommPkgPersistentTag(comm_pkg) = tag;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
  * The communication buffers are created, the send buffer is manually
- * packed, and the communication requests are posted.
+ * packed, and the communication requests are posted.  After the first
+ * exchange with a given comm_pkg, the buffers and persistent requests kept in
+ * the comm_pkg are reused (see hypre_CommPkgSetPersistent), unless they are
+ * still in use by another outstanding exchange.
  *
  * Different "actions" are possible when the buffer data is unpacked:
  *   action = 0    - copy the data over existing values in memory
@@ -808,30 +902,68 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
 
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
-
-   /*--------------------------------------------------------------------
-    * allocate requests and status
-    *--------------------------------------------------------------------*/
+   HYPRE_Int            persistent;
 
    num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
-   status   = hypre_CTAlloc(hypre_MPI_Status,  num_requests, HYPRE_MEMORY_HOST);
+   persistent   = ( !hypre_CommPkgFirstComm(comm_pkg) &&
+                    !hypre_CommPkgPersistentBusy(comm_pkg) );
 
-   /*--------------------------------------------------------------------
-    * allocate buffers
-    *--------------------------------------------------------------------*/
+   if (persistent)
+   {
+      /*-----------------------------------------------------------------
+       * use the requests and buffers kept in the comm_pkg
+       *-----------------------------------------------------------------*/
 
-   /* allocate send buffers */
-   send_buffers = hypre_TAlloc(HYPRE_Complex *,  num_sends, HYPRE_MEMORY_HOST);
-   if (num_sends > 0)
+      if (hypre_CommPkgPersistentTag(comm_pkg) != tag)
+      {
+         hypre_CommPkgSetPersistent(comm_pkg, tag);
+      }
+      hypre_CommPkgPersistentBusy(comm_pkg) = 1;
+
+      requests     = hypre_CommPkgPersistentRequests(comm_pkg);
+      status       = hypre_CommPkgPersistentStatus(comm_pkg);
+      send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+      recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+   }
+   else
    {
-      size = hypre_CommPkgSendBufsize(comm_pkg);
-      send_buffers[0] =  hypre_CTAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
-      for (i = 1; i < num_sends; i++)
+      /*-----------------------------------------------------------------
+       * allocate requests and status
+       *-----------------------------------------------------------------*/
+
+      requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
+      status   = hypre_CTAlloc(hypre_MPI_Status,  num_requests, HYPRE_MEMORY_HOST);
+
+      /*-----------------------------------------------------------------
+       * allocate buffers
+       *-----------------------------------------------------------------*/
+
+      /* allocate send buffers */
+      send_buffers = hypre_TAlloc(HYPRE_Complex *,  num_sends, HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
       {
-         comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
-         size = hypre_CommTypeBufsize(comm_type);
-         send_buffers[i] = send_buffers[i-1] + size;
+         size = hypre_CommPkgSendBufsize(comm_pkg);
+         send_buffers[0] =  hypre_CTAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
+            size = hypre_CommTypeBufsize(comm_type);
+            send_buffers[i] = send_buffers[i-1] + size;
+         }
+      }
+
+      /* allocate recv buffers */
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *,  num_recvs, HYPRE_MEMORY_HOST);
+      if (num_recvs > 0)
+      {
+         size = hypre_CommPkgRecvBufsize(comm_pkg);
+         recv_buffers[0] =  hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
+            size = hypre_CommTypeBufsize(comm_type);
+            recv_buffers[i] = recv_buffers[i-1] + size;
+         }
       }
    }
 
@@ -877,20 +1009,6 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
       send_buffers_data = send_buffers;
    }
 
-   /* allocate recv buffers */
-   recv_buffers = hypre_TAlloc(HYPRE_Complex *,  num_recvs, HYPRE_MEMORY_HOST);
-   if (num_recvs > 0)
-   {
-      size = hypre_CommPkgRecvBufsize(comm_pkg);
-      recv_buffers[0] =  hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
-      for (i = 1; i < num_recvs; i++)
-      {
-         comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
-         size = hypre_CommTypeBufsize(comm_type);
-         recv_buffers[i] = recv_buffers[i-1] + size;
-      }
-   }
-
    /* Prepare recv buffers */
 #if (defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP))
    if (alloc_dev_buffer)
@@ -1022,34 +1140,44 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
     * post receives and initiate sends
     *--------------------------------------------------------------------*/
 
-   j = 0;
-   for(i = 0; i < num_recvs; i++)
+   if (persistent)
    {
-      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
-      hypre_MPI_Irecv(recv_buffers[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      if (num_requests)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         hypre_MPI_Startall(num_requests, requests);
       }
    }
-
-   for(i = 0; i < num_sends; i++)
+   else
    {
-      comm_type = hypre_CommPkgSendType(comm_pkg, i);
-      hypre_MPI_Isend(send_buffers[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      j = 0;
+      for(i = 0; i < num_recvs; i++)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         hypre_MPI_Irecv(recv_buffers[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         }
+      }
+
+      for(i = 0; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         hypre_MPI_Isend(send_buffers[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         }
       }
    }
 
@@ -1097,6 +1225,7 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    hypre_CommHandleAction(comm_handle)      = action;
    hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers_data;
    hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers_data;
+   hypre_CommHandlePersistent(comm_handle)  = persistent;
 
    *comm_handle_ptr = comm_handle;
 
@@ -1301,36 +1430,61 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
     * Free up communication handle
     *--------------------------------------------------------------------*/
 
-   hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
-   hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
-   if (num_sends > 0)
+   if (send_buffers != send_buffers_data)
    {
-       hypre_TFree(send_buffers[0], HYPRE_MEMORY_HOST);
+      hypre_TFree(send_buffers_data, HYPRE_MEMORY_HOST);
    }
-   if (num_recvs > 0)
+   if (recv_buffers != recv_buffers_data)
    {
-       hypre_TFree(recv_buffers[0], HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_buffers_data, HYPRE_MEMORY_HOST);
    }
 
-   hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
-
-   if (send_buffers == send_buffers_data)
+   if (hypre_CommHandlePersistent(comm_handle))
    {
-      hypre_TFree(send_buffers, HYPRE_MEMORY_HOST);
+      /* the requests and buffers stay with the comm_pkg for the next exchange */
+      hypre_CommPkgPersistentBusy(comm_pkg) = 0;
    }
    else
    {
+      hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         hypre_TFree(send_buffers[0], HYPRE_MEMORY_HOST);
+      }
+      if (num_recvs > 0)
+      {
+         hypre_TFree(recv_buffers[0], HYPRE_MEMORY_HOST);
+      }
       hypre_TFree(send_buffers, HYPRE_MEMORY_HOST);
-      hypre_TFree(send_buffers_data, HYPRE_MEMORY_HOST);
-   }
-   if (recv_buffers == recv_buffers_data)
-   {
       hypre_TFree(recv_buffers, HYPRE_MEMORY_HOST);
    }
-   else
+
+   hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Make progress on an exchange started by hypre_InitializeCommunication()
+ * without blocking.  Code that overlaps computation with communication
+ * (e.g., on the independent boxes of a hypre_ComputePkg) may call this
+ * between pieces of work, which helps MPI implementations that do not
+ * progress messages asynchronously.  On return, 'done' indicates whether all
+ * of the requests have completed.  The exchange must still be completed with
+ * hypre_FinalizeCommunication().
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProgressCommunication( hypre_CommHandle *comm_handle,
+                             HYPRE_Int        *done )
+{
+   *done = 1;
+   if (hypre_CommHandleNumRequests(comm_handle))
    {
-      hypre_TFree(recv_buffers, HYPRE_MEMORY_HOST);
-      hypre_TFree(recv_buffers_data, HYPRE_MEMORY_HOST);
+      hypre_MPI_Testall(hypre_CommHandleNumRequests(comm_handle),
+                        hypre_CommHandleRequests(comm_handle), done,
+                        hypre_CommHandleStatus(comm_handle));
    }
 
    return hypre_error_flag;
@@ -1462,6 +1616,26 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
       hypre_TFree(hypre_CommPkgIdentityOrder(comm_pkg), HYPRE_MEMORY_HOST);
 
+      if (hypre_CommPkgPersistentRequests(comm_pkg) != NULL)
+      {
+         for (i = 0; i < hypre_CommPkgNumSends(comm_pkg) + hypre_CommPkgNumRecvs(comm_pkg); i++)
+         {
+            hypre_MPI_Request_free(&hypre_CommPkgPersistentRequests(comm_pkg)[i]);
+         }
+         hypre_TFree(hypre_CommPkgPersistentRequests(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersistentStatus(comm_pkg), HYPRE_MEMORY_HOST);
+         if (hypre_CommPkgNumSends(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgPersistentSendBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgPersistentRecvBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_CommPkgPersistentSendBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersistentRecvBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+      }
+
       hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
    }
 
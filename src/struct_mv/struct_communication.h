@@ -113,6 +113,15 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent exchange: after the first communication the buffer sizes
+    * are fixed, so the buffers and (persistent) requests are kept here */
+   HYPRE_Int           persistent_tag;  /* tag of the requests (-1 if none) */
+   HYPRE_Int           persistent_busy; /* are they in use by a handle? */
+   hypre_MPI_Request  *persistent_requests;
+   hypre_MPI_Status   *persistent_status;
+   HYPRE_Complex     **persistent_send_buffers;
+   HYPRE_Complex     **persistent_recv_buffers;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -138,6 +147,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* are the buffers and requests those of the CommPkg? */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -229,6 +241,13 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistentTag(comm_pkg)         (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentBusy(comm_pkg)        (comm_pkg -> persistent_busy)
+#define hypre_CommPkgPersistentRequests(comm_pkg)    (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)      (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg) (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg) (comm_pkg -> persistent_recv_buffers)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -244,5 +263,6 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 
 #endif
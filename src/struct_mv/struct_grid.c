@@ -46,10 +46,14 @@ hypre_StructGridCreate( MPI_Comm           comm,
 
    hypre_StructGridBoundingBox(grid) = NULL;
    hypre_StructGridLocalSize(grid)   = 0;
+   hypre_StructGridMaxBoxSize(grid)  = 0;
    hypre_StructGridGlobalSize(grid)  = 0;
    hypre_SetIndex(hypre_StructGridPeriodic(grid), 0);
    hypre_StructGridRefCount(grid)     = 1;
    hypre_StructGridBoxMan(grid)       = NULL;
+   hypre_StructGridNumCommInfos(grid) = 0;
+   hypre_StructGridCommInfoKeys(grid) = NULL;
+   hypre_StructGridCommInfos(grid)    = NULL;
 
    hypre_StructGridNumPeriods(grid)   = 1;
    hypre_StructGridPShifts(grid)     = NULL;
@@ -100,6 +104,7 @@ hypre_StructGridDestroy( hypre_StructGrid *grid )
 
          hypre_BoxManDestroy(hypre_StructGridBoxMan(grid));
          hypre_TFree( hypre_StructGridPShifts(grid), HYPRE_MEMORY_HOST);
+         hypre_StructGridClearCommInfos(grid);
 
          hypre_TFree(grid, HYPRE_MEMORY_HOST);
       }
@@ -108,6 +113,29 @@ hypre_StructGridDestroy( hypre_StructGrid *grid )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructGridClearCommInfos
+ *
+ * Free the communication patterns cached on the grid.  This is called when
+ * the grid is destroyed or (re)assembled.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructGridClearCommInfos( hypre_StructGrid *grid )
+{
+   HYPRE_Int  i;
+
+   for (i = 0; i < hypre_StructGridNumCommInfos(grid); i++)
+   {
+      hypre_CommInfoDestroy(hypre_StructGridCommInfos(grid)[i]);
+   }
+   hypre_TFree(hypre_StructGridCommInfoKeys(grid), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_StructGridCommInfos(grid), HYPRE_MEMORY_HOST);
+   hypre_StructGridNumCommInfos(grid) = 0;
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  * hypre_StructGridSetPeriodic
@@ -232,7 +260,7 @@ hypre_StructGridAssemble( hypre_StructGrid *grid )
    HYPRE_Int d, k, p, i;
 
    HYPRE_Int is_boxman;
-   HYPRE_Int size, ghostsize;
+   HYPRE_Int size, max_box_size, ghostsize;
    HYPRE_Int num_local_boxes;
    HYPRE_Int myid, num_procs;
    HYPRE_BigInt global_size;
@@ -275,6 +303,9 @@ hypre_StructGridAssemble( hypre_StructGrid *grid )
    /* other initializations */
    num_local_boxes = hypre_BoxArraySize(local_boxes);
 
+   /* cached communication patterns refer to the previous box layout */
+   hypre_StructGridClearCommInfos(grid);
+
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &myid);
 
@@ -351,6 +382,7 @@ hypre_StructGridAssemble( hypre_StructGrid *grid )
    /********calculate local size and the ghost size **************/
 
    size = 0;
+   max_box_size = 0;
    ghostsize = 0;
    ghostbox = hypre_BoxCreate(ndim);
 
@@ -358,6 +390,7 @@ hypre_StructGridAssemble( hypre_StructGrid *grid )
    {
       box = hypre_BoxArrayBox(local_boxes, i);
       size +=  hypre_BoxVolume(box);
+      max_box_size = hypre_max(max_box_size, hypre_BoxVolume(box));
 
       hypre_CopyBox(box, ghostbox);
       hypre_BoxGrowByArray(ghostbox, numghost);
@@ -365,6 +398,7 @@ hypre_StructGridAssemble( hypre_StructGrid *grid )
    }
 
    hypre_StructGridLocalSize(grid) = size;
+   hypre_StructGridMaxBoxSize(grid) = max_box_size;
    hypre_StructGridGhlocalSize(grid) = ghostsize;
    hypre_BoxDestroy(ghostbox);
 
@@ -856,6 +890,49 @@ hypre_StructGridSetNumGhost( hypre_StructGrid *grid, HYPRE_Int  *num_ghost )
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructGridBoxThreads
+ *
+ * Returns 1 if the host struct kernels should hand out whole boxes of the
+ * grid to the OpenMP threads, running the box loop over each box serially,
+ * and 0 if they should thread the box loop inside each box, one box after
+ * the other.  The choice follows HYPRE_SetStructBoxThreads; by default,
+ * whole boxes are used when there are enough of them to go around, they
+ * are small enough that a parallel region per box does not pay off, and
+ * no single box holds more than a thread's share of the points.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_STRUCT_BOX_THREADS_MAX_MEAN_SIZE 4096
+
+HYPRE_Int
+hypre_StructGridBoxThreads( hypre_StructGrid *grid )
+{
+#if defined(HYPRE_USING_OPENMP) && \
+    !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && \
+    !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   HYPRE_Int  box_threads  = hypre_HandleStructBoxThreads(hypre_handle());
+   HYPRE_Int  num_threads  = hypre_NumThreads();
+   HYPRE_Int  num_boxes    = hypre_StructGridNumBoxes(grid);
+   HYPRE_Int  local_size   = hypre_StructGridLocalSize(grid);
+   HYPRE_Int  max_box_size = hypre_StructGridMaxBoxSize(grid);
+
+   if (box_threads == 0 || num_threads < 2 || num_boxes < 2)
+   {
+      return 0;
+   }
+   if (box_threads > 0)
+   {
+      return 1;
+   }
+
+   return ( (num_boxes >= 2*num_threads) &&
+            (local_size <= HYPRE_STRUCT_BOX_THREADS_MAX_MEAN_SIZE*num_boxes) &&
+            (max_box_size*num_threads <= local_size) );
+#else
+   return 0;
+#endif
+}
+
 #if defined(HYPRE_USING_CUDA)
 HYPRE_Int
 hypre_StructGridGetMaxBoxSize(hypre_StructGrid *grid)
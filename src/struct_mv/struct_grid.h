@@ -31,6 +31,7 @@ typedef struct hypre_StructGrid_struct
    hypre_Box           *bounding_box; /* Bounding box around grid */
 
    HYPRE_Int            local_size;   /* Number of grid points locally */
+   HYPRE_Int            max_box_size; /* Number of points in largest local box */
    HYPRE_BigInt         global_size;  /* Total number of grid points */
 
    hypre_Index          periodic;     /* Indicates if grid is periodic */
@@ -46,6 +47,12 @@ typedef struct hypre_StructGrid_struct
    HYPRE_Int            num_ghost[2*HYPRE_MAXDIM]; /* ghost layer size */
 
    hypre_BoxManager    *boxman;
+
+   /* Communication patterns computed from stencils on this grid, cached for
+    * reuse by hypre_CreateCommInfoFromStencil() */
+   HYPRE_Int            num_comm_infos;
+   HYPRE_Int           *comm_info_keys;
+   struct hypre_CommInfo_struct **comm_infos;
 #if defined(HYPRE_USING_CUDA)
    HYPRE_MemoryLocation data_location;
 #endif
@@ -62,6 +69,7 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridMaxDistance(grid)   ((grid) -> max_distance)
 #define hypre_StructGridBoundingBox(grid)   ((grid) -> bounding_box)
 #define hypre_StructGridLocalSize(grid)     ((grid) -> local_size)
+#define hypre_StructGridMaxBoxSize(grid)    ((grid) -> max_box_size)
 #define hypre_StructGridGlobalSize(grid)    ((grid) -> global_size)
 #define hypre_StructGridPeriodic(grid)      ((grid) -> periodic)
 #define hypre_StructGridNumPeriods(grid)    ((grid) -> num_periods)
@@ -71,6 +79,14 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridGhlocalSize(grid)   ((grid) -> ghlocal_size)
 #define hypre_StructGridNumGhost(grid)      ((grid) -> num_ghost)
 #define hypre_StructGridBoxMan(grid)        ((grid) -> boxman)
+#define hypre_StructGridNumCommInfos(grid)  ((grid) -> num_comm_infos)
+#define hypre_StructGridCommInfoKeys(grid)  ((grid) -> comm_info_keys)
+#define hypre_StructGridCommInfos(grid)     ((grid) -> comm_infos)
+
+/* Key of a cached communication pattern: the ghost growth in each direction
+ * followed by the 3^ndim stencil footprint (see communication_info.c) */
+#define hypre_StructGridCommInfoKeySize     (2*HYPRE_MAXDIM + 27)
+#define hypre_StructGridCommInfoMaxCached   16
 
 #define hypre_StructGridBox(grid, i)        (hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i))
 #define hypre_StructGridNumBoxes(grid)      (hypre_BoxArraySize(hypre_StructGridBoxes(grid)))
@@ -15,16 +15,16 @@
 #include "_hypre_struct_mv.hpp"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * Returns the contribution of this process to the inner product (no
+ * communication).
  *--------------------------------------------------------------------------*/
 
 HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -38,6 +38,7 @@ hypre_StructInnerProd( hypre_StructVector *x,
    hypre_Index      unit_stride;
 
    HYPRE_Int        ndim = hypre_StructVectorNDim(x);
+   HYPRE_Int        box_threads;
    HYPRE_Int        i;
 
 #if defined(HYPRE_USING_CUDA)
@@ -49,6 +50,11 @@ hypre_StructInnerProd( hypre_StructVector *x,
    hypre_SetIndex(unit_stride, 1);
 
    boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   box_threads = hypre_StructGridBoxThreads(hypre_StructVectorGrid(y));
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, box, start, x_data_box, y_data_box, xp, yp, loop_size) reduction(+:local_result) if (box_threads) schedule(dynamic)
+#endif
    hypre_ForBoxI(i, boxes)
    {
       box   = hypre_BoxArrayBox(boxes, i);
@@ -96,7 +102,21 @@ hypre_StructInnerProd( hypre_StructVector *x,
       local_result += (HYPRE_Real) box_sum;
    }
 
-   process_result = (HYPRE_Real) local_result;
+   return local_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   process_result = hypre_StructInnerProdLocal(x, y);
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
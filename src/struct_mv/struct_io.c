@@ -378,3 +378,613 @@ hypre_ReadBoxArrayData_CC( FILE            *file,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * Binary struct data files, written and read collectively with MPI-IO.
+ *
+ * A file holds one grid-based object, stored in the native byte order and
+ * type sizes of the writer (these are checked when reading):
+ *
+ *   char          magic[8]
+ *   hypre_int     version, sizeof(HYPRE_BigInt), sizeof(HYPRE_Complex), kind
+ *   HYPRE_BigInt  ndim, periodic[3], num_boxes, info_size, num_const, num_var
+ *   HYPRE_BigInt  info[info_size]
+ *   HYPRE_BigInt  box table: (owner, imin[ndim], imax[ndim]) for each box
+ *   HYPRE_Complex const_values[num_const]
+ *   HYPRE_Complex box data, box by box: num_var blocks of the box volume each
+ *
+ * The boxes are those of the grid, in process order, and 'owner' is the
+ * writing process.  The 'info' array is defined by the object being stored.
+ * Readers intersect their own boxes with the box table, so a file can be read
+ * on any number of processes.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_StructBinaryMagic    "hypreSBF"
+#define hypre_StructBinaryVersion  1
+#define hypre_StructBinaryNumFixed 8
+
+static hypre_MPI_Offset
+hypre_StructBinaryPrefixSize( void )
+{
+   return (hypre_MPI_Offset) (8 + 4*sizeof(hypre_int) +
+                              hypre_StructBinaryNumFixed*sizeof(HYPRE_BigInt));
+}
+
+/*--------------------------------------------------------------------------
+ * Reads the header of an open binary file on process 0 and broadcasts it.
+ * The arrays 'info', 'table' (the box table) and 'const_values' are
+ * allocated here.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructBinaryReadHeader( MPI_Comm         comm,
+                              hypre_MPI_File   fh,
+                              HYPRE_Int        kind,
+                              HYPRE_BigInt    *fixed,
+                              HYPRE_BigInt   **info_ptr,
+                              HYPRE_BigInt   **table_ptr,
+                              HYPRE_Complex  **const_values_ptr )
+{
+   char              magic[8];
+   hypre_int         prefix[4];
+   HYPRE_Int         ndim, num_boxes, info_size, num_const, table_size;
+   HYPRE_BigInt     *info;
+   HYPRE_BigInt     *table;
+   HYPRE_Complex    *const_values;
+   hypre_MPI_Offset  offset;
+   hypre_MPI_Status  status;
+   HYPRE_Int         myid, ierr = 0;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   if (myid == 0)
+   {
+      ierr = hypre_MPI_File_read_at(fh, 0, magic, 8, hypre_MPI_BYTE, &status);
+      ierr = ierr || hypre_MPI_File_read_at(fh, 8, prefix, 4*sizeof(hypre_int),
+                                            hypre_MPI_BYTE, &status);
+      ierr = ierr || hypre_MPI_File_read_at(fh, 8 + 4*sizeof(hypre_int), fixed,
+                                            hypre_StructBinaryNumFixed*sizeof(HYPRE_BigInt),
+                                            hypre_MPI_BYTE, &status);
+      if (!ierr)
+      {
+         ierr = (strncmp(magic, hypre_StructBinaryMagic, 8) != 0) ||
+                (prefix[0] != hypre_StructBinaryVersion) ||
+                (prefix[1] != (hypre_int) sizeof(HYPRE_BigInt)) ||
+                (prefix[2] != (hypre_int) sizeof(HYPRE_Complex)) ||
+                (prefix[3] != (hypre_int) kind);
+      }
+   }
+   hypre_MPI_Bcast(&ierr, 1, HYPRE_MPI_INT, 0, comm);
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Not a binary struct file of this kind and build");
+      return hypre_error_flag;
+   }
+   hypre_MPI_Bcast(fixed, hypre_StructBinaryNumFixed, HYPRE_MPI_BIG_INT, 0, comm);
+
+   ndim       = (HYPRE_Int) fixed[0];
+   num_boxes  = (HYPRE_Int) fixed[4];
+   info_size  = (HYPRE_Int) fixed[5];
+   num_const  = (HYPRE_Int) fixed[6];
+   table_size = num_boxes*(1 + 2*ndim);
+
+   info         = hypre_CTAlloc(HYPRE_BigInt,  info_size,  HYPRE_MEMORY_HOST);
+   table        = hypre_CTAlloc(HYPRE_BigInt,  table_size, HYPRE_MEMORY_HOST);
+   const_values = hypre_CTAlloc(HYPRE_Complex, num_const,  HYPRE_MEMORY_HOST);
+
+   if (myid == 0)
+   {
+      offset = hypre_StructBinaryPrefixSize();
+      hypre_MPI_File_read_at(fh, offset, info, info_size*sizeof(HYPRE_BigInt),
+                             hypre_MPI_BYTE, &status);
+      offset += info_size*sizeof(HYPRE_BigInt);
+      hypre_MPI_File_read_at(fh, offset, table, table_size*sizeof(HYPRE_BigInt),
+                             hypre_MPI_BYTE, &status);
+      offset += table_size*sizeof(HYPRE_BigInt);
+      hypre_MPI_File_read_at(fh, offset, const_values, num_const*sizeof(HYPRE_Complex),
+                             hypre_MPI_BYTE, &status);
+   }
+   hypre_MPI_Bcast(info, info_size, HYPRE_MPI_BIG_INT, 0, comm);
+   hypre_MPI_Bcast(table, table_size, HYPRE_MPI_BIG_INT, 0, comm);
+   hypre_MPI_Bcast(const_values, num_const, HYPRE_MPI_COMPLEX, 0, comm);
+
+   *info_ptr         = info;
+   *table_ptr        = table;
+   *const_values_ptr = const_values;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PrintBinaryStructData
+ *
+ * Collectively writes a binary struct data file for an object on 'grid'.
+ * The data of value v on box i starts at var_data[i*num_var + v] and is
+ * laid out as data_space box i.  The constant values are taken from the
+ * first process that has boxes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PrintBinaryStructData( const char        *filename,
+                             hypre_StructGrid  *grid,
+                             HYPRE_Int          kind,
+                             HYPRE_Int          info_size,
+                             HYPRE_BigInt      *info,
+                             HYPRE_Int          num_const,
+                             HYPRE_Complex     *const_values,
+                             HYPRE_Int          num_var,
+                             hypre_BoxArray    *data_space,
+                             HYPRE_Complex    **var_data )
+{
+   MPI_Comm          comm  = hypre_StructGridComm(grid);
+   HYPRE_Int         ndim  = hypre_StructGridNDim(grid);
+   hypre_BoxArray   *boxes = hypre_StructGridBoxes(grid);
+   hypre_Box        *box;
+   hypre_Box        *data_box;
+
+   hypre_MPI_File    fh;
+   hypre_MPI_Status  status;
+   hypre_MPI_Offset  header_size, const_offset, offset;
+   HYPRE_Int         num_procs, myid, const_proc;
+   HYPRE_Int         num_local, num_boxes, entry_size;
+   HYPRE_Int        *counts, *displs;
+   HYPRE_BigInt     *local_table, *table;
+   HYPRE_BigInt      local_volume, volume_before;
+   HYPRE_BigInt      fixed[hypre_StructBinaryNumFixed];
+   hypre_int         prefix[4];
+   char             *header;
+   HYPRE_Complex    *buffer, *vp;
+
+   hypre_Index       loop_size;
+   hypre_IndexRef    start;
+   hypre_Index       stride;
+
+   HYPRE_Int         i, j, k, d, p, v;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   hypre_SetIndex(stride, 1);
+
+   /*----------------------------------------
+    * Collect the box table on process 0
+    *----------------------------------------*/
+
+   num_local  = hypre_BoxArraySize(boxes);
+   entry_size = 1 + 2*ndim;
+
+   counts = hypre_CTAlloc(HYPRE_Int, num_procs,   HYPRE_MEMORY_HOST);
+   displs = hypre_CTAlloc(HYPRE_Int, num_procs+1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&num_local, 1, HYPRE_MPI_INT, counts, 1, HYPRE_MPI_INT, comm);
+   const_proc = -1;
+   for (p = 0; p < num_procs; p++)
+   {
+      if (const_proc < 0 && counts[p] > 0)
+      {
+         const_proc = p;
+      }
+      counts[p] *= entry_size;
+      displs[p+1] = displs[p] + counts[p];
+   }
+   num_boxes = displs[num_procs] / entry_size;
+
+   local_table  = hypre_CTAlloc(HYPRE_BigInt, num_local*entry_size, HYPRE_MEMORY_HOST);
+   local_volume = 0;
+   k = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      local_table[k++] = myid;
+      for (d = 0; d < ndim; d++)
+      {
+         local_table[k++] = hypre_BoxIMinD(box, d);
+      }
+      for (d = 0; d < ndim; d++)
+      {
+         local_table[k++] = hypre_BoxIMaxD(box, d);
+      }
+      local_volume += hypre_BoxVolume(box);
+   }
+
+   table = NULL;
+   if (myid == 0)
+   {
+      table = hypre_CTAlloc(HYPRE_BigInt, displs[num_procs], HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gatherv(local_table, num_local*entry_size, HYPRE_MPI_BIG_INT,
+                     table, counts, displs, HYPRE_MPI_BIG_INT, 0, comm);
+
+   hypre_MPI_Scan(&local_volume, &volume_before, 1, HYPRE_MPI_BIG_INT,
+                  hypre_MPI_SUM, comm);
+   volume_before -= local_volume;
+
+   /*----------------------------------------
+    * Open the file and write the header
+    *----------------------------------------*/
+
+   if (hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_CREATE | hypre_MPI_MODE_WRONLY,
+                           hypre_MPI_INFO_NULL, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't open output file");
+      hypre_TFree(counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(local_table, HYPRE_MEMORY_HOST);
+      hypre_TFree(table, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+   /* MPI_MODE_CREATE does not truncate an existing (possibly longer) file */
+   hypre_MPI_File_set_size(fh, 0);
+
+   header_size  = hypre_StructBinaryPrefixSize() +
+                  (hypre_MPI_Offset) (info_size + num_boxes*entry_size)*sizeof(HYPRE_BigInt);
+   const_offset = header_size;
+
+   if (myid == 0)
+   {
+      prefix[0] = hypre_StructBinaryVersion;
+      prefix[1] = (hypre_int) sizeof(HYPRE_BigInt);
+      prefix[2] = (hypre_int) sizeof(HYPRE_Complex);
+      prefix[3] = (hypre_int) kind;
+      fixed[0]  = ndim;
+      for (d = 0; d < 3; d++)
+      {
+         fixed[1+d] = (d < ndim) ? hypre_IndexD(hypre_StructGridPeriodic(grid), d) : 0;
+      }
+      fixed[4] = num_boxes;
+      fixed[5] = info_size;
+      fixed[6] = num_const;
+      fixed[7] = num_var;
+
+      header = hypre_CTAlloc(char, header_size, HYPRE_MEMORY_HOST);
+      offset = 0;
+      hypre_TMemcpy(header + offset, hypre_StructBinaryMagic, char, 8,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      offset += 8;
+      hypre_TMemcpy(header + offset, prefix, hypre_int, 4,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      offset += 4*sizeof(hypre_int);
+      hypre_TMemcpy(header + offset, fixed, HYPRE_BigInt, hypre_StructBinaryNumFixed,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      offset += hypre_StructBinaryNumFixed*sizeof(HYPRE_BigInt);
+      hypre_TMemcpy(header + offset, info, HYPRE_BigInt, info_size,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      offset += info_size*sizeof(HYPRE_BigInt);
+      hypre_TMemcpy(header + offset, table, HYPRE_BigInt, num_boxes*entry_size,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+      hypre_MPI_File_write_at(fh, 0, header, (HYPRE_Int) header_size,
+                              hypre_MPI_BYTE, &status);
+      hypre_TFree(header, HYPRE_MEMORY_HOST);
+   }
+
+   if (myid == const_proc && num_const > 0)
+   {
+      hypre_MPI_File_write_at(fh, const_offset, const_values, num_const,
+                              HYPRE_MPI_COMPLEX, &status);
+   }
+
+   /*----------------------------------------
+    * Pack and write the box data
+    *----------------------------------------*/
+
+   buffer = hypre_CTAlloc(HYPRE_Complex, local_volume*num_var, HYPRE_MEMORY_HOST);
+   k = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box      = hypre_BoxArrayBox(boxes, i);
+      data_box = hypre_BoxArrayBox(data_space, i);
+      start    = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      for (v = 0; v < num_var; v++)
+      {
+         vp = var_data[i*num_var + v];
+         j  = k;
+         hypre_SerialBoxLoop1Begin(ndim, loop_size,
+                                   data_box, start, stride, datai);
+         {
+            buffer[j++] = vp[datai];
+         }
+         hypre_SerialBoxLoop1End(datai);
+         k = j;
+      }
+   }
+
+   offset = const_offset + (hypre_MPI_Offset)
+      (num_const + volume_before*num_var)*sizeof(HYPRE_Complex);
+   hypre_MPI_File_write_at_all(fh, offset, buffer, (HYPRE_Int) (local_volume*num_var),
+                               HYPRE_MPI_COMPLEX, &status);
+
+   hypre_MPI_File_close(&fh);
+
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_table, HYPRE_MEMORY_HOST);
+   hypre_TFree(table, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReadBinaryStructHeader
+ *
+ * Reads the object description from a binary struct data file.  If
+ * *grid_ptr is NULL on input, a grid is created from the box table, with
+ * the boxes of writing process p assigned to process p modulo the number
+ * of processes.  Otherwise the given grid must have the dimension stored
+ * in the file.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReadBinaryStructHeader( MPI_Comm            comm,
+                              const char         *filename,
+                              HYPRE_Int           kind,
+                              HYPRE_Int          *info_size_ptr,
+                              HYPRE_BigInt      **info_ptr,
+                              HYPRE_Int          *num_const_ptr,
+                              HYPRE_Complex     **const_values_ptr,
+                              HYPRE_Int          *num_var_ptr,
+                              hypre_StructGrid  **grid_ptr )
+{
+   hypre_MPI_File    fh;
+   HYPRE_BigInt      fixed[hypre_StructBinaryNumFixed];
+   HYPRE_BigInt     *info, *table, *entry;
+   HYPRE_Complex    *const_values;
+   hypre_StructGrid *grid;
+   hypre_Index       periodic, imin, imax;
+   HYPRE_Int         num_procs, myid;
+   HYPRE_Int         ndim, num_boxes;
+   HYPRE_Int         b, d;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   if (hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_RDONLY,
+                           hypre_MPI_INFO_NULL, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't open input file");
+      return hypre_error_flag;
+   }
+   if (hypre_StructBinaryReadHeader(comm, fh, kind, fixed,
+                                    &info, &table, &const_values))
+   {
+      hypre_MPI_File_close(&fh);
+      return hypre_error_flag;
+   }
+   hypre_MPI_File_close(&fh);
+
+   ndim      = (HYPRE_Int) fixed[0];
+   num_boxes = (HYPRE_Int) fixed[4];
+
+   grid = *grid_ptr;
+   if (grid == NULL)
+   {
+      hypre_StructGridCreate(comm, ndim, &grid);
+      for (b = 0; b < num_boxes; b++)
+      {
+         entry = &table[b*(1 + 2*ndim)];
+         if ((HYPRE_Int) (entry[0] % num_procs) == myid)
+         {
+            hypre_SetIndex(imin, 0);
+            hypre_SetIndex(imax, 0);
+            for (d = 0; d < ndim; d++)
+            {
+               hypre_IndexD(imin, d) = (HYPRE_Int) entry[1 + d];
+               hypre_IndexD(imax, d) = (HYPRE_Int) entry[1 + ndim + d];
+            }
+            hypre_StructGridSetExtents(grid, imin, imax);
+         }
+      }
+      hypre_SetIndex(periodic, 0);
+      for (d = 0; d < ndim; d++)
+      {
+         hypre_IndexD(periodic, d) = (HYPRE_Int) fixed[1+d];
+      }
+      hypre_StructGridSetPeriodic(grid, periodic);
+      hypre_StructGridAssemble(grid);
+      *grid_ptr = grid;
+   }
+   else if (hypre_StructGridNDim(grid) != ndim)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Grid dimension differs from file");
+   }
+
+   hypre_TFree(table, HYPRE_MEMORY_HOST);
+
+   *info_size_ptr    = (HYPRE_Int) fixed[5];
+   *info_ptr         = info;
+   *num_const_ptr    = (HYPRE_Int) fixed[6];
+   *const_values_ptr = const_values;
+   *num_var_ptr      = (HYPRE_Int) fixed[7];
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReadBinaryBoxArrayData
+ *
+ * Fills the data of 'box_array' from a binary struct data file, with the
+ * same data layout as in hypre_PrintBinaryStructData().  Each box is
+ * intersected with the boxes of the file, and each intersection is read in
+ * chunks that are contiguous in the file: a chunk extends over the leading
+ * dimensions in which the intersection covers the whole file box, plus the
+ * next one.  Lines along the first dimension are the smallest chunks.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReadBinaryBoxArrayData( MPI_Comm          comm,
+                              const char       *filename,
+                              HYPRE_Int         kind,
+                              hypre_BoxArray   *box_array,
+                              hypre_BoxArray   *data_space,
+                              HYPRE_Int         num_var,
+                              HYPRE_Complex   **var_data )
+{
+   hypre_MPI_File    fh;
+   hypre_MPI_Status  status;
+   hypre_MPI_Offset  data_offset, offset;
+   HYPRE_BigInt      fixed[hypre_StructBinaryNumFixed];
+   HYPRE_BigInt     *info, *table, *entry;
+   HYPRE_BigInt     *box_offsets;
+   HYPRE_Complex    *const_values;
+   HYPRE_Complex    *buffer, *vp;
+   HYPRE_Int         buffer_size;
+
+   hypre_Box        *box, *data_box;
+   hypre_Box        *file_box, *int_box, *chunk_box;
+   hypre_Index       imin, imax;
+   hypre_Index       loop_size;
+   hypre_IndexRef    start;
+   hypre_Index       stride;
+   HYPRE_Int         ndim, num_boxes, info_size, num_const;
+   HYPRE_Int         file_volume, chunk_dim, chunk_volume;
+   HYPRE_Int         num_chunks, c, r, rest;
+   HYPRE_Int         i, b, d, v;
+
+   if (hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_RDONLY,
+                           hypre_MPI_INFO_NULL, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't open input file");
+      return hypre_error_flag;
+   }
+   if (hypre_StructBinaryReadHeader(comm, fh, kind, fixed,
+                                    &info, &table, &const_values))
+   {
+      hypre_MPI_File_close(&fh);
+      return hypre_error_flag;
+   }
+
+   ndim      = (HYPRE_Int) fixed[0];
+   num_boxes = (HYPRE_Int) fixed[4];
+   info_size = (HYPRE_Int) fixed[5];
+   num_const = (HYPRE_Int) fixed[6];
+   if ((HYPRE_Int) fixed[7] != num_var)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Number of values differs from file");
+      num_boxes = 0;
+   }
+
+   data_offset = hypre_StructBinaryPrefixSize() +
+      (hypre_MPI_Offset) (info_size + num_boxes*(1 + 2*ndim))*sizeof(HYPRE_BigInt) +
+      (hypre_MPI_Offset) num_const*sizeof(HYPRE_Complex);
+
+   /* file boxes and the offsets of their data (in values) */
+   file_box    = hypre_BoxCreate(ndim);
+   int_box     = hypre_BoxCreate(ndim);
+   chunk_box   = hypre_BoxCreate(ndim);
+   box_offsets = hypre_CTAlloc(HYPRE_BigInt, num_boxes+1, HYPRE_MEMORY_HOST);
+   for (b = 0; b < num_boxes; b++)
+   {
+      entry = &table[b*(1 + 2*ndim)];
+      file_volume = 1;
+      for (d = 0; d < ndim; d++)
+      {
+         file_volume *= (HYPRE_Int) (entry[1 + ndim + d] - entry[1 + d] + 1);
+      }
+      box_offsets[b+1] = box_offsets[b] + (HYPRE_BigInt) file_volume*num_var;
+   }
+
+   hypre_SetIndex(stride, 1);
+   buffer_size = 0;
+   buffer      = NULL;
+
+   hypre_ForBoxI(i, box_array)
+   {
+      box      = hypre_BoxArrayBox(box_array, i);
+      data_box = hypre_BoxArrayBox(data_space, i);
+
+      for (b = 0; b < num_boxes; b++)
+      {
+         entry = &table[b*(1 + 2*ndim)];
+         hypre_SetIndex(imin, 0);
+         hypre_SetIndex(imax, 0);
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_IndexD(imin, d) = (HYPRE_Int) entry[1 + d];
+            hypre_IndexD(imax, d) = (HYPRE_Int) entry[1 + ndim + d];
+         }
+         hypre_BoxSetExtents(file_box, imin, imax);
+         hypre_IntersectBoxes(file_box, box, int_box);
+         if (hypre_BoxVolume(int_box) == 0)
+         {
+            continue;
+         }
+
+         file_volume = hypre_BoxVolume(file_box);
+
+         /* chunks span dimensions 0..chunk_dim of the intersection */
+         chunk_dim = 0;
+         while (chunk_dim < ndim - 1 &&
+                hypre_BoxSizeD(int_box, chunk_dim) == hypre_BoxSizeD(file_box, chunk_dim))
+         {
+            chunk_dim++;
+         }
+         chunk_volume = 1;
+         num_chunks   = 1;
+         for (d = 0; d < ndim; d++)
+         {
+            if (d <= chunk_dim)
+            {
+               chunk_volume *= hypre_BoxSizeD(int_box, d);
+            }
+            else
+            {
+               num_chunks *= hypre_BoxSizeD(int_box, d);
+            }
+         }
+         if (chunk_volume > buffer_size)
+         {
+            buffer_size = chunk_volume;
+            buffer = hypre_TReAlloc(buffer, HYPRE_Complex, buffer_size, HYPRE_MEMORY_HOST);
+         }
+
+         hypre_CopyBox(int_box, chunk_box);
+         for (c = 0; c < num_chunks; c++)
+         {
+            rest = c;
+            for (d = chunk_dim + 1; d < ndim; d++)
+            {
+               hypre_BoxIMinD(chunk_box, d) = hypre_BoxIMinD(int_box, d) +
+                                              rest % hypre_BoxSizeD(int_box, d);
+               hypre_BoxIMaxD(chunk_box, d) = hypre_BoxIMinD(chunk_box, d);
+               rest /= hypre_BoxSizeD(int_box, d);
+            }
+            start = hypre_BoxIMin(chunk_box);
+            r = hypre_BoxIndexRank(file_box, start);
+            hypre_BoxGetSize(chunk_box, loop_size);
+
+            for (v = 0; v < num_var; v++)
+            {
+               offset = data_offset + (hypre_MPI_Offset)
+                  (box_offsets[b] + (HYPRE_BigInt) v*file_volume + r)*sizeof(HYPRE_Complex);
+               hypre_MPI_File_read_at(fh, offset, buffer, chunk_volume,
+                                      HYPRE_MPI_COMPLEX, &status);
+
+               vp = var_data[i*num_var + v];
+               hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                         chunk_box, start, stride, bi,
+                                         data_box, start, stride, datai);
+               {
+                  vp[datai] = buffer[bi];
+               }
+               hypre_SerialBoxLoop2End(bi, datai);
+            }
+         }
+      }
+   }
+
+   hypre_MPI_File_close(&fh);
+
+   hypre_BoxDestroy(file_box);
+   hypre_BoxDestroy(int_box);
+   hypre_BoxDestroy(chunk_box);
+   hypre_TFree(box_offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+   hypre_TFree(table, HYPRE_MEMORY_HOST);
+   hypre_TFree(const_values, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
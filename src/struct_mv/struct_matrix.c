@@ -1960,6 +1960,257 @@ hypre_StructMatrixRead( MPI_Comm    comm,
 
    return matrix;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixPrintBinary
+ *
+ * Writes the matrix to a single binary file with MPI-IO (see struct_io.c).
+ * The stored stencil entries are described in the file info, the constant
+ * coefficients are stored once, and only the variable coefficients are
+ * stored per grid point.  The matrix data must be accessible on the host.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixPrintBinary( const char         *filename,
+                               hypre_StructMatrix *matrix )
+{
+   hypre_StructGrid     *grid = hypre_StructMatrixGrid(matrix);
+   hypre_BoxArray       *boxes = hypre_StructGridBoxes(grid);
+   hypre_StructStencil  *stencil = hypre_StructMatrixStencil(matrix);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int            *symm_elements = hypre_StructMatrixSymmElements(matrix);
+   HYPRE_Int             constant_coefficient;
+   HYPRE_Int             ndim = hypre_StructMatrixNDim(matrix);
+   HYPRE_Int             num_stored = hypre_StructMatrixNumValues(matrix);
+   HYPRE_Int             num_boxes = hypre_BoxArraySize(boxes);
+
+   hypre_Index           center_index;
+   HYPRE_Int             center_rank;
+   HYPRE_BigInt         *info;
+   HYPRE_Int             info_size;
+   HYPRE_Complex        *const_values;
+   HYPRE_Complex       **var_data;
+   HYPRE_Int             num_const, num_var;
+   HYPRE_Int             i, j, k, c, s, d;
+
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
+
+   hypre_SetIndex(center_index, 0);
+   center_rank = hypre_StructStencilElementRank(stencil, center_index);
+
+   info_size = 3 + num_stored*ndim;
+   info = hypre_CTAlloc(HYPRE_BigInt, info_size, HYPRE_MEMORY_HOST);
+   info[0] = hypre_StructMatrixSymmetric(matrix);
+   info[1] = constant_coefficient;
+   info[2] = num_stored;
+
+   switch (constant_coefficient)
+   {
+      case 0:
+         num_const = 0;
+         num_var   = num_stored;
+         break;
+      case 1:
+         num_const = num_stored;
+         num_var   = 0;
+         break;
+      default:
+         num_const = num_stored - 1;
+         num_var   = 1;
+         break;
+   }
+   const_values = hypre_CTAlloc(HYPRE_Complex, num_const, HYPRE_MEMORY_HOST);
+   var_data     = hypre_CTAlloc(HYPRE_Complex *, num_boxes*num_var, HYPRE_MEMORY_HOST);
+
+   j = 3;
+   k = 0;
+   c = 0;
+   for (s = 0; s < stencil_size; s++)
+   {
+      if (symm_elements[s] < 0)
+      {
+         for (d = 0; d < ndim; d++)
+         {
+            info[j++] = hypre_IndexD(stencil_shape[s], d);
+         }
+
+         if (constant_coefficient == 0 ||
+             (constant_coefficient == 2 && s == center_rank))
+         {
+            hypre_ForBoxI(i, boxes)
+            {
+               var_data[i*num_var + k] = hypre_StructMatrixBoxData(matrix, i, s);
+            }
+            k++;
+         }
+         else
+         {
+            if (num_boxes > 0)
+            {
+               const_values[c] = hypre_StructMatrixBoxData(matrix, 0, s)[0];
+            }
+            c++;
+         }
+      }
+   }
+
+   hypre_PrintBinaryStructData(filename, grid, 1, info_size, info,
+                               num_const, const_values, num_var,
+                               hypre_StructMatrixDataSpace(matrix), var_data);
+
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+   hypre_TFree(const_values, HYPRE_MEMORY_HOST);
+   hypre_TFree(var_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixReadBinary
+ *
+ * Reads a matrix written by hypre_StructMatrixPrintBinary() on any number of
+ * processes.  If 'grid' is NULL, the grid of the file is distributed over
+ * the processes in 'comm'.  Returns NULL on error.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixReadBinary( MPI_Comm          comm,
+                              const char       *filename,
+                              hypre_StructGrid *grid,
+                              HYPRE_Int        *num_ghost )
+{
+   hypre_StructMatrix   *matrix;
+   hypre_StructGrid     *file_grid = NULL;
+   hypre_BoxArray       *boxes;
+   hypre_StructStencil  *stencil;
+   hypre_Index          *stencil_shape;
+   hypre_Index           shape;
+   HYPRE_Int             ndim, num_stored, num_boxes;
+   HYPRE_Int             symmetric, constant_coefficient;
+   hypre_Index           center_index;
+   HYPRE_Int             center_rank;
+
+   HYPRE_BigInt         *info;
+   HYPRE_Int             info_size;
+   HYPRE_Complex        *const_values;
+   HYPRE_Complex       **var_data;
+   HYPRE_Complex        *data;
+   HYPRE_Int             num_const, num_var;
+   HYPRE_Int             i, j, k, c, s, d;
+
+   /*----------------------------------------
+    * Read header info and create the matrix
+    *----------------------------------------*/
+
+   file_grid = grid;
+   if (hypre_ReadBinaryStructHeader(comm, filename, 1, &info_size, &info,
+                                    &num_const, &const_values, &num_var,
+                                    &file_grid))
+   {
+      return NULL;
+   }
+   if (grid == NULL)
+   {
+      grid = file_grid;
+   }
+   else
+   {
+      file_grid = NULL;
+   }
+
+   ndim                 = hypre_StructGridNDim(grid);
+   symmetric            = (HYPRE_Int) info[0];
+   constant_coefficient = (HYPRE_Int) info[1];
+   num_stored           = (HYPRE_Int) info[2];
+   num_var              = (constant_coefficient == 0) ? num_stored :
+                          (constant_coefficient == 1) ? 0 : 1;
+   if (num_const != num_stored - num_var)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Inconsistent matrix file");
+      hypre_TFree(info, HYPRE_MEMORY_HOST);
+      hypre_TFree(const_values, HYPRE_MEMORY_HOST);
+      hypre_StructGridDestroy(file_grid);
+      return NULL;
+   }
+
+   stencil_shape = hypre_CTAlloc(hypre_Index, num_stored, HYPRE_MEMORY_HOST);
+   for (s = 0; s < num_stored; s++)
+   {
+      hypre_SetIndex(stencil_shape[s], 0);
+      for (d = 0; d < ndim; d++)
+      {
+         hypre_IndexD(stencil_shape[s], d) = (HYPRE_Int) info[3 + s*ndim + d];
+      }
+   }
+   stencil = hypre_StructStencilCreate(ndim, num_stored, stencil_shape);
+
+   matrix = hypre_StructMatrixCreate(comm, grid, stencil);
+   hypre_StructMatrixSymmetric(matrix) = symmetric;
+   hypre_StructMatrixConstantCoefficient(matrix) = constant_coefficient;
+   hypre_StructMatrixSetNumGhost(matrix, num_ghost);
+   hypre_StructMatrixInitialize(matrix);
+   hypre_StructStencilDestroy(stencil);
+   hypre_StructGridDestroy(file_grid);
+
+   /*----------------------------------------
+    * Set the constant coefficients and read the rest
+    *----------------------------------------*/
+
+   stencil   = hypre_StructMatrixStencil(matrix);
+   boxes     = hypre_StructGridBoxes(grid);
+   num_boxes = hypre_BoxArraySize(boxes);
+   var_data  = hypre_CTAlloc(HYPRE_Complex *, num_boxes*num_var, HYPRE_MEMORY_HOST);
+
+   hypre_SetIndex(center_index, 0);
+   center_rank = hypre_StructStencilElementRank(stencil, center_index);
+
+   c = 0;
+   k = 0;
+   for (j = 0; j < num_stored; j++)
+   {
+      hypre_SetIndex(shape, 0);
+      for (d = 0; d < ndim; d++)
+      {
+         hypre_IndexD(shape, d) = (HYPRE_Int) info[3 + j*ndim + d];
+      }
+      s = hypre_StructStencilElementRank(stencil, shape);
+      if (constant_coefficient == 0 ||
+          (constant_coefficient == 2 && s == center_rank))
+      {
+         hypre_ForBoxI(i, boxes)
+         {
+            var_data[i*num_var + k] = hypre_StructMatrixBoxData(matrix, i, s);
+         }
+         k++;
+      }
+      else
+      {
+         hypre_ForBoxI(i, boxes)
+         {
+            data = hypre_StructMatrixBoxData(matrix, i, s);
+            data[0] = const_values[c];
+         }
+         c++;
+      }
+   }
+
+   hypre_ReadBinaryBoxArrayData(comm, filename, 1, boxes,
+                                hypre_StructMatrixDataSpace(matrix),
+                                num_var, var_data);
+
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+   hypre_TFree(const_values, HYPRE_MEMORY_HOST);
+   hypre_TFree(var_data, HYPRE_MEMORY_HOST);
+
+   /*----------------------------------------
+    * Assemble the matrix
+    *----------------------------------------*/
+
+   hypre_StructMatrixAssemble(matrix);
+
+   return matrix;
+}
 /*--------------------------------------------------------------------------
  * clears matrix stencil coefficients reaching outside of the physical boundaries
  *--------------------------------------------------------------------------*/
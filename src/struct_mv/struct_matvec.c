@@ -117,6 +117,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    HYPRE_Int                constant_coefficient;
 
    HYPRE_Complex            temp;
+   HYPRE_Int                box_threads;
    HYPRE_Int                compute_i, i;
 
    hypre_StructVector      *x_tmp = NULL;
@@ -132,6 +133,8 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
 
    stride = hypre_ComputePkgStride(compute_pkg);
 
+   box_threads = hypre_StructGridBoxThreads(hypre_StructMatrixGrid(A));
+
    /*-----------------------------------------------------------------------
     * Do (alpha == 0.0) computation
     *-----------------------------------------------------------------------*/
@@ -139,6 +142,9 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    if (alpha == 0.0)
    {
       boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, box, start, y_data_box, yp, loop_size) if (box_threads) schedule(dynamic)
+#endif
       hypre_ForBoxI(i, boxes)
       {
          box   = hypre_BoxArrayBox(boxes, i);
@@ -198,6 +204,9 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
             if (temp != 1.0)
             {
                boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, box, start, y_data_box, yp, loop_size) if (box_threads) schedule(dynamic)
+#endif
                hypre_ForBoxI(i, boxes)
                {
                   box   = hypre_BoxArrayBox(boxes, i);
@@ -323,12 +332,23 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
    hypre_Index              loop_size;
    hypre_IndexRef           start;
    HYPRE_Int                ndim;
+   HYPRE_Int                box_threads;
+
+   /* kernels specialized to the common stencil sizes */
+   if (hypre_StructMatvecStencilSupported(A, stride))
+   {
+      return hypre_StructMatvecCC0Stencil(alpha, A, x, y, compute_box_aa, stride);
+   }
 
    stencil       = hypre_StructMatrixStencil(A);
    stencil_shape = hypre_StructStencilShape(stencil);
    stencil_size  = hypre_StructStencilSize(stencil);
    ndim          = hypre_StructVectorNDim(x);
+   box_threads   = hypre_StructGridBoxThreads(hypre_StructMatrixGrid(A));
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, si, Ap0, Ap1, Ap2, Ap3, Ap4, Ap5, Ap6, xoff0, xoff1, xoff2, xoff3, xoff4, xoff5, xoff6, compute_box_a, compute_box, A_data_box, x_data_box, y_data_box, xp, yp, depth, loop_size, start) if (box_threads) schedule(dynamic)
+#endif
    hypre_ForBoxArrayI(i, compute_box_aa)
    {
       compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -650,6 +670,12 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
    hypre_IndexRef           start;
    HYPRE_Int                ndim;
 
+   /* kernels specialized to the common stencil sizes */
+   if (hypre_StructMatvecStencilSupported(A, stride))
+   {
+      return hypre_StructMatvecCCStencil(alpha, A, x, y, compute_box_aa, stride);
+   }
+
    stencil       = hypre_StructMatrixStencil(A);
    stencil_shape = hypre_StructStencilShape(stencil);
    stencil_size  = hypre_StructStencilSize(stencil);
@@ -981,6 +1007,12 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
    HYPRE_Int                ndim;
    HYPRE_Complex            zero[1]={0};
 
+   /* kernels specialized to the common stencil sizes */
+   if (hypre_StructMatvecStencilSupported(A, stride))
+   {
+      return hypre_StructMatvecCCStencil(alpha, A, x, y, compute_box_aa, stride);
+   }
+
    stencil       = hypre_StructMatrixStencil(A);
    stencil_shape = hypre_StructStencilShape(stencil);
    stencil_size  = hypre_StructStencilSize(stencil);
@@ -0,0 +1,538 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Stencil-specialized structured matrix-vector multiply kernels
+ *
+ * hypre_StructMatvecCC0 calls hypre_StructMatvecCC0Stencil for variable
+ * coefficient matrices with the common 5/9-point (2D) and 7/19/27-point (3D)
+ * stencil sizes when the compute stride is one, and hypre_StructMatvecCC1
+ * and hypre_StructMatvecCC2 call hypre_StructMatvecCCStencil for constant
+ * coefficient matrices (with constant or variable diagonal) in the same
+ * cases.  The number of stencil entries is a compile-time constant in each
+ * kernel, so all entries are applied in one pass over y, and the innermost
+ * loop runs with unit stride over the x-lines of the box so that it can be
+ * vectorized.  The constant coefficients are kept in registers.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_mv.h"
+
+#if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && \
+    !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_STRUCT_MATVEC_STENCIL_KERNELS
+#endif
+
+#if defined(HYPRE_USING_OPENMP)
+#define HYPRE_STRUCT_MATVEC_OMP_LINES \
+   Pragma(omp parallel for private(line) HYPRE_SMP_SCHEDULE if (!omp_in_parallel()))
+#define HYPRE_STRUCT_MATVEC_SIMD Pragma(omp simd)
+#elif defined(__GNUC__) && !defined(__clang__)
+#define HYPRE_STRUCT_MATVEC_OMP_LINES
+#define HYPRE_STRUCT_MATVEC_SIMD _Pragma("GCC ivdep")
+#else
+#define HYPRE_STRUCT_MATVEC_OMP_LINES
+#define HYPRE_STRUCT_MATVEC_SIMD
+#endif
+
+#ifdef HYPRE_STRUCT_MATVEC_STENCIL_KERNELS
+
+/*--------------------------------------------------------------------------
+ * Box kernel for a stencil with N entries:
+ *
+ *    y = alpha * (y + A*x)
+ *
+ * on the nx x ny x nz compute box whose first point has ranks Ai0, xi0
+ * and yi0 in the data boxes of A, x and y.  (Ajs, Aks) etc. are the ranks
+ * between consecutive points in the second and third dimensions.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_StructMatvecStencilKernel(N)                                    \
+static void                                                                   \
+hypre_StructMatvecStencil##N( HYPRE_Complex   alpha,                          \
+                              HYPRE_Complex **Ap,                             \
+                              HYPRE_Int      *xoff,                           \
+                              HYPRE_Complex  *xp,                             \
+                              HYPRE_Complex  *yp,                             \
+                              HYPRE_Int       nx,                             \
+                              HYPRE_Int       ny,                             \
+                              HYPRE_Int       nz,                             \
+                              HYPRE_Int       Ai0,                            \
+                              HYPRE_Int       Ajs,                            \
+                              HYPRE_Int       Aks,                            \
+                              HYPRE_Int       xi0,                            \
+                              HYPRE_Int       xjs,                            \
+                              HYPRE_Int       xks,                            \
+                              HYPRE_Int       yi0,                            \
+                              HYPRE_Int       yjs,                            \
+                              HYPRE_Int       yks )                           \
+{                                                                             \
+   HYPRE_Int line;                                                            \
+                                                                              \
+   HYPRE_STRUCT_MATVEC_OMP_LINES                                              \
+   for (line = 0; line < ny*nz; line++)                                       \
+   {                                                                          \
+      HYPRE_Int      j  = line % ny;                                          \
+      HYPRE_Int      k  = line / ny;                                          \
+      HYPRE_Int      Ai = Ai0 + j*Ajs + k*Aks;                                \
+      HYPRE_Int      xi = xi0 + j*xjs + k*xks;                                \
+      HYPRE_Complex *yl = yp + yi0 + j*yjs + k*yks;                           \
+      HYPRE_Complex *al[N];                                                   \
+      HYPRE_Complex *xl[N];                                                   \
+      HYPRE_Int      i, s;                                                    \
+                                                                              \
+      for (s = 0; s < N; s++)                                                 \
+      {                                                                       \
+         al[s] = Ap[s] + Ai;                                                  \
+         xl[s] = xp + xi + xoff[s];                                           \
+      }                                                                       \
+                                                                              \
+      if (alpha == 1.0)                                                       \
+      {                                                                       \
+         HYPRE_STRUCT_MATVEC_SIMD                                             \
+         for (i = 0; i < nx; i++)                                             \
+         {                                                                    \
+            HYPRE_Complex sum = 0.0;                                          \
+            HYPRE_Int     t;                                                  \
+            for (t = 0; t < N; t++)                                           \
+            {                                                                 \
+               sum += al[t][i] * xl[t][i];                                    \
+            }                                                                 \
+            yl[i] += sum;                                                     \
+         }                                                                    \
+      }                                                                       \
+      else                                                                    \
+      {                                                                       \
+         HYPRE_STRUCT_MATVEC_SIMD                                             \
+         for (i = 0; i < nx; i++)                                             \
+         {                                                                    \
+            HYPRE_Complex sum = 0.0;                                          \
+            HYPRE_Int     t;                                                  \
+            for (t = 0; t < N; t++)                                           \
+            {                                                                 \
+               sum += al[t][i] * xl[t][i];                                    \
+            }                                                                 \
+            yl[i] = alpha * (yl[i] + sum);                                    \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+hypre_StructMatvecStencilKernel(5)
+hypre_StructMatvecStencilKernel(7)
+hypre_StructMatvecStencilKernel(9)
+hypre_StructMatvecStencilKernel(19)
+hypre_StructMatvecStencilKernel(27)
+
+/*--------------------------------------------------------------------------
+ * Box kernel for a constant coefficient stencil with N entries:
+ *
+ *    y = y + Ac*x                          if Ad is NULL
+ *    y = alpha * (y + Ad*x(0) + Ac*x)      otherwise
+ *
+ * where Ac holds the N constant coefficients.  In the second case the
+ * diagonal is entry 0, its coefficients Ad vary in space (Ai0, Ajs, Aks
+ * are its ranks) and Ac[0] is not used.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_StructMatvecStencilCCKernel(N)                                  \
+static void                                                                   \
+hypre_StructMatvecStencilCC##N( HYPRE_Complex   alpha,                        \
+                                HYPRE_Complex  *Ac,                           \
+                                HYPRE_Complex  *Ad,                           \
+                                HYPRE_Int      *xoff,                         \
+                                HYPRE_Complex  *xp,                           \
+                                HYPRE_Complex  *yp,                           \
+                                HYPRE_Int       nx,                           \
+                                HYPRE_Int       ny,                           \
+                                HYPRE_Int       nz,                           \
+                                HYPRE_Int       Ai0,                          \
+                                HYPRE_Int       Ajs,                          \
+                                HYPRE_Int       Aks,                          \
+                                HYPRE_Int       xi0,                          \
+                                HYPRE_Int       xjs,                          \
+                                HYPRE_Int       xks,                          \
+                                HYPRE_Int       yi0,                          \
+                                HYPRE_Int       yjs,                          \
+                                HYPRE_Int       yks )                         \
+{                                                                             \
+   HYPRE_Int line;                                                            \
+                                                                              \
+   HYPRE_STRUCT_MATVEC_OMP_LINES                                              \
+   for (line = 0; line < ny*nz; line++)                                       \
+   {                                                                          \
+      HYPRE_Int      j  = line % ny;                                          \
+      HYPRE_Int      k  = line / ny;                                          \
+      HYPRE_Int      xi = xi0 + j*xjs + k*xks;                                \
+      HYPRE_Complex *yl = yp + yi0 + j*yjs + k*yks;                           \
+      HYPRE_Complex *dl;                                                      \
+      HYPRE_Complex  c[N];                                                    \
+      HYPRE_Complex *xl[N];                                                   \
+      HYPRE_Int      i, s;                                                    \
+                                                                              \
+      for (s = 0; s < N; s++)                                                 \
+      {                                                                       \
+         c[s]  = Ac[s];                                                       \
+         xl[s] = xp + xi + xoff[s];                                           \
+      }                                                                       \
+                                                                              \
+      if (Ad == NULL)                                                         \
+      {                                                                       \
+         HYPRE_STRUCT_MATVEC_SIMD                                             \
+         for (i = 0; i < nx; i++)                                             \
+         {                                                                    \
+            HYPRE_Complex sum = 0.0;                                          \
+            HYPRE_Int     t;                                                  \
+            for (t = 0; t < N; t++)                                           \
+            {                                                                 \
+               sum += c[t] * xl[t][i];                                        \
+            }                                                                 \
+            yl[i] += sum;                                                     \
+         }                                                                    \
+      }                                                                       \
+      else if (alpha == 1.0)                                                  \
+      {                                                                       \
+         dl = Ad + Ai0 + j*Ajs + k*Aks;                                       \
+         HYPRE_STRUCT_MATVEC_SIMD                                             \
+         for (i = 0; i < nx; i++)                                             \
+         {                                                                    \
+            HYPRE_Complex sum = dl[i] * xl[0][i];                             \
+            HYPRE_Int     t;                                                  \
+            for (t = 1; t < N; t++)                                           \
+            {                                                                 \
+               sum += c[t] * xl[t][i];                                        \
+            }                                                                 \
+            yl[i] += sum;                                                     \
+         }                                                                    \
+      }                                                                       \
+      else                                                                    \
+      {                                                                       \
+         dl = Ad + Ai0 + j*Ajs + k*Aks;                                       \
+         HYPRE_STRUCT_MATVEC_SIMD                                             \
+         for (i = 0; i < nx; i++)                                             \
+         {                                                                    \
+            HYPRE_Complex sum = dl[i] * xl[0][i];                             \
+            HYPRE_Int     t;                                                  \
+            for (t = 1; t < N; t++)                                           \
+            {                                                                 \
+               sum += c[t] * xl[t][i];                                        \
+            }                                                                 \
+            yl[i] = alpha * (yl[i] + sum);                                    \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+hypre_StructMatvecStencilCCKernel(5)
+hypre_StructMatvecStencilCCKernel(7)
+hypre_StructMatvecStencilCCKernel(9)
+hypre_StructMatvecStencilCCKernel(19)
+hypre_StructMatvecStencilCCKernel(27)
+
+#endif /* HYPRE_STRUCT_MATVEC_STENCIL_KERNELS */
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecStencilSupported
+ *
+ * Returns 1 if hypre_StructMatvecCC0Stencil (for variable coefficients) or
+ * hypre_StructMatvecCCStencil (for constant coefficients) handles A with
+ * this stride.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecStencilSupported( hypre_StructMatrix *A,
+                                    hypre_IndexRef      stride )
+{
+#ifdef HYPRE_STRUCT_MATVEC_STENCIL_KERNELS
+   HYPRE_Int  ndim         = hypre_StructMatrixNDim(A);
+   HYPRE_Int  stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+   HYPRE_Int  d;
+
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(stride, d) != 1)
+      {
+         return 0;
+      }
+   }
+
+   switch (ndim)
+   {
+      case 2:
+         return (stencil_size == 5 || stencil_size == 9);
+      case 3:
+         return (stencil_size == 7 || stencil_size == 19 || stencil_size == 27);
+   }
+#endif
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecCC0Stencil
+ *
+ * Same as hypre_StructMatvecCC0 (y = alpha*(y + A*x) on the compute boxes)
+ * for the cases accepted by hypre_StructMatvecStencilSupported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecCC0Stencil( HYPRE_Complex        alpha,
+                              hypre_StructMatrix  *A,
+                              hypre_StructVector  *x,
+                              hypre_StructVector  *y,
+                              hypre_BoxArrayArray *compute_box_aa,
+                              hypre_IndexRef       stride )
+{
+#ifdef HYPRE_STRUCT_MATVEC_STENCIL_KERNELS
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int            ndim          = hypre_StructMatrixNDim(A);
+
+   hypre_BoxArray      *compute_box_a;
+   hypre_Box           *compute_box;
+   hypre_Box           *A_data_box;
+   hypre_Box           *x_data_box;
+   hypre_Box           *y_data_box;
+   hypre_IndexRef       start;
+   hypre_Index          loop_size;
+
+   HYPRE_Complex       *Ap[27];
+   HYPRE_Int            xoff[27];
+   HYPRE_Complex       *xp;
+   HYPRE_Complex       *yp;
+   HYPRE_Int            nx, ny, nz;
+   HYPRE_Int            Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks;
+   HYPRE_Int            box_threads;
+   HYPRE_Int            i, j, si;
+
+   box_threads = hypre_StructGridBoxThreads(hypre_StructMatrixGrid(A));
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, si, compute_box_a, compute_box, A_data_box, x_data_box, y_data_box, start, loop_size, Ap, xoff, xp, yp, nx, ny, nz, Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks) if (box_threads) schedule(dynamic)
+#endif
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         Ap[si]   = hypre_StructMatrixBoxData(A, i, si);
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      Ajs = hypre_BoxSizeD(A_data_box, 0);
+      xjs = hypre_BoxSizeD(x_data_box, 0);
+      yjs = hypre_BoxSizeD(y_data_box, 0);
+      Aks = (ndim > 2) ? Ajs * hypre_BoxSizeD(A_data_box, 1) : 0;
+      xks = (ndim > 2) ? xjs * hypre_BoxSizeD(x_data_box, 1) : 0;
+      yks = (ndim > 2) ? yjs * hypre_BoxSizeD(y_data_box, 1) : 0;
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start = hypre_BoxIMin(compute_box);
+
+         nx = hypre_IndexD(loop_size, 0);
+         ny = hypre_IndexD(loop_size, 1);
+         nz = (ndim > 2) ? hypre_IndexD(loop_size, 2) : 1;
+         if (nx < 1 || ny < 1 || nz < 1)
+         {
+            continue;
+         }
+
+         Ai0 = hypre_BoxIndexRank(A_data_box, start);
+         xi0 = hypre_BoxIndexRank(x_data_box, start);
+         yi0 = hypre_BoxIndexRank(y_data_box, start);
+
+         switch (stencil_size)
+         {
+            case 5:
+               hypre_StructMatvecStencil5(alpha, Ap, xoff, xp, yp, nx, ny, nz,
+                                          Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+            case 7:
+               hypre_StructMatvecStencil7(alpha, Ap, xoff, xp, yp, nx, ny, nz,
+                                          Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+            case 9:
+               hypre_StructMatvecStencil9(alpha, Ap, xoff, xp, yp, nx, ny, nz,
+                                          Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+            case 19:
+               hypre_StructMatvecStencil19(alpha, Ap, xoff, xp, yp, nx, ny, nz,
+                                           Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+            case 27:
+               hypre_StructMatvecStencil27(alpha, Ap, xoff, xp, yp, nx, ny, nz,
+                                           Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+         }
+      }
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecCCStencil
+ *
+ * Same as hypre_StructMatvecCC1 (y += alpha*A*x) and hypre_StructMatvecCC2
+ * (y = alpha*(y + A*x)) on the compute boxes, for the cases accepted by
+ * hypre_StructMatvecStencilSupported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecCCStencil( HYPRE_Complex        alpha,
+                             hypre_StructMatrix  *A,
+                             hypre_StructVector  *x,
+                             hypre_StructVector  *y,
+                             hypre_BoxArrayArray *compute_box_aa,
+                             hypre_IndexRef       stride )
+{
+#ifdef HYPRE_STRUCT_MATVEC_STENCIL_KERNELS
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int            ndim          = hypre_StructMatrixNDim(A);
+   HYPRE_Int            constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+
+   hypre_BoxArray      *compute_box_a;
+   hypre_Box           *compute_box;
+   hypre_Box           *A_data_box;
+   hypre_Box           *x_data_box;
+   hypre_Box           *y_data_box;
+   hypre_IndexRef       start;
+   hypre_Index          loop_size;
+   hypre_Index          center_index;
+
+   HYPRE_Complex        Ac[27];
+   HYPRE_Complex       *Ad;
+   HYPRE_Int            xoff[27];
+   HYPRE_Complex       *xp;
+   HYPRE_Complex       *yp;
+   HYPRE_Complex        kalpha;
+   HYPRE_Int            nx, ny, nz;
+   HYPRE_Int            Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks;
+   HYPRE_Int            center_rank;
+   HYPRE_Int            Ai_CC = hypre_CCBoxIndexRank_noargs();
+   HYPRE_Int            box_threads;
+   HYPRE_Int            i, j, si, sk;
+
+   hypre_SetIndex(center_index, 0);
+   center_rank = hypre_StructStencilElementRank(stencil, center_index);
+   box_threads = hypre_StructGridBoxThreads(hypre_StructMatrixGrid(A));
+
+   /* with constant coefficients only, alpha is folded into them */
+   kalpha = (constant_coefficient == 1) ? 1.0 : alpha;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, si, sk, compute_box_a, compute_box, A_data_box, x_data_box, y_data_box, start, loop_size, Ac, Ad, xoff, xp, yp, nx, ny, nz, Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks) if (box_threads) schedule(dynamic)
+#endif
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      /* for a variable diagonal, put it first */
+      if (constant_coefficient == 1)
+      {
+         Ad = NULL;
+         for (si = 0; si < stencil_size; si++)
+         {
+            Ac[si]   = alpha * hypre_StructMatrixBoxData(A, i, si)[Ai_CC];
+            xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+         }
+      }
+      else
+      {
+         Ad      = hypre_StructMatrixBoxData(A, i, center_rank);
+         Ac[0]   = 0.0;
+         xoff[0] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[center_rank]);
+         for (si = 0, sk = 1; si < stencil_size; si++)
+         {
+            if (si != center_rank)
+            {
+               Ac[sk]   = hypre_StructMatrixBoxData(A, i, si)[Ai_CC];
+               xoff[sk] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+               sk++;
+            }
+         }
+      }
+
+      Ajs = hypre_BoxSizeD(A_data_box, 0);
+      xjs = hypre_BoxSizeD(x_data_box, 0);
+      yjs = hypre_BoxSizeD(y_data_box, 0);
+      Aks = (ndim > 2) ? Ajs * hypre_BoxSizeD(A_data_box, 1) : 0;
+      xks = (ndim > 2) ? xjs * hypre_BoxSizeD(x_data_box, 1) : 0;
+      yks = (ndim > 2) ? yjs * hypre_BoxSizeD(y_data_box, 1) : 0;
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start = hypre_BoxIMin(compute_box);
+
+         nx = hypre_IndexD(loop_size, 0);
+         ny = hypre_IndexD(loop_size, 1);
+         nz = (ndim > 2) ? hypre_IndexD(loop_size, 2) : 1;
+         if (nx < 1 || ny < 1 || nz < 1)
+         {
+            continue;
+         }
+
+         Ai0 = hypre_BoxIndexRank(A_data_box, start);
+         xi0 = hypre_BoxIndexRank(x_data_box, start);
+         yi0 = hypre_BoxIndexRank(y_data_box, start);
+
+         switch (stencil_size)
+         {
+            case 5:
+               hypre_StructMatvecStencilCC5(kalpha, Ac, Ad, xoff, xp, yp, nx, ny, nz,
+                                            Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+            case 7:
+               hypre_StructMatvecStencilCC7(kalpha, Ac, Ad, xoff, xp, yp, nx, ny, nz,
+                                            Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+            case 9:
+               hypre_StructMatvecStencilCC9(kalpha, Ac, Ad, xoff, xp, yp, nx, ny, nz,
+                                            Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+            case 19:
+               hypre_StructMatvecStencilCC19(kalpha, Ac, Ad, xoff, xp, yp, nx, ny, nz,
+                                             Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+            case 27:
+               hypre_StructMatvecStencilCC27(kalpha, Ac, Ad, xoff, xp, yp, nx, ny, nz,
+                                             Ai0, Ajs, Aks, xi0, xjs, xks, yi0, yjs, yks);
+               break;
+         }
+      }
+   }
+#endif
+
+   return hypre_error_flag;
+}
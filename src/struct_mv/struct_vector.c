@@ -1180,6 +1180,114 @@ hypre_StructVectorRead( MPI_Comm    comm,
    return vector;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorPrintBinary
+ *
+ * Writes the vector to a single binary file with MPI-IO (see struct_io.c).
+ * The vector data must be accessible on the host.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorPrintBinary( const char         *filename,
+                               hypre_StructVector *vector )
+{
+   hypre_StructGrid     *grid  = hypre_StructVectorGrid(vector);
+   hypre_BoxArray       *boxes = hypre_StructGridBoxes(grid);
+   HYPRE_Complex       **var_data;
+   HYPRE_Int             i;
+
+   var_data = hypre_CTAlloc(HYPRE_Complex *, hypre_BoxArraySize(boxes), HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, boxes)
+   {
+      var_data[i] = hypre_StructVectorBoxData(vector, i);
+   }
+
+   hypre_PrintBinaryStructData(filename, grid, 0, 0, NULL, 0, NULL, 1,
+                               hypre_StructVectorDataSpace(vector), var_data);
+
+   hypre_TFree(var_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorReadBinary
+ *
+ * Reads a vector written by hypre_StructVectorPrintBinary() on any number of
+ * processes.  If 'grid' is NULL, the grid of the file is distributed over
+ * the processes in 'comm'.  Returns NULL on error.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructVector *
+hypre_StructVectorReadBinary( MPI_Comm          comm,
+                              const char       *filename,
+                              hypre_StructGrid *grid,
+                              HYPRE_Int        *num_ghost )
+{
+   hypre_StructVector   *vector;
+   hypre_StructGrid     *file_grid;
+   hypre_BoxArray       *boxes;
+
+   HYPRE_BigInt         *info;
+   HYPRE_Int             info_size;
+   HYPRE_Complex        *const_values;
+   HYPRE_Complex       **var_data;
+   HYPRE_Int             num_const, num_var;
+   HYPRE_Int             i;
+
+   /*----------------------------------------
+    * Read header info and create the vector
+    *----------------------------------------*/
+
+   file_grid = grid;
+   if (hypre_ReadBinaryStructHeader(comm, filename, 0, &info_size, &info,
+                                    &num_const, &const_values, &num_var,
+                                    &file_grid))
+   {
+      return NULL;
+   }
+   if (grid == NULL)
+   {
+      grid = file_grid;
+   }
+   else
+   {
+      file_grid = NULL;
+   }
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+   hypre_TFree(const_values, HYPRE_MEMORY_HOST);
+
+   vector = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(vector, num_ghost);
+   hypre_StructVectorInitialize(vector);
+   hypre_StructGridDestroy(file_grid);
+
+   /*----------------------------------------
+    * Read data
+    *----------------------------------------*/
+
+   boxes    = hypre_StructGridBoxes(grid);
+   var_data = hypre_CTAlloc(HYPRE_Complex *, hypre_BoxArraySize(boxes), HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, boxes)
+   {
+      var_data[i] = hypre_StructVectorBoxData(vector, i);
+   }
+
+   hypre_ReadBinaryBoxArrayData(comm, filename, 0, boxes,
+                                hypre_StructVectorDataSpace(vector),
+                                1, var_data);
+
+   hypre_TFree(var_data, HYPRE_MEMORY_HOST);
+
+   /*----------------------------------------
+    * Assemble the vector
+    *----------------------------------------*/
+
+   hypre_StructVectorAssemble(vector);
+
+   return vector;
+}
+
 /*--------------------------------------------------------------------------
  * The following is used only as a debugging aid.
  *
@@ -32,6 +32,15 @@ tail -17 ${TNAME}.out.200 | head -6 > ${TNAME}.mgr_testdata
 tail -17 ${TNAME}.out.202 | head -6 > ${TNAME}.mgr_testdata.temp
 diff ${TNAME}.mgr_testdata ${TNAME}.mgr_testdata.temp >&2
 
+#=============================================================================
+# IJ: fused and modularized RAP agree to rounding, compare results with
+#                    a tolerance
+#=============================================================================
+
+tail -3 ${TNAME}.out.328 > ${TNAME}.rap_testdata
+tail -3 ${TNAME}.out.339 > ${TNAME}.rap_testdata.temp
+(../runcheck.sh ${TNAME}.rap_testdata.temp ${TNAME}.rap_testdata 1.0e-5) >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -163,6 +172,23 @@ FILES="\
  ${TNAME}.out.322\
  ${TNAME}.out.323\
  ${TNAME}.out.324\
+ ${TNAME}.out.325\
+ ${TNAME}.out.326\
+ ${TNAME}.out.327\
+ ${TNAME}.out.328\
+ ${TNAME}.out.329\
+ ${TNAME}.out.332\
+ ${TNAME}.out.333\
+ ${TNAME}.out.334\
+ ${TNAME}.out.335\
+ ${TNAME}.out.336\
+ ${TNAME}.out.337\
+ ${TNAME}.out.338\
+ ${TNAME}.out.339\
+ ${TNAME}.out.340\
+ ${TNAME}.out.341\
+ ${TNAME}.out.342\
+ ${TNAME}.out.343\
 "
 
 for i in $FILES
@@ -171,6 +197,17 @@ do
   tail -3 $i
 done >> ${TNAME}.out
 
+FILES="\
+ ${TNAME}.out.330\
+ ${TNAME}.out.331\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -4 $i
+done >> ${TNAME}.out
+
 # Make sure that the output files are reasonable
 CHECK_LINE="Complexity"
 OUT_COUNT=`grep "$CHECK_LINE" ${TNAME}.out | wc -l`
@@ -189,3 +226,4 @@ fi
 
 rm -f ${TNAME}.testdata*
 rm -r ${TNAME}.mgr_testdata*
+rm -f ${TNAME}.rap_testdata*
@@ -75,6 +75,15 @@ HYPRE_Int SetSysVcoefValues(HYPRE_Int num_fun, HYPRE_BigInt nx, HYPRE_BigInt ny,
 
 HYPRE_Int BuildParCoordinates (HYPRE_Int argc , char *argv [], HYPRE_Int arg_index , HYPRE_Int *coorddim_ptr , float **coord_ptr );
 
+typedef struct
+{
+   HYPRE_ParCSRMatrix  A;
+   HYPRE_Int           num_calls;
+} ShellMatvecData;
+
+HYPRE_Int ShellMatvec (void *data , HYPRE_Complex alpha , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
+HYPRE_Int ShellMatvecT (void *data , HYPRE_Complex alpha , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
+
 extern HYPRE_Int hypre_FlexGMRESModifyPCAMGExample(void *precond_data, HYPRE_Int iterations,
                                                    HYPRE_Real rel_residual_norm);
 
@@ -97,6 +106,7 @@ main( hypre_int argc,
    HYPRE_Int           check_constant = 0;
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
+   HYPRE_Int           csr_block = 0;
    HYPRE_Int           omp_flag = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
@@ -114,6 +124,8 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           pcg_pipelined = 0;
+   HYPRE_Int           pcg_s_step = 1;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           debug_flag;
@@ -212,6 +224,10 @@ main( hypre_int argc,
    HYPRE_Int      relax_up = -1;
    HYPRE_Int      relax_down = -1;
    HYPRE_Int      relax_order = 0;
+   HYPRE_Int      relax_overlap = 0;
+   HYPRE_Int      relax_plan = 0;
+   HYPRE_Int      float_level = 0;
+   HYPRE_Int      float_drop_double = 0;
    HYPRE_Int      level_w = -1;
    HYPRE_Int      level_ow = -1;
    /* HYPRE_Int    smooth_lev; */
@@ -233,6 +249,8 @@ main( hypre_int argc,
    HYPRE_Real   add_trunc_factor = 0;
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
+   HYPRE_Int    fused_rap = 0;
+   char        *phase_stats_file = NULL;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Int    keepTranspose = 1;
 #else
@@ -407,6 +425,12 @@ main( hypre_int argc,
    HYPRE_ExecutionPolicy default_exec_policy = HYPRE_EXEC_HOST;
 #endif
    HYPRE_MemoryLocation memory_location = HYPRE_MEMORY_DEVICE;
+   HYPRE_Int spmv_use_sell = 0;
+   HYPRE_Int num_rhs = 1;
+   HYPRE_Int resetup = 0;
+   HYPRE_Int shell_matvec = 0;
+   ShellMatvecData shell_data;
+   HYPRE_ParVector b_single = NULL, x_single = NULL;
 
    /* CUB Allocator */
    hypre_uint mempool_bin_growth   = 8,
@@ -543,6 +567,11 @@ main( hypre_int argc,
          arg_index++;
          chunk = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-csr_block") == 0 )
+      {
+         arg_index++;
+         csr_block = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-off_proc") == 0 )
       {
          arg_index++;
@@ -1101,6 +1130,26 @@ main( hypre_int argc,
          spgemm_use_cusparse = atoi(argv[arg_index++]);
       }
 #endif
+      else if ( strcmp(argv[arg_index], "-sell") == 0 )
+      {
+         arg_index++;
+         spmv_use_sell = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-nrhs") == 0 )
+      {
+         arg_index++;
+         num_rhs = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-resetup") == 0 )
+      {
+         arg_index++;
+         resetup = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-shell_matvec") == 0 )
+      {
+         arg_index++;
+         shell_matvec = 1;
+      }
       else if ( strcmp(argv[arg_index], "-mempool_growth") == 0 )
       {
          arg_index++;
@@ -1305,6 +1354,26 @@ main( hypre_int argc,
          arg_index++;
          relax_order = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-relax_overlap") == 0 )
+      {
+         arg_index++;
+         relax_overlap = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-relax_plan") == 0 )
+      {
+         arg_index++;
+         relax_plan = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-float_level") == 0 )
+      {
+         arg_index++;
+         float_level = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-float_drop") == 0 )
+      {
+         arg_index++;
+         float_drop_double = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cf") == 0 )
       {
          arg_index++;
@@ -1430,6 +1499,16 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pcg_pipelined = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         pcg_s_step = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1608,6 +1687,16 @@ main( hypre_int argc,
          arg_index++;
          mod_rap2  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fused_rap") == 0 )
+      {
+         arg_index++;
+         fused_rap  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-phase_stats") == 0 )
+      {
+         arg_index++;
+         phase_stats_file = argv[arg_index++];
+      }
       else if ( strcmp(argv[arg_index], "-keepT") == 0 )
       {
          arg_index++;
@@ -1904,11 +1993,14 @@ main( hypre_int argc,
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
+         hypre_printf("  -cgs   <val>           : 2 uses CGS2 in GMRES, LGMRES, FlexGMRES and COGMRES\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -pipelined             : use pipelined PCG\n");
+         hypre_printf("  -sstep  <val>          : use s-step PCG with s = val (1-5)\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
@@ -1935,6 +2027,32 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
          hypre_printf("\n");
+         hypre_printf("  -sell                  : use SELL-C-sigma layout for host matvecs\n");
+         hypre_printf("\n");
+         hypre_printf("  -nrhs <val>            : solve for <val> right-hand sides at once\n");
+         hypre_printf("                           (b and random vectors; solvers 0 and 1)\n");
+         hypre_printf("\n");
+         hypre_printf("  -resetup               : double the diagonal of A after the AMG solve,\n");
+         hypre_printf("                           update AMG without coarsening and solve again\n");
+         hypre_printf("                           (solver 0)\n");
+         hypre_printf("  -fused_rap <val>       : compute Galerkin products row by row without\n");
+         hypre_printf("                           forming A*P and print their peak memory\n");
+         hypre_printf("                           (solver 0; -mod_rap2 1 prints the same for\n");
+         hypre_printf("                           the default triple product)\n");
+         hypre_printf("  -phase_stats <file>    : write per-level setup and solve phase\n");
+         hypre_printf("                           statistics as JSON to <file> (solver 0)\n");
+         hypre_printf("  -shell_matvec          : apply A in the Krylov solvers through a user\n");
+         hypre_printf("                           matvec callback instead of the matrix entries\n");
+         hypre_printf("  -relax_overlap <val>   : relax rows without off-processor connections\n");
+         hypre_printf("                           during the halo exchange (hybrid GS/SOR;\n");
+         hypre_printf("                           solvers 0 and 1)\n");
+         hypre_printf("  -relax_plan <val>      : precompute thread partitions, C/F point lists\n");
+         hypre_printf("                           and diagonal inverses for the smoothers\n");
+         hypre_printf("                           (solvers 0 and 1)\n");
+         hypre_printf("  -float_level <val>     : store AMG levels >= val in single precision\n");
+         hypre_printf("  -float_drop <val>      : 1 = free the double values of these levels\n");
+         hypre_printf("                           (solvers 0 and 1)\n");
+         hypre_printf("\n");
          /* begin lobpcg */
 
          hypre_printf("LOBPCG options:\n");
@@ -2078,6 +2196,7 @@ main( hypre_int argc,
                             mempool_max_bin, mempool_max_cached_bytes );
 
    hypre_HandleMemoryLocation(hypre_handle())    = memory_location;
+   HYPRE_SetSpMVUseSell(spmv_use_sell);
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle()) = default_exec_policy;
    hypre_HandleSpgemmUseCusparse(hypre_handle()) = spgemm_use_cusparse;
@@ -2345,7 +2464,31 @@ main( hypre_int argc,
          hypre_TMemcpy(data,     data_h,     HYPRE_Real,   mx_size*num_rows, memory_location, HYPRE_MEMORY_HOST);
       }
 
-      if (chunk)
+      if (csr_block && !add)
+      {
+         HYPRE_Int *row_ptr_h = hypre_TAlloc(HYPRE_Int, num_rows+1, HYPRE_MEMORY_HOST);
+         HYPRE_Int *row_ptr   = row_ptr_h;
+
+         row_ptr_h[0] = 0;
+         for (i = 0; i < num_rows; i++)
+         {
+            row_ptr_h[i+1] = row_ptr_h[i] + num_cols_h[i];
+         }
+         if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+         {
+            row_ptr = hypre_TAlloc(HYPRE_Int, num_rows+1, memory_location);
+            hypre_TMemcpy(row_ptr, row_ptr_h, HYPRE_Int, num_rows+1, memory_location, HYPRE_MEMORY_HOST);
+         }
+         ierr += HYPRE_IJMatrixSetValuesCSR(ij_A, num_rows, row_nums, row_ptr,
+                                            (const HYPRE_BigInt *) col_nums,
+                                            (const HYPRE_Real *) data);
+         if (row_ptr != row_ptr_h)
+         {
+            hypre_TFree(row_ptr, memory_location);
+         }
+         hypre_TFree(row_ptr_h, HYPRE_MEMORY_HOST);
+      }
+      else if (chunk)
       {
          if (add)
          {
@@ -2507,6 +2650,17 @@ main( hypre_int argc,
       parcsr_A = (HYPRE_ParCSRMatrix) object;
    }
 
+   /*-----------------------------------------------------------
+    * Let the Krylov solvers apply A through a user operator;
+    * the matrix entries are then only used by the preconditioner
+    *-----------------------------------------------------------*/
+   if (shell_matvec)
+   {
+      shell_data.A         = parcsr_A;
+      shell_data.num_calls = 0;
+      HYPRE_ParCSRMatrixSetShellMatvec(parcsr_A, ShellMatvec, ShellMatvecT, &shell_data);
+   }
+
    /*-----------------------------------------------------------
     * Set up the interp vector
     *-----------------------------------------------------------*/
@@ -3089,6 +3243,51 @@ main( hypre_int argc,
    hypre_ParVectorMigrate(b, hypre_HandleMemoryLocation(hypre_handle()));
    hypre_ParVectorMigrate(x, hypre_HandleMemoryLocation(hypre_handle()));
 
+   /*-----------------------------------------------------------
+    * Set up a block of right-hand sides: the first column is b,
+    * the others are random, and every column starts from x
+    *-----------------------------------------------------------*/
+
+   if (num_rhs > 1)
+   {
+      hypre_ParVector *b_col, *x_col;
+
+      if (myid == 0)
+      {
+         hypre_printf("  Solving for %d right-hand sides at once\n", num_rhs);
+      }
+
+      b_single = b;
+      x_single = x;
+
+      HYPRE_ParMultiVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParVectorGlobalSize(b_single),
+                                 hypre_ParVectorPartitioning(b_single), num_rhs, &b);
+      hypre_ParVectorSetPartitioningOwner(b, 0);
+      hypre_ParVectorInitialize_v2(b, hypre_ParVectorMemoryLocation(b_single));
+
+      HYPRE_ParMultiVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParVectorGlobalSize(x_single),
+                                 hypre_ParVectorPartitioning(x_single), num_rhs, &x);
+      hypre_ParVectorSetPartitioningOwner(x, 0);
+      hypre_ParVectorInitialize_v2(x, hypre_ParVectorMemoryLocation(x_single));
+
+      for (i = 0; i < num_rhs; i++)
+      {
+         b_col = hypre_ParMultiVectorColumnView(b, i);
+         x_col = hypre_ParMultiVectorColumnView(x, i);
+         if (i == 0)
+         {
+            hypre_ParVectorCopy(b_single, b_col);
+         }
+         else
+         {
+            hypre_ParVectorSetRandomValues(b_col, 2747*i);
+         }
+         hypre_ParVectorCopy(x_single, x_col);
+         hypre_ParVectorDestroy(b_col);
+         hypre_ParVectorDestroy(x_col);
+      }
+   }
+
    /* save the initial guess for the 2nd time */
 #if SECOND_TIME
    x0_save = hypre_ParVectorCloneDeep_v2(x, hypre_ParVectorMemoryLocation(x));
@@ -3327,6 +3526,10 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
+      HYPRE_BoomerAMGSetRelaxOverlap(amg_solver, relax_overlap);
+      HYPRE_BoomerAMGSetRelaxPlan(amg_solver, relax_plan);
+      HYPRE_BoomerAMGSetFloatLevel(amg_solver, float_level);
+      HYPRE_BoomerAMGSetFloatDropDouble(amg_solver, float_drop_double);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
       HYPRE_BoomerAMGSetMaxLevels(amg_solver, max_levels);
@@ -3381,6 +3584,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetFusedRAP(amg_solver, fused_rap);
+      HYPRE_BoomerAMGSetPhaseStats(amg_solver, phase_stats_file != NULL);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -3427,6 +3632,20 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (fused_rap || mod_rap2)
+      {
+         HYPRE_Real rap_peak_memory, max_rap_peak_memory;
+
+         HYPRE_BoomerAMGGetRAPPeakMemory(amg_solver, &rap_peak_memory);
+         hypre_MPI_Allreduce(&rap_peak_memory, &max_rap_peak_memory, 1, HYPRE_MPI_REAL,
+                             hypre_MPI_MAX, hypre_MPI_COMM_WORLD);
+         if (myid == 0)
+         {
+            hypre_printf("\nGalerkin product peak memory (max over processors) = %.3f MB\n",
+                         max_rap_peak_memory / 1048576.0);
+         }
+      }
+
       time_index = hypre_InitializeTiming("BoomerAMG Solve");
       hypre_BeginTiming(time_index);
 
@@ -3453,6 +3672,11 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (phase_stats_file)
+      {
+         HYPRE_BoomerAMGPrintPhaseStats(amg_solver, phase_stats_file);
+      }
+
       HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
       HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
 
@@ -3464,6 +3688,42 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      if (resetup)
+      {
+         /* change the values, but not the sparsity pattern, of A */
+         hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag((hypre_ParCSRMatrix *) parcsr_A);
+         HYPRE_Int        n_local = hypre_CSRMatrixNumRows(A_diag);
+
+         for (i = 0; i < n_local; i++)
+         {
+            hypre_CSRMatrixData(A_diag)[hypre_CSRMatrixI(A_diag)[i]] *= 2.0;
+         }
+
+         time_index = hypre_InitializeTiming("BoomerAMG Resetup");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_BoomerAMGResetup(amg_solver, parcsr_A, b, x);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Resetup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_ParVectorSetConstantValues(x, 0.0);
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("BoomerAMG Iterations = %d\n", num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+            hypre_printf("\n");
+         }
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -3709,6 +3969,8 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      HYPRE_PCGSetPipelined(pcg_solver, pcg_pipelined);
+      HYPRE_PCGSetSStep(pcg_solver, pcg_s_step);
 
       if (solver_id == 1)
       {
@@ -3762,6 +4024,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetRelaxPlan(pcg_precond, relax_plan);
+         HYPRE_BoomerAMGSetFloatLevel(pcg_precond, float_level);
+         HYPRE_BoomerAMGSetFloatDropDouble(pcg_precond, float_drop_double);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -5116,6 +5382,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_GMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_GMRESSetCGS(pcg_solver, cgs > 1);
       HYPRE_GMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_GMRESSetTol(pcg_solver, tol);
       HYPRE_GMRESSetAbsoluteTol(pcg_solver, atol);
@@ -5582,6 +5849,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRLGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_LGMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_LGMRESSetCGS(pcg_solver, cgs > 1);
       HYPRE_LGMRESSetAugDim(pcg_solver, aug_dim);
       HYPRE_LGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_LGMRESSetTol(pcg_solver, tol);
@@ -5769,6 +6037,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRFlexGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_FlexGMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_FlexGMRESSetCGS(pcg_solver, cgs > 1);
       HYPRE_FlexGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_FlexGMRESSetTol(pcg_solver, tol);
       HYPRE_FlexGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -7217,6 +7486,11 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x");
    }
 
+   if (shell_matvec && myid == 0)
+   {
+      hypre_printf("Shell matvec calls = %d\n", shell_data.num_calls);
+   }
+
    /*-----------------------------------------------------------
     * Finalize things
     *-----------------------------------------------------------*/
@@ -7225,6 +7499,14 @@ main( hypre_int argc,
 
    HYPRE_ParVectorDestroy(x0_save);
 
+   if (b_single)
+   {
+      HYPRE_ParVectorDestroy(b);
+      HYPRE_ParVectorDestroy(x);
+      b = b_single;
+      x = x_single;
+   }
+
    if (test_ij || build_matrix_type == -1)
    {
       HYPRE_IJMatrixDestroy(ij_A);
@@ -9357,5 +9639,38 @@ BuildParIsoLaplacian( HYPRE_Int argc, char** argv, HYPRE_ParCSRMatrix *A_ptr )
    return (0);
 }
 
-/* end lobpcg */
+/*----------------------------------------------------------------------
+ * User operator for -shell_matvec.  A real application would apply its
+ * (unassembled) operator here; the driver reuses the assembled matrix and
+ * counts the calls, so that the test output shows the callback was used.
+ *----------------------------------------------------------------------*/
 
+HYPRE_Int
+ShellMatvec( void            *data,
+             HYPRE_Complex    alpha,
+             HYPRE_ParVector  x,
+             HYPRE_Complex    beta,
+             HYPRE_ParVector  y )
+{
+   ShellMatvecData *shell_data = (ShellMatvecData *) data;
+
+   shell_data -> num_calls++;
+
+   return HYPRE_ParCSRMatrixMatvec(alpha, shell_data -> A, x, beta, y);
+}
+
+HYPRE_Int
+ShellMatvecT( void            *data,
+              HYPRE_Complex    alpha,
+              HYPRE_ParVector  x,
+              HYPRE_Complex    beta,
+              HYPRE_ParVector  y )
+{
+   ShellMatvecData *shell_data = (ShellMatvecData *) data;
+
+   shell_data -> num_calls++;
+
+   return HYPRE_ParCSRMatrixMatvecT(alpha, shell_data -> A, x, beta, y);
+}
+
+/* end lobpcg */
@@ -2245,6 +2245,9 @@ PrintUsage( char *progname,
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("                        3 - BiCGSTAB (only ParCSRHybrid)\n");
       hypre_printf("  -recompute <bool>  : Recompute residual in PCG?\n");
+      hypre_printf("  -pipelined         : use pipelined PCG\n");
+      hypre_printf("  -sstep <s>         : use s-step PCG\n");
+      hypre_printf("  -cgs2              : use CGS2 in GMRES, LGMRES and FlexGMRES\n");
       hypre_printf("  -v <n_pre> <n_post>: SysPFMG and Struct- # of pre and post relax\n");
       hypre_printf("  -skip <s>          : SysPFMG and Struct- skip relaxation (0 or 1)\n");
       hypre_printf("  -rap <r>           : Struct- coarse grid operator type\n");
@@ -2372,6 +2375,9 @@ main( hypre_int argc,
    HYPRE_Int             jump;
    HYPRE_Int             solver_type;
    HYPRE_Int             recompute_res;
+   HYPRE_Int             pcg_pipelined;
+   HYPRE_Int             pcg_s_step;
+   HYPRE_Int             gmres_cgs2;
 
    HYPRE_Real            cf_tol;
 
@@ -2487,6 +2493,9 @@ main( hypre_int argc,
    jump  = 0;
    solver_type = 1;
    recompute_res = 0;   /* What should be the default here? */
+   pcg_pipelined = 0;
+   pcg_s_step = 1;
+   gmres_cgs2 = 0;
    cf_tol = 0.90;
 
    nparts = global_data.nparts;
@@ -2663,6 +2672,21 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pcg_pipelined = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         pcg_s_step = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-cgs2") == 0 )
+      {
+         arg_index++;
+         gmres_cgs2 = 1;
+      }
       else if ( strcmp(argv[arg_index], "-cf") == 0 )
       {
          arg_index++;
@@ -3757,6 +3781,8 @@ main( hypre_int argc,
       HYPRE_PCGSetRelChange( (HYPRE_Solver) solver, 0 );
       HYPRE_PCGSetPrintLevel( (HYPRE_Solver) solver, 1 );
       HYPRE_PCGSetRecomputeResidual( (HYPRE_Solver) solver, recompute_res);
+      HYPRE_PCGSetPipelined( (HYPRE_Solver) solver, pcg_pipelined );
+      HYPRE_PCGSetSStep( (HYPRE_Solver) solver, pcg_s_step );
 
       if ((solver_id == 10) || (solver_id == 11))
       {
@@ -4239,6 +4265,8 @@ main( hypre_int argc,
       HYPRE_PCGSetRelChange( par_solver, 0 );
       HYPRE_PCGSetPrintLevel( par_solver, 1 );
       HYPRE_PCGSetRecomputeResidual( (HYPRE_Solver) par_solver, recompute_res);
+      HYPRE_PCGSetPipelined( par_solver, pcg_pipelined );
+      HYPRE_PCGSetSStep( par_solver, pcg_s_step );
 
       if (solver_id == 20)
       {
@@ -4334,6 +4362,7 @@ main( hypre_int argc,
 
       HYPRE_SStructGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
       HYPRE_GMRESSetKDim( (HYPRE_Solver) solver, 5 );
+      HYPRE_GMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs2 );
       HYPRE_GMRESSetMaxIter( (HYPRE_Solver) solver, 100 );
       HYPRE_GMRESSetTol( (HYPRE_Solver) solver, tol );
       HYPRE_GMRESSetPrintLevel( (HYPRE_Solver) solver, 1 );
@@ -4410,6 +4439,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRGMRESCreate(hypre_MPI_COMM_WORLD, &par_solver);
       HYPRE_GMRESSetKDim(par_solver, 5);
+      HYPRE_GMRESSetCGS(par_solver, gmres_cgs2);
       HYPRE_GMRESSetMaxIter(par_solver, 100);
       HYPRE_GMRESSetTol(par_solver, tol);
       HYPRE_GMRESSetPrintLevel(par_solver, 1);
@@ -4665,6 +4695,7 @@ main( hypre_int argc,
 
       HYPRE_SStructFlexGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
       HYPRE_FlexGMRESSetKDim( (HYPRE_Solver) solver, 5 );
+      HYPRE_FlexGMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs2 );
       HYPRE_FlexGMRESSetMaxIter( (HYPRE_Solver) solver, 100 );
       HYPRE_FlexGMRESSetTol( (HYPRE_Solver) solver, tol );
       HYPRE_FlexGMRESSetPrintLevel( (HYPRE_Solver) solver, 1 );
@@ -4741,6 +4772,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRFlexGMRESCreate(hypre_MPI_COMM_WORLD, &par_solver);
       HYPRE_FlexGMRESSetKDim(par_solver, 5);
+      HYPRE_FlexGMRESSetCGS(par_solver, gmres_cgs2);
       HYPRE_FlexGMRESSetMaxIter(par_solver, 100);
       HYPRE_FlexGMRESSetTol(par_solver, tol);
       HYPRE_FlexGMRESSetPrintLevel(par_solver, 1);
@@ -4802,6 +4834,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRLGMRESCreate(hypre_MPI_COMM_WORLD, &par_solver);
       HYPRE_LGMRESSetKDim(par_solver, 10);
+      HYPRE_LGMRESSetCGS(par_solver, gmres_cgs2);
       HYPRE_LGMRESSetAugDim(par_solver, 2);
       HYPRE_LGMRESSetMaxIter(par_solver, 100);
       HYPRE_LGMRESSetTol(par_solver, tol);
@@ -5173,6 +5206,8 @@ main( hypre_int argc,
       HYPRE_PCGSetRelChange( (HYPRE_Solver)struct_solver, 0 );
       HYPRE_PCGSetPrintLevel( (HYPRE_Solver)struct_solver, 1 );
       HYPRE_PCGSetRecomputeResidual( (HYPRE_Solver)struct_solver, recompute_res);
+      HYPRE_PCGSetPipelined( (HYPRE_Solver)struct_solver, pcg_pipelined );
+      HYPRE_PCGSetSStep( (HYPRE_Solver)struct_solver, pcg_s_step );
 
       if (solver_id == 210)
       {
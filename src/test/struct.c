@@ -75,6 +75,9 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type;
    HYPRE_Int           recompute_res;
+   HYPRE_Int           pcg_pipelined;
+   HYPRE_Int           pcg_s_step;
+   HYPRE_Int           gmres_cgs2;
 
    /*HYPRE_Real          dxyz[3];*/
 
@@ -100,6 +103,9 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           tile_depth;
+   HYPRE_Int           coarse_solve_size;
+   HYPRE_Int           box_threads;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -138,6 +144,8 @@ main( hypre_int argc,
    HYPRE_Int           sum;
 
    HYPRE_Int           print_system = 0;
+   HYPRE_Int           binary_io = 0;
+   HYPRE_Int           binary_grid = 0;
 
    /* begin lobpcg */
 
@@ -198,6 +206,9 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   tile_depth = 1;
+   coarse_solve_size = 0;
+   box_threads = -1;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -230,6 +241,9 @@ main( hypre_int argc,
    solver_id = 0;
    solver_type = 1;
    recompute_res = 0;   /* What should be the default here? */
+   pcg_pipelined = 0;
+   pcg_s_step = 1;
+   gmres_cgs2 = 0;
 
    istart[0] = -3;
    istart[1] = -3;
@@ -389,6 +403,21 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-tile") == 0 )
+      {
+         arg_index++;
+         tile_depth = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-csize") == 0 )
+      {
+         arg_index++;
+         coarse_solve_size = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-boxthreads") == 0 )
+      {
+         arg_index++;
+         box_threads = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -404,6 +433,21 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pcg_pipelined = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         pcg_s_step = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-cgs2") == 0 )
+      {
+         arg_index++;
+         gmres_cgs2 = 1;
+      }
       else if ( strcmp(argv[arg_index], "-cf") == 0 )
       {
          arg_index++;
@@ -414,6 +458,16 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-binary") == 0 )
+      {
+         arg_index++;
+         binary_io = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-binary_grid") == 0 )
+      {
+         arg_index++;
+         binary_grid = 1;
+      }
       else if ( strcmp(argv[arg_index], "-help") == 0 )
       {
          print_usage = 1;
@@ -528,6 +582,10 @@ main( hypre_int argc,
       hypre_printf("  -fromfile <name>    : prefix name for matrixfiles\n");
       hypre_printf("  -rhsfromfile <name> : prefix name for rhsfiles\n");
       hypre_printf("  -x0fromfile <name>  : prefix name for firstguessfiles\n");
+      hypre_printf("  -binary             : print and read (when reading all three\n");
+      hypre_printf("                        of the above) single binary files\n");
+      hypre_printf("  -binary_grid        : read the binary files onto the grid given\n");
+      hypre_printf("                        by -n, -P and -b instead of the file boxes\n");
       hypre_printf("  -repeats <reps>     : number of times to repeat the run, default 1.  For solver 0,1,3\n");
       hypre_printf("  -solver <ID>        : solver ID\n");
       hypre_printf("                        0  - SMG (default)\n");
@@ -577,12 +635,20 @@ main( hypre_int argc,
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -tile <k>           : relaxation sweeps per ghost exchange in PFMG\n");
+      hypre_printf("  -csize <n>          : solve PFMG coarse grids of up to n points directly\n");
+      hypre_printf("  -boxthreads <b>     : OpenMP threads over whole boxes (1), inside\n");
+      hypre_printf("                        each box (0), or chosen per grid (-1, default)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
       hypre_printf("                        1 - PCG (default)\n");
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("  -recompute <bool>   : Recompute residual in PCG?\n");
+      hypre_printf("  -pipelined          : use pipelined PCG (solvers 10-19)\n");
+      hypre_printf("  -sstep <s>          : use s-step PCG, s = 1-5 (solvers 10-19)\n");
+      hypre_printf("  -cgs2               : use CGS2 instead of modified Gram-Schmidt\n");
+      hypre_printf("                        in GMRES, LGMRES and FlexGMRES\n");
       hypre_printf("  -cf <cf>            : convergence factor for Hybrid\n");
       hypre_printf("\n");
 
@@ -634,6 +700,8 @@ main( hypre_int argc,
       exit(1);
    }
 
+   HYPRE_SetStructBoxThreads(box_threads);
+
    /*-----------------------------------------------------------
     * Check a few things
     *-----------------------------------------------------------*/
@@ -895,38 +963,9 @@ main( hypre_int argc,
       }
 #endif
 
-      /* We do the extreme cases first reading everything from files => sum = 3
-       * building things from scratch (grid,stencils,extents) sum = 0 */
-
-      if ( (read_fromfile_param ==1) &&
-           (read_x0fromfile_param ==1) &&
-           (read_rhsfromfile_param ==1)
-         )
-      {
-         /* ghost selection for reading the matrix and vectors */
-         for (i = 0; i < dim; i++)
-         {
-            A_num_ghost[2*i] = 1;
-            A_num_ghost[2*i + 1] = 1;
-            v_num_ghost[2*i] = 1;
-            v_num_ghost[2*i + 1] = 1;
-         }
-
-         A = (HYPRE_StructMatrix)
-            hypre_StructMatrixRead(hypre_MPI_COMM_WORLD,
-                                   argv[read_fromfile_index],A_num_ghost);
-
-         b = (HYPRE_StructVector)
-            hypre_StructVectorRead(hypre_MPI_COMM_WORLD,
-                                   argv[read_rhsfromfile_index],v_num_ghost);
-
-         x = (HYPRE_StructVector)
-            hypre_StructVectorRead(hypre_MPI_COMM_WORLD,
-                                   argv[read_x0fromfile_index],v_num_ghost);
-      }
-
-      /* beginning of sum == 0  */
-      if (sum == 0)    /* no read from any file */
+      /* the grid built from the (p,q,r) partition, also used to read binary
+       * files with a different partition than the one they were written with */
+      if (sum == 0 || binary_grid)
       {
          /*-----------------------------------------------------------
           * prepare space for the extents
@@ -1013,6 +1052,69 @@ main( hypre_int argc,
          */
 #endif
 
+         for (i = 0; i < nblocks; i++)
+         {
+            hypre_TFree(iupper[i], HYPRE_MEMORY_HOST);
+            hypre_TFree(ilower[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(ilower, HYPRE_MEMORY_HOST);
+         hypre_TFree(iupper, HYPRE_MEMORY_HOST);
+      }
+
+      /* We do the extreme cases first reading everything from files => sum = 3
+       * building things from scratch (grid,stencils,extents) sum = 0 */
+
+      if ( (read_fromfile_param ==1) &&
+           (read_x0fromfile_param ==1) &&
+           (read_rhsfromfile_param ==1)
+         )
+      {
+         /* ghost selection for reading the matrix and vectors */
+         for (i = 0; i < dim; i++)
+         {
+            A_num_ghost[2*i] = 1;
+            A_num_ghost[2*i + 1] = 1;
+            v_num_ghost[2*i] = 1;
+            v_num_ghost[2*i + 1] = 1;
+         }
+
+         if (binary_io)
+         {
+            HYPRE_StructMatrixReadBinary(hypre_MPI_COMM_WORLD,
+                                         argv[read_fromfile_index],
+                                         binary_grid ? grid : NULL,
+                                         A_num_ghost, &A);
+            readgrid = hypre_StructMatrixGrid(A);
+            HYPRE_StructVectorReadBinary(hypre_MPI_COMM_WORLD,
+                                         argv[read_rhsfromfile_index], readgrid,
+                                         v_num_ghost, &b);
+            HYPRE_StructVectorReadBinary(hypre_MPI_COMM_WORLD,
+                                         argv[read_x0fromfile_index], readgrid,
+                                         v_num_ghost, &x);
+            if (binary_grid)
+            {
+               HYPRE_StructGridDestroy(grid);
+            }
+         }
+         else
+         {
+            A = (HYPRE_StructMatrix)
+               hypre_StructMatrixRead(hypre_MPI_COMM_WORLD,
+                                      argv[read_fromfile_index],A_num_ghost);
+
+            b = (HYPRE_StructVector)
+               hypre_StructVectorRead(hypre_MPI_COMM_WORLD,
+                                      argv[read_rhsfromfile_index],v_num_ghost);
+
+            x = (HYPRE_StructVector)
+               hypre_StructVectorRead(hypre_MPI_COMM_WORLD,
+                                      argv[read_x0fromfile_index],v_num_ghost);
+         }
+      }
+
+      /* beginning of sum == 0  */
+      if (sum == 0)    /* no read from any file */
+      {
          /*-----------------------------------------------------------
           * Set up the matrix structure
           *-----------------------------------------------------------*/
@@ -1102,14 +1204,6 @@ main( hypre_int argc,
          HYPRE_StructVectorAssemble(x);
 
          HYPRE_StructGridDestroy(grid);
-
-         for (i = 0; i < nblocks; i++)
-         {
-            hypre_TFree(iupper[i], HYPRE_MEMORY_HOST);
-            hypre_TFree(ilower[i], HYPRE_MEMORY_HOST);
-         }
-         hypre_TFree(ilower, HYPRE_MEMORY_HOST);
-         hypre_TFree(iupper, HYPRE_MEMORY_HOST);
       }
 
       /* the grid will be read from file.  */
@@ -1327,7 +1421,13 @@ main( hypre_int argc,
        * Print out the system and initial guess
        *-----------------------------------------------------------*/
 
-      if (print_system)
+      if (print_system && binary_io)
+      {
+         HYPRE_StructMatrixPrintBinary("struct.out.A.bin", A);
+         HYPRE_StructVectorPrintBinary("struct.out.b.bin", b);
+         HYPRE_StructVectorPrintBinary("struct.out.x0.bin", x);
+      }
+      else if (print_system)
       {
          HYPRE_StructMatrixPrint("struct.out.A", A, 0);
          HYPRE_StructVectorPrint("struct.out.b", b, 0);
@@ -1423,6 +1523,8 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetRelaxTileDepth(solver, tile_depth);
+         HYPRE_StructPFMGSetCoarseSolveSize(solver, coarse_solve_size);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1562,6 +1664,8 @@ main( hypre_int argc,
          HYPRE_PCGSetTwoNorm( (HYPRE_Solver)solver, 1 );
          HYPRE_PCGSetRelChange( (HYPRE_Solver)solver, 0 );
          HYPRE_PCGSetPrintLevel( (HYPRE_Solver)solver, 1 );
+         HYPRE_PCGSetPipelined( (HYPRE_Solver)solver, pcg_pipelined );
+         HYPRE_PCGSetSStep( (HYPRE_Solver)solver, pcg_s_step );
 
          if (solver_id == 10)
          {
@@ -1601,6 +1705,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRelaxTileDepth(precond, tile_depth);
+            HYPRE_StructPFMGSetCoarseSolveSize(precond, coarse_solve_size);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1766,6 +1872,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetRelaxTileDepth(precond, tile_depth);
+               HYPRE_StructPFMGSetCoarseSolveSize(precond, coarse_solve_size);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2000,6 +2108,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetRelaxTileDepth(precond, tile_depth);
+               HYPRE_StructPFMGSetCoarseSolveSize(precond, coarse_solve_size);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2245,6 +2355,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRelaxTileDepth(precond, tile_depth);
+            HYPRE_StructPFMGSetCoarseSolveSize(precond, coarse_solve_size);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2326,6 +2438,7 @@ main( hypre_int argc,
 
          HYPRE_StructGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
          HYPRE_GMRESSetKDim( (HYPRE_Solver) solver, 5 );
+         HYPRE_GMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs2 );
          HYPRE_GMRESSetMaxIter( (HYPRE_Solver)solver, 100 );
          HYPRE_GMRESSetTol( (HYPRE_Solver)solver, tol );
          HYPRE_GMRESSetRelChange( (HYPRE_Solver)solver, 0 );
@@ -2369,6 +2482,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRelaxTileDepth(precond, tile_depth);
+            HYPRE_StructPFMGSetCoarseSolveSize(precond, coarse_solve_size);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2520,6 +2635,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRelaxTileDepth(precond, tile_depth);
+            HYPRE_StructPFMGSetCoarseSolveSize(precond, coarse_solve_size);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2629,6 +2746,7 @@ main( hypre_int argc,
 
          HYPRE_StructLGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
          HYPRE_LGMRESSetKDim( (HYPRE_Solver) solver, 5 );
+         HYPRE_LGMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs2 );
          HYPRE_LGMRESSetMaxIter( (HYPRE_Solver)solver, 100 );
          HYPRE_LGMRESSetTol( (HYPRE_Solver)solver, tol );
          HYPRE_LGMRESSetPrintLevel( (HYPRE_Solver)solver, 1 );
@@ -2671,6 +2789,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRelaxTileDepth(precond, tile_depth);
+            HYPRE_StructPFMGSetCoarseSolveSize(precond, coarse_solve_size);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2727,6 +2847,7 @@ main( hypre_int argc,
 
          HYPRE_StructFlexGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
          HYPRE_FlexGMRESSetKDim( (HYPRE_Solver) solver, 5 );
+         HYPRE_FlexGMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs2 );
          HYPRE_FlexGMRESSetMaxIter( (HYPRE_Solver)solver, 100 );
          HYPRE_FlexGMRESSetTol( (HYPRE_Solver)solver, tol );
          HYPRE_FlexGMRESSetPrintLevel( (HYPRE_Solver)solver, 1 );
@@ -2769,6 +2890,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRelaxTileDepth(precond, tile_depth);
+            HYPRE_StructPFMGSetCoarseSolveSize(precond, coarse_solve_size);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2819,7 +2942,11 @@ main( hypre_int argc,
        * Print the solution and other info
        *-----------------------------------------------------------*/
 
-      if (print_system)
+      if (print_system && binary_io)
+      {
+         HYPRE_StructVectorPrintBinary("struct.out.x.bin", x);
+      }
+      else if (print_system)
       {
          HYPRE_StructVectorPrint("struct.out.x", x, 0);
       }
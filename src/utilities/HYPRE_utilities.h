@@ -116,6 +116,22 @@ typedef HYPRE_Int MPI_Comm;
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
 
+/*--------------------------------------------------------------------------
+ * HYPRE global options
+ *--------------------------------------------------------------------------*/
+
+/* Use the SELL-C-sigma companion layout for host CSR matvecs (default 0).
+ * Matrices whose values change after their first matvec must be
+ * re-assembled (or have their SELL copy reset) before the next solve. */
+HYPRE_Int HYPRE_SetSpMVUseSell( HYPRE_Int use_sell );
+
+/* OpenMP scheduling of the host struct kernels (matvec, relaxation, axpy,
+ * inner products) on grids with several boxes per process: a negative
+ * value (default) chooses per grid from the box sizes, 0 threads the loop
+ * inside each box, and a positive value hands out whole boxes to the
+ * threads, which suits many small boxes. */
+HYPRE_Int HYPRE_SetStructBoxThreads( HYPRE_Int box_threads );
+
 /*--------------------------------------------------------------------------
  * HYPRE error user functions
  *--------------------------------------------------------------------------*/
@@ -179,6 +179,8 @@ extern "C" {
 #define MPI_Op              hypre_MPI_Op
 #define MPI_Aint            hypre_MPI_Aint
 #define MPI_Info            hypre_MPI_Info
+#define MPI_File            hypre_MPI_File
+#define MPI_Offset          hypre_MPI_Offset
 
 #define MPI_COMM_WORLD       hypre_MPI_COMM_WORLD
 #define MPI_COMM_NULL        hypre_MPI_COMM_NULL
@@ -233,6 +235,8 @@ extern "C" {
 #define MPI_Address         hypre_MPI_Address
 #define MPI_Get_count       hypre_MPI_Get_count
 #define MPI_Alltoall        hypre_MPI_Alltoall
+#define MPI_Dist_graph_create_adjacent hypre_MPI_Dist_graph_create_adjacent
+#define MPI_Ineighbor_alltoallv hypre_MPI_Ineighbor_alltoallv
 #define MPI_Allgather       hypre_MPI_Allgather
 #define MPI_Allgatherv      hypre_MPI_Allgatherv
 #define MPI_Gather          hypre_MPI_Gather
@@ -256,6 +260,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -269,6 +274,12 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_File_open       hypre_MPI_File_open
+#define MPI_File_close      hypre_MPI_File_close
+#define MPI_File_set_size   hypre_MPI_File_set_size
+#define MPI_File_read_at    hypre_MPI_File_read_at
+#define MPI_File_write_at   hypre_MPI_File_write_at
+#define MPI_File_write_at_all hypre_MPI_File_write_at_all
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -290,6 +301,8 @@ typedef struct
 typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
+typedef void      *hypre_MPI_File;
+typedef long int   hypre_MPI_Offset;
 
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
@@ -323,6 +336,10 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
 
+#define  hypre_MPI_MODE_CREATE   1
+#define  hypre_MPI_MODE_RDONLY   2
+#define  hypre_MPI_MODE_WRONLY   4
+
 #else
 
 /******************************************************************************
@@ -337,6 +354,8 @@ typedef MPI_Status   hypre_MPI_Status;
 typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
+typedef MPI_File     hypre_MPI_File;
+typedef MPI_Offset   hypre_MPI_Offset;
 typedef MPI_User_function    hypre_MPI_User_function;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
@@ -373,6 +392,9 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_SOURCE          MPI_SOURCE
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
+#define  hypre_MPI_MODE_CREATE     MPI_MODE_CREATE
+#define  hypre_MPI_MODE_RDONLY     MPI_MODE_RDONLY
+#define  hypre_MPI_MODE_WRONLY     MPI_MODE_WRONLY
 
 #endif
 
@@ -427,6 +449,7 @@ HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request , hypre_MPI_Status *status
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count , hypre_MPI_Request *array_of_requests , hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_requests , HYPRE_Int *index , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
@@ -438,11 +461,21 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_File_open( hypre_MPI_Comm comm , const char *filename , HYPRE_Int amode , hypre_MPI_Info info , hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_close( hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_set_size( hypre_MPI_File fh , hypre_MPI_Offset size );
+HYPRE_Int hypre_MPI_File_read_at( hypre_MPI_File fh , hypre_MPI_Offset offset , void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_write_at( hypre_MPI_File fh , hypre_MPI_Offset offset , void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_write_at_all( hypre_MPI_File fh , hypre_MPI_Offset offset , void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Status *status );
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm_old , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , HYPRE_Int reorder , hypre_MPI_Comm *comm_dist_graph );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+#endif
 
 #ifdef __cplusplus
 }
@@ -1196,6 +1229,13 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   /* host SpMV options */
+   HYPRE_Int              spmv_use_sell;
+   /* host struct box loop threading (see HYPRE_SetStructBoxThreads) */
+   HYPRE_Int              struct_box_threads;
+   /* point-to-point traffic posted through ParCSR communication handles */
+   HYPRE_Real             comm_num_messages;
+   HYPRE_Real             comm_num_bytes;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_CudaData        *cuda_data;
 #endif
@@ -1205,6 +1245,10 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSell(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleStructBoxThreads(hypre_handle)               ((hypre_handle) -> struct_box_threads)
+#define hypre_HandleCommNumMessages(hypre_handle)                ((hypre_handle) -> comm_num_messages)
+#define hypre_HandleCommNumBytes(hypre_handle)                   ((hypre_handle) -> comm_num_bytes)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
@@ -1279,6 +1323,8 @@ HYPRE_Int hypre_HandleDestroy(hypre_Handle *hypre_handle_);
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
 HYPRE_Int hypre_SetDevice(HYPRE_Int use_device, hypre_Handle *hypre_handle_);
+HYPRE_Int HYPRE_SetSpMVUseSell( HYPRE_Int use_sell );
+HYPRE_Int HYPRE_SetStructBoxThreads( HYPRE_Int box_threads );
 
 /* hypre_qsort.c */
 void hypre_swap ( HYPRE_Int *v , HYPRE_Int i , HYPRE_Int j );
@@ -37,6 +37,10 @@ hypre_HandleCreate()
    hypre_Handle *hypre_handle_ = hypre_CTAlloc(hypre_Handle, 1, HYPRE_MEMORY_HOST);
 
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
+   hypre_HandleSpMVUseSell(hypre_handle_) = 0;
+   hypre_HandleStructBoxThreads(hypre_handle_) = -1;
+   hypre_HandleCommNumMessages(hypre_handle_) = 0.0;
+   hypre_HandleCommNumBytes(hypre_handle_) = 0.0;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle_) = HYPRE_EXEC_HOST;
@@ -215,3 +219,30 @@ HYPRE_Finalize()
    return hypre_error_flag;
 }
 
+
+/******************************************************************************
+ *
+ * hypre global options
+ *
+ *****************************************************************************/
+
+/* use_sell > 0: host CSR matvecs go through a lazily built SELL-C-sigma copy
+ * of the matrix (see seq_mv/csr_matvec_sell.c) */
+HYPRE_Int
+HYPRE_SetSpMVUseSell( HYPRE_Int use_sell )
+{
+   hypre_HandleSpMVUseSell(hypre_handle()) = use_sell;
+
+   return hypre_error_flag;
+}
+
+/* box_threads < 0: choose per grid from its box sizes (default), 0: thread
+ * inside each box, > 0: hand out whole boxes to the threads (see
+ * hypre_StructGridBoxThreads in struct_mv/struct_grid.c) */
+HYPRE_Int
+HYPRE_SetStructBoxThreads( HYPRE_Int box_threads )
+{
+   hypre_HandleStructBoxThreads(hypre_handle()) = box_threads;
+
+   return hypre_error_flag;
+}
@@ -27,6 +27,13 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   /* host SpMV options */
+   HYPRE_Int              spmv_use_sell;
+   /* host struct box loop threading (see HYPRE_SetStructBoxThreads) */
+   HYPRE_Int              struct_box_threads;
+   /* point-to-point traffic posted through ParCSR communication handles */
+   HYPRE_Real             comm_num_messages;
+   HYPRE_Real             comm_num_bytes;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_CudaData        *cuda_data;
 #endif
@@ -36,6 +43,10 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSell(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleStructBoxThreads(hypre_handle)               ((hypre_handle) -> struct_box_threads)
+#define hypre_HandleCommNumMessages(hypre_handle)                ((hypre_handle) -> comm_num_messages)
+#define hypre_HandleCommNumBytes(hypre_handle)                   ((hypre_handle) -> comm_num_bytes)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
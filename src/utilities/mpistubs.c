@@ -553,6 +553,19 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+   return 0;
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -646,6 +659,112 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return(0);
 }
 
+/* MPI-IO is mapped onto stdio; only whole files are supported */
+
+static size_t
+hypre_MPI_TypeSize( hypre_MPI_Datatype datatype )
+{
+   switch (datatype)
+   {
+      case hypre_MPI_FLOAT:       return sizeof(float);
+      case hypre_MPI_DOUBLE:      return sizeof(double);
+      case hypre_MPI_LONG_DOUBLE: return sizeof(long double);
+      case hypre_MPI_INT:         return sizeof(HYPRE_Int);
+      case hypre_MPI_LONG:        return sizeof(long);
+      case hypre_MPI_REAL:        return sizeof(HYPRE_Real);
+      case hypre_MPI_COMPLEX:     return sizeof(HYPRE_Complex);
+   }
+   return 1;
+}
+
+HYPRE_Int
+hypre_MPI_File_open( hypre_MPI_Comm    comm,
+                     const char       *filename,
+                     HYPRE_Int         amode,
+                     hypre_MPI_Info    info,
+                     hypre_MPI_File   *fh )
+{
+   FILE *file;
+
+   if (amode & hypre_MPI_MODE_RDONLY)
+   {
+      file = fopen(filename, "rb");
+   }
+   else
+   {
+      file = fopen(filename, "wb");
+   }
+   *fh = (hypre_MPI_File) file;
+
+   return (file == NULL);
+}
+
+HYPRE_Int
+hypre_MPI_File_close( hypre_MPI_File *fh )
+{
+   fclose((FILE *) *fh);
+   *fh = NULL;
+
+   return(0);
+}
+
+/* files opened for writing are already truncated by fopen */
+HYPRE_Int
+hypre_MPI_File_set_size( hypre_MPI_File    fh,
+                         hypre_MPI_Offset  size )
+{
+   return (size != 0);
+}
+
+HYPRE_Int
+hypre_MPI_File_read_at( hypre_MPI_File      fh,
+                        hypre_MPI_Offset    offset,
+                        void               *buf,
+                        HYPRE_Int           count,
+                        hypre_MPI_Datatype  datatype,
+                        hypre_MPI_Status   *status )
+{
+   size_t size = hypre_MPI_TypeSize(datatype);
+
+   if (fseek((FILE *) fh, offset, SEEK_SET) ||
+       fread(buf, size, (size_t) count, (FILE *) fh) != (size_t) count)
+   {
+      return(1);
+   }
+
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at( hypre_MPI_File      fh,
+                         hypre_MPI_Offset    offset,
+                         void               *buf,
+                         HYPRE_Int           count,
+                         hypre_MPI_Datatype  datatype,
+                         hypre_MPI_Status   *status )
+{
+   size_t size = hypre_MPI_TypeSize(datatype);
+
+   if (fseek((FILE *) fh, offset, SEEK_SET) ||
+       fwrite(buf, size, (size_t) count, (FILE *) fh) != (size_t) count)
+   {
+      return(1);
+   }
+
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at_all( hypre_MPI_File      fh,
+                             hypre_MPI_Offset    offset,
+                             void               *buf,
+                             HYPRE_Int           count,
+                             hypre_MPI_Datatype  datatype,
+                             hypre_MPI_Status   *status )
+{
+   return hypre_MPI_File_write_at(fh, offset, buf, count, datatype, status);
+}
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
@@ -663,6 +782,36 @@ HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info )
 }
 #endif
 
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm_old,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      HYPRE_Int       reorder,
+                                      hypre_MPI_Comm *comm_dist_graph )
+{
+   *comm_dist_graph = comm_old;
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+   return(0);
+}
+#endif
+
 /******************************************************************************
  * MPI stubs to do casting of HYPRE_Int and hypre_int correctly
  *****************************************************************************/
@@ -1181,6 +1330,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
                                     datatype, op, comm);
 }
 
+/* Falls back to a blocking reduction (with a null request) before MPI-3 */
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1303,6 +1472,66 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
+HYPRE_Int
+hypre_MPI_File_open( hypre_MPI_Comm    comm,
+                     const char       *filename,
+                     HYPRE_Int         amode,
+                     hypre_MPI_Info    info,
+                     hypre_MPI_File   *fh )
+{
+   return (HYPRE_Int) MPI_File_open(comm, (char *) filename, (hypre_int)amode,
+                                    info, fh);
+}
+
+HYPRE_Int
+hypre_MPI_File_close( hypre_MPI_File *fh )
+{
+   return (HYPRE_Int) MPI_File_close(fh);
+}
+
+HYPRE_Int
+hypre_MPI_File_set_size( hypre_MPI_File    fh,
+                         hypre_MPI_Offset  size )
+{
+   return (HYPRE_Int) MPI_File_set_size(fh, size);
+}
+
+HYPRE_Int
+hypre_MPI_File_read_at( hypre_MPI_File      fh,
+                        hypre_MPI_Offset    offset,
+                        void               *buf,
+                        HYPRE_Int           count,
+                        hypre_MPI_Datatype  datatype,
+                        hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_read_at(fh, offset, buf, (hypre_int)count,
+                                       datatype, status);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at( hypre_MPI_File      fh,
+                         hypre_MPI_Offset    offset,
+                         void               *buf,
+                         HYPRE_Int           count,
+                         hypre_MPI_Datatype  datatype,
+                         hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_write_at(fh, offset, buf, (hypre_int)count,
+                                        datatype, status);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at_all( hypre_MPI_File      fh,
+                             hypre_MPI_Offset    offset,
+                             void               *buf,
+                             HYPRE_Int           count,
+                             hypre_MPI_Datatype  datatype,
+                             hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_write_at_all(fh, offset, buf, (hypre_int)count,
+                                            datatype, status);
+}
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
@@ -1323,4 +1552,74 @@ hypre_MPI_Info_free( hypre_MPI_Info *info )
 }
 #endif
 
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+/* creates an unweighted graph; the neighbor lists are converted to hypre_int */
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm_old,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      HYPRE_Int       reorder,
+                                      hypre_MPI_Comm *comm_dist_graph )
+{
+   hypre_int *mpi_sources = NULL, *mpi_destinations = NULL;
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   /* a rank without neighbors passes explicit NULL lists */
+   if (indegree > 0)
+   {
+      mpi_sources = hypre_TAlloc(hypre_int, indegree, HYPRE_MEMORY_HOST);
+   }
+   if (outdegree > 0)
+   {
+      mpi_destinations = hypre_TAlloc(hypre_int, outdegree, HYPRE_MEMORY_HOST);
+   }
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_sources[i] = (hypre_int) sources[i];
+   }
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_destinations[i] = (hypre_int) destinations[i];
+   }
+   /* GCC takes the MPI_UNWEIGHTED sentinel for an empty weights array */
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overread"
+#endif
+   ierr = (HYPRE_Int) MPI_Dist_graph_create_adjacent(comm_old,
+                                                     (hypre_int)indegree, mpi_sources, MPI_UNWEIGHTED,
+                                                     (hypre_int)outdegree, mpi_destinations, MPI_UNWEIGHTED,
+                                                     MPI_INFO_NULL, (hypre_int)reorder, comm_dist_graph);
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic pop
+#endif
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+
+/* counts and displacements are passed as hypre_int since they must stay
+ * valid until the request completes */
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+   return (HYPRE_Int) MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                              recvbuf, recvcounts, rdispls, recvtype,
+                                              comm, request);
+}
+#endif
+
 #endif